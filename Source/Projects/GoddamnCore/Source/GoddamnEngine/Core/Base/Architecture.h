@@ -627,9 +627,9 @@
 #if (!defined(__has_builtin))
 #	define __has_builtin(builtin) 0	// Compatibility with Clang...
 #endif	// if (!defined(__has_builtin))
-#if (!defined(__builtin_expect))
-#	define __builtin_expect(expression, expected) (!!(expression) == expected)
-#endif	// if (!defined(__builtin_expect))
+#if !GD_COMPILER_GCC_COMPATIBLE	// '__builtin_expect' is a builtin, not a macro, so it cannot be checked with 'defined'.
+#	define __builtin_expect(expression, expected) (expression)
+#endif	// if !GD_COMPILER_GCC_COMPATIBLE
 #if !GD_COMPILER_MSVC_COMPATIBLE
 #	define __analysis_assume(...)
 #endif	// if !GD_COMPILER_MSVC_COMPATIBLE
@@ -747,6 +747,12 @@
 	GD_COMPILER_GCC_COMPATIBLE_CODE(__attribute__((always_inline)) inline) \
 	GD_COMPILER_MSVC_COMPATIBLE_CODE(__forceinline))
 
+// ------------------------------------------------------------------------------------------
+//! Defines a method that is never inlined into code.
+#define GD_NOINLINE \
+	GD_COMPILER_GCC_COMPATIBLE_CODE(__attribute__((noinline))) \
+	GD_COMPILER_MSVC_COMPATIBLE_CODE(__declspec(noinline)) 
+
 // ------------------------------------------------------------------------------------------
 //! Defines a method that would terminate the application.
 #define GD_NORETURN \
@@ -0,0 +1,181 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/CStdlib/CFormat.h
+ * Number to string conversions.
+ */
+#pragma once
+
+#include <GoddamnEngine/Include.h>
+
+GD_NAMESPACE_BEGIN
+
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+	// ******                                  CFormat class.                                  ******
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+
+	// **------------------------------------------------------------------------------------------**
+	//! Number to string conversions, that do not use the C library formatting.
+	//! Integers are written two digits per division. Floating point numbers are written with the
+	//! shortest sequence of digits, that is parsed back to the same number (Ryu algorithm).
+	//! Functions write into the caller-provided buffers and do not null-terminate the results.
+	// **------------------------------------------------------------------------------------------**
+	class CFormat final : public TNonCreatable
+	{
+	public:
+
+		/*!
+		 * Maximum length of the formatted integer, e.g. "-9223372036854775808".
+		 */
+		SizeTp static const MaxIntegerLength = 20;
+
+		/*!
+		 * Maximum length of the shortest formatted floating point number, e.g. "-2.2250738585072014e-308".
+		 */
+		SizeTp static const MaxFloatLength = 24;
+
+		/*!
+		 * Maximum number of the digits of the fixed representation of the double precision number, e.g. 309 
+		 * integral digits of the largest number or 767 significant fractional digits of the smallest one.
+		 */
+		SizeTp static const MaxFixedDigitsLength = 800;
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Integers.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Returns number of decimal digits of the specified value.
+		 * @param value The value.
+		 */
+		GDAPI static SizeTp GetDecimalLength(UInt64 const value);
+
+		/*!
+		 * Writes decimal representation of the specified integer.
+		 *
+		 * @param dst Destination buffer of at least 'MaxIntegerLength' characters.
+		 * @param value The value to write.
+		 *
+		 * @returns Number of the written characters.
+		 */
+		//! @{
+		GDAPI static SizeTp FormatUInt64(Char* const dst, UInt64 const value);
+		GDAPI static SizeTp FormatInt64(Char* const dst, Int64 const value);
+		GDINL static SizeTp FormatUInt64(WideChar* const dst, UInt64 const value)
+		{
+			Char buffer[MaxIntegerLength];
+			return Widen(dst, buffer, FormatUInt64(buffer, value));
+		}
+		GDINL static SizeTp FormatInt64(WideChar* const dst, Int64 const value)
+		{
+			Char buffer[MaxIntegerLength];
+			return Widen(dst, buffer, FormatInt64(buffer, value));
+		}
+		//! @}
+
+		/*!
+		 * Writes hexadecimal representation of the specified integer, without the prefix.
+		 *
+		 * @param dst Destination buffer of at least 'MaxIntegerLength' characters.
+		 * @param value The value to write.
+		 * @param upperCase Whether upper case letters should be used.
+		 *
+		 * @returns Number of the written characters.
+		 */
+		//! @{
+		GDAPI static SizeTp FormatUInt64Hex(Char* const dst, UInt64 const value, bool const upperCase = false);
+		GDINL static SizeTp FormatUInt64Hex(WideChar* const dst, UInt64 const value, bool const upperCase = false)
+		{
+			Char buffer[MaxIntegerLength];
+			return Widen(dst, buffer, FormatUInt64Hex(buffer, value, upperCase));
+		}
+		//! @}
+
+		// ------------------------------------------------------------------------------------------
+		// Floating point numbers.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Computes the shortest decimal representation of the finite floating point number, which is 
+		 * parsed back to the same number. If there are several shortest representations, the closest one
+		 * to the exact value is selected.
+		 *
+		 * @param value The finite value. Sign of the value is ignored.
+		 * @param mantissa Decimal digits of the value, without trailing zeros. Zero for zero values.
+		 * @param exponent Decimal exponent of the value, so that value is mantissa * 10^exponent.
+		 */
+		//! @{
+		GDAPI static void GetShortestDecimal(Float64 const value, UInt64& mantissa, Int32& exponent);
+		GDAPI static void GetShortestDecimal(Float32 const value, UInt64& mantissa, Int32& exponent);
+		//! @}
+
+		/*!
+		 * Computes the decimal representation of the finite floating point number with the fixed number of
+		 * the fractional digits. Digits are produced from the exact binary value and rounded half to even,
+		 * like the "%.*f" conversion of the C library does.
+		 *
+		 * @param digits Destination buffer of at least 'MaxFixedDigitsLength' characters for the digits 
+		 *               without the leading zeros. Zero values are written as the single zero.
+		 * @param value The finite value. Sign of the value is ignored.
+		 * @param precision Number of the fractional digits.
+		 * @param exponent Decimal exponent of the value, so that the rounded value is digits * 10^exponent.
+		 *                 It is never less than -precision.
+		 *
+		 * @returns Number of the written digits.
+		 */
+		//! @{
+		GDAPI static SizeTp GetFixedDecimal(Char* const digits, Float64 const value, SizeTp const precision, Int32& exponent);
+		GDINL static SizeTp GetFixedDecimal(WideChar* const digits, Float64 const value, SizeTp const precision, Int32& exponent)
+		{
+			Char buffer[MaxFixedDigitsLength];
+			return Widen(digits, buffer, GetFixedDecimal(buffer, value, precision, exponent));
+		}
+		//! @}
+
+		/*!
+		 * Writes the shortest representation of the floating point number, that is parsed back to 
+		 * the same number. Numbers with the decimal exponent in range [-4, 16) are written in the fixed 
+		 * notation with at least one fractional digit, e.g. "0.001" or "100.0", other numbers are 
+		 * written in the scientific notation, e.g. "1e+16" or "2.5e-05". Infinities and not-a-numbers 
+		 * are written as "inf", "-inf" and "nan".
+		 *
+		 * @param dst Destination buffer of at least 'MaxFloatLength' characters.
+		 * @param value The value to write.
+		 *
+		 * @returns Number of the written characters.
+		 */
+		//! @{
+		GDAPI static SizeTp FormatFloat64(Char* const dst, Float64 const value);
+		GDAPI static SizeTp FormatFloat32(Char* const dst, Float32 const value);
+		GDINL static SizeTp FormatFloat64(WideChar* const dst, Float64 const value)
+		{
+			Char buffer[MaxFloatLength];
+			return Widen(dst, buffer, FormatFloat64(buffer, value));
+		}
+		GDINL static SizeTp FormatFloat32(WideChar* const dst, Float32 const value)
+		{
+			Char buffer[MaxFloatLength];
+			return Widen(dst, buffer, FormatFloat32(buffer, value));
+		}
+		//! @}
+
+	private:
+		GDINL static SizeTp Widen(WideChar* const dst, Char const* const src, SizeTp const srcLength)
+		{
+			for (SizeTp cnt = 0; cnt < srcLength; ++cnt)
+			{
+				dst[cnt] = static_cast<WideChar>(src[cnt]);
+			}
+			return srcLength;
+		}
+	};	// class CFormat
+
+GD_NAMESPACE_END
@@ -0,0 +1,173 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/CStdlib/CFormat_UnitTests.cpp
+ * Number to string conversions tests.
+ */
+#include <GoddamnEngine/Core/CStdlib/CFormat.h>
+#include <GoddamnEngine/Core/CStdlib/CMemory.h>
+#include <GoddamnEngine/Core/CStdlib/CString.h>
+#if GD_TESTING_ENABLED
+
+#include <cstdio>
+#include <cstdlib>
+
+GD_NAMESPACE_BEGIN
+
+	// Compares the formatted characters with the expected null-terminated text.
+	GDINL static bool CFormatTestEquals(Char const* const formatted, SizeTp const formattedLength, Char const* const expected)
+	{
+		return formattedLength == CString::Strlen(expected) && CMemory::Memcmp(formatted, expected, formattedLength) == 0;
+	}
+
+	gd_testing_unit_test(CFormatIntegers)
+	{
+		Char buffer[CFormat::MaxIntegerLength];
+		gd_testing_verify(CFormatTestEquals(buffer, CFormat::FormatUInt64(buffer, 0), "0"));
+		gd_testing_verify(CFormatTestEquals(buffer, CFormat::FormatUInt64(buffer, 7), "7"));
+		gd_testing_verify(CFormatTestEquals(buffer, CFormat::FormatUInt64(buffer, 10), "10"));
+		gd_testing_verify(CFormatTestEquals(buffer, CFormat::FormatUInt64(buffer, 12345), "12345"));
+		gd_testing_verify(CFormatTestEquals(buffer, CFormat::FormatUInt64(buffer, UInt64Max), "18446744073709551615"));
+		gd_testing_verify(CFormatTestEquals(buffer, CFormat::FormatInt64(buffer, -1), "-1"));
+		gd_testing_verify(CFormatTestEquals(buffer, CFormat::FormatInt64(buffer, Int64Min), "-9223372036854775808"));
+		gd_testing_verify(CFormatTestEquals(buffer, CFormat::FormatInt64(buffer, Int64Max), "9223372036854775807"));
+		gd_testing_verify(CFormatTestEquals(buffer, CFormat::FormatUInt64Hex(buffer, 0), "0"));
+		gd_testing_verify(CFormatTestEquals(buffer, CFormat::FormatUInt64Hex(buffer, 0xBEEF), "beef"));
+		gd_testing_verify(CFormatTestEquals(buffer, CFormat::FormatUInt64Hex(buffer, UInt64Max, true), "FFFFFFFFFFFFFFFF"));
+
+		// Lengths of all powers of ten and their neighbours.
+		UInt64 power = 1;
+		for (SizeTp length = 1; length < CFormat::MaxIntegerLength; ++length, power *= 10)
+		{
+			gd_testing_verify(CFormat::GetDecimalLength(power) == length);
+			gd_testing_verify(CFormat::GetDecimalLength(power * 10 - 1) == length);
+			gd_testing_verify(CFormat::FormatUInt64(buffer, power) == length);
+		}
+
+		WideChar wideBuffer[CFormat::MaxIntegerLength];
+		gd_testing_verify(CFormat::FormatInt64(wideBuffer, -42) == 3 && wideBuffer[0] == L'-' && wideBuffer[1] == L'4' && wideBuffer[2] == L'2');
+	};
+
+	gd_testing_unit_test(CFormatFloats)
+	{
+		Char buffer[CFormat::MaxFloatLength];
+		gd_testing_verify(CFormatTestEquals(buffer, CFormat::FormatFloat64(buffer, 0.0), "0.0"));
+		gd_testing_verify(CFormatTestEquals(buffer, CFormat::FormatFloat64(buffer, -0.0), "-0.0"));
+		gd_testing_verify(CFormatTestEquals(buffer, CFormat::FormatFloat64(buffer, 1.0), "1.0"));
+		gd_testing_verify(CFormatTestEquals(buffer, CFormat::FormatFloat64(buffer, 0.1), "0.1"));
+		gd_testing_verify(CFormatTestEquals(buffer, CFormat::FormatFloat64(buffer, 0.1 + 0.2), "0.30000000000000004"));
+		gd_testing_verify(CFormatTestEquals(buffer, CFormat::FormatFloat64(buffer, -12.5), "-12.5"));
+		gd_testing_verify(CFormatTestEquals(buffer, CFormat::FormatFloat64(buffer, 12500.0), "12500.0"));
+		gd_testing_verify(CFormatTestEquals(buffer, CFormat::FormatFloat64(buffer, 0.0001), "0.0001"));
+		gd_testing_verify(CFormatTestEquals(buffer, CFormat::FormatFloat64(buffer, 0.00001), "1e-05"));
+		gd_testing_verify(CFormatTestEquals(buffer, CFormat::FormatFloat64(buffer, 1e15), "1000000000000000.0"));
+		gd_testing_verify(CFormatTestEquals(buffer, CFormat::FormatFloat64(buffer, 1e16), "1e+16"));
+		gd_testing_verify(CFormatTestEquals(buffer, CFormat::FormatFloat64(buffer, 1.25e100), "1.25e+100"));
+		gd_testing_verify(CFormatTestEquals(buffer, CFormat::FormatFloat64(buffer, 5e-324), "5e-324"));
+		gd_testing_verify(CFormatTestEquals(buffer, CFormat::FormatFloat64(buffer, -2.2250738585072014e-308), "-2.2250738585072014e-308"));
+		gd_testing_verify(CFormatTestEquals(buffer, CFormat::FormatFloat64(buffer, 1.7976931348623157e308), "1.7976931348623157e+308"));
+		gd_testing_verify(CFormatTestEquals(buffer, CFormat::FormatFloat32(buffer, 0.1f), "0.1"));
+		gd_testing_verify(CFormatTestEquals(buffer, CFormat::FormatFloat32(buffer, 16777216.0f), "16777216.0"));
+		gd_testing_verify(CFormatTestEquals(buffer, CFormat::FormatFloat32(buffer, 3.4028235e38f), "3.4028235e+38"));
+		gd_testing_verify(CFormatTestEquals(buffer, CFormat::FormatFloat32(buffer, 1e-45f), "1e-45"));
+
+		// Special values.
+		auto const infinity = 1e308 * 10.0;
+		gd_testing_verify(CFormatTestEquals(buffer, CFormat::FormatFloat64(buffer, infinity), "inf"));
+		gd_testing_verify(CFormatTestEquals(buffer, CFormat::FormatFloat64(buffer, -infinity), "-inf"));
+		gd_testing_verify(CFormatTestEquals(buffer, CFormat::FormatFloat64(buffer, infinity - infinity), "nan"));
+		gd_testing_verify(CFormatTestEquals(buffer, CFormat::FormatFloat32(buffer, static_cast<Float32>(-infinity)), "-inf"));
+	};
+
+	gd_testing_unit_test(CFormatFloatsRoundTrip)
+	{
+		Char buffer[CFormat::MaxFloatLength + 1];
+		UInt64 random = 1;
+		for (SizeTp cnt = 0; cnt < 100000; ++cnt)
+		{
+			random = random * 6364136223846793005u + 1442695040888963407u;
+
+			// Random bit patterns cover all exponents, including the subnormal ones.
+			Float64 value64;
+			CMemory::Memcpy(&value64, &random, sizeof value64);
+			auto const length64 = CFormat::FormatFloat64(buffer, value64);
+			gd_testing_verify(length64 <= CFormat::MaxFloatLength);
+			if (value64 == value64 && value64 - value64 == 0.0)
+			{
+				buffer[length64] = '\0';
+				gd_testing_verify(::strtod(buffer, nullptr) == value64);
+			}
+
+			Float32 value32;
+			auto const bits32 = static_cast<UInt32>(random >> 32);
+			CMemory::Memcpy(&value32, &bits32, sizeof value32);
+			auto const length32 = CFormat::FormatFloat32(buffer, value32);
+			gd_testing_verify(length32 <= CFormat::MaxFloatLength);
+			if (value32 == value32 && value32 - value32 == 0.0f)
+			{
+				buffer[length32] = '\0';
+				gd_testing_verify(::strtof(buffer, nullptr) == value32);
+			}
+		}
+	};
+
+	gd_testing_unit_test(CFormatFixed)
+	{
+		Char digits[CFormat::MaxFixedDigitsLength];
+		Int32 exponent;
+		gd_testing_verify(CFormatTestEquals(digits, CFormat::GetFixedDecimal(digits, 0.0, 2, exponent), "0") && exponent == 0);
+		gd_testing_verify(CFormatTestEquals(digits, CFormat::GetFixedDecimal(digits, 2.675, 2, exponent), "267") && exponent == -2);
+		gd_testing_verify(CFormatTestEquals(digits, CFormat::GetFixedDecimal(digits, 0.125, 2, exponent), "12") && exponent == -2);
+		gd_testing_verify(CFormatTestEquals(digits, CFormat::GetFixedDecimal(digits, 0.999, 2, exponent), "100") && exponent == -2);
+		gd_testing_verify(CFormatTestEquals(digits, CFormat::GetFixedDecimal(digits, 0.004, 2, exponent), "0") && exponent == 0);
+		gd_testing_verify(CFormatTestEquals(digits, CFormat::GetFixedDecimal(digits, 0.5, 5, exponent), "5") && exponent == -1);
+		gd_testing_verify(CFormatTestEquals(digits, CFormat::GetFixedDecimal(digits, 1e22, 2, exponent), "10000000000000000000000") && exponent == 0);
+
+		// Digits are compared with the C library ones, without the point and the leading zeros.
+		Char expected[2048];
+		UInt64 random = 1;
+		for (SizeTp cnt = 0; cnt < 20000; ++cnt)
+		{
+			random = random * 6364136223846793005u + 1442695040888963407u;
+			Float64 value;
+			CMemory::Memcpy(&value, &random, sizeof value);
+			if (value != value || value - value != 0.0)
+			{
+				continue;
+			}
+
+			auto const precision = static_cast<SizeTp>(cnt % 100 == 0 ? random % 1100 : random % 20);
+			auto const expectedLength = ::snprintf(expected, sizeof expected, "%.*f", static_cast<int>(precision), value < 0.0 ? -value : value);
+			gd_testing_verify(expectedLength > 0 && static_cast<SizeTp>(expectedLength) < sizeof expected);
+			auto const length = CFormat::GetFixedDecimal(digits, value, precision, exponent);
+			gd_testing_verify(length <= CFormat::MaxFixedDigitsLength && exponent >= -static_cast<Int32>(precision));
+
+			SizeTp expectedDigitsLength = 0;
+			for (auto expectedCharacter = expected; *expectedCharacter != '\0'; ++expectedCharacter)
+			{
+				if (*expectedCharacter != '.' && (*expectedCharacter != '0' || expectedDigitsLength != 0))
+				{
+					expected[expectedDigitsLength++] = *expectedCharacter;
+				}
+			}
+			if (digits[0] == '0')
+			{
+				gd_testing_verify(length == 1 && exponent == 0 && expectedDigitsLength == 0);
+			}
+			else
+			{
+				auto const trailingZerosLength = static_cast<SizeTp>(exponent + static_cast<Int32>(precision));
+				gd_testing_verify(expectedDigitsLength == length + trailingZerosLength && CMemory::Memcmp(digits, expected, length) == 0);
+			}
+		}
+	};
+
+GD_NAMESPACE_END
+
+#endif	// if GD_TESTING_ENABLED
@@ -18,6 +18,9 @@
 
 #include <cstring>
 #include <cwchar>
+#if GD_COMPILER_MSVC_COMPATIBLE && (GD_ARCHITECTURE_X86 || GD_ARCHITECTURE_X64)
+#	include <xmmintrin.h>
+#endif	// if GD_COMPILER_MSVC_COMPATIBLE && (GD_ARCHITECTURE_X86 || GD_ARCHITECTURE_X64)
 
 GD_NAMESPACE_BEGIN
 
@@ -84,7 +87,7 @@ GD_NAMESPACE_BEGIN
 		 * @see @c "std::memmove" function.
 		 */
 		//! @{
-		GDINL static Handle Memmove(Char* const dest, CHandle const source, SizeTp const sourceLength)
+		GDINL static Handle Memmove(Handle const dest, CHandle const source, SizeTp const sourceLength)
 		{
 			return ::memmove(dest, source, sourceLength);
 		}
@@ -98,6 +101,27 @@ GD_NAMESPACE_BEGIN
 		}
 		//! @}
 
+		// ------------------------------------------------------------------------------------------
+		// Cache control functions.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Hints the processor to load the cache line, containing specified address, into all cache levels.
+		 * Does nothing if such hints are not supported.
+		 *
+		 * @param address Address to prefetch. May be invalid.
+		 */
+		GDINL static void Prefetch(CHandle const address)
+		{
+#if GD_COMPILER_GCC_COMPATIBLE
+			__builtin_prefetch(address);
+#elif GD_COMPILER_MSVC_COMPATIBLE && (GD_ARCHITECTURE_X86 || GD_ARCHITECTURE_X64)
+			_mm_prefetch(static_cast<char const*>(address), _MM_HINT_T0);
+#else	// *** Prefetching. ***
+			GD_NOT_USED(address);
+#endif	// *** Prefetching. ***
+		}
+
 	};	// class CMemoryGeneric
 
 	enum
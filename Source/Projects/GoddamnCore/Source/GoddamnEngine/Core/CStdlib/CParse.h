@@ -0,0 +1,101 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/CStdlib/CParse.h
+ * String to number conversions.
+ */
+#pragma once
+
+#include <GoddamnEngine/Include.h>
+
+GD_NAMESPACE_BEGIN
+
+	// **------------------------------------------------------------------------------------------**
+	//! Result of the number parsing.
+	// **------------------------------------------------------------------------------------------**
+	struct CParseResult final
+	{
+	public:
+		SizeTp Length;		//!< Number of the consumed characters, zero if the text does not start with a number.
+		bool   OutOfRange;	//!< Whether the number does not fit the result, which is clamped (or rounded to infinity or zero).
+
+	public:
+
+		/*!
+		 * Returns true if a number was parsed and it fits the result.
+		 */
+		GDINL bool Succeeded() const
+		{
+			return Length != 0 && !OutOfRange;
+		}
+	};	// struct CParseResult
+
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+	// ******                                  CParse class.                                   ******
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+
+	// **------------------------------------------------------------------------------------------**
+	//! String to number conversions, that do not depend on the C library locale.
+	//! Decimal digits are converted eight per iteration. Floating point numbers are rounded exactly
+	//! with the 128-bit approximations of the powers of five (Eisel-Lemire algorithm), only the
+	//! ambiguous numbers with more than 19 significant digits fall back to the exact slow path.
+	//! The texts are not required to be null-terminated, the leading spaces are not skipped.
+	// **------------------------------------------------------------------------------------------**
+	class CParse final : public TNonCreatable
+	{
+	public:
+
+		/*!
+		 * Parses an unsigned integer.
+		 *
+		 * @param text Text to parse.
+		 * @param textLength Length of the text.
+		 * @param value Parsed value. Out of range values are clamped.
+		 * @param base Base of the number in range [2, 36], or zero to detect the base from the "0x" and "0" prefixes.
+		 *             The "0x" prefix is also accepted for the base 16.
+		 *
+		 * @returns Number of the consumed characters and whether the value is out of range.
+		 */
+		//! @{
+		GDAPI static CParseResult ParseUInt64(Char const* const text, SizeTp const textLength, UInt64& value, UInt32 const base = 10);
+		GDAPI static CParseResult ParseUInt64(WideChar const* const text, SizeTp const textLength, UInt64& value, UInt32 const base = 10);
+		//! @}
+
+		/*!
+		 * Parses an optionally signed integer.
+		 *
+		 * @param text Text to parse.
+		 * @param textLength Length of the text.
+		 * @param value Parsed value. Out of range values are clamped.
+		 * @param base Base of the number in range [2, 36], or zero to detect the base from the "0x" and "0" prefixes.
+		 *
+		 * @returns Number of the consumed characters and whether the value is out of range.
+		 */
+		//! @{
+		GDAPI static CParseResult ParseInt64(Char const* const text, SizeTp const textLength, Int64& value, UInt32 const base = 10);
+		GDAPI static CParseResult ParseInt64(WideChar const* const text, SizeTp const textLength, Int64& value, UInt32 const base = 10);
+		//! @}
+
+		/*!
+		 * Parses an optionally signed decimal floating point number, e.g. "-12.5e-3", "inf" or "nan".
+		 * The result is the nearest double precision number, halfway cases are rounded to even.
+		 *
+		 * @param text Text to parse.
+		 * @param textLength Length of the text.
+		 * @param value Parsed value.
+		 *
+		 * @returns Number of the consumed characters and whether the value was rounded to infinity or zero.
+		 */
+		//! @{
+		GDAPI static CParseResult ParseFloat64(Char const* const text, SizeTp const textLength, Float64& value);
+		GDAPI static CParseResult ParseFloat64(WideChar const* const text, SizeTp const textLength, Float64& value);
+		//! @}
+	};	// class CParse
+
+GD_NAMESPACE_END
@@ -0,0 +1,113 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/CStdlib/CParse_Benchmarks.cpp
+ * String to number conversions benchmarks against the C library.
+ */
+#include <GoddamnEngine/Core/CStdlib/CParse.h>
+#include <GoddamnEngine/Core/CStdlib/CFormat.h>
+#include <GoddamnEngine/Core/CStdlib/CString.h>
+#include <GoddamnEngine/Core/Containers/Vector.h>
+
+#include <cstdlib>
+
+GD_NAMESPACE_BEGIN
+
+#if GD_TESTING_ENABLED
+
+	SizeTp static const CParseBenchmarkCount = 100000;
+
+	// Keeps results of the benchmarks, so that computations are not optimized away.
+	static Float64 volatile g_CParseBenchmarkSink;
+
+	// Generates null-terminated text of comma-separated numbers, like in the vertex arrays.
+	GDINL static Vector<Char> GenerateCParseBenchmarkText(bool const floats)
+	{
+		Vector<Char> text;
+		Char buffer[CFormat::MaxFloatLength];
+		UInt64 random = 1;
+		for (SizeTp cnt = 0; cnt < CParseBenchmarkCount; ++cnt)
+		{
+			random = random * 6364136223846793005u + 1442695040888963407u;
+			auto const length = floats 
+				? CFormat::FormatFloat64(buffer, static_cast<Float64>(static_cast<Int64>(random >> 11) - (Int64(1) << 52)) / 1e15) 
+				: CFormat::FormatInt64(buffer, static_cast<Int64>(random) >> (random % 64));
+			for (SizeTp index = 0; index < length; ++index)
+			{
+				text.InsertLast(buffer[index]);
+			}
+			text.InsertLast(',');
+		}
+		text.InsertLast('\0');
+		return text;
+	}
+
+	// Measures a case, that parses all numbers of the text.
+	template<typename TFunc>
+	GDINL static void MeasureCParse(goddamn_testing::benchmark_state& state, char const* const caseName, Vector<Char> const& text, TFunc const& caseFunction)
+	{
+		state.measure(caseName, CParseBenchmarkCount, [&]
+		{
+			Float64 sum = 0.0;
+			auto const textEnd = text.GetData() + text.GetLength() - 1;
+			for (auto number = text.GetData(); number < textEnd; )
+			{
+				Char const* numberEnd;
+				sum += caseFunction(number, textEnd, numberEnd);
+				number = numberEnd + 1;
+			}
+			g_CParseBenchmarkSink = g_CParseBenchmarkSink + sum;
+		});
+	}
+
+	gd_testing_benchmark(CParseIntegers, state)
+	{
+		auto const text = GenerateCParseBenchmarkText(false);
+		MeasureCParse(state, "strtoll", text, [](Char const* const number, Char const* const textEnd, Char const*& numberEnd)
+		{
+			GD_NOT_USED(textEnd);
+			return static_cast<Float64>(::strtoll(number, const_cast<Char**>(&numberEnd), 10));
+		});
+		MeasureCParse(state, "CString::Strtoi64", text, [](Char const* const number, Char const* const textEnd, Char const*& numberEnd)
+		{
+			GD_NOT_USED(textEnd);
+			return static_cast<Float64>(CString::Strtoi64(number, &numberEnd, 10));
+		});
+		MeasureCParse(state, "CParse::ParseInt64", text, [](Char const* const number, Char const* const textEnd, Char const*& numberEnd)
+		{
+			Int64 value;
+			numberEnd = number + CParse::ParseInt64(number, textEnd - number, value).Length;
+			return static_cast<Float64>(value);
+		});
+	};
+
+	gd_testing_benchmark(CParseFloats, state)
+	{
+		auto const text = GenerateCParseBenchmarkText(true);
+		MeasureCParse(state, "strtod", text, [](Char const* const number, Char const* const textEnd, Char const*& numberEnd)
+		{
+			GD_NOT_USED(textEnd);
+			return ::strtod(number, const_cast<Char**>(&numberEnd));
+		});
+		MeasureCParse(state, "CString::Strtof64", text, [](Char const* const number, Char const* const textEnd, Char const*& numberEnd)
+		{
+			GD_NOT_USED(textEnd);
+			return CString::Strtof64(number, &numberEnd);
+		});
+		MeasureCParse(state, "CParse::ParseFloat64", text, [](Char const* const number, Char const* const textEnd, Char const*& numberEnd)
+		{
+			Float64 value;
+			numberEnd = number + CParse::ParseFloat64(number, textEnd - number, value).Length;
+			return value;
+		});
+	};
+
+#endif	// if GD_TESTING_ENABLED
+
+GD_NAMESPACE_END
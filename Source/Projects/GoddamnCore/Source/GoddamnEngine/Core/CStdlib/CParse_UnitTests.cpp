@@ -0,0 +1,207 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/CStdlib/CParse_UnitTests.cpp
+ * String to number conversions tests.
+ */
+#include <GoddamnEngine/Core/CStdlib/CParse.h>
+#include <GoddamnEngine/Core/CStdlib/CFormat.h>
+#include <GoddamnEngine/Core/CStdlib/CMemory.h>
+#include <GoddamnEngine/Core/CStdlib/CString.h>
+#if GD_TESTING_ENABLED
+
+#include <cstdlib>
+
+GD_NAMESPACE_BEGIN
+
+	// Dispatches to the unsigned or the signed parser.
+	GDINL static CParseResult CParseTestParseImpl(Char const* const text, SizeTp const textLength, UInt64& value, UInt32 const base)
+	{
+		return CParse::ParseUInt64(text, textLength, value, base);
+	}
+	GDINL static CParseResult CParseTestParseImpl(Char const* const text, SizeTp const textLength, Int64& value, UInt32 const base)
+	{
+		return CParse::ParseInt64(text, textLength, value, base);
+	}
+
+	// Parses the null-terminated text and checks the consumed length and the range.
+	template<typename TValue>
+	GDINL static bool CParseTestParse(Char const* const text, TValue const expected, SizeTp const expectedLength, bool const expectedOutOfRange = false, UInt32 const base = 10)
+	{
+		TValue value;
+		auto const result = CParseTestParseImpl(text, CString::Strlen(text), value, base);
+		return value == expected && result.Length == expectedLength && result.OutOfRange == expectedOutOfRange;
+	}
+
+	// Parses the null-terminated text as a floating point number and compares the bits of the result.
+	GDINL static bool CParseTestParseFloat(Char const* const text, Float64 const expected, SizeTp const expectedLength, bool const expectedOutOfRange = false)
+	{
+		Float64 value;
+		auto const result = CParse::ParseFloat64(text, CString::Strlen(text), value);
+		return CMemory::Memcmp(&value, &expected, sizeof value) == 0 && result.Length == expectedLength && result.OutOfRange == expectedOutOfRange;
+	}
+
+	gd_testing_unit_test(CParseIntegers)
+	{
+		gd_testing_verify(CParseTestParse<UInt64>("0", 0, 1));
+		gd_testing_verify(CParseTestParse<UInt64>("12345", 12345, 5));
+		gd_testing_verify(CParseTestParse<UInt64>("0012345678901234567890", 12345678901234567890u, 22));
+		gd_testing_verify(CParseTestParse<UInt64>("18446744073709551615", UInt64Max, 20));
+		gd_testing_verify(CParseTestParse<UInt64>("18446744073709551616", UInt64Max, 20, true));
+		gd_testing_verify(CParseTestParse<UInt64>("123456789012345678901234", UInt64Max, 24, true));
+		gd_testing_verify(CParseTestParse<UInt64>("42abc", 42, 2));
+		gd_testing_verify(CParseTestParse<UInt64>("", 0, 0));
+		gd_testing_verify(CParseTestParse<UInt64>("-1", 0, 0));
+		gd_testing_verify(CParseTestParse<UInt64>("x1", 0, 0));
+
+		// Bases and prefixes.
+		gd_testing_verify(CParseTestParse<UInt64>("ffFF", 0xFFFF, 4, false, 16));
+		gd_testing_verify(CParseTestParse<UInt64>("0x1F", 0x1F, 4, false, 16));
+		gd_testing_verify(CParseTestParse<UInt64>("0x1F", 0x1F, 4, false, 0));
+		gd_testing_verify(CParseTestParse<UInt64>("0xg", 0, 1, false, 0));
+		gd_testing_verify(CParseTestParse<UInt64>("0x1F", 0, 1, false, 10));
+		gd_testing_verify(CParseTestParse<UInt64>("0178", 15, 3, false, 0));
+		gd_testing_verify(CParseTestParse<UInt64>("1012", 5, 3, false, 2));
+		gd_testing_verify(CParseTestParse<UInt64>("Zz", 35 * 36 + 35, 2, false, 36));
+		gd_testing_verify(CParseTestParse<UInt64>("FFFFFFFFFFFFFFFF", UInt64Max, 16, false, 16));
+		gd_testing_verify(CParseTestParse<UInt64>("10000000000000000", UInt64Max, 17, true, 16));
+
+		// Signs.
+		gd_testing_verify(CParseTestParse<Int64>("-1234", -1234, 5));
+		gd_testing_verify(CParseTestParse<Int64>("+1234", 1234, 5));
+		gd_testing_verify(CParseTestParse<Int64>("-0x10", -16, 5, false, 0));
+		gd_testing_verify(CParseTestParse<Int64>("9223372036854775807", Int64Max, 19));
+		gd_testing_verify(CParseTestParse<Int64>("9223372036854775808", Int64Max, 19, true));
+		gd_testing_verify(CParseTestParse<Int64>("-9223372036854775808", Int64Min, 20));
+		gd_testing_verify(CParseTestParse<Int64>("-9223372036854775809", Int64Min, 20, true));
+		gd_testing_verify(CParseTestParse<Int64>("-", 0, 0));
+		gd_testing_verify(CParseTestParse<Int64>("+-1", 0, 0));
+
+		// Texts are not required to be null-terminated, digits after the length are ignored.
+		Char buffer[CFormat::MaxIntegerLength + 8];
+		UInt64 random = 1;
+		for (SizeTp cnt = 0; cnt < 10000; ++cnt)
+		{
+			random = random * 6364136223846793005u + 1442695040888963407u;
+			auto const expected = random >> (random % 64);
+			auto const length = CFormat::FormatUInt64(buffer, expected);
+			CMemory::Memset(buffer + length, '7', sizeof buffer - length);
+
+			UInt64 value;
+			auto const result = CParse::ParseUInt64(buffer, length, value);
+			gd_testing_verify(value == expected && result.Length == length && result.Succeeded());
+		}
+
+		WideChar const wideText[] = { L'-', L'4', L'2', L'0', L'x' };
+		Int64 wideValue;
+		gd_testing_verify(CParse::ParseInt64(wideText, GD::GetLength(wideText), wideValue).Length == 4 && wideValue == -420);
+	};
+
+	gd_testing_unit_test(CParseFloats)
+	{
+		gd_testing_verify(CParseTestParseFloat("0", 0.0, 1));
+		gd_testing_verify(CParseTestParseFloat("-0.0", -0.0, 4));
+		gd_testing_verify(CParseTestParseFloat("1.5", 1.5, 3));
+		gd_testing_verify(CParseTestParseFloat("+.5", 0.5, 3));
+		gd_testing_verify(CParseTestParseFloat("5.", 5.0, 2));
+		gd_testing_verify(CParseTestParseFloat("0.1", 0.1, 3));
+		gd_testing_verify(CParseTestParseFloat("-1234.567", -1234.567, 9));
+		gd_testing_verify(CParseTestParseFloat("12.5e-3", 12.5e-3, 7));
+		gd_testing_verify(CParseTestParseFloat("1E+22", 1e22, 5));
+		gd_testing_verify(CParseTestParseFloat("1e23", 1e23, 4));
+		gd_testing_verify(CParseTestParseFloat("0.30000000000000004", 0.30000000000000004, 19));
+		gd_testing_verify(CParseTestParseFloat("1.7976931348623157e308", 1.7976931348623157e308, 22));
+		gd_testing_verify(CParseTestParseFloat("2.2250738585072011e-308", 2.2250738585072011e-308, 23));
+		gd_testing_verify(CParseTestParseFloat("4.9406564584124654e-324", 4.9406564584124654e-324, 23));
+		gd_testing_verify(CParseTestParseFloat("0e999999999999", 0.0, 14));
+		gd_testing_verify(CParseTestParseFloat("12ex", 12.0, 2));
+		gd_testing_verify(CParseTestParseFloat("12e+", 12.0, 2));
+		gd_testing_verify(CParseTestParseFloat("1.5.5", 1.5, 3));
+
+		// Numbers out of range are rounded to infinity or zero.
+		auto const infinity = 1e308 * 10.0;
+		gd_testing_verify(CParseTestParseFloat("1e309", infinity, 5, true));
+		gd_testing_verify(CParseTestParseFloat("-1e999999999999", -infinity, 15, true));
+		gd_testing_verify(CParseTestParseFloat("2e-324", 0.0, 6, true));
+
+		// Halfway cases with many significant digits, that are resolved by the truncated digits.
+		gd_testing_verify(CParseTestParseFloat("9007199254740993", 9007199254740992.0, 16));
+		gd_testing_verify(CParseTestParseFloat("9007199254740993.0000000000000000000001", 9007199254740994.0, 39));
+		gd_testing_verify(CParseTestParseFloat("9007199254740992.9999999999999999999999", 9007199254740992.0, 39));
+		gd_testing_verify(CParseTestParseFloat("0.000000000000000000000000000000000000000000000000000000000000000000000000001", 1e-75, 77));
+		gd_testing_verify(CParseTestParseFloat("2.4703282292062327208828439643411068618252990130716238221279284125033775363510437593264991818081799618989828234772285886546332835517796989819938739800539093906315035659515570226392290858392449105184435931802849936536152500319370457678249219365623669863658480757001585769269903706311928279558551332927834338409351978015531246597263579574622766465272827220056374006485499977096599470454020828166226237857393450736339007967761930577506740176324673600968951340535537458516661134223766678604162159680461914467291840300530057530849048765391711386591646239524912623653881879636239373280423891018672348497668235089863388587925628302755995657524455507255189313690836254779186948667994968324049705821028513185451396213837722826145437693412532098591327667236328125e-324", 0.0, 758, true));
+		gd_testing_verify(CParseTestParseFloat("2.4703282292062327208828439643411068618252990130716238221279284125033775363510437593264991818081799618989828234772285886546332835517796989819938739800539093906315035659515570226392290858392449105184435931802849936536152500319370457678249219365623669863658480757001585769269903706311928279558551332927834338409351978015531246597263579574622766465272827220056374006485499977096599470454020828166226237857393450736339007967761930577506740176324673600968951340535537458516661134223766678604162159680461914467291840300530057530849048765391711386591646239524912623653881879636239373280423891018672348497668235089863388587925628302755995657524455507255189313690836254779186948667994968324049705821028513185451396213837722826145437693412532098591327667236328125000000000000000000000001e-324", 4.9406564584124654e-324, 782));
+
+		// Special values.
+		gd_testing_verify(CParseTestParseFloat("inf", infinity, 3));
+		gd_testing_verify(CParseTestParseFloat("-Infinity", -infinity, 9));
+		gd_testing_verify(CParseTestParseFloat("INFINITE", infinity, 3));
+		Float64 nan;
+		gd_testing_verify(CParse::ParseFloat64("NaN", 3, nan).Length == 3 && nan != nan);
+
+		// Texts, that are not numbers.
+		gd_testing_verify(CParseTestParseFloat("", 0.0, 0));
+		gd_testing_verify(CParseTestParseFloat("-", 0.0, 0));
+		gd_testing_verify(CParseTestParseFloat(".", 0.0, 0));
+		gd_testing_verify(CParseTestParseFloat("-.e1", 0.0, 0));
+		gd_testing_verify(CParseTestParseFloat("in", 0.0, 0));
+
+		WideChar const wideText[] = { L'-', L'2', L'.', L'5', L'e', L'1', L'0' };
+		Float64 wideValue;
+		gd_testing_verify(CParse::ParseFloat64(wideText, 6, wideValue).Length == 6 && wideValue == -2.5e1);
+	};
+
+	gd_testing_unit_test(CParseFloatsRoundTrip)
+	{
+		Char buffer[64];
+		UInt64 random = 1;
+		for (SizeTp cnt = 0; cnt < 100000; ++cnt)
+		{
+			random = random * 6364136223846793005u + 1442695040888963407u;
+
+			// Shortest representations of random bit patterns cover all exponents, including the subnormal ones.
+			Float64 expected;
+			CMemory::Memcpy(&expected, &random, sizeof expected);
+			if (expected == expected && expected - expected == 0.0)
+			{
+				auto const length = CFormat::FormatFloat64(buffer, expected);
+				Float64 value;
+				auto const result = CParse::ParseFloat64(buffer, length, value);
+				gd_testing_verify(result.Length == length && CMemory::Memcmp(&value, &expected, sizeof value) == 0);
+			}
+
+			// Random decimal numbers with up to 30 digits, that are compared to the C library.
+			auto decimal = random;
+			SizeTp length = 0;
+			auto const digitCount = 1 + decimal % 30;
+			decimal /= 30;
+			for (SizeTp digit = 0; digit < digitCount; ++digit)
+			{
+				if (digit == digitCount / 2 && decimal % 2 == 0)
+				{
+					buffer[length++] = '.';
+				}
+				// Runs of zeros and nines are more likely to produce the halfway cases.
+				auto const digitKind = (random >> (digit % 60)) % 4;
+				buffer[length++] = digitKind == 0 ? '0' : digitKind == 1 ? '9' : static_cast<Char>('0' + (random >> ((digit * 7) % 61)) % 10);
+			}
+			buffer[length++] = 'e';
+			length += CFormat::FormatInt64(buffer + length, static_cast<Int64>((random >> 40) % 700) - 350);
+			buffer[length] = '\0';
+
+			Float64 value;
+			auto const result = CParse::ParseFloat64(buffer, length, value);
+			auto const expectedValue = ::strtod(buffer, nullptr);
+			gd_testing_verify(result.Length == length && CMemory::Memcmp(&value, &expectedValue, sizeof value) == 0);
+		}
+	};
+
+GD_NAMESPACE_END
+
+#endif	// if GD_TESTING_ENABLED
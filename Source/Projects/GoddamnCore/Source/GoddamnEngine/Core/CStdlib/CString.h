@@ -15,6 +15,8 @@
 
 #include <GoddamnEngine/Include.h>
 #include <GoddamnEngine/Core/PlatformSpecificInclude.h>
+#include <GoddamnEngine/Core/CStdlib/CStringSearch.h>
+#include <GoddamnEngine/Core/CStdlib/CParse.h>
 
 #include <cstring>
 #include <cstdarg>
@@ -235,20 +237,7 @@ GD_NAMESPACE_BEGIN
 			{
 				return cstr;
 			}
-
-			auto cstrMut = cstr;
-			TChar const* result = nullptr;
-			while (true)
-			{
-				auto const found = Strstr(cstrMut, subCStr);
-				if (found == nullptr)
-				{
-					break;
-				}
-				result = found;
-				cstrMut = found + 1;
-			}
-			return result;
+			return CStringSearch::ReverseFind(cstr, CStringSearch::Strlen(cstr), subCStr, CStringSearch::Strlen(subCStr));
 		}
 
 		// ------------------------------------------------------------------------------------------
@@ -281,51 +270,46 @@ GD_NAMESPACE_BEGIN
 
 		/*!
 		 * @see @c "std::strtoull" function.
+		 * Unlike the C library function, the conversion does not depend on the locale.
 		 */
 		//! @{
 		GDINL static UInt64 Strtoui64(CStr const cstr, Char** const endPtr = nullptr, SizeTp const base = 0)
 		{
-			// ReSharper disable once CppIdenticalOperandsInBinaryExpression
-			static_assert(sizeof(UInt64) <= sizeof(unsigned long long), "'unsigned long long' is not large enough to store 'UInt64' type.");
-			return static_cast<UInt64>(::strtoull(cstr, endPtr, static_cast<int>(base)));
+			return StrtoUnsigned(cstr, endPtr, base);
 		}
 		GDINL static UInt64 Strtoui64(WideChar const* const cstr, WideChar** const endPtr = nullptr, SizeTp const base = 0)
 		{
-			// ReSharper disable once CppIdenticalOperandsInBinaryExpression
-			static_assert(sizeof(UInt64) <= sizeof(unsigned long long), "'unsigned long long' is not large enough to store 'UInt64' type.");
-			return static_cast<UInt64>(::wcstoull(cstr, endPtr, static_cast<int>(base)));
+			return StrtoUnsigned(cstr, endPtr, base);
 		}
 		//! @}
 
 		/*!
 		 * @see @c "std::strtoll" function.
+		 * Unlike the C library function, the conversion does not depend on the locale.
 		 */
 		//! @{
 		GDINL static Int64 Strtoi64(CStr const cstr, CStr* const endPtr = nullptr, SizeTp const base = 0)
 		{
-			// ReSharper disable once CppIdenticalOperandsInBinaryExpression
-			static_assert(sizeof(Int64) <= sizeof(long long), "'long long' is not large enough to store 'Int64' type.");
-			return static_cast<Int64>(::strtoll(cstr, const_cast<char**>(endPtr), static_cast<int>(base)));
+			return StrtoSigned(cstr, endPtr, base);
 		}
 		GDINL static Int64 Strtoi64(WideChar const* const cstr, WideChar const** const endPtr = nullptr, SizeTp const base = 0)
 		{
-			// ReSharper disable once CppIdenticalOperandsInBinaryExpression
-			static_assert(sizeof(Int64) <= sizeof(long long), "'long long' is not large enough to store 'Int64' type.");
-			return static_cast<Int64>(::wcstoll(cstr, const_cast<wchar_t**>(endPtr), static_cast<int>(base)));
+			return StrtoSigned(cstr, endPtr, base);
 		}
 		//! @}
 
 		/*!
 		 * @see @c "std::strtod" function.
+		 * Unlike the C library function, the conversion does not depend on the locale and hexadecimal numbers are not supported.
 		 */
 		//! @{
 		GDINL static Float64 Strtof64(CStr const cstr, CStr* const endPtr = nullptr)
 		{
-			return ::strtod(cstr, const_cast<char**>(endPtr));
+			return StrtoFloat(cstr, endPtr);
 		}
 		GDINL static Float64 Strtof64(WideChar const* const cstr, WideChar const** const endPtr = nullptr)
 		{
-			return ::wcstod(cstr, const_cast<wchar_t**>(endPtr));
+			return StrtoFloat(cstr, endPtr);
 		}
 		//! @}
 
@@ -392,6 +376,94 @@ GD_NAMESPACE_BEGIN
 			va_end(arguments);
 			return result;
 		}
+
+	private:
+
+		// ------------------------------------------------------------------------------------------
+		// String to number conversions.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Skips the leading spaces, as the C library does.
+		 */
+		template<typename TChar>
+		GDINL static TChar const* SkipSpaces(TChar const* cstr)
+		{
+			while (*cstr == ' ' || (*cstr >= '\t' && *cstr <= '\r'))
+			{
+				++cstr;
+			}
+			return cstr;
+		}
+
+		/*!
+		 * Returns length of the prefix, that may belong to a number, so that the parsers never read past the terminator.
+		 */
+		template<typename TChar>
+		GDINL static SizeTp GetNumberLength(TChar const* const cstr)
+		{
+			SizeTp length = 0;
+			for (;; ++length)
+			{
+				auto const character = static_cast<UInt32>(cstr[length]);
+				if (character - '0' >= 10 && (character | 0x20) - 'a' >= 26 && character != '.' && character != '+' && character != '-')
+				{
+					return length;
+				}
+			}
+		}
+
+		/*!
+		 * Parses the unsigned integer with the C library semantics.
+		 */
+		template<typename TChar, typename TEndChar>
+		GDINL static UInt64 StrtoUnsigned(TChar const* const cstr, TEndChar** const endPtr, SizeTp const base)
+		{
+			// Negative values are negated in the unsigned arithmetic, as in the C library.
+			auto const text = SkipSpaces(cstr);
+			auto const isNegative = *text == '-';
+			SizeTp const signLength = *text == '-' || *text == '+' ? 1 : 0;
+
+			UInt64 value;
+			auto const result = CParse::ParseUInt64(text + signLength, GetNumberLength(text + signLength), value, static_cast<UInt32>(base));
+			if (endPtr != nullptr)
+			{
+				*endPtr = const_cast<TEndChar*>(result.Length != 0 ? text + signLength + result.Length : cstr);
+			}
+			return isNegative && !result.OutOfRange ? 0 - value : value;
+		}
+
+		/*!
+		 * Parses the signed integer with the C library semantics.
+		 */
+		template<typename TChar>
+		GDINL static Int64 StrtoSigned(TChar const* const cstr, TChar const** const endPtr, SizeTp const base)
+		{
+			auto const text = SkipSpaces(cstr);
+			Int64 value;
+			auto const result = CParse::ParseInt64(text, GetNumberLength(text), value, static_cast<UInt32>(base));
+			if (endPtr != nullptr)
+			{
+				*endPtr = result.Length != 0 ? text + result.Length : cstr;
+			}
+			return value;
+		}
+
+		/*!
+		 * Parses the floating point number with the C library semantics.
+		 */
+		template<typename TChar>
+		GDINL static Float64 StrtoFloat(TChar const* const cstr, TChar const** const endPtr)
+		{
+			auto const text = SkipSpaces(cstr);
+			Float64 value;
+			auto const result = CParse::ParseFloat64(text, GetNumberLength(text), value);
+			if (endPtr != nullptr)
+			{
+				*endPtr = result.Length != 0 ? text + result.Length : cstr;
+			}
+			return value;
+		}
 	};	// class CStringGeneric
 
 	/*!
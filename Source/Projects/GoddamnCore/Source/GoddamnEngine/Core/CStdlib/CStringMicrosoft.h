@@ -133,34 +133,6 @@ GD_NAMESPACE_BEGIN
 			return output;
 		}
 
-		/*!
-		 * @see @c "std::strtoull" function.
-		 */
-		//! @{
-		GDINL static UInt64 Strtoui64(CStr const cstr, Char** const endPtr = nullptr, SizeTp const base = 0)
-		{
-			return ::_strtoui64(cstr, endPtr, static_cast<int>(base));
-		}
-		GDINL static UInt64 Strtoui64(WideChar const* const cstr, WideChar** const endPtr = nullptr, SizeTp const base = 0)
-		{
-			return ::_wcstoui64(cstr, endPtr, static_cast<int>(base));
-		}
-		//! @}
-
-		/*!
-		 * @see @c "std::strtoll" function.
-		 */
-		//! @{
-		GDINL static Int64 Strtoi64(CStr const cstr, CStr* const endPtr = nullptr, SizeTp const base = 0)
-		{
-			return ::_strtoi64(cstr, const_cast<char**>(endPtr), static_cast<int>(base));
-		}
-		GDINL static Int64 Strtoi64(WideChar const* const cstr, WideChar const** const endPtr = nullptr, SizeTp const base = 0)
-		{
-			return ::_wcstoi64(cstr, const_cast<wchar_t**>(endPtr), static_cast<int>(base));
-		}
-		//! @}
-
 		// ------------------------------------------------------------------------------------------
 		// String formatting functions.
 		// ------------------------------------------------------------------------------------------
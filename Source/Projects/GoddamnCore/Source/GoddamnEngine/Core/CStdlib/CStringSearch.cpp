@@ -0,0 +1,667 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/CStdlib/CStringSearch.cpp
+ * Vectorized string search kernels.
+ */
+#include <GoddamnEngine/Core/CStdlib/CStringSearch.h>
+#include <GoddamnEngine/Core/CStdlib/CMemory.h>
+#include <GoddamnEngine/Core/CStdlib/CChar.h>
+
+#if (GD_ARCHITECTURE_X64 || GD_ARCHITECTURE_X86) && !GD_PLATFORM_HTML5 && defined(__AVX2__)
+#	define GD_CSTRING_SEARCH_AVX2 GD_TRUE
+#	include <immintrin.h>
+#else	// if (GD_ARCHITECTURE_X64 || GD_ARCHITECTURE_X86) && !GD_PLATFORM_HTML5 && defined(__AVX2__)
+#	define GD_CSTRING_SEARCH_AVX2 GD_FALSE
+#endif	// if (GD_ARCHITECTURE_X64 || GD_ARCHITECTURE_X86) && !GD_PLATFORM_HTML5 && defined(__AVX2__)
+#if (GD_ARCHITECTURE_X64 || GD_ARCHITECTURE_X86) && !GD_PLATFORM_HTML5 && !GD_CSTRING_SEARCH_AVX2
+#	define GD_CSTRING_SEARCH_SSE2 GD_TRUE
+#	include <emmintrin.h>
+#else	// if (GD_ARCHITECTURE_X64 || GD_ARCHITECTURE_X86) && !GD_PLATFORM_HTML5 && !GD_CSTRING_SEARCH_AVX2
+#	define GD_CSTRING_SEARCH_SSE2 GD_FALSE
+#endif	// if (GD_ARCHITECTURE_X64 || GD_ARCHITECTURE_X86) && !GD_PLATFORM_HTML5 && !GD_CSTRING_SEARCH_AVX2
+#if GD_ARCHITECTURE_ARM64
+#	define GD_CSTRING_SEARCH_NEON GD_TRUE
+#	include <arm_neon.h>
+#else	// if GD_ARCHITECTURE_ARM64
+#	define GD_CSTRING_SEARCH_NEON GD_FALSE
+#endif	// if GD_ARCHITECTURE_ARM64
+#define GD_CSTRING_SEARCH_SIMD (GD_CSTRING_SEARCH_AVX2 || GD_CSTRING_SEARCH_SSE2 || GD_CSTRING_SEARCH_NEON)
+
+// Reading the whole aligned block with the terminator is safe, but is reported by the address sanitizer.
+#if defined(__SANITIZE_ADDRESS__)
+#	define GD_CSTRING_SEARCH_SANITIZED GD_TRUE
+#elif defined(__has_feature)
+#	if __has_feature(address_sanitizer)
+#		define GD_CSTRING_SEARCH_SANITIZED GD_TRUE
+#	endif	// if __has_feature(address_sanitizer)
+#endif	// if defined(__SANITIZE_ADDRESS__)
+#if !defined(GD_CSTRING_SEARCH_SANITIZED)
+#	define GD_CSTRING_SEARCH_SANITIZED GD_FALSE
+#endif	// if !defined(GD_CSTRING_SEARCH_SANITIZED)
+
+#if GD_COMPILER_MSVC_COMPATIBLE
+#	include <intrin.h>
+#endif	// if GD_COMPILER_MSVC_COMPATIBLE
+
+GD_NAMESPACE_BEGIN
+
+#if GD_CSTRING_SEARCH_SIMD
+
+	/*!
+	 * Returns index of the lowest set bit of the non-zero value.
+	 */
+	GDINL static SizeTp CStringSearchLowestBit(UInt64 const value)
+	{
+#if GD_COMPILER_MSVC_COMPATIBLE && (GD_ARCHITECTURE_X64 || GD_ARCHITECTURE_ARM64)
+		unsigned long index;
+		_BitScanForward64(&index, value);
+#elif GD_COMPILER_MSVC_COMPATIBLE
+		unsigned long index;
+		if (!_BitScanForward(&index, static_cast<unsigned long>(value)))
+		{
+			_BitScanForward(&index, static_cast<unsigned long>(value >> 32));
+			index += 32;
+		}
+#else	// if GD_COMPILER_MSVC_COMPATIBLE
+		auto const index = __builtin_ctzll(value);
+#endif	// if GD_COMPILER_MSVC_COMPATIBLE
+		return static_cast<SizeTp>(index);
+	}
+
+	/*!
+	 * Returns index of the highest set bit of the non-zero value.
+	 */
+	GDINL static SizeTp CStringSearchHighestBit(UInt64 const value)
+	{
+#if GD_COMPILER_MSVC_COMPATIBLE && (GD_ARCHITECTURE_X64 || GD_ARCHITECTURE_ARM64)
+		unsigned long index;
+		_BitScanReverse64(&index, value);
+#elif GD_COMPILER_MSVC_COMPATIBLE
+		unsigned long index;
+		if (_BitScanReverse(&index, static_cast<unsigned long>(value >> 32)))
+		{
+			index += 32;
+		}
+		else
+		{
+			_BitScanReverse(&index, static_cast<unsigned long>(value));
+		}
+#else	// if GD_COMPILER_MSVC_COMPATIBLE
+		auto const index = 63 - __builtin_clzll(value);
+#endif	// if GD_COMPILER_MSVC_COMPATIBLE
+		return static_cast<SizeTp>(index);
+	}
+
+	// **------------------------------------------------------------------------------------------**
+	//! Thin wrapper over the vector registers of the target architecture.
+	//! Comparisons are performed on lanes of the character size, the results are packed into
+	//! the scalar mask, where each byte of the vector is represented with several bits.
+	// **------------------------------------------------------------------------------------------**
+	struct CStringSearchVector final : public TNonCreatable
+	{
+	public:
+#if GD_CSTRING_SEARCH_AVX2
+		using Type = __m256i;
+		SizeTp static const Width = 32;
+		SizeTp static const MaskBitsPerByte = 1;
+#elif GD_CSTRING_SEARCH_SSE2
+		using Type = __m128i;
+		SizeTp static const Width = 16;
+		SizeTp static const MaskBitsPerByte = 1;
+#else	// *** NEON. ***
+		using Type = uint8x16_t;
+		SizeTp static const Width = 16;
+		SizeTp static const MaskBitsPerByte = 4;
+#endif	// *** NEON. ***
+
+	public:
+
+		/*!
+		 * Loads a vector from unaligned memory.
+		 */
+		GDINL static Type Load(CHandle const data)
+		{
+#if GD_CSTRING_SEARCH_AVX2
+			return _mm256_loadu_si256(static_cast<Type const*>(data));
+#elif GD_CSTRING_SEARCH_SSE2
+			return _mm_loadu_si128(static_cast<Type const*>(data));
+#else	// *** NEON. ***
+			return vld1q_u8(static_cast<UInt8 const*>(data));
+#endif	// *** NEON. ***
+		}
+
+		/*!
+		 * Loads a vector from memory, aligned to the vector width.
+		 */
+		GDINL static Type LoadAligned(CHandle const data)
+		{
+#if GD_CSTRING_SEARCH_AVX2
+			return _mm256_load_si256(static_cast<Type const*>(data));
+#elif GD_CSTRING_SEARCH_SSE2
+			return _mm_load_si128(static_cast<Type const*>(data));
+#else	// *** NEON. ***
+			return vld1q_u8(static_cast<UInt8 const*>(data));
+#endif	// *** NEON. ***
+		}
+
+		/*!
+		 * Fills all lanes of the vector with the character.
+		 */
+		template<typename TChar>
+		GDINL static Type Splat(TChar const character)
+		{
+#if GD_CSTRING_SEARCH_AVX2
+			return sizeof(TChar) == 1 ? _mm256_set1_epi8(static_cast<char>(character))
+				: sizeof(TChar) == 2 ? _mm256_set1_epi16(static_cast<short>(character)) : _mm256_set1_epi32(static_cast<int>(character));
+#elif GD_CSTRING_SEARCH_SSE2
+			return sizeof(TChar) == 1 ? _mm_set1_epi8(static_cast<char>(character))
+				: sizeof(TChar) == 2 ? _mm_set1_epi16(static_cast<short>(character)) : _mm_set1_epi32(static_cast<int>(character));
+#else	// *** NEON. ***
+			return sizeof(TChar) == 1 ? vdupq_n_u8(static_cast<UInt8>(character))
+				: sizeof(TChar) == 2 ? vreinterpretq_u8_u16(vdupq_n_u16(static_cast<UInt16>(character))) : vreinterpretq_u8_u32(vdupq_n_u32(static_cast<UInt32>(character)));
+#endif	// *** NEON. ***
+		}
+
+		/*!
+		 * Returns lanes of the character size, which are equal in both vectors.
+		 */
+		template<typename TChar>
+		GDINL static Type Equal(Type const lhs, Type const rhs)
+		{
+#if GD_CSTRING_SEARCH_AVX2
+			return sizeof(TChar) == 1 ? _mm256_cmpeq_epi8(lhs, rhs) : sizeof(TChar) == 2 ? _mm256_cmpeq_epi16(lhs, rhs) : _mm256_cmpeq_epi32(lhs, rhs);
+#elif GD_CSTRING_SEARCH_SSE2
+			return sizeof(TChar) == 1 ? _mm_cmpeq_epi8(lhs, rhs) : sizeof(TChar) == 2 ? _mm_cmpeq_epi16(lhs, rhs) : _mm_cmpeq_epi32(lhs, rhs);
+#else	// *** NEON. ***
+			return sizeof(TChar) == 1 ? vceqq_u8(lhs, rhs)
+				: sizeof(TChar) == 2 ? vreinterpretq_u8_u16(vceqq_u16(vreinterpretq_u16_u8(lhs), vreinterpretq_u16_u8(rhs)))
+				: vreinterpretq_u8_u32(vceqq_u32(vreinterpretq_u32_u8(lhs), vreinterpretq_u32_u8(rhs)));
+#endif	// *** NEON. ***
+		}
+
+		/*!
+		 * Returns lanes of the character size, which contain ASCII characters in the specified range.
+		 * x86 comparisons are signed, so characters with the high bit set never match.
+		 */
+		template<typename TChar>
+		GDINL static Type InRange(Type const value, TChar const lowest, TChar const highest)
+		{
+#if GD_CSTRING_SEARCH_AVX2
+			auto const lowerBound = Splat(static_cast<TChar>(lowest - 1));
+			auto const upperBound = Splat(static_cast<TChar>(highest + 1));
+			return sizeof(TChar) == 1 ? _mm256_and_si256(_mm256_cmpgt_epi8(value, lowerBound), _mm256_cmpgt_epi8(upperBound, value))
+				: sizeof(TChar) == 2 ? _mm256_and_si256(_mm256_cmpgt_epi16(value, lowerBound), _mm256_cmpgt_epi16(upperBound, value))
+				: _mm256_and_si256(_mm256_cmpgt_epi32(value, lowerBound), _mm256_cmpgt_epi32(upperBound, value));
+#elif GD_CSTRING_SEARCH_SSE2
+			auto const lowerBound = Splat(static_cast<TChar>(lowest - 1));
+			auto const upperBound = Splat(static_cast<TChar>(highest + 1));
+			return sizeof(TChar) == 1 ? _mm_and_si128(_mm_cmpgt_epi8(value, lowerBound), _mm_cmpgt_epi8(upperBound, value))
+				: sizeof(TChar) == 2 ? _mm_and_si128(_mm_cmpgt_epi16(value, lowerBound), _mm_cmpgt_epi16(upperBound, value))
+				: _mm_and_si128(_mm_cmpgt_epi32(value, lowerBound), _mm_cmpgt_epi32(upperBound, value));
+#else	// *** NEON. ***
+			auto const lowerBound = Splat(lowest);
+			auto const upperBound = Splat(highest);
+			return sizeof(TChar) == 1 ? vandq_u8(vcgeq_u8(value, lowerBound), vcleq_u8(value, upperBound))
+				: sizeof(TChar) == 2 ? vreinterpretq_u8_u16(vandq_u16(vcgeq_u16(vreinterpretq_u16_u8(value), vreinterpretq_u16_u8(lowerBound)), vcleq_u16(vreinterpretq_u16_u8(value), vreinterpretq_u16_u8(upperBound))))
+				: vreinterpretq_u8_u32(vandq_u32(vcgeq_u32(vreinterpretq_u32_u8(value), vreinterpretq_u32_u8(lowerBound)), vcleq_u32(vreinterpretq_u32_u8(value), vreinterpretq_u32_u8(upperBound))));
+#endif	// *** NEON. ***
+		}
+
+		/*!
+		 * Returns bitwise 'and' of the vectors.
+		 */
+		GDINL static Type And(Type const lhs, Type const rhs)
+		{
+#if GD_CSTRING_SEARCH_AVX2
+			return _mm256_and_si256(lhs, rhs);
+#elif GD_CSTRING_SEARCH_SSE2
+			return _mm_and_si128(lhs, rhs);
+#else	// *** NEON. ***
+			return vandq_u8(lhs, rhs);
+#endif	// *** NEON. ***
+		}
+
+		/*!
+		 * Returns bitwise 'or' of the vectors.
+		 */
+		GDINL static Type Or(Type const lhs, Type const rhs)
+		{
+#if GD_CSTRING_SEARCH_AVX2
+			return _mm256_or_si256(lhs, rhs);
+#elif GD_CSTRING_SEARCH_SSE2
+			return _mm_or_si128(lhs, rhs);
+#else	// *** NEON. ***
+			return vorrq_u8(lhs, rhs);
+#endif	// *** NEON. ***
+		}
+
+		/*!
+		 * Packs the comparison result into the scalar mask.
+		 */
+		GDINL static UInt64 MoveMask(Type const value)
+		{
+#if GD_CSTRING_SEARCH_AVX2
+			return static_cast<UInt32>(_mm256_movemask_epi8(value));
+#elif GD_CSTRING_SEARCH_SSE2
+			return static_cast<UInt32>(_mm_movemask_epi8(value));
+#else	// *** NEON. ***
+			// Narrowing shift leaves a nibble per byte.
+			return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(value), 4)), 0);
+#endif	// *** NEON. ***
+		}
+	};	// struct CStringSearchVector
+
+#endif	// if GD_CSTRING_SEARCH_SIMD
+
+	// **------------------------------------------------------------------------------------------**
+	//! Search kernels for the specified character type.
+	// **------------------------------------------------------------------------------------------**
+	template<typename TChar>
+	struct CStringSearchKernels final : public TNonCreatable
+	{
+	private:
+#if GD_CSTRING_SEARCH_SIMD
+		using Vector = CStringSearchVector;
+
+		SizeTp static const Step = Vector::Width / sizeof(TChar);
+		SizeTp static const MaskBitsPerChar = Vector::MaskBitsPerByte * sizeof(TChar);
+
+		// Keeps only the lowest bit of each character in the mask, so that bits map to characters.
+		UInt64 static const MaskCharBits = ~UInt64(0) / ((UInt64(1) << MaskBitsPerChar) - 1);
+
+		// Main loops check several vectors per iteration and extract a single mask for all of them.
+		SizeTp static const Unroll = 4;
+
+		GDINL static UInt64 MatchMask(Vector::Type const matches)
+		{
+			return Vector::MoveMask(matches) & MaskCharBits;
+		}
+		GDINL static bool AnyMatches(Vector::Type const (&matches)[Unroll])
+		{
+			return Vector::MoveMask(Vector::Or(Vector::Or(matches[0], matches[1]), Vector::Or(matches[2], matches[3]))) != 0;
+		}
+		GDINL static Vector::Type MatchCandidates(TChar const* const block, Vector::Type const first, Vector::Type const last, SizeTp const subTextLength)
+		{
+			return Vector::And(Vector::Equal<TChar>(Vector::Load(block), first), Vector::Equal<TChar>(Vector::Load(block + subTextLength - 1), last));
+		}
+		GDINL static TChar const* VerifyCandidates(TChar const* const block, UInt64 mask, TChar const* const subText, SizeTp const subTextLength)
+		{
+			for (; mask != 0; mask &= mask - 1)
+			{
+				auto const candidate = block + CStringSearchLowestBit(mask) / MaskBitsPerChar;
+				if (CMemory::Memcmp(candidate + 1, subText + 1, (subTextLength - 2) * sizeof(TChar)) == 0)
+				{
+					return candidate;
+				}
+			}
+			return nullptr;
+		}
+		GDINL static TChar const* ReverseVerifyCandidates(TChar const* const block, UInt64 mask, TChar const* const subText, SizeTp const subTextLength)
+		{
+			while (mask != 0)
+			{
+				auto const highestBit = CStringSearchHighestBit(mask);
+				auto const candidate = block + highestBit / MaskBitsPerChar;
+				if (CMemory::Memcmp(candidate + 1, subText + 1, (subTextLength - 2) * sizeof(TChar)) == 0)
+				{
+					return candidate;
+				}
+				mask &= ~(UInt64(1) << highestBit);
+			}
+			return nullptr;
+		}
+		GDINL static Vector::Type FoldCase(Vector::Type const value)
+		{
+			return Vector::Or(value, Vector::And(Vector::InRange<TChar>(value, 'A', 'Z'), Vector::Splat(static_cast<TChar>(0x20))));
+		}
+#endif	// if GD_CSTRING_SEARCH_SIMD
+
+		GDINL static TChar FoldCase(TChar const character)
+		{
+			return sizeof(TChar) == 1 ? (character >= 'A' && character <= 'Z' ? static_cast<TChar>(character | 0x20) : character) : CChar::ToLower(character);
+		}
+
+	public:
+		GDINL static SizeTp Strlen(TChar const* const text)
+		{
+			GD_ASSERT(text != nullptr);
+#if GD_CSTRING_SEARCH_SIMD && !GD_CSTRING_SEARCH_SANITIZED
+			// Aligned blocks never cross the page boundary, so reading past the terminator is safe.
+			auto const textBytes = reinterpret_cast<Byte const*>(text);
+			auto const misalignment = static_cast<SizeTp>(reinterpret_cast<UIntPtr>(text) % Vector::Width);
+			auto block = textBytes - misalignment;
+			auto const zero = Vector::Splat(static_cast<TChar>(0));
+			auto mask = MatchMask(Vector::Equal<TChar>(Vector::LoadAligned(block), zero)) >> (misalignment * Vector::MaskBitsPerByte);
+			if (mask != 0)
+			{
+				return CStringSearchLowestBit(mask) / MaskBitsPerChar;
+			}
+
+			// Unrolled blocks are aligned to their size, so that they do not cross the page boundary too.
+			block += Vector::Width;
+			while (reinterpret_cast<UIntPtr>(block) % (Unroll * Vector::Width) != 0)
+			{
+				mask = MatchMask(Vector::Equal<TChar>(Vector::LoadAligned(block), zero));
+				if (mask != 0)
+				{
+					return static_cast<SizeTp>(block - textBytes) / sizeof(TChar) + CStringSearchLowestBit(mask) / MaskBitsPerChar;
+				}
+				block += Vector::Width;
+			}
+			while (true)
+			{
+				Vector::Type const matches[Unroll] = {
+					Vector::Equal<TChar>(Vector::LoadAligned(block + 0 * Vector::Width), zero), Vector::Equal<TChar>(Vector::LoadAligned(block + 1 * Vector::Width), zero),
+					Vector::Equal<TChar>(Vector::LoadAligned(block + 2 * Vector::Width), zero), Vector::Equal<TChar>(Vector::LoadAligned(block + 3 * Vector::Width), zero),
+				};
+				if (AnyMatches(matches))
+				{
+					break;
+				}
+				block += Unroll * Vector::Width;
+			}
+			while (true)
+			{
+				mask = MatchMask(Vector::Equal<TChar>(Vector::LoadAligned(block), zero));
+				if (mask != 0)
+				{
+					return static_cast<SizeTp>(block - textBytes) / sizeof(TChar) + CStringSearchLowestBit(mask) / MaskBitsPerChar;
+				}
+				block += Vector::Width;
+			}
+#else	// if GD_CSTRING_SEARCH_SIMD && !GD_CSTRING_SEARCH_SANITIZED
+			auto end = text;
+			while (*end != 0)
+			{
+				++end;
+			}
+			return static_cast<SizeTp>(end - text);
+#endif	// if GD_CSTRING_SEARCH_SIMD && !GD_CSTRING_SEARCH_SANITIZED
+		}
+
+		GDINL static TChar const* Find(TChar const* const text, SizeTp const textLength, TChar const character)
+		{
+			GD_ASSERT(text != nullptr || textLength == 0);
+			SizeTp index = 0;
+#if GD_CSTRING_SEARCH_SIMD
+			auto const pattern = Vector::Splat(character);
+			for (; index + Unroll * Step <= textLength; index += Unroll * Step)
+			{
+				// The match itself is located by the single vector loop below.
+				auto const block = text + index;
+				Vector::Type const matches[Unroll] = {
+					Vector::Equal<TChar>(Vector::Load(block + 0 * Step), pattern), Vector::Equal<TChar>(Vector::Load(block + 1 * Step), pattern),
+					Vector::Equal<TChar>(Vector::Load(block + 2 * Step), pattern), Vector::Equal<TChar>(Vector::Load(block + 3 * Step), pattern),
+				};
+				if (AnyMatches(matches))
+				{
+					break;
+				}
+			}
+			for (; index + Step <= textLength; index += Step)
+			{
+				auto const mask = MatchMask(Vector::Equal<TChar>(Vector::Load(text + index), pattern));
+				if (mask != 0)
+				{
+					return text + index + CStringSearchLowestBit(mask) / MaskBitsPerChar;
+				}
+			}
+#endif	// if GD_CSTRING_SEARCH_SIMD
+			for (; index < textLength; ++index)
+			{
+				if (text[index] == character)
+				{
+					return text + index;
+				}
+			}
+			return nullptr;
+		}
+
+		GDINL static TChar const* ReverseFind(TChar const* const text, SizeTp const textLength, TChar const character)
+		{
+			GD_ASSERT(text != nullptr || textLength == 0);
+			auto end = textLength;
+#if GD_CSTRING_SEARCH_SIMD
+			auto const pattern = Vector::Splat(character);
+			for (; end >= Unroll * Step; end -= Unroll * Step)
+			{
+				auto const block = text + end - Unroll * Step;
+				Vector::Type const matches[Unroll] = {
+					Vector::Equal<TChar>(Vector::Load(block + 0 * Step), pattern), Vector::Equal<TChar>(Vector::Load(block + 1 * Step), pattern),
+					Vector::Equal<TChar>(Vector::Load(block + 2 * Step), pattern), Vector::Equal<TChar>(Vector::Load(block + 3 * Step), pattern),
+				};
+				if (AnyMatches(matches))
+				{
+					break;
+				}
+			}
+			for (; end >= Step; end -= Step)
+			{
+				auto const mask = MatchMask(Vector::Equal<TChar>(Vector::Load(text + end - Step), pattern));
+				if (mask != 0)
+				{
+					return text + end - Step + CStringSearchHighestBit(mask) / MaskBitsPerChar;
+				}
+			}
+#endif	// if GD_CSTRING_SEARCH_SIMD
+			while (end != 0)
+			{
+				if (text[--end] == character)
+				{
+					return text + end;
+				}
+			}
+			return nullptr;
+		}
+
+		GDINL static TChar const* Find(TChar const* const text, SizeTp const textLength, TChar const* const subText, SizeTp const subTextLength)
+		{
+			GD_ASSERT(subText != nullptr || subTextLength == 0);
+			if (subTextLength <= 1)
+			{
+				return subTextLength == 0 ? text : Find(text, textLength, subText[0]);
+			}
+			if (subTextLength > textLength)
+			{
+				return nullptr;
+			}
+
+			// Number of the positions, where substring could start.
+			auto const numPositions = textLength - subTextLength + 1;
+			SizeTp index = 0;
+#if GD_CSTRING_SEARCH_SIMD
+			auto const first = Vector::Splat(subText[0]);
+			auto const last = Vector::Splat(subText[subTextLength - 1]);
+			for (; index + Unroll * Step <= numPositions; index += Unroll * Step)
+			{
+				auto const block = text + index;
+				Vector::Type const candidates[Unroll] = {
+					MatchCandidates(block + 0 * Step, first, last, subTextLength), MatchCandidates(block + 1 * Step, first, last, subTextLength),
+					MatchCandidates(block + 2 * Step, first, last, subTextLength), MatchCandidates(block + 3 * Step, first, last, subTextLength),
+				};
+				if (AnyMatches(candidates))
+				{
+					for (SizeTp cnt = 0; cnt < Unroll; ++cnt)
+					{
+						if (auto const found = VerifyCandidates(block + cnt * Step, MatchMask(candidates[cnt]), subText, subTextLength))
+						{
+							return found;
+						}
+					}
+				}
+			}
+			for (; index + Step <= numPositions; index += Step)
+			{
+				if (auto const found = VerifyCandidates(text + index, MatchMask(MatchCandidates(text + index, first, last, subTextLength)), subText, subTextLength))
+				{
+					return found;
+				}
+			}
+#endif	// if GD_CSTRING_SEARCH_SIMD
+			for (; index < numPositions; ++index)
+			{
+				if (text[index] == subText[0] && CMemory::Memcmp(text + index + 1, subText + 1, (subTextLength - 1) * sizeof(TChar)) == 0)
+				{
+					return text + index;
+				}
+			}
+			return nullptr;
+		}
+
+		GDINL static TChar const* ReverseFind(TChar const* const text, SizeTp const textLength, TChar const* const subText, SizeTp const subTextLength)
+		{
+			GD_ASSERT(subText != nullptr || subTextLength == 0);
+			if (subTextLength <= 1)
+			{
+				return subTextLength == 0 ? text + textLength : ReverseFind(text, textLength, subText[0]);
+			}
+			if (subTextLength > textLength)
+			{
+				return nullptr;
+			}
+
+			auto end = textLength - subTextLength + 1;
+#if GD_CSTRING_SEARCH_SIMD
+			auto const first = Vector::Splat(subText[0]);
+			auto const last = Vector::Splat(subText[subTextLength - 1]);
+			for (; end >= Unroll * Step; end -= Unroll * Step)
+			{
+				auto const block = text + end - Unroll * Step;
+				Vector::Type const candidates[Unroll] = {
+					MatchCandidates(block + 0 * Step, first, last, subTextLength), MatchCandidates(block + 1 * Step, first, last, subTextLength),
+					MatchCandidates(block + 2 * Step, first, last, subTextLength), MatchCandidates(block + 3 * Step, first, last, subTextLength),
+				};
+				if (AnyMatches(candidates))
+				{
+					for (auto cnt = Unroll; cnt != 0; --cnt)
+					{
+						if (auto const found = ReverseVerifyCandidates(block + (cnt - 1) * Step, MatchMask(candidates[cnt - 1]), subText, subTextLength))
+						{
+							return found;
+						}
+					}
+				}
+			}
+			for (; end >= Step; end -= Step)
+			{
+				auto const block = text + end - Step;
+				if (auto const found = ReverseVerifyCandidates(block, MatchMask(MatchCandidates(block, first, last, subTextLength)), subText, subTextLength))
+				{
+					return found;
+				}
+			}
+#endif	// if GD_CSTRING_SEARCH_SIMD
+			while (end != 0)
+			{
+				--end;
+				if (text[end] == subText[0] && CMemory::Memcmp(text + end + 1, subText + 1, (subTextLength - 1) * sizeof(TChar)) == 0)
+				{
+					return text + end;
+				}
+			}
+			return nullptr;
+		}
+
+		GDINL static Int32 CompareIgnoreCase(TChar const* const lhs, TChar const* const rhs, SizeTp const length)
+		{
+			GD_ASSERT((lhs != nullptr && rhs != nullptr) || length == 0);
+			SizeTp index = 0;
+			while (index < length)
+			{
+#if GD_CSTRING_SEARCH_SIMD
+				// Characters, that are equal after folding ASCII letters, are equal after folding any letters,
+				// so vectors are used to skip equal blocks and mismatches are checked with scalar code.
+				for (; index + Step <= length; index += Step)
+				{
+					auto const lhsFolded = FoldCase(Vector::Load(lhs + index));
+					auto const rhsFolded = FoldCase(Vector::Load(rhs + index));
+					auto const mask = MatchMask(Vector::Equal<TChar>(lhsFolded, rhsFolded)) ^ (MaskCharBits >> (64 - Vector::Width * Vector::MaskBitsPerByte));
+					if (mask != 0)
+					{
+						index += CStringSearchLowestBit(mask) / MaskBitsPerChar;
+						break;
+					}
+				}
+				if (index == length)
+				{
+					break;
+				}
+#endif	// if GD_CSTRING_SEARCH_SIMD
+				auto const lhsFolded = FoldCase(lhs[index]);
+				auto const rhsFolded = FoldCase(rhs[index]);
+				if (lhsFolded != rhsFolded)
+				{
+					return lhsFolded < rhsFolded ? -1 : 1;
+				}
+				++index;
+			}
+			return 0;
+		}
+	};	// struct CStringSearchKernels
+
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+	// ******                               CStringSearch class.                               ******
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+
+	GDAPI SizeTp CStringSearch::Strlen(Char const* const text)
+	{
+		return CStringSearchKernels<Char>::Strlen(text);
+	}
+	GDAPI SizeTp CStringSearch::Strlen(WideChar const* const text)
+	{
+		return CStringSearchKernels<WideChar>::Strlen(text);
+	}
+
+	GDAPI Char const* CStringSearch::Find(Char const* const text, SizeTp const textLength, Char const character)
+	{
+		return CStringSearchKernels<Char>::Find(text, textLength, character);
+	}
+	GDAPI WideChar const* CStringSearch::Find(WideChar const* const text, SizeTp const textLength, WideChar const character)
+	{
+		return CStringSearchKernels<WideChar>::Find(text, textLength, character);
+	}
+
+	GDAPI Char const* CStringSearch::ReverseFind(Char const* const text, SizeTp const textLength, Char const character)
+	{
+		return CStringSearchKernels<Char>::ReverseFind(text, textLength, character);
+	}
+	GDAPI WideChar const* CStringSearch::ReverseFind(WideChar const* const text, SizeTp const textLength, WideChar const character)
+	{
+		return CStringSearchKernels<WideChar>::ReverseFind(text, textLength, character);
+	}
+
+	GDAPI Char const* CStringSearch::Find(Char const* const text, SizeTp const textLength, Char const* const subText, SizeTp const subTextLength)
+	{
+		return CStringSearchKernels<Char>::Find(text, textLength, subText, subTextLength);
+	}
+	GDAPI WideChar const* CStringSearch::Find(WideChar const* const text, SizeTp const textLength, WideChar const* const subText, SizeTp const subTextLength)
+	{
+		return CStringSearchKernels<WideChar>::Find(text, textLength, subText, subTextLength);
+	}
+
+	GDAPI Char const* CStringSearch::ReverseFind(Char const* const text, SizeTp const textLength, Char const* const subText, SizeTp const subTextLength)
+	{
+		return CStringSearchKernels<Char>::ReverseFind(text, textLength, subText, subTextLength);
+	}
+	GDAPI WideChar const* CStringSearch::ReverseFind(WideChar const* const text, SizeTp const textLength, WideChar const* const subText, SizeTp const subTextLength)
+	{
+		return CStringSearchKernels<WideChar>::ReverseFind(text, textLength, subText, subTextLength);
+	}
+
+	GDAPI Int32 CStringSearch::CompareIgnoreCase(Char const* const lhs, Char const* const rhs, SizeTp const length)
+	{
+		return CStringSearchKernels<Char>::CompareIgnoreCase(lhs, rhs, length);
+	}
+	GDAPI Int32 CStringSearch::CompareIgnoreCase(WideChar const* const lhs, WideChar const* const rhs, SizeTp const length)
+	{
+		return CStringSearchKernels<WideChar>::CompareIgnoreCase(lhs, rhs, length);
+	}
+
+GD_NAMESPACE_END
@@ -0,0 +1,120 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/CStdlib/CStringSearch.h
+ * Vectorized string search kernels.
+ */
+#pragma once
+
+#include <GoddamnEngine/Include.h>
+
+GD_NAMESPACE_BEGIN
+
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+	// ******                               CStringSearch class.                               ******
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+
+	// **------------------------------------------------------------------------------------------**
+	//! Search kernels for the character arrays with known lengths.
+	//! Kernels process 16 (SSE2 and NEON) or 32 (AVX2) bytes per iteration and fall back to the
+	//! scalar loops on other architectures. Substring search filters candidate positions by the
+	//! first and the last characters of the substring and compares the rest only for them.
+	// **------------------------------------------------------------------------------------------**
+	class CStringSearch final : public TNonCreatable
+	{
+	public:
+
+		/*!
+		 * Calculates length of the null-terminated string.
+		 * Reads aligned blocks, that may cross the terminator, but never the page boundary.
+		 *
+		 * @param text The null-terminated string.
+		 * @returns Number of characters before the terminator.
+		 */
+		//! @{
+		GDAPI static SizeTp Strlen(Char const* const text);
+		GDAPI static SizeTp Strlen(WideChar const* const text);
+		//! @}
+
+		/*!
+		 * Searches for first occurrence of the character.
+		 *
+		 * @param text Text to search in.
+		 * @param textLength Length of the text.
+		 * @param character Character we are looking for.
+		 *
+		 * @returns Pointer to the found character or null pointer if nothing was found.
+		 */
+		//! @{
+		GDAPI static Char const* Find(Char const* const text, SizeTp const textLength, Char const character);
+		GDAPI static WideChar const* Find(WideChar const* const text, SizeTp const textLength, WideChar const character);
+		//! @}
+
+		/*!
+		 * Searches for last occurrence of the character.
+		 *
+		 * @param text Text to search in.
+		 * @param textLength Length of the text.
+		 * @param character Character we are looking for.
+		 *
+		 * @returns Pointer to the found character or null pointer if nothing was found.
+		 */
+		//! @{
+		GDAPI static Char const* ReverseFind(Char const* const text, SizeTp const textLength, Char const character);
+		GDAPI static WideChar const* ReverseFind(WideChar const* const text, SizeTp const textLength, WideChar const character);
+		//! @}
+
+		/*!
+		 * Searches for first occurrence of the substring.
+		 *
+		 * @param text Text to search in.
+		 * @param textLength Length of the text.
+		 * @param subText Substring we are looking for.
+		 * @param subTextLength Length of the substring. Empty substring is found at the beginning of the text.
+		 *
+		 * @returns Pointer to the found substring or null pointer if nothing was found.
+		 */
+		//! @{
+		GDAPI static Char const* Find(Char const* const text, SizeTp const textLength, Char const* const subText, SizeTp const subTextLength);
+		GDAPI static WideChar const* Find(WideChar const* const text, SizeTp const textLength, WideChar const* const subText, SizeTp const subTextLength);
+		//! @}
+
+		/*!
+		 * Searches for last occurrence of the substring.
+		 *
+		 * @param text Text to search in.
+		 * @param textLength Length of the text.
+		 * @param subText Substring we are looking for.
+		 * @param subTextLength Length of the substring. Empty substring is found at the end of the text.
+		 *
+		 * @returns Pointer to the found substring or null pointer if nothing was found.
+		 */
+		//! @{
+		GDAPI static Char const* ReverseFind(Char const* const text, SizeTp const textLength, Char const* const subText, SizeTp const subTextLength);
+		GDAPI static WideChar const* ReverseFind(WideChar const* const text, SizeTp const textLength, WideChar const* const subText, SizeTp const subTextLength);
+		//! @}
+
+		/*!
+		 * Lexicographically compares two character arrays of the same length ignoring case.
+		 * Only ASCII letters are folded in the narrow strings, since they are encoded in UTF-8,
+		 * wide characters are folded with @c CChar::ToLower.
+		 *
+		 * @param lhs First character array.
+		 * @param rhs Second character array.
+		 * @param length Length of the both arrays.
+		 *
+		 * @returns Negative value if the first array is less, zero if they are equal and positive value otherwise.
+		 */
+		//! @{
+		GDAPI static Int32 CompareIgnoreCase(Char const* const lhs, Char const* const rhs, SizeTp const length);
+		GDAPI static Int32 CompareIgnoreCase(WideChar const* const lhs, WideChar const* const rhs, SizeTp const length);
+		//! @}
+	};	// class CStringSearch
+
+GD_NAMESPACE_END
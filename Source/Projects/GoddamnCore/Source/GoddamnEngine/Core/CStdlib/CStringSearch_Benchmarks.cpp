@@ -0,0 +1,145 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/CStdlib/CStringSearch_Benchmarks.cpp
+ * Vectorized string search kernels benchmarks against the C library.
+ */
+#include <GoddamnEngine/Core/CStdlib/CStringSearch.h>
+#include <GoddamnEngine/Core/CStdlib/CChar.h>
+#include <GoddamnEngine/Core/Containers/Vector.h>
+
+#include <cstring>
+#include <cwchar>
+
+GD_NAMESPACE_BEGIN
+
+#if GD_TESTING_ENABLED
+
+	SizeTp static const CStringSearchBenchmarkLength = 1024 * 1024;
+	SizeTp static const CStringSearchBenchmarkRepetitions = 16;
+
+	// Keeps results of the benchmarks, so that computations are not optimized away.
+	static UInt64 volatile g_CStringSearchBenchmarkSink;
+
+	// Generates null-terminated text of lowercase letters, which ends with the specified needle.
+	template<typename TChar>
+	GDINL static Vector<TChar> GenerateCStringSearchBenchmarkText(TChar const* const needle)
+	{
+		auto const needleLength = CStringSearch::Strlen(needle);
+		Vector<TChar> text(CStringSearchBenchmarkLength + 1);
+		UInt32 random = 1;
+		for (SizeTp cnt = 0; cnt < CStringSearchBenchmarkLength - needleLength; ++cnt)
+		{
+			random = random * 1664525 + 1013904223;
+			text[cnt] = static_cast<TChar>('a' + (random >> 16) % 26);
+		}
+		CMemory::Memcpy(text.GetData() + CStringSearchBenchmarkLength - needleLength, needle, needleLength * sizeof(TChar));
+		text[CStringSearchBenchmarkLength] = 0;
+		return text;
+	}
+
+	// Measures a case, that processes the whole benchmark text.
+	template<typename TFunc>
+	GDINL static void MeasureCStringSearch(goddamn_testing::benchmark_state& state, char const* const caseName, TFunc const& caseFunction)
+	{
+		state.measure(caseName, CStringSearchBenchmarkLength * CStringSearchBenchmarkRepetitions, [&]
+		{
+			for (SizeTp repetition = 0; repetition < CStringSearchBenchmarkRepetitions; ++repetition)
+			{
+				g_CStringSearchBenchmarkSink = g_CStringSearchBenchmarkSink + static_cast<UInt64>(caseFunction());
+			}
+		});
+	}
+
+	gd_testing_benchmark(CStringSearchStrlen, state)
+	{
+		auto const text = GenerateCStringSearchBenchmarkText("Z");
+		auto const wideText = GenerateCStringSearchBenchmarkText(L"Z");
+		MeasureCStringSearch(state, "strlen", [&] { return ::strlen(text.GetData()); });
+		MeasureCStringSearch(state, "CStringSearch::Strlen", [&] { return CStringSearch::Strlen(text.GetData()); });
+		MeasureCStringSearch(state, "wcslen", [&] { return ::wcslen(wideText.GetData()); });
+		MeasureCStringSearch(state, "CStringSearch::Strlen (wide)", [&] { return CStringSearch::Strlen(wideText.GetData()); });
+	};
+
+	gd_testing_benchmark(CStringSearchFindCharacter, state)
+	{
+		auto const text = GenerateCStringSearchBenchmarkText("Z");
+		auto const wideText = GenerateCStringSearchBenchmarkText(L"Z");
+		MeasureCStringSearch(state, "memchr", [&] { return reinterpret_cast<UIntPtr>(::memchr(text.GetData(), 'Z', CStringSearchBenchmarkLength)); });
+		MeasureCStringSearch(state, "CStringSearch::Find", [&] { return reinterpret_cast<UIntPtr>(CStringSearch::Find(text.GetData(), CStringSearchBenchmarkLength, 'Z')); });
+		MeasureCStringSearch(state, "wmemchr", [&] { return reinterpret_cast<UIntPtr>(::wmemchr(wideText.GetData(), L'Z', CStringSearchBenchmarkLength)); });
+		MeasureCStringSearch(state, "CStringSearch::Find (wide)", [&] { return reinterpret_cast<UIntPtr>(CStringSearch::Find(wideText.GetData(), CStringSearchBenchmarkLength, L'Z')); });
+	};
+
+	gd_testing_benchmark(CStringSearchReverseFindCharacter, state)
+	{
+		// Searched character is the first one, so that the whole text is scanned.
+		auto text = GenerateCStringSearchBenchmarkText("a");
+		auto wideText = GenerateCStringSearchBenchmarkText(L"a");
+		text[0] = 'Z';
+		wideText[0] = L'Z';
+		MeasureCStringSearch(state, "strrchr", [&] { return reinterpret_cast<UIntPtr>(::strrchr(text.GetData(), 'Z')); });
+		MeasureCStringSearch(state, "CStringSearch::ReverseFind", [&] { return reinterpret_cast<UIntPtr>(CStringSearch::ReverseFind(text.GetData(), CStringSearchBenchmarkLength, 'Z')); });
+		MeasureCStringSearch(state, "wcsrchr", [&] { return reinterpret_cast<UIntPtr>(::wcsrchr(wideText.GetData(), L'Z')); });
+		MeasureCStringSearch(state, "CStringSearch::ReverseFind (wide)", [&] { return reinterpret_cast<UIntPtr>(CStringSearch::ReverseFind(wideText.GetData(), CStringSearchBenchmarkLength, L'Z')); });
+	};
+
+	gd_testing_benchmark(CStringSearchFindSubstring, state)
+	{
+		// Typical path search: the needle shares the first characters with many positions of the text.
+		auto const text = GenerateCStringSearchBenchmarkText("/textures/stone.png");
+		auto const wideText = GenerateCStringSearchBenchmarkText(L"/textures/stone.png");
+		MeasureCStringSearch(state, "strstr", [&] { return reinterpret_cast<UIntPtr>(::strstr(text.GetData(), "/textures/stone.png")); });
+		MeasureCStringSearch(state, "CStringSearch::Find", [&] { return reinterpret_cast<UIntPtr>(CStringSearch::Find(text.GetData(), CStringSearchBenchmarkLength, "/textures/stone.png", 19)); });
+		MeasureCStringSearch(state, "wcsstr", [&] { return reinterpret_cast<UIntPtr>(::wcsstr(wideText.GetData(), L"/textures/stone.png")); });
+		MeasureCStringSearch(state, "CStringSearch::Find (wide)", [&] { return reinterpret_cast<UIntPtr>(CStringSearch::Find(wideText.GetData(), CStringSearchBenchmarkLength, L"/textures/stone.png", 19)); });
+	};
+
+	gd_testing_benchmark(CStringSearchReverseFindSubstring, state)
+	{
+		auto text = GenerateCStringSearchBenchmarkText("a");
+		CMemory::Memcpy(text.GetData(), "\"name\":", 7);
+		MeasureCStringSearch(state, "strstr loop", [&]
+		{
+			// Previous implementation of the 'CString::Strrstr'.
+			Char const* result = nullptr;
+			for (auto found = ::strstr(text.GetData(), "\"name\":"); found != nullptr; found = ::strstr(found + 1, "\"name\":"))
+			{
+				result = found;
+			}
+			return reinterpret_cast<UIntPtr>(result);
+		});
+		MeasureCStringSearch(state, "CStringSearch::ReverseFind", [&] { return reinterpret_cast<UIntPtr>(CStringSearch::ReverseFind(text.GetData(), CStringSearchBenchmarkLength, "\"name\":", 7)); });
+	};
+
+	gd_testing_benchmark(CStringSearchCompareIgnoreCase, state)
+	{
+		auto const lhs = GenerateCStringSearchBenchmarkText("a");
+		auto rhs = lhs;
+		for (SizeTp cnt = 0; cnt < CStringSearchBenchmarkLength; cnt += 3)
+		{
+			rhs[cnt] = CChar::ToUpper(rhs[cnt]);
+		}
+		MeasureCStringSearch(state, "CChar::ToLower loop", [&]
+		{
+			for (SizeTp cnt = 0; cnt < CStringSearchBenchmarkLength; ++cnt)
+			{
+				if (CChar::ToLower(lhs[cnt]) != CChar::ToLower(rhs[cnt]))
+				{
+					return cnt;
+				}
+			}
+			return CStringSearchBenchmarkLength;
+		});
+		MeasureCStringSearch(state, "CStringSearch::CompareIgnoreCase", [&] { return static_cast<SizeTp>(CStringSearch::CompareIgnoreCase(lhs.GetData(), rhs.GetData(), CStringSearchBenchmarkLength)); });
+	};
+
+#endif	// if GD_TESTING_ENABLED
+
+GD_NAMESPACE_END
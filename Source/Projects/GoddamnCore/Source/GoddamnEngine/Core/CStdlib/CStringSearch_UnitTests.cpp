@@ -0,0 +1,159 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/CStdlib/CStringSearch_UnitTests.cpp
+ * Vectorized string search kernels tests.
+ */
+#include <GoddamnEngine/Core/CStdlib/CStringSearch.h>
+#include <GoddamnEngine/Core/CStdlib/CMemory.h>
+#if GD_TESTING_ENABLED
+
+GD_NAMESPACE_BEGIN
+
+	SizeTp static const CStringSearchTestLength = 200;
+	SizeTp static const CStringSearchTestOffsets = 9;
+
+	// Fills the buffer with random characters from the small alphabet, so that partial matches are frequent.
+	template<typename TChar>
+	GDINL static void GenerateCStringSearchInput(TChar* const buffer, SizeTp const length, SizeTp const alphabetLength)
+	{
+		UInt32 random = 1;
+		for (SizeTp cnt = 0; cnt < length; ++cnt)
+		{
+			random = random * 1664525 + 1013904223;
+			buffer[cnt] = static_cast<TChar>('a' + (random >> 16) % alphabetLength);
+		}
+	}
+
+	// Naive reference implementation of the substring search.
+	template<typename TChar>
+	GDINL static SizeTp NaiveCStringSearch(TChar const* const text, SizeTp const textLength, TChar const* const subText, SizeTp const subTextLength, bool const reverse)
+	{
+		auto result = SizeTpMax;
+		for (SizeTp index = 0; index + subTextLength <= textLength; ++index)
+		{
+			SizeTp matched = 0;
+			while (matched < subTextLength && text[index + matched] == subText[matched])
+			{
+				++matched;
+			}
+			if (matched == subTextLength)
+			{
+				result = index;
+				if (!reverse)
+				{
+					break;
+				}
+			}
+		}
+		return result;
+	}
+
+	template<typename TChar>
+	GDINL static SizeTp CStringSearchIndex(TChar const* const text, TChar const* const found)
+	{
+		return found != nullptr ? static_cast<SizeTp>(found - text) : SizeTpMax;
+	}
+
+	gd_testing_unit_test_foreach(CStringSearchStrlen, T, Char, WideChar)
+	{
+		T buffer[CStringSearchTestLength + CStringSearchTestOffsets + 1];
+		GenerateCStringSearchInput(buffer, GD::GetLength(buffer), 4);
+		for (SizeTp offset = 0; offset < CStringSearchTestOffsets; ++offset)
+		{
+			for (SizeTp length = 0; length <= CStringSearchTestLength; ++length)
+			{
+				auto const terminated = buffer[offset + length];
+				buffer[offset + length] = 0;
+				gd_testing_verify(CStringSearch::Strlen(buffer + offset) == length);
+				buffer[offset + length] = terminated;
+			}
+		}
+	};
+
+	gd_testing_unit_test_foreach(CStringSearchFindCharacter, T, Char, WideChar)
+	{
+		T buffer[CStringSearchTestLength + CStringSearchTestOffsets];
+		GenerateCStringSearchInput(buffer, GD::GetLength(buffer), 24);
+		for (SizeTp offset = 0; offset < CStringSearchTestOffsets; ++offset)
+		{
+			auto const text = buffer + offset;
+			for (SizeTp length = 0; length <= CStringSearchTestLength; ++length)
+			{
+				for (auto character = static_cast<T>('a'); character <= static_cast<T>('z'); ++character)
+				{
+					gd_testing_verify(CStringSearchIndex(text, CStringSearch::Find(text, length, character)) == NaiveCStringSearch(text, length, &character, 1, false));
+					gd_testing_verify(CStringSearchIndex(text, CStringSearch::ReverseFind(text, length, character)) == NaiveCStringSearch(text, length, &character, 1, true));
+				}
+			}
+		}
+	};
+
+	gd_testing_unit_test_foreach(CStringSearchFindSubstring, T, Char, WideChar)
+	{
+		T buffer[CStringSearchTestLength + CStringSearchTestOffsets];
+		T subText[8];
+		GenerateCStringSearchInput(buffer, GD::GetLength(buffer), 2);
+		for (SizeTp offset = 0; offset < CStringSearchTestOffsets; ++offset)
+		{
+			auto const text = buffer + offset;
+			for (SizeTp length = 0; length <= CStringSearchTestLength; length += 7)
+			{
+				for (SizeTp subTextLength = 1; subTextLength <= GD::GetLength(subText); ++subTextLength)
+				{
+					// Substrings from the both ends of the buffer, that are sometimes contained in the text.
+					T const* const subTextSources[] = { buffer, buffer + GD::GetLength(buffer) - subTextLength };
+					for (auto const subTextSource : subTextSources)
+					{
+						CMemory::Memcpy(subText, subTextSource, subTextLength * sizeof(T));
+						gd_testing_verify(CStringSearchIndex(text, CStringSearch::Find(text, length, subText, subTextLength)) == NaiveCStringSearch(text, length, subText, subTextLength, false));
+						gd_testing_verify(CStringSearchIndex(text, CStringSearch::ReverseFind(text, length, subText, subTextLength)) == NaiveCStringSearch(text, length, subText, subTextLength, true));
+					}
+				}
+				gd_testing_verify(CStringSearch::Find(text, length, subText, 0) == text);
+				gd_testing_verify(CStringSearch::ReverseFind(text, length, subText, 0) == text + length);
+			}
+		}
+	};
+
+	gd_testing_unit_test_foreach(CStringSearchCompareIgnoreCase, T, Char, WideChar)
+	{
+		T lower[CStringSearchTestLength];
+		T upper[CStringSearchTestLength];
+		GenerateCStringSearchInput(lower, CStringSearchTestLength, 26);
+		for (SizeTp cnt = 0; cnt < CStringSearchTestLength; ++cnt)
+		{
+			upper[cnt] = cnt % 3 == 0 ? static_cast<T>(lower[cnt] - 'a' + 'A') : lower[cnt];
+		}
+		for (SizeTp length = 0; length <= CStringSearchTestLength; ++length)
+		{
+			gd_testing_verify(CStringSearch::CompareIgnoreCase(lower, upper, length) == 0);
+		}
+
+		// Characters next to the letters are not folded, e.g. '[' would become '{' otherwise.
+		for (SizeTp index = 0; index < CStringSearchTestLength; index += 13)
+		{
+			auto const lowerCharacter = lower[index];
+			auto const upperCharacter = upper[index];
+			lower[index] = static_cast<T>('{');
+			upper[index] = static_cast<T>('[');
+			gd_testing_verify(CStringSearch::CompareIgnoreCase(upper, lower, CStringSearchTestLength) < 0);
+			gd_testing_verify(CStringSearch::CompareIgnoreCase(lower, upper, CStringSearchTestLength) > 0);
+			gd_testing_verify(CStringSearch::CompareIgnoreCase(lower, upper, index) == 0);
+			lower[index] = static_cast<T>('`');
+			upper[index] = static_cast<T>('@');
+			gd_testing_verify(CStringSearch::CompareIgnoreCase(upper, lower, CStringSearchTestLength) < 0);
+			lower[index] = lowerCharacter;
+			upper[index] = upperCharacter;
+		}
+	};
+
+GD_NAMESPACE_END
+
+#endif	// if GD_TESTING_ENABLED
@@ -0,0 +1,465 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/CStdlib/CUnicode.cpp
+ * Validating UTF-8 transcoder.
+ */
+#include <GoddamnEngine/Core/CStdlib/CUnicode.h>
+
+#if (GD_ARCHITECTURE_X64 || GD_ARCHITECTURE_X86) && !GD_PLATFORM_HTML5
+#	define GD_CUNICODE_SSE2 GD_TRUE
+#	include <emmintrin.h>
+#else	// if (GD_ARCHITECTURE_X64 || GD_ARCHITECTURE_X86) && !GD_PLATFORM_HTML5
+#	define GD_CUNICODE_SSE2 GD_FALSE
+#endif	// if (GD_ARCHITECTURE_X64 || GD_ARCHITECTURE_X86) && !GD_PLATFORM_HTML5
+#if GD_ARCHITECTURE_ARM64
+#	define GD_CUNICODE_NEON GD_TRUE
+#	include <arm_neon.h>
+#else	// if GD_ARCHITECTURE_ARM64
+#	define GD_CUNICODE_NEON GD_FALSE
+#endif	// if GD_ARCHITECTURE_ARM64
+#define GD_CUNICODE_SIMD (GD_CUNICODE_SSE2 || GD_CUNICODE_NEON)
+
+#if GD_COMPILER_MSVC_COMPATIBLE
+#	include <intrin.h>
+#endif	// if GD_COMPILER_MSVC_COMPATIBLE
+
+GD_NAMESPACE_BEGIN
+
+	static_assert(sizeof(WideChar) == 2 || sizeof(WideChar) == 4, "Wide characters should be either UTF-16 or UTF-32.");
+
+#if GD_CUNICODE_SIMD
+
+	/*!
+	 * Returns index of the lowest set bit of the non-zero value.
+	 */
+	GDINL static SizeTp CUnicodeLowestBit(UInt64 const value)
+	{
+#if GD_COMPILER_MSVC_COMPATIBLE && (GD_ARCHITECTURE_X64 || GD_ARCHITECTURE_ARM64)
+		unsigned long index;
+		_BitScanForward64(&index, value);
+#elif GD_COMPILER_MSVC_COMPATIBLE
+		unsigned long index;
+		if (!_BitScanForward(&index, static_cast<unsigned long>(value)))
+		{
+			_BitScanForward(&index, static_cast<unsigned long>(value >> 32));
+			index += 32;
+		}
+#else	// if GD_COMPILER_MSVC_COMPATIBLE
+		auto const index = __builtin_ctzll(value);
+#endif	// if GD_COMPILER_MSVC_COMPATIBLE
+		return static_cast<SizeTp>(index);
+	}
+
+	// **------------------------------------------------------------------------------------------**
+	//! ASCII fast paths, that convert 16 characters at once.
+	//! All 16 characters are stored, but only the leading ASCII ones are valid, the rest are
+	//! overwritten by the scalar code later.
+	// **------------------------------------------------------------------------------------------**
+	struct CUnicodeVector final : public TNonCreatable
+	{
+	public:
+		SizeTp static const Width = 16;
+
+	private:
+		GDINL static SizeTp LeadingASCIILength(UInt64 const nonASCIIMask, SizeTp const maskBitsPerChar)
+		{
+			return nonASCIIMask == 0 ? Width : CUnicodeLowestBit(nonASCIIMask) / maskBitsPerChar;
+		}
+
+#if GD_CUNICODE_NEON
+		// Packs comparison results of 16 bytes into 64-bit mask with 4 bits per byte.
+		GDINL static UInt64 MoveMask(uint8x16_t const matches)
+		{
+			return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(matches), 4)), 0);
+		}
+#endif	// if GD_CUNICODE_NEON
+
+	public:
+
+		/*!
+		 * Widens 16 bytes to wide characters.
+		 * The destination buffer is not accessed, if the result is not stored.
+		 *
+		 * @returns Number of the leading ASCII characters.
+		 */
+		template<bool TStore>
+		GDINL static SizeTp DecodeASCII(WideChar* const dst, Char const* const src)
+		{
+#if GD_CUNICODE_SSE2
+			auto const bytes = _mm_loadu_si128(reinterpret_cast<__m128i const*>(src));
+			if (TStore)
+			{
+				auto const zero = _mm_setzero_si128();
+				auto const low = _mm_unpacklo_epi8(bytes, zero);
+				auto const high = _mm_unpackhi_epi8(bytes, zero);
+				auto const out = reinterpret_cast<__m128i*>(dst);
+				if (sizeof(WideChar) == 2)
+				{
+					_mm_storeu_si128(out + 0, low);
+					_mm_storeu_si128(out + 1, high);
+				}
+				else
+				{
+					_mm_storeu_si128(out + 0, _mm_unpacklo_epi16(low, zero));
+					_mm_storeu_si128(out + 1, _mm_unpackhi_epi16(low, zero));
+					_mm_storeu_si128(out + 2, _mm_unpacklo_epi16(high, zero));
+					_mm_storeu_si128(out + 3, _mm_unpackhi_epi16(high, zero));
+				}
+			}
+			return LeadingASCIILength(static_cast<UInt64>(_mm_movemask_epi8(bytes)), 1);
+#else	// if GD_CUNICODE_SSE2
+			auto const bytes = vld1q_u8(reinterpret_cast<UInt8 const*>(src));
+			if (TStore)
+			{
+				auto const low = vmovl_u8(vget_low_u8(bytes));
+				auto const high = vmovl_high_u8(bytes);
+				if (sizeof(WideChar) == 2)
+				{
+					auto const out = reinterpret_cast<UInt16*>(dst);
+					vst1q_u16(out + 0, low);
+					vst1q_u16(out + 8, high);
+				}
+				else
+				{
+					auto const out = reinterpret_cast<UInt32*>(dst);
+					vst1q_u32(out + 0, vmovl_u16(vget_low_u16(low)));
+					vst1q_u32(out + 4, vmovl_high_u16(low));
+					vst1q_u32(out + 8, vmovl_u16(vget_low_u16(high)));
+					vst1q_u32(out + 12, vmovl_high_u16(high));
+				}
+			}
+			return LeadingASCIILength(MoveMask(vcgeq_u8(bytes, vdupq_n_u8(0x80))), 4);
+#endif	// if GD_CUNICODE_SSE2
+		}
+
+		/*!
+		 * Narrows 16 wide characters to bytes.
+		 * The destination buffer is not accessed, if the result is not stored.
+		 *
+		 * @returns Number of the leading ASCII characters.
+		 */
+		template<bool TStore>
+		GDINL static SizeTp EncodeASCII(Char* const dst, WideChar const* const src)
+		{
+#if GD_CUNICODE_SSE2
+			auto const in = reinterpret_cast<__m128i const*>(src);
+			auto const zero = _mm_setzero_si128();
+			__m128i bytes;
+			UInt64 nonASCIIMask;
+			SizeTp maskBitsPerChar;
+			if (sizeof(WideChar) == 2)
+			{
+				auto const first = _mm_loadu_si128(in + 0);
+				auto const second = _mm_loadu_si128(in + 1);
+				auto const asciiMask = _mm_set1_epi16(static_cast<Int16>(~0x7F));
+				auto const firstASCII = static_cast<UInt64>(_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(first, asciiMask), zero)));
+				auto const secondASCII = static_cast<UInt64>(_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(second, asciiMask), zero)));
+				nonASCIIMask = ~(firstASCII | (secondASCII << 16)) & 0xFFFFFFFF;
+				maskBitsPerChar = 2;
+				bytes = _mm_packus_epi16(first, second);
+			}
+			else
+			{
+				auto const first = _mm_loadu_si128(in + 0);
+				auto const second = _mm_loadu_si128(in + 1);
+				auto const third = _mm_loadu_si128(in + 2);
+				auto const fourth = _mm_loadu_si128(in + 3);
+				auto const asciiMask = _mm_set1_epi32(~0x7F);
+				bytes = _mm_packus_epi16(_mm_packs_epi32(first, second), _mm_packs_epi32(third, fourth));
+				if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(_mm_or_si128(_mm_or_si128(first, second), _mm_or_si128(third, fourth)), asciiMask), zero)) == 0xFFFF)
+				{
+					if (TStore)
+					{
+						_mm_storeu_si128(reinterpret_cast<__m128i*>(dst), bytes);
+					}
+					return Width;
+				}
+				auto const firstASCII = static_cast<UInt64>(_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(first, asciiMask), zero)));
+				auto const secondASCII = static_cast<UInt64>(_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(second, asciiMask), zero)));
+				auto const thirdASCII = static_cast<UInt64>(_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(third, asciiMask), zero)));
+				auto const fourthASCII = static_cast<UInt64>(_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(fourth, asciiMask), zero)));
+				nonASCIIMask = ~(firstASCII | (secondASCII << 16) | (thirdASCII << 32) | (fourthASCII << 48));
+				maskBitsPerChar = 4;
+			}
+			if (TStore)
+			{
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst), bytes);
+			}
+			return LeadingASCIILength(nonASCIIMask, maskBitsPerChar);
+#else	// if GD_CUNICODE_SSE2
+			uint8x16_t bytes, nonASCII;
+			if (sizeof(WideChar) == 2)
+			{
+				auto const in = reinterpret_cast<UInt16 const*>(src);
+				auto const first = vld1q_u16(in + 0);
+				auto const second = vld1q_u16(in + 8);
+				auto const asciiLimit = vdupq_n_u16(0x80);
+				nonASCII = vcombine_u8(vmovn_u16(vcgeq_u16(first, asciiLimit)), vmovn_u16(vcgeq_u16(second, asciiLimit)));
+				bytes = vcombine_u8(vmovn_u16(first), vmovn_u16(second));
+			}
+			else
+			{
+				auto const in = reinterpret_cast<UInt32 const*>(src);
+				auto const first = vld1q_u32(in + 0);
+				auto const second = vld1q_u32(in + 4);
+				auto const third = vld1q_u32(in + 8);
+				auto const fourth = vld1q_u32(in + 12);
+				auto const asciiLimit = vdupq_n_u32(0x80);
+				auto const firstHalfNonASCII = vcombine_u16(vmovn_u32(vcgeq_u32(first, asciiLimit)), vmovn_u32(vcgeq_u32(second, asciiLimit)));
+				auto const secondHalfNonASCII = vcombine_u16(vmovn_u32(vcgeq_u32(third, asciiLimit)), vmovn_u32(vcgeq_u32(fourth, asciiLimit)));
+				nonASCII = vcombine_u8(vmovn_u16(firstHalfNonASCII), vmovn_u16(secondHalfNonASCII));
+				bytes = vcombine_u8(vmovn_u16(vcombine_u16(vmovn_u32(first), vmovn_u32(second))), vmovn_u16(vcombine_u16(vmovn_u32(third), vmovn_u32(fourth))));
+			}
+			if (TStore)
+			{
+				vst1q_u8(reinterpret_cast<UInt8*>(dst), bytes);
+			}
+			return LeadingASCIILength(MoveMask(nonASCII), 4);
+#endif	// if GD_CUNICODE_SSE2
+		}
+	};	// struct CUnicodeVector
+
+#endif	// if GD_CUNICODE_SIMD
+
+	/*!
+	 * Decodes a single non-ASCII UTF-8 sequence.
+	 *
+	 * @param bytes The sequence.
+	 * @param bytesLeft Number of the bytes left in the text.
+	 * @param codePoint Decoded code point.
+	 *
+	 * @returns Length of the sequence or zero if it is invalid.
+	 */
+	GDINL static SizeTp CUnicodeDecodeSequence(UInt8 const* const bytes, SizeTp const bytesLeft, UInt32& codePoint)
+	{
+		// Ranges of the second byte exclude overlong sequences, surrogates and code points above U+10FFFF.
+		auto const lead = bytes[0];
+		SizeTp length;
+		UInt8 secondMin = 0x80, secondMax = 0xBF;
+		if (lead >= 0xC2 && lead <= 0xDF)
+		{
+			length = 2;
+			codePoint = lead & 0x1F;
+		}
+		else if (lead >= 0xE0 && lead <= 0xEF)
+		{
+			length = 3;
+			codePoint = lead & 0x0F;
+			secondMin = lead == 0xE0 ? 0xA0 : 0x80;
+			secondMax = lead == 0xED ? 0x9F : 0xBF;
+		}
+		else if (lead >= 0xF0 && lead <= 0xF4)
+		{
+			length = 4;
+			codePoint = lead & 0x07;
+			secondMin = lead == 0xF0 ? 0x90 : 0x80;
+			secondMax = lead == 0xF4 ? 0x8F : 0xBF;
+		}
+		else
+		{
+			return 0;
+		}
+		if (length > bytesLeft || bytes[1] < secondMin || bytes[1] > secondMax)
+		{
+			return 0;
+		}
+		codePoint = (codePoint << 6) | (bytes[1] & 0x3F);
+		for (SizeTp cnt = 2; cnt < length; ++cnt)
+		{
+			if ((bytes[cnt] & 0xC0) != 0x80)
+			{
+				return 0;
+			}
+			codePoint = (codePoint << 6) | (bytes[cnt] & 0x3F);
+		}
+		return length;
+	}
+
+	/*!
+	 * Encodes or measures the wide-character text in UTF-8.
+	 * @tparam TStore Whether the result should be written to the destination buffer.
+	 */
+	template<bool TStore>
+	GDINL static CUnicodeResult CUnicodeEncodeUTF8(Char* const dst, SizeTp const dstLength, WideChar const* const src, SizeTp const srcLength)
+	{
+		GD_ASSERT(src != nullptr || srcLength == 0);
+		GD_ASSERT(!TStore || dst != nullptr || dstLength == 0);
+		SizeTp srcIndex = 0, dstIndex = 0;
+		while (srcIndex < srcLength)
+		{
+			auto codePoint = static_cast<UInt32>(src[srcIndex]);
+#if GD_CUNICODE_SIMD
+			if (codePoint < 0x80)
+			{
+				while (srcIndex + CUnicodeVector::Width <= srcLength && (!TStore || dstIndex + CUnicodeVector::Width <= dstLength))
+				{
+					auto const asciiLength = CUnicodeVector::EncodeASCII<TStore>(TStore ? dst + dstIndex : nullptr, src + srcIndex);
+					srcIndex += asciiLength;
+					dstIndex += asciiLength;
+					if (asciiLength != CUnicodeVector::Width)
+					{
+						break;
+					}
+				}
+				if (srcIndex == srcLength)
+				{
+					break;
+				}
+				codePoint = static_cast<UInt32>(src[srcIndex]);
+			}
+#endif	// if GD_CUNICODE_SIMD
+
+			SizeTp srcUnits = 1;
+			if (codePoint >= 0xD800 && codePoint <= 0xDFFF)
+			{
+				// Only a high surrogate followed by a low surrogate is valid, and only in UTF-16.
+				auto const lowSurrogate = sizeof(WideChar) == 2 && srcIndex + 1 < srcLength ? static_cast<UInt32>(src[srcIndex + 1]) : 0;
+				if (codePoint >= 0xDC00 || lowSurrogate < 0xDC00 || lowSurrogate > 0xDFFF)
+				{
+					return { dstIndex, srcIndex };
+				}
+				codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (lowSurrogate - 0xDC00);
+				srcUnits = 2;
+			}
+			else if (codePoint > 0x10FFFF)
+			{
+				return { dstIndex, srcIndex };
+			}
+
+			SizeTp const dstUnits = codePoint < 0x80 ? 1 : codePoint < 0x800 ? 2 : codePoint < 0x10000 ? 3 : 4;
+			if (TStore)
+			{
+				if (dstIndex + dstUnits > dstLength)
+				{
+					return { dstIndex, srcIndex };
+				}
+				auto const out = dst + dstIndex;
+				switch (dstUnits)
+				{
+					case 1:
+						out[0] = static_cast<Char>(codePoint);
+						break;
+					case 2:
+						out[0] = static_cast<Char>(0xC0 | (codePoint >> 6));
+						out[1] = static_cast<Char>(0x80 | (codePoint & 0x3F));
+						break;
+					case 3:
+						out[0] = static_cast<Char>(0xE0 | (codePoint >> 12));
+						out[1] = static_cast<Char>(0x80 | ((codePoint >> 6) & 0x3F));
+						out[2] = static_cast<Char>(0x80 | (codePoint & 0x3F));
+						break;
+					default:
+						out[0] = static_cast<Char>(0xF0 | (codePoint >> 18));
+						out[1] = static_cast<Char>(0x80 | ((codePoint >> 12) & 0x3F));
+						out[2] = static_cast<Char>(0x80 | ((codePoint >> 6) & 0x3F));
+						out[3] = static_cast<Char>(0x80 | (codePoint & 0x3F));
+						break;
+				}
+			}
+			srcIndex += srcUnits;
+			dstIndex += dstUnits;
+		}
+		return { dstIndex, SizeTpMax };
+	}
+
+	/*!
+	 * Decodes or measures the UTF-8 text in wide characters.
+	 * @tparam TStore Whether the result should be written to the destination buffer.
+	 */
+	template<bool TStore>
+	GDINL static CUnicodeResult CUnicodeDecodeUTF8(WideChar* const dst, SizeTp const dstLength, Char const* const src, SizeTp const srcLength)
+	{
+		GD_ASSERT(src != nullptr || srcLength == 0);
+		GD_ASSERT(!TStore || dst != nullptr || dstLength == 0);
+		auto const srcBytes = reinterpret_cast<UInt8 const*>(src);
+		SizeTp srcIndex = 0, dstIndex = 0;
+		while (srcIndex < srcLength)
+		{
+			UInt32 codePoint = srcBytes[srcIndex];
+#if GD_CUNICODE_SIMD
+			if (codePoint < 0x80)
+			{
+				while (srcIndex + CUnicodeVector::Width <= srcLength && (!TStore || dstIndex + CUnicodeVector::Width <= dstLength))
+				{
+					auto const asciiLength = CUnicodeVector::DecodeASCII<TStore>(TStore ? dst + dstIndex : nullptr, src + srcIndex);
+					srcIndex += asciiLength;
+					dstIndex += asciiLength;
+					if (asciiLength != CUnicodeVector::Width)
+					{
+						break;
+					}
+				}
+				if (srcIndex == srcLength)
+				{
+					break;
+				}
+				codePoint = srcBytes[srcIndex];
+			}
+#endif	// if GD_CUNICODE_SIMD
+
+			SizeTp srcUnits = 1;
+			if (codePoint >= 0x80)
+			{
+				srcUnits = CUnicodeDecodeSequence(srcBytes + srcIndex, srcLength - srcIndex, codePoint);
+				if (srcUnits == 0)
+				{
+					return { dstIndex, srcIndex };
+				}
+			}
+
+			// Code points outside of the basic plane take a surrogate pair in UTF-16.
+			SizeTp const dstUnits = sizeof(WideChar) == 2 && codePoint >= 0x10000 ? 2 : 1;
+			if (TStore)
+			{
+				if (dstIndex + dstUnits > dstLength)
+				{
+					return { dstIndex, srcIndex };
+				}
+				if (dstUnits == 1)
+				{
+					dst[dstIndex] = static_cast<WideChar>(codePoint);
+				}
+				else
+				{
+					dst[dstIndex + 0] = static_cast<WideChar>(0xD800 + ((codePoint - 0x10000) >> 10));
+					dst[dstIndex + 1] = static_cast<WideChar>(0xDC00 + ((codePoint - 0x10000) & 0x3FF));
+				}
+			}
+			srcIndex += srcUnits;
+			dstIndex += dstUnits;
+		}
+		return { dstIndex, SizeTpMax };
+	}
+
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+	// ******                                 CUnicode class.                                  ******
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+
+	GDAPI CUnicodeResult CUnicode::EncodeUTF8(Char* const dst, SizeTp const dstLength, WideChar const* const src, SizeTp const srcLength)
+	{
+		return CUnicodeEncodeUTF8<true>(dst, dstLength, src, srcLength);
+	}
+
+	GDAPI CUnicodeResult CUnicode::DecodeUTF8(WideChar* const dst, SizeTp const dstLength, Char const* const src, SizeTp const srcLength)
+	{
+		return CUnicodeDecodeUTF8<true>(dst, dstLength, src, srcLength);
+	}
+
+	GDAPI CUnicodeResult CUnicode::CalculateEncodedLength(WideChar const* const text, SizeTp const textLength)
+	{
+		return CUnicodeEncodeUTF8<false>(nullptr, 0, text, textLength);
+	}
+
+	GDAPI CUnicodeResult CUnicode::CalculateDecodedLength(Char const* const text, SizeTp const textLength)
+	{
+		return CUnicodeDecodeUTF8<false>(nullptr, 0, text, textLength);
+	}
+
+GD_NAMESPACE_END
@@ -0,0 +1,118 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/CStdlib/CUnicode.h
+ * Validating UTF-8 transcoder.
+ */
+#pragma once
+
+#include <GoddamnEngine/Include.h>
+
+GD_NAMESPACE_BEGIN
+
+	// **------------------------------------------------------------------------------------------**
+	//! Result of the text transcoding.
+	// **------------------------------------------------------------------------------------------**
+	struct CUnicodeResult final
+	{
+	public:
+		SizeTp Length;			//!< Number of the written (or required) destination code units.
+		SizeTp ErrorPosition;	//!< Index of the first source code unit, that was not converted, or SizeTpMax.
+
+	public:
+
+		/*!
+		 * Returns true if the whole source text was converted.
+		 */
+		GDINL bool Succeeded() const
+		{
+			return ErrorPosition == SizeTpMax;
+		}
+	};	// struct CUnicodeResult
+
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+	// ******                                 CUnicode class.                                  ******
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+
+	// **------------------------------------------------------------------------------------------**
+	//! Validating transcoder between UTF-8 and wide characters (UTF-32, or UTF-16 where the wide
+	//! character is 16 bits). ASCII runs are converted 16 characters per iteration with SSE2 or
+	//! NEON, other characters are decoded with scalar code. Overlong sequences, surrogates, code
+	//! points above U+10FFFF and truncated sequences are rejected.
+	// **------------------------------------------------------------------------------------------**
+	class CUnicode final : public TNonCreatable
+	{
+	public:
+
+		/*!
+		 * Returns maximum length of the wide-character text in UTF-8 in bytes.
+		 * @param textLength Length of the text in wide characters.
+		 */
+		GDINL static SizeTp GetMaxEncodedLength(SizeTp const textLength)
+		{
+			// Surrogate pairs take 4 bytes, other 16-bit characters take at most 3.
+			return textLength * (sizeof(WideChar) == 2 ? 3 : 4);
+		}
+
+		/*!
+		 * Returns maximum length of the UTF-8 text in wide characters.
+		 * @param textLength Length of the text in bytes.
+		 */
+		GDINL static SizeTp GetMaxDecodedLength(SizeTp const textLength)
+		{
+			// Each wide character (or surrogate pair) is encoded with at least one (or four) bytes.
+			return textLength;
+		}
+
+		/*!
+		 * Encodes the specified wide-character text in UTF-8.
+		 *
+		 * @param dst Destination buffer.
+		 * @param dstLength Length of the destination buffer. Conversion stops when the buffer is full.
+		 * @param src Text to encode.
+		 * @param srcLength Length of the specified text.
+		 *
+		 * @returns Number of the written bytes and position of the first invalid or unconverted character.
+		 */
+		GDAPI static CUnicodeResult EncodeUTF8(Char* const dst, SizeTp const dstLength, WideChar const* const src, SizeTp const srcLength);
+
+		/*!
+		 * Decodes the specified UTF-8 text to wide characters.
+		 *
+		 * @param dst Destination buffer.
+		 * @param dstLength Length of the destination buffer. Conversion stops when the buffer is full.
+		 * @param src Text to decode.
+		 * @param srcLength Length of the specified text in bytes.
+		 *
+		 * @returns Number of the written wide characters and position of the first invalid or unconverted byte.
+		 */
+		GDAPI static CUnicodeResult DecodeUTF8(WideChar* const dst, SizeTp const dstLength, Char const* const src, SizeTp const srcLength);
+
+		/*!
+		 * Validates the wide-character text and calculates its length in UTF-8.
+		 *
+		 * @param text Text for calculation.
+		 * @param textLength Length of the text.
+		 *
+		 * @returns Length of the text in UTF-8 in bytes and position of the first invalid character.
+		 */
+		GDAPI static CUnicodeResult CalculateEncodedLength(WideChar const* const text, SizeTp const textLength);
+
+		/*!
+		 * Validates the UTF-8 text and calculates its length in wide characters.
+		 *
+		 * @param text Text for calculation.
+		 * @param textLength Length of the text in bytes.
+		 *
+		 * @returns Length of the text in wide characters and position of the first invalid byte.
+		 */
+		GDAPI static CUnicodeResult CalculateDecodedLength(Char const* const text, SizeTp const textLength);
+	};	// class CUnicode
+
+GD_NAMESPACE_END
@@ -0,0 +1,146 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/CStdlib/CUnicode_Benchmarks.cpp
+ * Validating UTF-8 transcoder benchmarks against iconv.
+ */
+#include <GoddamnEngine/Core/CStdlib/CUnicode.h>
+#include <GoddamnEngine/Core/Containers/Vector.h>
+#include <GoddamnEngine/Core/Platform/PlatformEncoding.h>
+
+#if GD_PLATFORM_API_POSIX && !GD_PLATFORM_API_COCOA
+#	include <iconv.h>
+#endif	// if GD_PLATFORM_API_POSIX && !GD_PLATFORM_API_COCOA
+
+GD_NAMESPACE_BEGIN
+
+#if GD_TESTING_ENABLED
+
+	SizeTp static const CUnicodeBenchmarkLength = 64 * 1024;
+	SizeTp static const CUnicodeBenchmarkRepetitions = 16;
+	SizeTp static const CUnicodeBenchmarkPathLength = 64;
+
+	// Keeps results of the benchmarks, so that computations are not optimized away.
+	static UInt64 volatile g_CUnicodeBenchmarkSink;
+
+	// Generates path-like text, every n-th letter of which is Cyrillic, or ASCII-only text, if zero is specified.
+	GDINL static Vector<WideChar> GenerateCUnicodeBenchmarkText(SizeTp const length, SizeTp const cyrillicPeriod)
+	{
+		Vector<WideChar> text(length);
+		UInt32 random = 1;
+		for (SizeTp cnt = 0; cnt < length; ++cnt)
+		{
+			random = random * 1664525 + 1013904223;
+			auto const letter = (random >> 16) % 27;
+			if (letter == 26)
+			{
+				text[cnt] = L'/';
+			}
+			else
+			{
+				text[cnt] = static_cast<WideChar>(cyrillicPeriod != 0 && cnt % cyrillicPeriod == 0 ? 0x0430 + letter : 'a' + letter);
+			}
+		}
+		return text;
+	}
+
+	// Measures a case, that converts the whole benchmark text.
+	template<typename TFunc>
+	GDINL static void MeasureCUnicode(goddamn_testing::benchmark_state& state, char const* const caseName, TFunc const& caseFunction)
+	{
+		state.measure(caseName, CUnicodeBenchmarkLength * CUnicodeBenchmarkRepetitions, [&]
+		{
+			for (SizeTp repetition = 0; repetition < CUnicodeBenchmarkRepetitions; ++repetition)
+			{
+				g_CUnicodeBenchmarkSink = g_CUnicodeBenchmarkSink + static_cast<UInt64>(caseFunction());
+			}
+		});
+	}
+
+	gd_testing_benchmark(CUnicodeTranscode, state)
+	{
+		struct
+		{
+			char const* CaseNames[4];
+			SizeTp CyrillicPeriod;
+		} const textKinds[] = {
+			{ { "ASCII/CUnicode::EncodeUTF8", "ASCII/CUnicode::DecodeUTF8", "ASCII/iconv encode", "ASCII/iconv decode" }, 0 },
+			{ { "Mostly ASCII/CUnicode::EncodeUTF8", "Mostly ASCII/CUnicode::DecodeUTF8", "Mostly ASCII/iconv encode", "Mostly ASCII/iconv decode" }, 32 },
+			{ { "Cyrillic/CUnicode::EncodeUTF8", "Cyrillic/CUnicode::DecodeUTF8", "Cyrillic/iconv encode", "Cyrillic/iconv decode" }, 1 },
+		};
+		Vector<Char> encoded(CUnicode::GetMaxEncodedLength(CUnicodeBenchmarkLength));
+		Vector<WideChar> decoded(CUnicodeBenchmarkLength);
+		for (auto const& textKind : textKinds)
+		{
+			auto const text = GenerateCUnicodeBenchmarkText(CUnicodeBenchmarkLength, textKind.CyrillicPeriod);
+			auto const encodedLength = CUnicode::EncodeUTF8(encoded.GetData(), encoded.GetLength(), text.GetData(), text.GetLength()).Length;
+
+			MeasureCUnicode(state, textKind.CaseNames[0], [&]
+			{
+				return CUnicode::EncodeUTF8(encoded.GetData(), encoded.GetLength(), text.GetData(), text.GetLength()).Length;
+			});
+			MeasureCUnicode(state, textKind.CaseNames[1], [&]
+			{
+				return CUnicode::DecodeUTF8(decoded.GetData(), decoded.GetLength(), encoded.GetData(), encodedLength).Length;
+			});
+#if GD_PLATFORM_API_POSIX && !GD_PLATFORM_API_COCOA
+			auto const wideCharToUTF8 = iconv_open("UTF-8", "UTF-32LE");
+			auto const utf8ToWideChar = iconv_open("UTF-32LE", "UTF-8");
+			MeasureCUnicode(state, textKind.CaseNames[2], [&]
+			{
+				auto inBuffer = reinterpret_cast<char*>(const_cast<WideChar*>(text.GetData()));
+				auto inBufferBytesLeft = ::size_t(text.GetLength() * sizeof(WideChar));
+				auto outBuffer = encoded.GetData();
+				auto outBufferBytesLeft = ::size_t(encoded.GetLength());
+				iconv(wideCharToUTF8, &inBuffer, &inBufferBytesLeft, &outBuffer, &outBufferBytesLeft);
+				return outBufferBytesLeft;
+			});
+			MeasureCUnicode(state, textKind.CaseNames[3], [&]
+			{
+				auto inBuffer = encoded.GetData();
+				auto inBufferBytesLeft = ::size_t(encodedLength);
+				auto outBuffer = reinterpret_cast<char*>(decoded.GetData());
+				auto outBufferBytesLeft = ::size_t(decoded.GetLength() * sizeof(WideChar));
+				iconv(utf8ToWideChar, &inBuffer, &inBufferBytesLeft, &outBuffer, &outBufferBytesLeft);
+				return outBufferBytesLeft;
+			});
+			iconv_close(wideCharToUTF8);
+			iconv_close(utf8ToWideChar);
+#endif	// if GD_PLATFORM_API_POSIX && !GD_PLATFORM_API_COCOA
+		}
+	};
+
+	gd_testing_benchmark(CUnicodeStringConvPaths, state)
+	{
+		// Short paths, that are converted on each file system call.
+		auto const text = GenerateCUnicodeBenchmarkText(CUnicodeBenchmarkLength, 0);
+		auto const encoded = StringConv::EncodeUTF8(text.GetData(), text.GetLength());
+		MeasureCUnicode(state, "StringConv::EncodeUTF8", [&]
+		{
+			SizeTp encodedLength = 0;
+			for (SizeTp offset = 0; offset < CUnicodeBenchmarkLength; offset += CUnicodeBenchmarkPathLength)
+			{
+				encodedLength += StringConv::EncodeUTF8(text.GetData() + offset, CUnicodeBenchmarkPathLength).GetLength();
+			}
+			return encodedLength;
+		});
+		MeasureCUnicode(state, "StringConv::DecodeUTF8", [&]
+		{
+			SizeTp decodedLength = 0;
+			for (SizeTp offset = 0; offset < CUnicodeBenchmarkLength; offset += CUnicodeBenchmarkPathLength)
+			{
+				decodedLength += StringConv::DecodeUTF8(encoded.CStr() + offset, CUnicodeBenchmarkPathLength).GetLength();
+			}
+			return decodedLength;
+		});
+	};
+
+#endif	// if GD_TESTING_ENABLED
+
+GD_NAMESPACE_END
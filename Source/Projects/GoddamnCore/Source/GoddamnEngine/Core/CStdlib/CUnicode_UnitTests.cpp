@@ -0,0 +1,174 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/CStdlib/CUnicode_UnitTests.cpp
+ * Validating UTF-8 transcoder tests.
+ */
+#include <GoddamnEngine/Core/CStdlib/CUnicode.h>
+#include <GoddamnEngine/Core/CStdlib/CMemory.h>
+#include <GoddamnEngine/Core/CStdlib/CString.h>
+#if GD_TESTING_ENABLED
+
+GD_NAMESPACE_BEGIN
+
+	SizeTp static const CUnicodeTestLength = 1024;
+
+	// Code points on the boundaries of the UTF-8 sequence lengths.
+	UInt32 static const CUnicodeTestCodePoints[] = { 0x00, 0x41, 0x7F, 0x80, 0xE9, 0x7FF, 0x800, 0x4E2D, 0xD7FF, 0xE000, 0xFFFD, 0xFFFF, 0x10000, 0x1F600, 0x10FFFF };
+
+	// Appends the code point to the wide-character text, as a surrogate pair if needed.
+	GDINL static SizeTp AppendCUnicodeTestCodePoint(WideChar* const text, SizeTp const textLength, UInt32 const codePoint)
+	{
+		if (sizeof(WideChar) == 2 && codePoint >= 0x10000)
+		{
+			text[textLength + 0] = static_cast<WideChar>(0xD800 + ((codePoint - 0x10000) >> 10));
+			text[textLength + 1] = static_cast<WideChar>(0xDC00 + ((codePoint - 0x10000) & 0x3FF));
+			return textLength + 2;
+		}
+		text[textLength] = static_cast<WideChar>(codePoint);
+		return textLength + 1;
+	}
+
+	gd_testing_unit_test(CUnicodeKnownSequences)
+	{
+		WideChar wide[2];
+		Char encoded[4];
+		WideChar decoded[2];
+
+		// Two-byte, three-byte and four-byte sequences.
+		Char const* const sequences[] = { "\xC3\xA9", "\xE4\xB8\xAD", "\xF0\x9F\x98\x80" };
+		UInt32 const codePoints[] = { 0xE9, 0x4E2D, 0x1F600 };
+		for (SizeTp cnt = 0; cnt < GD::GetLength(sequences); ++cnt)
+		{
+			auto const sequenceLength = cnt + 2;
+			auto const wideLength = AppendCUnicodeTestCodePoint(wide, 0, codePoints[cnt]);
+
+			auto const encodeResult = CUnicode::EncodeUTF8(encoded, GD::GetLength(encoded), wide, wideLength);
+			gd_testing_verify(encodeResult.Succeeded() && encodeResult.Length == sequenceLength);
+			gd_testing_verify(CMemory::Memcmp(encoded, sequences[cnt], sequenceLength) == 0);
+
+			auto const decodeResult = CUnicode::DecodeUTF8(decoded, GD::GetLength(decoded), sequences[cnt], sequenceLength);
+			gd_testing_verify(decodeResult.Succeeded() && decodeResult.Length == wideLength);
+			gd_testing_verify(CMemory::Memcmp(decoded, wide, wideLength * sizeof(WideChar)) == 0);
+		}
+	};
+
+	gd_testing_unit_test(CUnicodeRoundTrip)
+	{
+		WideChar wide[CUnicodeTestLength];
+		Char encoded[CUnicodeTestLength * 4];
+		WideChar decoded[CUnicodeTestLength];
+
+		// Non-ASCII characters are placed after ASCII runs of all lengths, so that vectorized and scalar paths interleave.
+		for (SizeTp runLength = 0; runLength < 40; ++runLength)
+		{
+			SizeTp wideLength = 0;
+			for (auto const codePoint : CUnicodeTestCodePoints)
+			{
+				for (SizeTp cnt = 0; cnt < runLength; ++cnt)
+				{
+					wideLength = AppendCUnicodeTestCodePoint(wide, wideLength, 'a' + cnt % 26);
+				}
+				wideLength = AppendCUnicodeTestCodePoint(wide, wideLength, codePoint);
+			}
+			GD_ASSERT(wideLength <= CUnicodeTestLength);
+
+			auto const encodedLength = CUnicode::CalculateEncodedLength(wide, wideLength);
+			auto const encodeResult = CUnicode::EncodeUTF8(encoded, CUnicode::GetMaxEncodedLength(wideLength), wide, wideLength);
+			gd_testing_verify(encodeResult.Succeeded() && encodedLength.Succeeded());
+			gd_testing_verify(encodeResult.Length == encodedLength.Length);
+
+			auto const decodedLength = CUnicode::CalculateDecodedLength(encoded, encodeResult.Length);
+			auto const decodeResult = CUnicode::DecodeUTF8(decoded, CUnicode::GetMaxDecodedLength(encodeResult.Length), encoded, encodeResult.Length);
+			gd_testing_verify(decodeResult.Succeeded() && decodedLength.Succeeded());
+			gd_testing_verify(decodeResult.Length == wideLength && decodedLength.Length == wideLength);
+			gd_testing_verify(CMemory::Memcmp(decoded, wide, wideLength * sizeof(WideChar)) == 0);
+		}
+	};
+
+	gd_testing_unit_test(CUnicodeInvalidSequences)
+	{
+		// Overlong encodings, surrogates, code points above U+10FFFF, stray continuations and truncated sequences.
+		Char const* const sequences[] = {
+			"\xC0\x80", "\xC1\xBF", "\xE0\x80\x80", "\xE0\x9F\xBF", "\xF0\x8F\xBF\xBF", "\xED\xA0\x80", "\xED\xBF\xBF",
+			"\xF4\x90\x80\x80", "\xF5\x80\x80\x80", "\xFF", "\x80", "\xBF", "\xC3\x28", "\xE4\xB8\x28", "\xF0\x9F\x98\x28",
+		};
+		Char text[64];
+		WideChar decoded[64];
+		for (SizeTp prefixLength = 0; prefixLength < 34; prefixLength += 11)
+		{
+			CMemory::Memset(text, 'a', prefixLength);
+			for (auto const sequence : sequences)
+			{
+				auto const sequenceLength = CString::Strlen(sequence);
+				CMemory::Memcpy(text + prefixLength, sequence, sequenceLength);
+				CMemory::Memset(text + prefixLength + sequenceLength, 'b', 20);
+
+				auto const decodeResult = CUnicode::DecodeUTF8(decoded, GD::GetLength(decoded), text, prefixLength + sequenceLength + 20);
+				gd_testing_verify(!decodeResult.Succeeded() && decodeResult.ErrorPosition == prefixLength);
+				gd_testing_verify(decodeResult.Length == prefixLength);
+				gd_testing_verify(CUnicode::CalculateDecodedLength(text, prefixLength + sequenceLength + 20).ErrorPosition == prefixLength);
+			}
+
+			// Sequences, truncated by the end of the text.
+			CMemory::Memcpy(text + prefixLength, "\xF0\x9F\x98", 3);
+			for (SizeTp sequenceLength = 1; sequenceLength <= 3; ++sequenceLength)
+			{
+				gd_testing_verify(CUnicode::DecodeUTF8(decoded, GD::GetLength(decoded), text, prefixLength + sequenceLength).ErrorPosition == prefixLength);
+			}
+		}
+
+		// Unpaired surrogates and code points above U+10FFFF in the wide-character text.
+		WideChar wide[24];
+		Char encoded[96];
+		for (SizeTp cnt = 0; cnt < GD::GetLength(wide); ++cnt)
+		{
+			wide[cnt] = static_cast<WideChar>('a');
+		}
+		UInt32 const codePoints[] = { 0xD800, 0xDBFF, 0xDC00, 0xDFFF, sizeof(WideChar) == 2 ? 0xD800 : 0x110000 };
+		for (auto const codePoint : codePoints)
+		{
+			wide[17] = static_cast<WideChar>(codePoint);
+			auto const encodeResult = CUnicode::EncodeUTF8(encoded, GD::GetLength(encoded), wide, GD::GetLength(wide));
+			gd_testing_verify(!encodeResult.Succeeded() && encodeResult.ErrorPosition == 17 && encodeResult.Length == 17);
+			gd_testing_verify(CUnicode::CalculateEncodedLength(wide, GD::GetLength(wide)).ErrorPosition == 17);
+		}
+	};
+
+	gd_testing_unit_test(CUnicodeDestinationOverflow)
+	{
+		WideChar wide[40];
+		Char encoded[120];
+		WideChar decoded[40];
+		SizeTp wideLength = 0;
+		for (SizeTp cnt = 0; cnt < 30; ++cnt)
+		{
+			wideLength = AppendCUnicodeTestCodePoint(wide, wideLength, cnt % 3 == 0 ? 0x4E2D : 'a' + cnt);
+		}
+		auto const encodedLength = CUnicode::CalculateEncodedLength(wide, wideLength).Length;
+
+		// Conversion stops at the first character, that does not fit.
+		for (SizeTp dstLength = 0; dstLength < encodedLength; ++dstLength)
+		{
+			auto const encodeResult = CUnicode::EncodeUTF8(encoded, dstLength, wide, wideLength);
+			gd_testing_verify(!encodeResult.Succeeded() && encodeResult.Length <= dstLength && encodeResult.Length + 3 > dstLength);
+			gd_testing_verify(CUnicode::CalculateEncodedLength(wide, encodeResult.ErrorPosition).Length == encodeResult.Length);
+		}
+		CUnicode::EncodeUTF8(encoded, GD::GetLength(encoded), wide, wideLength);
+		for (SizeTp dstLength = 0; dstLength < wideLength; ++dstLength)
+		{
+			auto const decodeResult = CUnicode::DecodeUTF8(decoded, dstLength, encoded, encodedLength);
+			gd_testing_verify(!decodeResult.Succeeded() && decodeResult.Length == dstLength);
+			gd_testing_verify(CUnicode::CalculateDecodedLength(encoded, decodeResult.ErrorPosition).Length == dstLength);
+		}
+	};
+
+GD_NAMESPACE_END
+
+#endif	// if GD_TESTING_ENABLED
@@ -44,6 +44,13 @@ GD_NAMESPACE_BEGIN
 
 	GDINT void JobManager::InitManager()
 	{
+		static auto initialized = false;
+		if (initialized)
+		{
+			return;
+		}
+		initialized = true;
+
 		UInt32 const workerThreadsCount = 4;
 		GD_STUBBED(workerThreadsCount);
 
@@ -54,6 +61,15 @@ GD_NAMESPACE_BEGIN
 		}
 	}
 
+	/*!
+	 * Returns amount of the worker threads, that execute the jobs.
+	 */
+	GDAPI UInt32 JobManager::GetNumWorkerThreads()
+	{
+		InitManager();
+		return static_cast<UInt32>(g_WorkerThreads.GetLength());
+	}
+
 	// ------------------------------------------------------------------------------------------
 	// JobWorkerThread class.
 	// ------------------------------------------------------------------------------------------
@@ -92,15 +108,8 @@ GD_NAMESPACE_BEGIN
 	 */
 	GDAPI JobManager::ParallelJobList::ParallelJobList()
 	{
-		static auto initialized = false;
-		if (initialized)
-		{
-			return;
-		}
-
 		// Initializing the manager.
 		InitManager();
-		initialized = true;
 	}
 
 	/*!
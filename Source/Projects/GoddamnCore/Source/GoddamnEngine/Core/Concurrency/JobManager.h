@@ -33,13 +33,19 @@ GD_NAMESPACE_BEGIN
 			AtomicUInt32*	NumJobs;
 		};	// struct Job
 
+		/*!
+		 * Returns amount of the worker threads, that execute the jobs.
+		 */
+		GDAPI UInt32 GetNumWorkerThreads();
+
 		// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 		//! A container for jobs.
 		// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 		class ParallelJobList
 		{
 		private:
-			AtomicUInt32 m_NumJobs;
+			// Atomic operations require the pointer-size alignment.
+			alignas(Handle) AtomicUInt32 m_NumJobs;
 
 		public:
 			
@@ -0,0 +1,961 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/Containers/BTree/BTree.h
+ * B-tree data structure interface.
+ */
+#pragma once
+
+#include <GoddamnEngine/Include.h>
+#include <GoddamnEngine/Core/CStdlib/CMemory.h>
+#include <GoddamnEngine/Core/Templates/Utility.h>
+#include <GoddamnEngine/Core/Templates/Iterators.h>
+#include <GoddamnEngine/Core/Templates/Algorithm.h>
+
+GD_NAMESPACE_BEGIN
+
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+	// ******                                BTreeNode<T> class.                               ******
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+
+	//! Size of the elements part of the B-tree node in bytes. Four cache lines are used, so
+	//! searching inside a node touches few lines, while the tree stays shallow.
+	SizeTp static const BTreeNodeTargetSize = 4 * 64;
+
+	// **------------------------------------------------------------------------------------------**
+	//! Node of the B-tree. Leaf nodes contain elements only, internal nodes are additionally
+	//! followed by the array of the child pointers.
+	//! @warning Do not create/destroy instances of this class using default allocation operators. 
+	// **------------------------------------------------------------------------------------------**
+	template<typename TElement>
+	struct BTreeNode : public TNonCopyable
+	{
+	public:
+		SizeTp static const Capacity  = (BTreeNodeTargetSize - 2 * sizeof(Handle)) / sizeof(TElement) > 3 ? (BTreeNodeTargetSize - 2 * sizeof(Handle)) / sizeof(TElement) : 3;
+		SizeTp static const MinLength = (Capacity - 1) / 2;
+
+	public:
+		BTreeNode* m_Parent;
+		UInt16     m_Position;
+		UInt16     m_Length;
+		bool       m_IsLeaf;
+		alignas(TElement) Byte m_Elements[Capacity * sizeof(TElement)];
+
+	public:
+		GDINL explicit BTreeNode(bool const isLeaf)
+			: m_Parent(nullptr), m_Position(0), m_Length(0), m_IsLeaf(isLeaf)
+		{
+		}
+
+		/*!
+		 * Returns pointer to the elements of this node.
+		 */
+		//! @{
+		GDINL TElement const* GetElements() const
+		{
+			return reinterpret_cast<TElement const*>(m_Elements);
+		}
+		GDINL TElement* GetElements()
+		{
+			return reinterpret_cast<TElement*>(m_Elements);
+		}
+		//! @}
+
+		/*!
+		 * Returns pointer to the children of this internal node.
+		 */
+		//! @{
+		GDINL BTreeNode* const* GetChildren() const;
+		GDINL BTreeNode** GetChildren()
+		{
+			return const_cast<BTreeNode**>(const_cast<BTreeNode const*>(this)->GetChildren());
+		}
+		//! @}
+
+		/*!
+		 * Sets child of this internal node at the specified position.
+		 */
+		GDINL void SetChild(SizeTp const position, BTreeNode* const child)
+		{
+			GetChildren()[position] = child;
+			child->m_Parent = this;
+			child->m_Position = static_cast<UInt16>(position);
+		}
+
+		/*!
+		 * Updates parent links of the children of this internal node in the specified range.
+		 */
+		GDINL void UpdateChildren(SizeTp const startPosition, SizeTp const endPosition)
+		{
+			for (auto position = startPosition; position < endPosition; ++position)
+			{
+				SetChild(position, GetChildren()[position]);
+			}
+		}
+	};	// struct BTreeNode
+
+	template<typename TElement>
+	struct BTreeInternalNode final : public BTreeNode<TElement>
+	{
+	public:
+		BTreeNode<TElement>* m_Children[BTreeNode<TElement>::Capacity + 1];
+
+	public:
+		GDINL BTreeInternalNode()
+			: BTreeNode<TElement>(false)
+		{
+		}
+	};	// struct BTreeInternalNode
+
+	template<typename TElement>
+	GDINL BTreeNode<TElement>* const* BTreeNode<TElement>::GetChildren() const
+	{
+		GD_ASSERT(!m_IsLeaf, "Leaf nodes do not have children.");
+		return static_cast<BTreeInternalNode<TElement> const*>(this)->m_Children;
+	}
+
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+	// ******                                  BTree<T> class.                                 ******
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+
+	// **------------------------------------------------------------------------------------------**
+	//! Key selector for the trees, whose elements are keys themselves.
+	// **------------------------------------------------------------------------------------------**
+	template<typename TElement>
+	struct BTreeIdentityKeySelector final : public TNonCreatable
+	{
+	public:
+		GDINL static TElement const& GetKey(TElement const& element)
+		{
+			return element;
+		}
+	};	// struct BTreeIdentityKeySelector
+
+	// **------------------------------------------------------------------------------------------**
+	//! Iterator for B-tree-based containers. End Iterator is also the one before the first element.
+	//! @tparam TTreeContainer Type of container.
+	// **------------------------------------------------------------------------------------------**
+	template<typename TTreeContainer>
+	struct BTreeIterator final
+	{
+	public:
+		using ContainerType = TTreeContainer;
+		using ElementType   = Conditional<TypeTraits::IsConst<ContainerType>::Value, typename ContainerType::ElementType const, typename ContainerType::ElementType>;
+		using NodeType      = Conditional<TypeTraits::IsConst<ContainerType>::Value, typename ContainerType::NodeType const, typename ContainerType::NodeType>;
+
+	private:
+		ContainerType& m_Container;
+		NodeType*      m_Node;
+		SizeTp         m_Index;
+
+	public:
+
+		/*!
+		 * Initializes Iterator that points on the specified element of the tree.
+		 *
+		 * @param container The container that is going to be iterated.
+		 * @param node Node of the start element or null pointer for the End Iterator.
+		 * @param index Index of the start element inside the node.
+		 */
+		GDINL BTreeIterator(ContainerType& container, NodeType* const node, SizeTp const index = 0)
+			: m_Container(container), m_Node(node), m_Index(index)
+		{
+		}
+
+	public:
+
+		/*!
+		 * Returns node associated with this Iterator.
+		 */
+		GDINL NodeType* GetNode() const
+		{
+			return m_Node;
+		}
+
+		/*!
+		 * Returns index of the element inside the node associated with this Iterator.
+		 */
+		GDINL SizeTp GetIndex() const
+		{
+			return m_Index;
+		}
+
+		// ------------------------------------------------------------------------------------------
+		// Overloaded operators.
+		// ------------------------------------------------------------------------------------------
+
+		GDINL BTreeIterator& operator= (BTreeIterator const& other)
+		{
+			GD_ASSERT(&m_Container == &other.m_Container, "Iterators have different base containers.");
+			m_Node = other.m_Node;
+			m_Index = other.m_Index;
+			return *this;
+		}
+
+		// iterator++
+		GDINL BTreeIterator& operator++ ()
+		{
+			GD_ASSERT(m_Node != nullptr, "Iterator is out of range.");
+			if (!m_Node->m_IsLeaf)
+			{
+				// Next element is the leftmost one in the right subtree.
+				m_Node = m_Node->GetChildren()[m_Index + 1];
+				while (!m_Node->m_IsLeaf)
+				{
+					m_Node = m_Node->GetChildren()[0];
+				}
+				m_Index = 0;
+				return *this;
+			}
+			++m_Index;
+			while (m_Index == m_Node->m_Length)
+			{
+				if (m_Node->m_Parent == nullptr)
+				{
+					m_Node = nullptr;
+					m_Index = 0;
+					break;
+				}
+				m_Index = m_Node->m_Position;
+				m_Node = m_Node->m_Parent;
+			}
+			return *this;
+		}
+		GDINL BTreeIterator operator++ (int const unused)
+		{
+			GD_NOT_USED(unused);
+			auto copy(*this);
+			++(*this);
+			return copy;
+		}
+
+		// iterator--
+		GDINL BTreeIterator& operator-- ()
+		{
+			if (m_Node == nullptr)
+			{
+				GD_ASSERT(!m_Container.IsEmpty(), "Iterator is out of range.");
+				m_Node = m_Container.m_Root;
+				m_Index = m_Node->m_Length;
+			}
+			if (!m_Node->m_IsLeaf)
+			{
+				// Previous element is the rightmost one in the left subtree.
+				m_Node = m_Node->GetChildren()[m_Index];
+				while (!m_Node->m_IsLeaf)
+				{
+					m_Node = m_Node->GetChildren()[m_Node->m_Length];
+				}
+				m_Index = m_Node->m_Length - 1;
+				return *this;
+			}
+			while (m_Index == 0)
+			{
+				if (m_Node->m_Parent == nullptr)
+				{
+					m_Node = nullptr;
+					return *this;
+				}
+				m_Index = m_Node->m_Position;
+				m_Node = m_Node->m_Parent;
+			}
+			--m_Index;
+			return *this;
+		}
+		GDINL BTreeIterator operator-- (int const unused)
+		{
+			GD_NOT_USED(unused);
+			auto copy(*this);
+			--(*this);
+			return copy;
+		}
+
+		// iterator + ptrdiff_t
+		GDINL BTreeIterator& operator+= (PtrDiffTp const offset)
+		{
+			if (offset > 0)
+			{
+				for (PtrDiffTp cnt = 0; cnt < offset; ++cnt)
+				{
+					++(*this);
+				}
+			}
+			else
+			{
+				for (PtrDiffTp cnt = 0; cnt < -offset; ++cnt)
+				{
+					--(*this);
+				}
+			}
+			return *this;
+		}
+		GDINL BTreeIterator operator+ (PtrDiffTp const offset) const
+		{
+			auto copy(*this);
+			return copy += offset;
+		}
+
+		// iterator - ptrdiff_t
+		GDINL BTreeIterator& operator-= (PtrDiffTp const offset)
+		{
+			return *this += -offset;
+		}
+		GDINL BTreeIterator operator- (PtrDiffTp const offset) const
+		{
+			auto copy(*this);
+			return copy -= offset;
+		}
+
+		// iterator == iterator
+		GDINL bool operator== (BTreeIterator const& other) const
+		{
+			return (&m_Container == &other.m_Container) && (m_Node == other.m_Node) && (m_Index == other.m_Index);
+		}
+		GDINL bool operator!= (BTreeIterator const& other) const
+		{
+			return !(*this == other);
+		}
+
+		// *iterator
+		GDINL ElementType& operator* () const
+		{
+			GD_ASSERT(m_Node != nullptr && m_Index < m_Node->m_Length, "Iterator is out of range.");
+			return m_Node->GetElements()[m_Index];
+		}
+		GDINL ElementType* operator-> () const
+		{
+			return &**this;
+		}
+
+	};	// struct BTreeIterator
+
+	// **------------------------------------------------------------------------------------------**
+	//! Templated B-tree. Each node stores a sorted array of elements that fits a few cache lines,
+	//! so both lookups and ordered iteration touch much less memory than binary trees do.
+	//! Inserting and erasing elements invalidates iterators and pointers to other elements.
+	//!
+	//! @tparam TKey Type of the key, used for searching.
+	//! @tparam TElement Type of the elements stored in the tree.
+	//! @tparam TKeySelector Type, that extracts keys from the elements.
+	//! @tparam TAllocator Allocator used by this tree.
+	// **------------------------------------------------------------------------------------------**
+	template<typename TKey, typename TElement, typename TKeySelector, typename TAllocator = DefaultContainerAllocator>
+	class BTree : public TNonCopyable, public TAllocator
+	{
+		template<typename>
+		friend struct BTreeIterator;
+
+	public:
+		using KeyType              = TKey;
+		using ElementType          = TElement;
+		using NodeType             = BTreeNode<TElement>;
+		using InternalNodeType     = BTreeInternalNode<TElement>;
+		using Iterator             = BTreeIterator<BTree>;
+		using ConstIterator        = BTreeIterator<BTree const>;
+		using ReverseIterator      = ReverseContainerIterator<Iterator>;
+		using ReverseConstIterator = ReverseContainerIterator<ConstIterator>;
+
+		GD_CONTAINER_DEFINE_ITERATION_SUPPORT(BTree)
+
+	private:
+		NodeType* m_Root   = nullptr;
+		SizeTp    m_Length = 0;
+
+	protected:
+
+		// ------------------------------------------------------------------------------------------
+		// Constructor and destructor.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Initializes an empty B-tree.
+		 */
+		GDINL BTree() = default;
+
+		/*!
+		 * Moves other B-tree here.
+		 * @param other The other tree to move here.
+		 */
+		GDINL BTree(BTree&& other) noexcept
+		{
+			Swap(other);
+		}
+
+		GDINL ~BTree()
+		{
+			Clear();
+		}
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Tree iteration.
+		// ------------------------------------------------------------------------------------------
+
+		GDINL Iterator Begin()
+		{
+			return Iterator(*this, GetFirstLeaf());
+		}
+		GDINL ConstIterator Begin() const
+		{
+			return ConstIterator(*this, GetFirstLeaf());
+		}
+
+		GDINL Iterator End()
+		{
+			return Iterator(*this, nullptr);
+		}
+		GDINL ConstIterator End() const
+		{
+			return ConstIterator(*this, nullptr);
+		}
+
+		GDINL ReverseIterator ReverseBegin()
+		{
+			return !IsEmpty() ? ReverseIterator(End() - 1) : ReverseEnd();
+		}
+		GDINL ReverseConstIterator ReverseBegin() const
+		{
+			return !IsEmpty() ? ReverseConstIterator(End() - 1) : ReverseEnd();
+		}
+
+		GDINL ReverseIterator ReverseEnd()
+		{
+			return ReverseIterator(End());
+		}
+		GDINL ReverseConstIterator ReverseEnd() const
+		{
+			return ReverseConstIterator(End());
+		}
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Dynamic size management.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Returns number of elements that exist in the tree.
+		 */
+		GDINL SizeTp GetLength() const
+		{
+			return m_Length;
+		}
+
+		/*!
+		 * Returns true if this tree is empty.
+		 */
+		GDINL bool IsEmpty() const
+		{
+			return m_Length == 0;
+		}
+
+		/*!
+		 * Removes all elements from the tree.
+		 */
+		GDINL void Clear()
+		{
+			if (m_Root != nullptr)
+			{
+				DestroySubtree(m_Root);
+				m_Root = nullptr;
+				m_Length = 0;
+			}
+		}
+
+		/*!
+		 * Swaps two trees.
+		 * @param other The other tree to swap with.
+		 */
+		GDINL void Swap(BTree& other)
+		{
+			GD::Swap(m_Root, other.m_Root);
+			GD::Swap(m_Length, other.m_Length);
+		}
+
+	protected:
+
+		// ------------------------------------------------------------------------------------------
+		// Tree manipulation.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Searches for the element with the specified key.
+		 *
+		 * @param key The key of the element we are looking for.
+		 * @param index Output for the index of the element inside the found node.
+		 *
+		 * @returns Node that contains the element or null pointer if nothing was found.
+		 */
+		template<typename TLookupKey>
+		GDINL NodeType const* FindNode(TLookupKey const& key, SizeTp& index) const
+		{
+			for (auto node = m_Root; node != nullptr; node = node->GetChildren()[index])
+			{
+				index = LowerBound(node, key);
+				if (index < node->m_Length && !(key < TKeySelector::GetKey(node->GetElements()[index])))
+				{
+					return node;
+				}
+				if (node->m_IsLeaf)
+				{
+					break;
+				}
+			}
+			index = 0;
+			return nullptr;
+		}
+		template<typename TLookupKey>
+		GDINL NodeType* FindNode(TLookupKey const& key, SizeTp& index)
+		{
+			return const_cast<NodeType*>(const_cast<BTree const*>(this)->FindNode(key, index));
+		}
+
+		/*!
+		 * Inserts a new element with the specified key, that does not exist in the tree.
+		 *
+		 * @param key The key of the new element.
+		 * @param arguments Arguments of the element constructor.
+		 *
+		 * @returns Reference to the inserted element.
+		 */
+		template<typename TLookupKey, typename... TArguments>
+		GDINL TElement& InsertElement(TLookupKey const& key, TArguments&&... arguments)
+		{
+			if (m_Root == nullptr)
+			{
+				m_Root = CreateNode(true);
+			}
+
+			auto node = m_Root;
+			auto index = LowerBound(node, key);
+			while (!node->m_IsLeaf)
+			{
+				node = node->GetChildren()[index];
+				index = LowerBound(node, key);
+			}
+			if (node->m_Length == NodeType::Capacity)
+			{
+				// Median is pushed to the parent before inserting, so that it is not overwritten.
+				auto const rightNode = SplitNode(node);
+				InsertIntoParent(node, rightNode);
+				if (index > node->m_Length)
+				{
+					index -= node->m_Length + 1;
+					node = rightNode;
+				}
+			}
+
+			auto const elements = node->GetElements();
+			Algo::RelocateRange(elements + index, elements + node->m_Length, elements + index + 1);
+			new (elements + index) TElement(Utils::Forward<TArguments>(arguments)...);
+			++node->m_Length;
+			++m_Length;
+			return elements[index];
+		}
+
+		/*!
+		 * Appends a new element, whose key is greater than the keys of all existing elements.
+		 * Nodes are filled completely, so the right spine of the tree should be repaired with
+		 * 'RepairAppendedTree' after appending all elements.
+		 *
+		 * @param arguments Arguments of the element constructor.
+		 * @returns Reference to the appended element.
+		 */
+		template<typename... TArguments>
+		GDINL TElement& AppendElement(TArguments&&... arguments)
+		{
+			if (m_Root == nullptr)
+			{
+				m_Root = CreateNode(true);
+			}
+
+			auto const leaf = GetLastLeaf();
+			if (leaf->m_Length < NodeType::Capacity)
+			{
+				auto const element = new (leaf->GetElements() + leaf->m_Length) TElement(Utils::Forward<TArguments>(arguments)...);
+				++leaf->m_Length;
+				++m_Length;
+				return *element;
+			}
+
+			// Element becomes a separator in the lowest non-full ancestor and is followed by a new
+			// chain of the empty nodes down to the leaf level.
+			SizeTp depth = 0;
+			auto fullNode = leaf;
+			while (fullNode->m_Parent != nullptr && fullNode->m_Parent->m_Length == NodeType::Capacity)
+			{
+				fullNode = fullNode->m_Parent;
+				++depth;
+			}
+			auto hostNode = fullNode->m_Parent;
+			if (hostNode == nullptr)
+			{
+				hostNode = CreateNode(false);
+				hostNode->SetChild(0, fullNode);
+				m_Root = hostNode;
+			}
+			auto const element = new (hostNode->GetElements() + hostNode->m_Length) TElement(Utils::Forward<TArguments>(arguments)...);
+			++hostNode->m_Length;
+			++m_Length;
+
+			auto parentNode = hostNode;
+			auto position = static_cast<SizeTp>(hostNode->m_Length);
+			for (; depth > 0; --depth)
+			{
+				auto const chainNode = CreateNode(false);
+				parentNode->SetChild(position, chainNode);
+				parentNode = chainNode;
+				position = 0;
+			}
+			parentNode->SetChild(position, CreateNode(true));
+			return *element;
+		}
+
+		/*!
+		 * Restores minimal occupancy of the right spine nodes after appending elements into the
+		 * empty tree. Elements are moved from the left siblings, which are completely full.
+		 */
+		GDINL void RepairAppendedTree()
+		{
+			if (m_Root == nullptr || m_Root->m_IsLeaf)
+			{
+				return;
+			}
+			for (auto node = m_Root->GetChildren()[m_Root->m_Length];; node = node->GetChildren()[node->m_Length])
+			{
+				if (node->m_Length < NodeType::MinLength)
+				{
+					auto const parentNode = node->m_Parent;
+					auto const leftNode = parentNode->GetChildren()[node->m_Position - 1];
+					MoveToRightSibling(parentNode, node->m_Position - 1, (leftNode->m_Length - node->m_Length) / 2);
+				}
+				if (node->m_IsLeaf)
+				{
+					break;
+				}
+			}
+		}
+
+		/*!
+		 * Removes the element, pointed by the specified iterator.
+		 *
+		 * @param node Node of the element.
+		 * @param index Index of the element inside the node.
+		 */
+		GDINL void EraseElement(NodeType* node, SizeTp const index)
+		{
+			auto const elements = node->GetElements();
+			Algo::DeinitializeIterator(elements + index);
+			if (!node->m_IsLeaf)
+			{
+				// Element is replaced with its predecessor, that is always stored in the leaf.
+				auto leaf = node->GetChildren()[index];
+				while (!leaf->m_IsLeaf)
+				{
+					leaf = leaf->GetChildren()[leaf->m_Length];
+				}
+				auto const leafElements = leaf->GetElements();
+				Algo::RelocateRange(leafElements + leaf->m_Length - 1, leafElements + leaf->m_Length, elements + index);
+				node = leaf;
+			}
+			else
+			{
+				Algo::RelocateRange(elements + index + 1, elements + node->m_Length, elements + index);
+			}
+			--node->m_Length;
+			--m_Length;
+			Rebalance(node);
+		}
+
+	private:
+
+		/*!
+		 * Returns index of the first element in the node, whose key is not less than specified.
+		 */
+		template<typename TLookupKey>
+		GDINL static SizeTp LowerBound(NodeType const* const node, TLookupKey const& key)
+		{
+			auto const elements = node->GetElements();
+			return Algo::LowerBound(elements, elements + node->m_Length, key, [](TElement const& element, TLookupKey const& lookupKey)
+			{
+				return TKeySelector::GetKey(element) < lookupKey;
+			}) - elements;
+		}
+
+		GDINL NodeType* GetFirstLeaf() const
+		{
+			auto node = m_Root;
+			if (node != nullptr)
+			{
+				while (!node->m_IsLeaf)
+				{
+					node = node->GetChildren()[0];
+				}
+			}
+			return node;
+		}
+
+		GDINL NodeType* GetLastLeaf() const
+		{
+			auto node = m_Root;
+			if (node != nullptr)
+			{
+				while (!node->m_IsLeaf)
+				{
+					node = node->GetChildren()[node->m_Length];
+				}
+			}
+			return node;
+		}
+
+		GDINL static NodeType* CreateNode(bool const isLeaf)
+		{
+			if (isLeaf)
+			{
+				return new (GD_MALLOC(sizeof(NodeType))) NodeType(true);
+			}
+			return new (GD_MALLOC(sizeof(InternalNodeType))) InternalNodeType();
+		}
+
+		GDINL static void DestroySubtree(NodeType* const node)
+		{
+			if (!TypeTraits::IsPOD<TElement>::Value)
+			{
+				for (SizeTp index = 0; index < node->m_Length; ++index)
+				{
+					Algo::DeinitializeIterator(node->GetElements() + index);
+				}
+			}
+			if (!node->m_IsLeaf)
+			{
+				for (SizeTp position = 0; position <= node->m_Length; ++position)
+				{
+					DestroySubtree(node->GetChildren()[position]);
+				}
+			}
+			GD_FREE(node);
+		}
+
+		/*!
+		 * Moves the upper half of the full node into the new right sibling. The median element is
+		 * left right after the last element of the node and should be moved to the parent.
+		 *
+		 * @returns The new right sibling.
+		 */
+		GDINT NodeType* SplitNode(NodeType* const node)
+		{
+			SizeTp static const medianIndex = NodeType::Capacity / 2;
+
+			auto const rightNode = CreateNode(node->m_IsLeaf);
+			auto const elements = node->GetElements();
+			Algo::RelocateRange(elements + medianIndex + 1, elements + NodeType::Capacity, rightNode->GetElements());
+			if (!node->m_IsLeaf)
+			{
+				CMemory::Memcpy(rightNode->GetChildren(), node->GetChildren() + medianIndex + 1, (NodeType::Capacity - medianIndex) * sizeof(NodeType*));
+				rightNode->UpdateChildren(0, NodeType::Capacity - medianIndex);
+			}
+			rightNode->m_Length = static_cast<UInt16>(NodeType::Capacity - medianIndex - 1);
+			node->m_Length = static_cast<UInt16>(medianIndex);
+			return rightNode;
+		}
+
+		/*!
+		 * Moves median element, left by the split, into the parent of the node and inserts the new
+		 * right sibling after the node. Parent is split recursively, if it is full.
+		 */
+		GDINT void InsertIntoParent(NodeType* const node, NodeType* const rightNode)
+		{
+			auto parentNode = node->m_Parent;
+			if (parentNode == nullptr)
+			{
+				parentNode = CreateNode(false);
+				parentNode->SetChild(0, node);
+				m_Root = parentNode;
+			}
+			else if (parentNode->m_Length == NodeType::Capacity)
+			{
+				// Splitting parent updates the parent link of the node.
+				auto const parentRightNode = SplitNode(parentNode);
+				InsertIntoParent(parentNode, parentRightNode);
+				parentNode = node->m_Parent;
+			}
+
+			SizeTp const position = node->m_Position;
+			auto const parentElements = parentNode->GetElements();
+			auto const medianElement = node->GetElements() + node->m_Length;
+			Algo::RelocateRange(parentElements + position, parentElements + parentNode->m_Length, parentElements + position + 1);
+			Algo::RelocateRange(medianElement, medianElement + 1, parentElements + position);
+
+			auto const parentChildren = parentNode->GetChildren();
+			CMemory::Memmove(parentChildren + position + 2, parentChildren + position + 1, (parentNode->m_Length - position) * sizeof(NodeType*));
+			++parentNode->m_Length;
+			parentNode->SetChild(position + 1, rightNode);
+			parentNode->UpdateChildren(position + 2, parentNode->m_Length + 1);
+		}
+
+		/*!
+		 * Restores minimal occupancy of the node after erasing, by borrowing elements from the
+		 * siblings or merging with them. Merging may propagate up to the root.
+		 */
+		GDINT void Rebalance(NodeType* node)
+		{
+			while (node != m_Root && node->m_Length < NodeType::MinLength)
+			{
+				auto const parentNode = node->m_Parent;
+				SizeTp const position = node->m_Position;
+				if (position > 0 && parentNode->GetChildren()[position - 1]->m_Length > NodeType::MinLength)
+				{
+					MoveToRightSibling(parentNode, position - 1, 1);
+					return;
+				}
+				if (position < parentNode->m_Length && parentNode->GetChildren()[position + 1]->m_Length > NodeType::MinLength)
+				{
+					MoveToLeftSibling(parentNode, position, 1);
+					return;
+				}
+				MergeChildren(parentNode, position > 0 ? position - 1 : position);
+				node = parentNode;
+			}
+			if (m_Root->m_Length == 0)
+			{
+				auto const oldRoot = m_Root;
+				if (oldRoot->m_IsLeaf)
+				{
+					m_Root = nullptr;
+				}
+				else
+				{
+					m_Root = oldRoot->GetChildren()[0];
+					m_Root->m_Parent = nullptr;
+					m_Root->m_Position = 0;
+				}
+				GD_FREE(oldRoot);
+			}
+		}
+
+		/*!
+		 * Moves the specified amount of elements from the left child to the right one through the
+		 * separator in the parent.
+		 *
+		 * @param parentNode Parent of the children.
+		 * @param separatorIndex Index of the separator between the children.
+		 * @param count Amount of the elements to move.
+		 */
+		GDINT static void MoveToRightSibling(NodeType* const parentNode, SizeTp const separatorIndex, SizeTp const count)
+		{
+			auto const leftNode = parentNode->GetChildren()[separatorIndex];
+			auto const rightNode = parentNode->GetChildren()[separatorIndex + 1];
+			auto const leftElements = leftNode->GetElements();
+			auto const rightElements = rightNode->GetElements();
+			auto const separatorElement = parentNode->GetElements() + separatorIndex;
+			SizeTp const leftLength = leftNode->m_Length;
+			SizeTp const rightLength = rightNode->m_Length;
+
+			Algo::RelocateRange(rightElements, rightElements + rightLength, rightElements + count);
+			Algo::RelocateRange(separatorElement, separatorElement + 1, rightElements + count - 1);
+			Algo::RelocateRange(leftElements + leftLength - count + 1, leftElements + leftLength, rightElements);
+			Algo::RelocateRange(leftElements + leftLength - count, leftElements + leftLength - count + 1, separatorElement);
+			if (!leftNode->m_IsLeaf)
+			{
+				auto const rightChildren = rightNode->GetChildren();
+				CMemory::Memmove(rightChildren + count, rightChildren, (rightLength + 1) * sizeof(NodeType*));
+				CMemory::Memcpy(rightChildren, leftNode->GetChildren() + leftLength - count + 1, count * sizeof(NodeType*));
+				rightNode->UpdateChildren(0, rightLength + count + 1);
+			}
+			leftNode->m_Length = static_cast<UInt16>(leftLength - count);
+			rightNode->m_Length = static_cast<UInt16>(rightLength + count);
+		}
+
+		/*!
+		 * Moves the specified amount of elements from the right child to the left one through the
+		 * separator in the parent.
+		 *
+		 * @param parentNode Parent of the children.
+		 * @param separatorIndex Index of the separator between the children.
+		 * @param count Amount of the elements to move.
+		 */
+		GDINT static void MoveToLeftSibling(NodeType* const parentNode, SizeTp const separatorIndex, SizeTp const count)
+		{
+			auto const leftNode = parentNode->GetChildren()[separatorIndex];
+			auto const rightNode = parentNode->GetChildren()[separatorIndex + 1];
+			auto const leftElements = leftNode->GetElements();
+			auto const rightElements = rightNode->GetElements();
+			auto const separatorElement = parentNode->GetElements() + separatorIndex;
+			SizeTp const leftLength = leftNode->m_Length;
+			SizeTp const rightLength = rightNode->m_Length;
+
+			Algo::RelocateRange(separatorElement, separatorElement + 1, leftElements + leftLength);
+			Algo::RelocateRange(rightElements, rightElements + count - 1, leftElements + leftLength + 1);
+			Algo::RelocateRange(rightElements + count - 1, rightElements + count, separatorElement);
+			Algo::RelocateRange(rightElements + count, rightElements + rightLength, rightElements);
+			if (!leftNode->m_IsLeaf)
+			{
+				auto const rightChildren = rightNode->GetChildren();
+				CMemory::Memcpy(leftNode->GetChildren() + leftLength + 1, rightChildren, count * sizeof(NodeType*));
+				leftNode->UpdateChildren(leftLength + 1, leftLength + count + 1);
+				CMemory::Memmove(rightChildren, rightChildren + count, (rightLength - count + 1) * sizeof(NodeType*));
+				rightNode->UpdateChildren(0, rightLength - count + 1);
+			}
+			leftNode->m_Length = static_cast<UInt16>(leftLength + count);
+			rightNode->m_Length = static_cast<UInt16>(rightLength - count);
+		}
+
+		/*!
+		 * Merges the right child into the left one together with the separator between them.
+		 *
+		 * @param parentNode Parent of the children.
+		 * @param separatorIndex Index of the separator between the children.
+		 */
+		GDINT static void MergeChildren(NodeType* const parentNode, SizeTp const separatorIndex)
+		{
+			auto const leftNode = parentNode->GetChildren()[separatorIndex];
+			auto const rightNode = parentNode->GetChildren()[separatorIndex + 1];
+			auto const leftElements = leftNode->GetElements();
+			auto const parentElements = parentNode->GetElements();
+			SizeTp const leftLength = leftNode->m_Length;
+			SizeTp const rightLength = rightNode->m_Length;
+			SizeTp const parentLength = parentNode->m_Length;
+
+			Algo::RelocateRange(parentElements + separatorIndex, parentElements + separatorIndex + 1, leftElements + leftLength);
+			Algo::RelocateRange(rightNode->GetElements(), rightNode->GetElements() + rightLength, leftElements + leftLength + 1);
+			if (!leftNode->m_IsLeaf)
+			{
+				CMemory::Memcpy(leftNode->GetChildren() + leftLength + 1, rightNode->GetChildren(), (rightLength + 1) * sizeof(NodeType*));
+				leftNode->UpdateChildren(leftLength + 1, leftLength + rightLength + 2);
+			}
+			leftNode->m_Length = static_cast<UInt16>(leftLength + rightLength + 1);
+
+			auto const parentChildren = parentNode->GetChildren();
+			Algo::RelocateRange(parentElements + separatorIndex + 1, parentElements + parentLength, parentElements + separatorIndex);
+			CMemory::Memmove(parentChildren + separatorIndex + 1, parentChildren + separatorIndex + 2, (parentLength - separatorIndex - 1) * sizeof(NodeType*));
+			parentNode->m_Length = static_cast<UInt16>(parentLength - 1);
+			parentNode->UpdateChildren(separatorIndex + 1, parentLength);
+			GD_FREE(rightNode);
+		}
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Overloaded operators.
+		// ------------------------------------------------------------------------------------------
+
+		GDINL BTree& operator= (BTree&& other) noexcept
+		{
+			if (&other != this)
+			{
+				Clear();
+				Swap(other);
+			}
+			return *this;
+		}
+
+	};	// class BTree
+
+GD_NAMESPACE_END
@@ -0,0 +1,246 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/Containers/BTreeMap.h
+ * Dynamically sized B-tree-based associative container class.
+ */
+#pragma once
+
+#include <GoddamnEngine/Include.h>
+#include <GoddamnEngine/Core/Containers/Map.h>
+#include <GoddamnEngine/Core/Containers/BTree/BTree.h>
+
+GD_NAMESPACE_BEGIN
+
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+	// ******                              BTreeMap<K, V> class.                               ******
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+
+	// **------------------------------------------------------------------------------------------**
+	//! Key selector for the trees of key-value pairs.
+	// **------------------------------------------------------------------------------------------**
+	template<typename TKey, typename TValue>
+	struct BTreeMapKeySelector final : public TNonCreatable
+	{
+	public:
+		GDINL static TKey const& GetKey(MapPair<TKey, TValue> const& pair)
+		{
+			return pair.Key;
+		}
+	};	// struct BTreeMapKeySelector
+
+	// **------------------------------------------------------------------------------------------**
+	//! Dynamically sized associative container that is implemented with B-tree.
+	//! Drop-in replacement for the map class, that is much faster for lookups and ordered
+	//! iteration, but does not keep elements in place: inserting and erasing invalidates
+	//! iterators and pointers to other elements.
+	//!
+	//! Lookup functions accept any key type, that is comparable with the map keys, e.g. string
+	//! maps could be searched with C strings.
+	//!
+	//! @tparam TKey Key type, used for searching.
+	//! @tparam TValue Type of elements stored in the map.
+	//! @tparam TAllocator Allocator used by this map.
+	// **------------------------------------------------------------------------------------------**
+	template<typename TKey, typename TValue, typename TAllocator = DefaultContainerAllocator>
+	class BTreeMap : public BTree<TKey, MapPair<TKey, TValue>, BTreeMapKeySelector<TKey, TValue>, TAllocator>
+	{
+	public:
+		using PairType             = MapPair<TKey, TValue>;
+		using ElementType          = PairType;
+		using BTreeType            = BTree<TKey, PairType, BTreeMapKeySelector<TKey, TValue>, TAllocator>;
+		using Iterator             = typename BTreeType::Iterator;
+		using ConstIterator        = typename BTreeType::ConstIterator;
+		using ReverseIterator      = typename BTreeType::ReverseIterator;
+		using ReverseConstIterator = typename BTreeType::ReverseConstIterator;
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Constructor and destructor.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Initializes an empty map.
+		 */
+		GDINL BTreeMap() = default;
+
+		/*!
+		 * Moves other map here.
+		 * @param otherMap Map would be moved into current object.
+		 */
+		GDINL BTreeMap(BTreeMap&& otherMap) = default;
+
+		/*!
+		 * Initializes map with default C++11's initializer list. You should not use this constructor manually.
+		 * @param initializerList Initializer list passed by the compiler.
+		 */
+		GDINL BTreeMap(InitializerList<PairType> const& initializerList)
+		{
+			for (auto const& element : initializerList)
+			{
+				this->Insert(element.Key, element.Value);
+			}
+		}
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Map manipulation.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Queries for the iterator of the element with specified key.
+		 *
+		 * @param key The key of the element we are looking for.
+		 * @returns Iterator on the element if it was found and End Iterator otherwise.
+		 */
+		//! @{
+		template<typename TLookupKey>
+		GDINL ConstIterator FindIterator(TLookupKey const& key) const
+		{
+			SizeTp index;
+			auto const node = this->FindNode(key, index);
+			return ConstIterator(*this, node, index);
+		}
+		template<typename TLookupKey>
+		GDINL Iterator FindIterator(TLookupKey const& key)
+		{
+			SizeTp index;
+			auto const node = this->FindNode(key, index);
+			return Iterator(*this, node, index);
+		}
+		//! @}
+
+		/*!
+		 * Queries for the value of the element with specified key.
+		 *
+		 * @param key The key of the element we are looking for.
+		 * @returns Pointer to the element if it was found and null pointer otherwise.
+		 */
+		//! @{
+		template<typename TLookupKey>
+		GDINL TValue const* Find(TLookupKey const& key) const
+		{
+			SizeTp index;
+			auto const node = this->FindNode(key, index);
+			return node != nullptr ? &node->GetElements()[index].Value : nullptr;
+		}
+		template<typename TLookupKey>
+		GDINL TValue* Find(TLookupKey const& key)
+		{
+			return const_cast<TValue*>(const_cast<BTreeMap const*>(this)->Find(key));
+		}
+		//! @}
+
+		/*!
+		 * Determines whether the element with specified key exists in the map.
+		 *
+		 * @param key The key of the element we are looking for.
+		 * @returns True if element with specified key exists in the map, false otherwise.
+		 */
+		template<typename TLookupKey>
+		GDINL bool Contains(TLookupKey const& key) const
+		{
+			SizeTp index;
+			return this->FindNode(key, index) != nullptr;
+		}
+
+		/*!
+		 * Inserts the specified key-value pair into the map.
+		 *
+		 * @param key The key of the element that is going to be inserted.
+		 * @param value The value of the element that is going to be inserted.
+		 */
+		//! @{
+		GDINL TValue& Insert(TKey&& key, TValue&& value = TValue())
+		{
+			GD_ASSERT(!this->Contains(key), "Element with specified key already exists.");
+			return this->InsertElement(key, Utils::Forward<TKey>(key), Utils::Forward<TValue>(value)).Value;
+		}
+		GDINL TValue& Insert(TKey const& key, TValue const& value = TValue())
+		{
+			GD_ASSERT(!this->Contains(key), "Element with specified key already exists.");
+			return this->InsertElement(key, key, value).Value;
+		}
+		//! @}
+
+		/*!
+		 * Replaces contents of the map with the key-value pairs, sorted by unique keys.
+		 * Map is built in linear time with completely filled nodes.
+		 *
+		 * @param startIterator First iterator of the sorted pairs range.
+		 * @param endIterator End iterator of the sorted pairs range.
+		 */
+		template<typename TIterator>
+		GDINL void AssignSorted(TIterator const startIterator, TIterator const endIterator)
+		{
+			this->Clear();
+			TKey const* lastKey = nullptr;
+			for (auto iterator = startIterator; iterator != endIterator; ++iterator)
+			{
+				GD_ASSERT(lastKey == nullptr || *lastKey < (*iterator).Key, "Pairs should be sorted by unique keys.");
+				lastKey = &this->AppendElement((*iterator).Key, (*iterator).Value).Key;
+			}
+			this->RepairAppendedTree();
+		}
+
+		/*!
+		 * Removes existing element with specified key from the map.
+		 * @param key The key of the element that is going to be removed.
+		 */
+		template<typename TLookupKey>
+		GDINL void Erase(TLookupKey const& key)
+		{
+			SizeTp index;
+			auto const node = this->FindNode(key, index);
+			GD_ASSERT(node != nullptr, "Element with specified key does not exist.");
+			this->EraseElement(node, index);
+		}
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Overloaded operators.
+		// ------------------------------------------------------------------------------------------
+
+		GDINL BTreeMap& operator= (BTreeMap&& otherMap) = default;
+
+		/*!
+		 * Returns reference on value of the element with specified key.
+		 *
+		 * @param key The key of the element we are looking for.
+		 * @returns Reference on some element, or a newly created instance of the value type, that was automatically added to the map.
+		 */
+		GDINL TValue& operator[] (TKey const& key)
+		{
+			auto const value = this->Find(key);
+			if (value == nullptr)
+			{
+				return this->InsertElement(key, key, TValue()).Value;
+			}
+			return *value;
+		}
+
+		/*!
+		 * Returns reference on value of the element with specified key.
+		 *
+		 * @param key The key of the element we are looking for.
+		 * @returns Reference on some element.
+		 */
+		GDINL TValue const& operator[] (TKey const& key) const
+		{
+			auto const value = this->Find(key);
+			GD_ASSERT(value != nullptr, "Element with specified key does not exist.");
+			return *value;
+		}
+
+	};	// class BTreeMap
+
+GD_NAMESPACE_END
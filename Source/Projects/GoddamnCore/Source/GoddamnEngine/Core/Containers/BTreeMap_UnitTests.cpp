@@ -0,0 +1,158 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/Containers/BTreeMap_UnitTests.cpp
+ * Dynamically sized B-tree-based associative container class.
+ */
+#include <GoddamnEngine/Core/Containers/Set.h>
+#include <GoddamnEngine/Core/Containers/String.h>
+#include <GoddamnEngine/Core/Containers/Vector.h>
+#include <GoddamnEngine/Core/Containers/BTreeMap.h>
+#include <GoddamnEngine/Core/Containers/BTreeSet.h>
+
+GD_NAMESPACE_BEGIN
+
+#if GD_TESTING_ENABLED
+
+	// Large key, so that nodes contain only three elements and trees are deep.
+	struct BTreeTestKey final
+	{
+		Int32 Value;
+		Byte  Padding[60];
+
+		GDINL BTreeTestKey(Int32 const value = 0) : Value(value), Padding() {}
+		GDINL friend bool operator< (BTreeTestKey const& lhs, BTreeTestKey const& rhs) { return lhs.Value < rhs.Value; }
+	};	// struct BTreeTestKey
+
+	gd_testing_unit_test(BTreeMapRandomInsertErase)
+	{
+		// B-tree is compared with the red-black tree.
+		BTreeMap<BTreeTestKey, String> btreeMap;
+		Set<UInt32> treeSet;
+		UInt32 random = 1;
+		for (SizeTp cnt = 0; cnt < 20000; ++cnt)
+		{
+			random = random * 1664525 + 1013904223;
+			auto const element = (random >> 8) % 1024;
+			if (treeSet.Contains(element))
+			{
+				gd_testing_verify(*btreeMap.Find(BTreeTestKey(element)) == String::FromInt64(element));
+				btreeMap.Erase(BTreeTestKey(element));
+				treeSet.Erase(element);
+			}
+			else
+			{
+				btreeMap.Insert(BTreeTestKey(element), String::FromInt64(element));
+				treeSet.Insert(element);
+			}
+			gd_testing_verify(btreeMap.GetLength() == treeSet.GetLength());
+		}
+
+		Vector<UInt32> treeElements;
+		for (auto const element : treeSet)
+		{
+			treeElements.InsertLast(element);
+		}
+
+		SizeTp index = 0;
+		for (auto const& pair : btreeMap)
+		{
+			gd_testing_verify(static_cast<UInt32>(pair.Key.Value) == treeElements[index]);
+			++index;
+		}
+		gd_testing_verify(index == treeElements.GetLength());
+		for (auto iterator = btreeMap.ReverseBegin(); iterator != btreeMap.ReverseEnd(); ++iterator)
+		{
+			--index;
+			gd_testing_verify(static_cast<UInt32>(iterator->Key.Value) == treeElements[index]);
+		}
+		gd_testing_verify(index == 0);
+	};
+
+	gd_testing_unit_test(BTreeMapEmptyReverseIteration)
+	{
+		BTreeMap<Int32, Int32> map;
+		BTreeSet<Int32> const set;
+		gd_testing_verify(map.ReverseBegin() == map.ReverseEnd());
+		gd_testing_verify(set.ReverseBegin() == set.ReverseEnd());
+
+		// This should succeed: tree, emptied by erasing, is iterated the same way.
+		map.Insert(1, 1);
+		map.Erase(1);
+		SizeTp length = 0;
+		for (auto iterator = map.ReverseBegin(); iterator != map.ReverseEnd(); ++iterator)
+		{
+			++length;
+		}
+		gd_testing_verify(length == 0);
+	};
+
+	gd_testing_unit_test(BTreeMapAssignSorted)
+	{
+		for (Int32 length = 0; length < 1000; length += length < 50 ? 1 : 37)
+		{
+			Vector<MapPair<BTreeTestKey, Int32>> pairs;
+			for (Int32 cnt = 0; cnt < length; ++cnt)
+			{
+				pairs.InsertLast(MapPair<BTreeTestKey, Int32>(BTreeTestKey(cnt * 2), cnt));
+			}
+
+			BTreeMap<BTreeTestKey, Int32> map;
+			map.AssignSorted(pairs.Begin(), pairs.End());
+			gd_testing_verify(map.GetLength() == static_cast<SizeTp>(length));
+
+			Int32 expected = 0;
+			for (auto const& pair : map)
+			{
+				gd_testing_verify(pair.Key.Value == expected * 2 && pair.Value == expected);
+				++expected;
+			}
+			gd_testing_verify(expected == length);
+
+			// Erasing checks that the bulk-loaded tree is balanced correctly.
+			for (Int32 cnt = 0; cnt < length; ++cnt)
+			{
+				gd_testing_verify(!map.Contains(BTreeTestKey(cnt * 2 + 1)));
+				map.Erase(BTreeTestKey(cnt * 2));
+			}
+			gd_testing_verify(map.IsEmpty());
+		}
+
+		try
+		{
+			// This should fail.
+			Int32 const unsortedElements[] = { 1, 3, 2 };
+			BTreeSet<Int32> set;
+			set.AssignSorted(unsortedElements, unsortedElements + 3);
+			gd_testing_verify(false);
+		}
+		catch (goddamn_testing::assertion_exception const&)
+		{
+			gd_testing_verify(true);
+		}
+	};
+
+	gd_testing_unit_test(BTreeMapHeterogeneousLookup)
+	{
+		BTreeMap<String, Int32> map;
+		for (Int32 cnt = 0; cnt < 1000; ++cnt)
+		{
+			map.Insert(String::FromInt64(cnt), cnt);
+		}
+		gd_testing_verify(*map.Find("123") == 123);
+		gd_testing_verify(map.Contains("999"));
+		gd_testing_verify(!map.Contains("1000"));
+		map.Erase("500");
+		gd_testing_verify(!map.Contains(String("500")));
+		gd_testing_verify(map.Begin()->Key == "0");
+	};
+
+#endif	// if GD_TESTING_ENABLED
+
+GD_NAMESPACE_END
@@ -0,0 +1,193 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/Containers/BTreeSet.h
+ * Dynamically sized B-tree-based set class.
+ */
+#pragma once
+
+#include <GoddamnEngine/Include.h>
+#include <GoddamnEngine/Core/Containers/InitializerList.h>
+#include <GoddamnEngine/Core/Containers/BTree/BTree.h>
+
+GD_NAMESPACE_BEGIN
+
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+	// ******                                BTreeSet<T> class.                                ******
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+
+	// **------------------------------------------------------------------------------------------**
+	//! Dynamically sized set that is implemented with B-tree.
+	//! Drop-in replacement for the set class, that is much faster for lookups and ordered
+	//! iteration, but does not keep elements in place: inserting and erasing invalidates
+	//! iterators and pointers to other elements.
+	//!
+	//! @tparam TElement Container element type.
+	//! @tparam TAllocator Allocator used by this set.
+	// **------------------------------------------------------------------------------------------**
+	template<typename TElement, typename TAllocator = DefaultContainerAllocator>
+	class BTreeSet : public BTree<TElement, TElement, BTreeIdentityKeySelector<TElement>, TAllocator>
+	{
+	public:
+		using ElementType          = TElement;
+		using BTreeType            = BTree<TElement, TElement, BTreeIdentityKeySelector<TElement>, TAllocator>;
+		using Iterator             = typename BTreeType::Iterator;
+		using ConstIterator        = typename BTreeType::ConstIterator;
+		using ReverseIterator      = typename BTreeType::ReverseIterator;
+		using ReverseConstIterator = typename BTreeType::ReverseConstIterator;
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Constructor and destructor.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Initializes an empty set.
+		 */
+		GDINL BTreeSet() = default;
+
+		/*!
+		 * Moves other set here.
+		 * @param otherSet Set would be moved into current object.
+		 */
+		GDINL BTreeSet(BTreeSet&& otherSet) = default;
+
+		/*!
+		 * Initializes set with default C++11's initializer list. You should not use this constructor manually.
+		 * @param initializerList Initializer list passed by the compiler.
+		 */
+		GDINL BTreeSet(InitializerList<TElement> const& initializerList)
+		{
+			for (auto const& element : initializerList)
+			{
+				this->Insert(element);
+			}
+		}
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Set manipulation.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Queries for the Iterator of the specified element.
+		 *
+		 * @param element The element we are looking for.
+		 * @returns Iterator on the element if it was found and End Iterator otherwise.
+		 */
+		//! @{
+		template<typename TLookupElement>
+		GDINL ConstIterator FindIterator(TLookupElement const& element) const
+		{
+			SizeTp index;
+			auto const node = this->FindNode(element, index);
+			return ConstIterator(*this, node, index);
+		}
+		template<typename TLookupElement>
+		GDINL Iterator FindIterator(TLookupElement const& element)
+		{
+			SizeTp index;
+			auto const node = this->FindNode(element, index);
+			return Iterator(*this, node, index);
+		}
+		//! @}
+
+		/*!
+		 * Queries for the specified element.
+		 *
+		 * @param element The element we are looking for.
+		 * @returns Pointer to the element if it was found and null pointer otherwise.
+		 */
+		//! @{
+		template<typename TLookupElement>
+		GDINL TElement const* Find(TLookupElement const& element) const
+		{
+			SizeTp index;
+			auto const node = this->FindNode(element, index);
+			return node != nullptr ? &node->GetElements()[index] : nullptr;
+		}
+		template<typename TLookupElement>
+		GDINL TElement* Find(TLookupElement const& element)
+		{
+			return const_cast<TElement*>(const_cast<BTreeSet const*>(this)->Find(element));
+		}
+		//! @}
+
+		/*!
+		 * Determines whether the specified element exists in the set.
+		 * @param element The element we are looking for.
+		 */
+		template<typename TLookupElement>
+		GDINL bool Contains(TLookupElement const& element) const
+		{
+			SizeTp index;
+			return this->FindNode(element, index) != nullptr;
+		}
+
+		/*!
+		 * Adds a new specified element to the set.
+		 * @param element The element that would be inserted.
+		 */
+		//! @{
+		GDINL TElement& Insert(TElement&& element)
+		{
+			GD_ASSERT(!this->Contains(element), "Specified element already exists.");
+			return this->InsertElement(element, Utils::Forward<TElement>(element));
+		}
+		GDINL TElement& Insert(TElement const& element)
+		{
+			GD_ASSERT(!this->Contains(element), "Specified element already exists.");
+			return this->InsertElement(element, element);
+		}
+		//! @}
+
+		/*!
+		 * Replaces contents of the set with the sorted unique elements.
+		 * Set is built in linear time with completely filled nodes.
+		 *
+		 * @param startIterator First iterator of the sorted elements range.
+		 * @param endIterator End iterator of the sorted elements range.
+		 */
+		template<typename TIterator>
+		GDINL void AssignSorted(TIterator const startIterator, TIterator const endIterator)
+		{
+			this->Clear();
+			TElement const* lastElement = nullptr;
+			for (auto iterator = startIterator; iterator != endIterator; ++iterator)
+			{
+				GD_ASSERT(lastElement == nullptr || *lastElement < *iterator, "Elements should be sorted and unique.");
+				lastElement = &this->AppendElement(*iterator);
+			}
+			this->RepairAppendedTree();
+		}
+
+		/*!
+		 * Removes existing element from the set.
+		 * @param element The element that is going to be removed.
+		 */
+		template<typename TLookupElement>
+		GDINL void Erase(TLookupElement const& element)
+		{
+			SizeTp index;
+			auto const node = this->FindNode(element, index);
+			GD_ASSERT(node != nullptr, "Specified element does not exist.");
+			this->EraseElement(node, index);
+		}
+
+		// ------------------------------------------------------------------------------------------
+		// Overloaded operators.
+		// ------------------------------------------------------------------------------------------
+
+		GDINL BTreeSet& operator= (BTreeSet&&) = default;
+
+	};	// class BTreeSet
+
+GD_NAMESPACE_END
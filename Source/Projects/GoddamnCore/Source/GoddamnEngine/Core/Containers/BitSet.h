@@ -0,0 +1,416 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/Containers/BitSet.h
+ * Fixed size bit array class.
+ */
+#pragma once
+
+#include <GoddamnEngine/Include.h>
+#include <GoddamnEngine/Core/Containers/InitializerList.h>
+#include <GoddamnEngine/Core/Containers/BitVector.h>
+
+GD_NAMESPACE_BEGIN
+
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+	// ******                                 BitSet<N> class.                                 ******
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+
+	// **------------------------------------------------------------------------------------------**
+	//! Fixed size array of bits, stored inline.
+	//! Set operations are performed with loops over the compile-time number of words, which
+	//! are unrolled or vectorized by the compiler. Sets of the component types and similar
+	//! masks of several words fit into the registers.
+	//!
+	//! @tparam TLength Number of bits in the set.
+	// **------------------------------------------------------------------------------------------**
+	template<SizeTp TLength>
+	class BitSet final
+	{
+		static_assert(TLength > 0, "Length of the 'BitSet' should be positive.");
+
+	public:
+		using Word = BitWords::Word;
+		SizeTp static const BitsPerWord = BitWords::BitsPerWord;
+		SizeTp static const Length = TLength;
+		SizeTp static const WordsCount = (TLength + BitsPerWord - 1) / BitsPerWord;
+		SizeTp static constexpr Npos = BitWords::Npos;
+
+	private:
+		Word m_Words[WordsCount];
+
+	public:
+
+		/*!
+		 * Initializes bit set with all bits cleared.
+		 */
+		GDINL BitSet()
+			: m_Words()
+		{}
+
+		/*!
+		 * Initializes bit set with the specified bits set.
+		 * @param initializerList List of indices of the set bits.
+		 */
+		GDINL BitSet(InitializerList<SizeTp> const& initializerList)
+			: m_Words()
+		{
+			for (auto const index : initializerList)
+			{
+				Set(index);
+			}
+		}
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Bits access.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Returns pointer to the words of the bit set.
+		 */
+		//! @{
+		GDINL Word const* GetData() const
+		{
+			return m_Words;
+		}
+		GDINL Word* GetData()
+		{
+			return m_Words;
+		}
+		//! @}
+
+		/*!
+		 * Returns number of bits in the bit set.
+		 */
+		GDINL static SizeTp GetLength()
+		{
+			return TLength;
+		}
+
+		/*!
+		 * Returns value of the bit at the specified index.
+		 */
+		GDINL bool Get(SizeTp const index) const
+		{
+			GD_ASSERT(index < TLength, "Index is out of bounds");
+			return ((m_Words[index / BitsPerWord] >> index % BitsPerWord) & 1) != 0;
+		}
+
+		/*!
+		 * Sets value of the bit at the specified index.
+		 *
+		 * @param index Index of the bit.
+		 * @param value New value of the bit.
+		 */
+		GDINL void Set(SizeTp const index, bool const value = true)
+		{
+			GD_ASSERT(index < TLength, "Index is out of bounds");
+			auto& word = m_Words[index / BitsPerWord];
+			auto const mask = Word(1) << index % BitsPerWord;
+			word = value ? word | mask : word & ~mask;
+		}
+
+		/*!
+		 * Clears the bit at the specified index.
+		 */
+		GDINL void Reset(SizeTp const index)
+		{
+			Set(index, false);
+		}
+
+		/*!
+		 * Inverts the bit at the specified index.
+		 */
+		GDINL void Flip(SizeTp const index)
+		{
+			GD_ASSERT(index < TLength, "Index is out of bounds");
+			m_Words[index / BitsPerWord] ^= Word(1) << index % BitsPerWord;
+		}
+
+		/*!
+		 * Sets value of the range of bits.
+		 *
+		 * @param firstIndex Index of the first bit in the range.
+		 * @param count Number of bits in the range.
+		 * @param value New value of the bits.
+		 */
+		GDINL void SetRange(SizeTp const firstIndex, SizeTp const count, bool const value = true)
+		{
+			GD_ASSERT(firstIndex + count <= TLength, "Index is out of bounds");
+			BitWords::SetRange(m_Words, firstIndex, count, value);
+		}
+
+		/*!
+		 * Clears the range of bits.
+		 *
+		 * @param firstIndex Index of the first bit in the range.
+		 * @param count Number of bits in the range.
+		 */
+		GDINL void ResetRange(SizeTp const firstIndex, SizeTp const count)
+		{
+			SetRange(firstIndex, count, false);
+		}
+
+		/*!
+		 * Sets all bits of the bit set.
+		 */
+		GDINL void SetAll()
+		{
+			for (SizeTp wordIndex = 0; wordIndex < WordsCount; ++wordIndex)
+			{
+				m_Words[wordIndex] = ~Word(0);
+			}
+			m_Words[WordsCount - 1] &= BitWords::GetLastWordMask(TLength);
+		}
+
+		/*!
+		 * Clears all bits of the bit set.
+		 */
+		GDINL void ResetAll()
+		{
+			for (SizeTp wordIndex = 0; wordIndex < WordsCount; ++wordIndex)
+			{
+				m_Words[wordIndex] = 0;
+			}
+		}
+
+		/*!
+		 * Inverts all bits of the bit set.
+		 */
+		GDINL void FlipAll()
+		{
+			BitWords::Flip(m_Words, TLength);
+		}
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Queries.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Returns number of set bits.
+		 */
+		GDINL SizeTp CountSet() const
+		{
+			SizeTp count = 0;
+			for (SizeTp wordIndex = 0; wordIndex < WordsCount; ++wordIndex)
+			{
+				count += BitWords::CountBits(m_Words[wordIndex]);
+			}
+			return count;
+		}
+
+		/*!
+		 * Returns true if at least one bit is set.
+		 */
+		GDINL bool IsAnySet() const
+		{
+			return !BitWords::IsZero(m_Words, WordsCount);
+		}
+
+		/*!
+		 * Returns true if no bits are set.
+		 */
+		GDINL bool IsNoneSet() const
+		{
+			return BitWords::IsZero(m_Words, WordsCount);
+		}
+
+		/*!
+		 * Returns true if all bits are set.
+		 */
+		GDINL bool AreAllSet() const
+		{
+			return BitWords::IsFull(m_Words, TLength);
+		}
+
+		/*!
+		 * Searches for the first set bit.
+		 * @returns Index of the found bit or @ref Npos if nothing was found.
+		 */
+		GDINL SizeTp FindFirstSet() const
+		{
+			return BitWords::FindNextSet(m_Words, WordsCount, 0);
+		}
+
+		/*!
+		 * Searches for the first set bit, starting from the specified one.
+		 *
+		 * @param firstIndex Index of the first bit to check.
+		 * @returns Index of the found bit or @ref Npos if nothing was found.
+		 */
+		GDINL SizeTp FindNextSet(SizeTp const firstIndex) const
+		{
+			return BitWords::FindNextSet(m_Words, WordsCount, firstIndex);
+		}
+
+		/*!
+		 * Searches for the last set bit.
+		 * @returns Index of the found bit or @ref Npos if nothing was found.
+		 */
+		GDINL SizeTp FindLastSet() const
+		{
+			return BitWords::FindLastSet(m_Words, WordsCount);
+		}
+
+		/*!
+		 * Searches for the first cleared bit.
+		 * @returns Index of the found bit or @ref Npos if nothing was found.
+		 */
+		GDINL SizeTp FindFirstUnset() const
+		{
+			return BitWords::FindNextUnset(m_Words, TLength, 0);
+		}
+
+		/*!
+		 * Searches for the first cleared bit, starting from the specified one.
+		 *
+		 * @param firstIndex Index of the first bit to check.
+		 * @returns Index of the found bit or @ref Npos if nothing was found.
+		 */
+		GDINL SizeTp FindNextUnset(SizeTp const firstIndex) const
+		{
+			return BitWords::FindNextUnset(m_Words, TLength, firstIndex);
+		}
+
+		/*!
+		 * Invokes the predicate for indices of all set bits in the ascending order.
+		 * @param predicate Predicate, that accepts index of the bit.
+		 */
+		template<typename TPredicate>
+		GDINL void ForEachSet(TPredicate const& predicate) const
+		{
+			BitWords::ForEachSet(m_Words, WordsCount, predicate);
+		}
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Set operations.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Returns true if at least one bit is set in both bit sets.
+		 */
+		GDINL bool Intersects(BitSet const& otherSet) const
+		{
+			Word intersection = 0;
+			for (SizeTp wordIndex = 0; wordIndex < WordsCount; ++wordIndex)
+			{
+				intersection |= m_Words[wordIndex] & otherSet.m_Words[wordIndex];
+			}
+			return intersection != 0;
+		}
+
+		/*!
+		 * Returns true if all bits, set in the other bit set, are also set in this one.
+		 */
+		GDINL bool Includes(BitSet const& otherSet) const
+		{
+			Word difference = 0;
+			for (SizeTp wordIndex = 0; wordIndex < WordsCount; ++wordIndex)
+			{
+				difference |= otherSet.m_Words[wordIndex] & ~m_Words[wordIndex];
+			}
+			return difference == 0;
+		}
+
+		/*!
+		 * Clears all bits, that are set in the other bit set.
+		 */
+		GDINL BitSet& AndNot(BitSet const& otherSet)
+		{
+			for (SizeTp wordIndex = 0; wordIndex < WordsCount; ++wordIndex)
+			{
+				m_Words[wordIndex] &= ~otherSet.m_Words[wordIndex];
+			}
+			return *this;
+		}
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Overloaded operators.
+		// ------------------------------------------------------------------------------------------
+
+		// bitset[]
+		GDINL bool operator[] (SizeTp const index) const
+		{
+			return Get(index);
+		}
+
+		// bitset == bitset
+		GDINL friend bool operator== (BitSet const& lhs, BitSet const& rhs)
+		{
+			Word difference = 0;
+			for (SizeTp wordIndex = 0; wordIndex < WordsCount; ++wordIndex)
+			{
+				difference |= lhs.m_Words[wordIndex] ^ rhs.m_Words[wordIndex];
+			}
+			return difference == 0;
+		}
+		GDINL friend bool operator!= (BitSet const& lhs, BitSet const& rhs)
+		{
+			return !(lhs == rhs);
+		}
+
+		// bitset &= bitset
+		GDINL BitSet& operator&= (BitSet const& otherSet)
+		{
+			for (SizeTp wordIndex = 0; wordIndex < WordsCount; ++wordIndex)
+			{
+				m_Words[wordIndex] &= otherSet.m_Words[wordIndex];
+			}
+			return *this;
+		}
+		GDINL friend BitSet operator& (BitSet lhs, BitSet const& rhs)
+		{
+			return lhs &= rhs;
+		}
+
+		// bitset |= bitset
+		GDINL BitSet& operator|= (BitSet const& otherSet)
+		{
+			for (SizeTp wordIndex = 0; wordIndex < WordsCount; ++wordIndex)
+			{
+				m_Words[wordIndex] |= otherSet.m_Words[wordIndex];
+			}
+			return *this;
+		}
+		GDINL friend BitSet operator| (BitSet lhs, BitSet const& rhs)
+		{
+			return lhs |= rhs;
+		}
+
+		// bitset ^= bitset
+		GDINL BitSet& operator^= (BitSet const& otherSet)
+		{
+			for (SizeTp wordIndex = 0; wordIndex < WordsCount; ++wordIndex)
+			{
+				m_Words[wordIndex] ^= otherSet.m_Words[wordIndex];
+			}
+			return *this;
+		}
+		GDINL friend BitSet operator^ (BitSet lhs, BitSet const& rhs)
+		{
+			return lhs ^= rhs;
+		}
+
+		// ~bitset
+		GDINL friend BitSet operator~ (BitSet set)
+		{
+			set.FlipAll();
+			return set;
+		}
+	};	// class BitSet
+
+GD_NAMESPACE_END
@@ -0,0 +1,378 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/Containers/BitVector.cpp
+ * Dynamically sized bit array class.
+ */
+#include <GoddamnEngine/Core/Containers/BitVector.h>
+
+#if (GD_ARCHITECTURE_X64 || GD_ARCHITECTURE_X86) && !GD_PLATFORM_HTML5 && defined(__AVX2__)
+#	define GD_BIT_WORDS_AVX2 GD_TRUE
+#	include <immintrin.h>
+#else	// if (GD_ARCHITECTURE_X64 || GD_ARCHITECTURE_X86) && !GD_PLATFORM_HTML5 && defined(__AVX2__)
+#	define GD_BIT_WORDS_AVX2 GD_FALSE
+#endif	// if (GD_ARCHITECTURE_X64 || GD_ARCHITECTURE_X86) && !GD_PLATFORM_HTML5 && defined(__AVX2__)
+#if (GD_ARCHITECTURE_X64 || GD_ARCHITECTURE_X86) && !GD_PLATFORM_HTML5 && !GD_BIT_WORDS_AVX2
+#	define GD_BIT_WORDS_SSE2 GD_TRUE
+#	include <emmintrin.h>
+#else	// if (GD_ARCHITECTURE_X64 || GD_ARCHITECTURE_X86) && !GD_PLATFORM_HTML5 && !GD_BIT_WORDS_AVX2
+#	define GD_BIT_WORDS_SSE2 GD_FALSE
+#endif	// if (GD_ARCHITECTURE_X64 || GD_ARCHITECTURE_X86) && !GD_PLATFORM_HTML5 && !GD_BIT_WORDS_AVX2
+#if GD_ARCHITECTURE_ARM64
+#	define GD_BIT_WORDS_NEON GD_TRUE
+#	include <arm_neon.h>
+#else	// if GD_ARCHITECTURE_ARM64
+#	define GD_BIT_WORDS_NEON GD_FALSE
+#endif	// if GD_ARCHITECTURE_ARM64
+#define GD_BIT_WORDS_SIMD (GD_BIT_WORDS_AVX2 || GD_BIT_WORDS_SSE2 || GD_BIT_WORDS_NEON)
+
+GD_NAMESPACE_BEGIN
+
+#if GD_BIT_WORDS_SIMD
+
+	// **------------------------------------------------------------------------------------------**
+	//! Thin wrapper over the vector registers of the target architecture.
+	//! Bit counts are calculated for each byte and are summed into the 64-bit lanes.
+	// **------------------------------------------------------------------------------------------**
+	struct BitWordsVector final : public TNonCreatable
+	{
+	public:
+#if GD_BIT_WORDS_AVX2
+		using Type = __m256i;
+		SizeTp static const WordsCount = 4;
+#elif GD_BIT_WORDS_SSE2
+		using Type = __m128i;
+		SizeTp static const WordsCount = 2;
+#else	// *** NEON. ***
+		using Type = uint64x2_t;
+		SizeTp static const WordsCount = 2;
+#endif	// *** NEON. ***
+
+	public:
+
+		/*!
+		 * Loads a vector from unaligned memory.
+		 */
+		GDINL static Type Load(BitWords::Word const* const words)
+		{
+#if GD_BIT_WORDS_AVX2
+			return _mm256_loadu_si256(reinterpret_cast<Type const*>(words));
+#elif GD_BIT_WORDS_SSE2
+			return _mm_loadu_si128(reinterpret_cast<Type const*>(words));
+#else	// *** NEON. ***
+			return vld1q_u64(words);
+#endif	// *** NEON. ***
+		}
+
+		/*!
+		 * Stores a vector into unaligned memory.
+		 */
+		GDINL static void Store(BitWords::Word* const words, Type const value)
+		{
+#if GD_BIT_WORDS_AVX2
+			_mm256_storeu_si256(reinterpret_cast<Type*>(words), value);
+#elif GD_BIT_WORDS_SSE2
+			_mm_storeu_si128(reinterpret_cast<Type*>(words), value);
+#else	// *** NEON. ***
+			vst1q_u64(words, value);
+#endif	// *** NEON. ***
+		}
+
+		/*!
+		 * Returns vector with all bits cleared.
+		 */
+		GDINL static Type Zero()
+		{
+#if GD_BIT_WORDS_AVX2
+			return _mm256_setzero_si256();
+#elif GD_BIT_WORDS_SSE2
+			return _mm_setzero_si128();
+#else	// *** NEON. ***
+			return vdupq_n_u64(0);
+#endif	// *** NEON. ***
+		}
+
+		GDINL static Type And(Type const lhs, Type const rhs)
+		{
+#if GD_BIT_WORDS_AVX2
+			return _mm256_and_si256(lhs, rhs);
+#elif GD_BIT_WORDS_SSE2
+			return _mm_and_si128(lhs, rhs);
+#else	// *** NEON. ***
+			return vandq_u64(lhs, rhs);
+#endif	// *** NEON. ***
+		}
+
+		GDINL static Type Or(Type const lhs, Type const rhs)
+		{
+#if GD_BIT_WORDS_AVX2
+			return _mm256_or_si256(lhs, rhs);
+#elif GD_BIT_WORDS_SSE2
+			return _mm_or_si128(lhs, rhs);
+#else	// *** NEON. ***
+			return vorrq_u64(lhs, rhs);
+#endif	// *** NEON. ***
+		}
+
+		GDINL static Type Xor(Type const lhs, Type const rhs)
+		{
+#if GD_BIT_WORDS_AVX2
+			return _mm256_xor_si256(lhs, rhs);
+#elif GD_BIT_WORDS_SSE2
+			return _mm_xor_si128(lhs, rhs);
+#else	// *** NEON. ***
+			return veorq_u64(lhs, rhs);
+#endif	// *** NEON. ***
+		}
+
+		/*!
+		 * Returns bits of the left operand, that are cleared in the right one.
+		 */
+		GDINL static Type AndNot(Type const lhs, Type const rhs)
+		{
+#if GD_BIT_WORDS_AVX2
+			return _mm256_andnot_si256(rhs, lhs);
+#elif GD_BIT_WORDS_SSE2
+			return _mm_andnot_si128(rhs, lhs);
+#else	// *** NEON. ***
+			return vbicq_u64(lhs, rhs);
+#endif	// *** NEON. ***
+		}
+
+		/*!
+		 * Returns true if all bits of the vector are cleared.
+		 */
+		GDINL static bool IsZero(Type const value)
+		{
+#if GD_BIT_WORDS_AVX2
+			return _mm256_testz_si256(value, value) != 0;
+#elif GD_BIT_WORDS_SSE2
+			return _mm_movemask_epi8(_mm_cmpeq_epi8(value, _mm_setzero_si128())) == 0xFFFF;
+#else	// *** NEON. ***
+			return (vgetq_lane_u64(value, 0) | vgetq_lane_u64(value, 1)) == 0;
+#endif	// *** NEON. ***
+		}
+
+		/*!
+		 * Returns number of set bits in each 64-bit lane of the vector.
+		 */
+		GDINL static Type CountBits(Type const value)
+		{
+#if GD_BIT_WORDS_AVX2
+			// Counts are looked up for each nibble.
+			auto const lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+			auto const lowMask = _mm256_set1_epi8(0x0F);
+			auto const lowCounts = _mm256_shuffle_epi8(lookup, _mm256_and_si256(value, lowMask));
+			auto const highCounts = _mm256_shuffle_epi8(lookup, _mm256_and_si256(_mm256_srli_epi16(value, 4), lowMask));
+			return _mm256_sad_epu8(_mm256_add_epi8(lowCounts, highCounts), _mm256_setzero_si256());
+#elif GD_BIT_WORDS_SSE2
+			// Counts are summed in the pairs of bits, nibbles and bytes.
+			auto counts = _mm_sub_epi8(value, _mm_and_si128(_mm_srli_epi64(value, 1), _mm_set1_epi8(0x55)));
+			counts = _mm_add_epi8(_mm_and_si128(counts, _mm_set1_epi8(0x33)), _mm_and_si128(_mm_srli_epi64(counts, 2), _mm_set1_epi8(0x33)));
+			counts = _mm_and_si128(_mm_add_epi8(counts, _mm_srli_epi64(counts, 4)), _mm_set1_epi8(0x0F));
+			return _mm_sad_epu8(counts, _mm_setzero_si128());
+#else	// *** NEON. ***
+			return vpaddlq_u32(vpaddlq_u16(vpaddlq_u8(vcntq_u8(vreinterpretq_u8_u64(value)))));
+#endif	// *** NEON. ***
+		}
+
+		/*!
+		 * Adds 64-bit lanes of the vectors.
+		 */
+		GDINL static Type Add(Type const lhs, Type const rhs)
+		{
+#if GD_BIT_WORDS_AVX2
+			return _mm256_add_epi64(lhs, rhs);
+#elif GD_BIT_WORDS_SSE2
+			return _mm_add_epi64(lhs, rhs);
+#else	// *** NEON. ***
+			return vaddq_u64(lhs, rhs);
+#endif	// *** NEON. ***
+		}
+
+		/*!
+		 * Returns sum of the 64-bit lanes of the vector.
+		 */
+		GDINL static UInt64 Sum(Type const value)
+		{
+			BitWords::Word lanes[WordsCount];
+			Store(lanes, value);
+			UInt64 sum = 0;
+			for (auto const lane : lanes)
+			{
+				sum += lane;
+			}
+			return sum;
+		}
+	};	// struct BitWordsVector
+
+#endif	// if GD_BIT_WORDS_SIMD
+
+	// ------------------------------------------------------------------------------------------
+	// Bitwise operations.
+	// ------------------------------------------------------------------------------------------
+
+	struct BitWordsAnd final
+	{
+#if GD_BIT_WORDS_SIMD
+		GDINL static BitWordsVector::Type Apply(BitWordsVector::Type const lhs, BitWordsVector::Type const rhs)
+		{
+			return BitWordsVector::And(lhs, rhs);
+		}
+#endif	// if GD_BIT_WORDS_SIMD
+		GDINL static BitWords::Word Apply(BitWords::Word const lhs, BitWords::Word const rhs)
+		{
+			return lhs & rhs;
+		}
+	};	// struct BitWordsAnd
+
+	struct BitWordsOr final
+	{
+#if GD_BIT_WORDS_SIMD
+		GDINL static BitWordsVector::Type Apply(BitWordsVector::Type const lhs, BitWordsVector::Type const rhs)
+		{
+			return BitWordsVector::Or(lhs, rhs);
+		}
+#endif	// if GD_BIT_WORDS_SIMD
+		GDINL static BitWords::Word Apply(BitWords::Word const lhs, BitWords::Word const rhs)
+		{
+			return lhs | rhs;
+		}
+	};	// struct BitWordsOr
+
+	struct BitWordsXor final
+	{
+#if GD_BIT_WORDS_SIMD
+		GDINL static BitWordsVector::Type Apply(BitWordsVector::Type const lhs, BitWordsVector::Type const rhs)
+		{
+			return BitWordsVector::Xor(lhs, rhs);
+		}
+#endif	// if GD_BIT_WORDS_SIMD
+		GDINL static BitWords::Word Apply(BitWords::Word const lhs, BitWords::Word const rhs)
+		{
+			return lhs ^ rhs;
+		}
+	};	// struct BitWordsXor
+
+	struct BitWordsAndNot final
+	{
+#if GD_BIT_WORDS_SIMD
+		GDINL static BitWordsVector::Type Apply(BitWordsVector::Type const lhs, BitWordsVector::Type const rhs)
+		{
+			return BitWordsVector::AndNot(lhs, rhs);
+		}
+#endif	// if GD_BIT_WORDS_SIMD
+		GDINL static BitWords::Word Apply(BitWords::Word const lhs, BitWords::Word const rhs)
+		{
+			return lhs & ~rhs;
+		}
+	};	// struct BitWordsAndNot
+
+	/*!
+	 * Applies the bitwise operation to the arrays of words.
+	 */
+	template<typename TOperation>
+	GDINL static void ApplyBitWords(BitWords::Word* const destination, BitWords::Word const* const source, SizeTp const wordsCount)
+	{
+		SizeTp wordIndex = 0;
+#if GD_BIT_WORDS_SIMD
+		for (; wordIndex + BitWordsVector::WordsCount <= wordsCount; wordIndex += BitWordsVector::WordsCount)
+		{
+			auto const lhs = BitWordsVector::Load(destination + wordIndex);
+			auto const rhs = BitWordsVector::Load(source + wordIndex);
+			BitWordsVector::Store(destination + wordIndex, TOperation::Apply(lhs, rhs));
+		}
+#endif	// if GD_BIT_WORDS_SIMD
+		for (; wordIndex < wordsCount; ++wordIndex)
+		{
+			destination[wordIndex] = TOperation::Apply(destination[wordIndex], source[wordIndex]);
+		}
+	}
+
+	/*!
+	 * Returns true if the bitwise operation over the arrays of words produces at least one set bit.
+	 */
+	template<typename TOperation>
+	GDINL static bool ApplyBitWordsAny(BitWords::Word const* const lhs, BitWords::Word const* const rhs, SizeTp const wordsCount)
+	{
+		SizeTp wordIndex = 0;
+#if GD_BIT_WORDS_SIMD
+		for (; wordIndex + BitWordsVector::WordsCount <= wordsCount; wordIndex += BitWordsVector::WordsCount)
+		{
+			auto const result = TOperation::Apply(BitWordsVector::Load(lhs + wordIndex), BitWordsVector::Load(rhs + wordIndex));
+			if (!BitWordsVector::IsZero(result))
+			{
+				return true;
+			}
+		}
+#endif	// if GD_BIT_WORDS_SIMD
+		for (; wordIndex < wordsCount; ++wordIndex)
+		{
+			if (TOperation::Apply(lhs[wordIndex], rhs[wordIndex]) != 0)
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	GDAPI void BitWords::And(Word* const destination, Word const* const source, SizeTp const wordsCount)
+	{
+		ApplyBitWords<BitWordsAnd>(destination, source, wordsCount);
+	}
+
+	GDAPI void BitWords::Or(Word* const destination, Word const* const source, SizeTp const wordsCount)
+	{
+		ApplyBitWords<BitWordsOr>(destination, source, wordsCount);
+	}
+
+	GDAPI void BitWords::Xor(Word* const destination, Word const* const source, SizeTp const wordsCount)
+	{
+		ApplyBitWords<BitWordsXor>(destination, source, wordsCount);
+	}
+
+	GDAPI void BitWords::AndNot(Word* const destination, Word const* const source, SizeTp const wordsCount)
+	{
+		ApplyBitWords<BitWordsAndNot>(destination, source, wordsCount);
+	}
+
+	GDAPI bool BitWords::Intersects(Word const* const lhs, Word const* const rhs, SizeTp const wordsCount)
+	{
+		return ApplyBitWordsAny<BitWordsAnd>(lhs, rhs, wordsCount);
+	}
+
+	GDAPI bool BitWords::Includes(Word const* const lhs, Word const* const rhs, SizeTp const wordsCount)
+	{
+		return !ApplyBitWordsAny<BitWordsAndNot>(rhs, lhs, wordsCount);
+	}
+
+	// ------------------------------------------------------------------------------------------
+	// Bit counting.
+	// ------------------------------------------------------------------------------------------
+
+	GDAPI SizeTp BitWords::CountBits(Word const* const words, SizeTp const wordsCount)
+	{
+		SizeTp count = 0;
+		SizeTp wordIndex = 0;
+#if GD_BIT_WORDS_SIMD
+		auto counts = BitWordsVector::Zero();
+		for (; wordIndex + BitWordsVector::WordsCount <= wordsCount; wordIndex += BitWordsVector::WordsCount)
+		{
+			counts = BitWordsVector::Add(counts, BitWordsVector::CountBits(BitWordsVector::Load(words + wordIndex)));
+		}
+		count = static_cast<SizeTp>(BitWordsVector::Sum(counts));
+#endif	// if GD_BIT_WORDS_SIMD
+		for (; wordIndex < wordsCount; ++wordIndex)
+		{
+			count += CountBits(words[wordIndex]);
+		}
+		return count;
+	}
+
+GD_NAMESPACE_END
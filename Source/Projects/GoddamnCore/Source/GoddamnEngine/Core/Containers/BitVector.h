@@ -0,0 +1,936 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/Containers/BitVector.h
+ * Dynamically sized bit array class.
+ */
+#pragma once
+
+#include <GoddamnEngine/Include.h>
+#include <GoddamnEngine/Core/CStdlib/CMemory.h>
+#if GD_COMPILER_MSVC_COMPATIBLE
+#	include <intrin.h>
+#endif	// if GD_COMPILER_MSVC_COMPATIBLE
+
+GD_NAMESPACE_BEGIN
+
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+	// ******                           BitWords & BitVector classes.                          ******
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+
+	// **------------------------------------------------------------------------------------------**
+	//! Operations over the arrays of 64-bit words, shared by the bit containers.
+	//! Bit with index N is stored in the word N / 64 at position N % 64. Bits after the last
+	//! one are expected to be zero. Bulk kernels process 32 (AVX2) or 16 (SSE2 and NEON) bytes
+	//! per iteration and fall back to the scalar loops on other architectures.
+	// **------------------------------------------------------------------------------------------**
+	class BitWords final : public TNonCreatable
+	{
+	public:
+		using Word = UInt64;
+		SizeTp static const BitsPerWord = sizeof(Word) * 8;
+		SizeTp static constexpr Npos = SizeTpMax;
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Single word operations.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Returns number of words, required to store the specified number of bits.
+		 */
+		GDINL static SizeTp GetWordsCount(SizeTp const bitsCount)
+		{
+			return bitsCount / BitsPerWord + (bitsCount % BitsPerWord != 0);
+		}
+
+		/*!
+		 * Returns mask of the bits, that are used in the last word of the array.
+		 */
+		GDINL static Word GetLastWordMask(SizeTp const bitsCount)
+		{
+			return bitsCount % BitsPerWord != 0 ? ~(~Word(0) << bitsCount % BitsPerWord) : ~Word(0);
+		}
+
+		/*!
+		 * Returns number of set bits in the word.
+		 */
+		GDINL static SizeTp CountBits(Word word)
+		{
+#if GD_COMPILER_MSVC_COMPATIBLE && GD_ARCHITECTURE_X64 && defined(__AVX__)
+			return static_cast<SizeTp>(__popcnt64(word));
+#elif GD_COMPILER_MSVC_COMPATIBLE
+			word = word - ((word >> 1) & 0x5555555555555555ull);
+			word = (word & 0x3333333333333333ull) + ((word >> 2) & 0x3333333333333333ull);
+			word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+			return static_cast<SizeTp>((word * 0x0101010101010101ull) >> 56);
+#else	// if GD_COMPILER_MSVC_COMPATIBLE
+			return static_cast<SizeTp>(__builtin_popcountll(word));
+#endif	// if GD_COMPILER_MSVC_COMPATIBLE
+		}
+
+		/*!
+		 * Returns index of the lowest set bit of the non-zero word.
+		 */
+		GDINL static SizeTp GetLowestBit(Word const word)
+		{
+			GD_ASSERT(word != 0, "Word is empty.");
+#if GD_COMPILER_MSVC_COMPATIBLE && (GD_ARCHITECTURE_X64 || GD_ARCHITECTURE_ARM64)
+			unsigned long index;
+			_BitScanForward64(&index, word);
+#elif GD_COMPILER_MSVC_COMPATIBLE
+			unsigned long index;
+			if (!_BitScanForward(&index, static_cast<unsigned long>(word)))
+			{
+				_BitScanForward(&index, static_cast<unsigned long>(word >> 32));
+				index += 32;
+			}
+#else	// if GD_COMPILER_MSVC_COMPATIBLE
+			auto const index = __builtin_ctzll(word);
+#endif	// if GD_COMPILER_MSVC_COMPATIBLE
+			return static_cast<SizeTp>(index);
+		}
+
+		/*!
+		 * Returns index of the highest set bit of the non-zero word.
+		 */
+		GDINL static SizeTp GetHighestBit(Word const word)
+		{
+			GD_ASSERT(word != 0, "Word is empty.");
+#if GD_COMPILER_MSVC_COMPATIBLE && (GD_ARCHITECTURE_X64 || GD_ARCHITECTURE_ARM64)
+			unsigned long index;
+			_BitScanReverse64(&index, word);
+#elif GD_COMPILER_MSVC_COMPATIBLE
+			unsigned long index;
+			if (_BitScanReverse(&index, static_cast<unsigned long>(word >> 32)))
+			{
+				index += 32;
+			}
+			else
+			{
+				_BitScanReverse(&index, static_cast<unsigned long>(word));
+			}
+#else	// if GD_COMPILER_MSVC_COMPATIBLE
+			auto const index = 63 - __builtin_clzll(word);
+#endif	// if GD_COMPILER_MSVC_COMPATIBLE
+			return static_cast<SizeTp>(index);
+		}
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Bulk operations.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Performs the bitwise operation over two arrays of words and stores the result into the first one.
+		 * Arrays should either be the same or should not overlap.
+		 *
+		 * @param destination Left operand and destination array.
+		 * @param source Right operand.
+		 * @param wordsCount Number of words in both arrays.
+		 */
+		//! @{
+		GDAPI static void And(Word* const destination, Word const* const source, SizeTp const wordsCount);
+		GDAPI static void Or(Word* const destination, Word const* const source, SizeTp const wordsCount);
+		GDAPI static void Xor(Word* const destination, Word const* const source, SizeTp const wordsCount);
+		GDAPI static void AndNot(Word* const destination, Word const* const source, SizeTp const wordsCount);
+		//! @}
+
+		/*!
+		 * Returns number of set bits in the array of words.
+		 */
+		GDAPI static SizeTp CountBits(Word const* const words, SizeTp const wordsCount);
+
+		/*!
+		 * Returns true if at least one bit is set in both arrays.
+		 */
+		GDAPI static bool Intersects(Word const* const lhs, Word const* const rhs, SizeTp const wordsCount);
+
+		/*!
+		 * Returns true if all bits, set in the second array, are also set in the first one.
+		 */
+		GDAPI static bool Includes(Word const* const lhs, Word const* const rhs, SizeTp const wordsCount);
+
+		/*!
+		 * Returns true if no bits are set in the array of words.
+		 */
+		GDINL static bool IsZero(Word const* const words, SizeTp const wordsCount)
+		{
+			for (SizeTp wordIndex = 0; wordIndex < wordsCount; ++wordIndex)
+			{
+				if (words[wordIndex] != 0)
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+		/*!
+		 * Returns true if all bits are set in the array of words.
+		 *
+		 * @param words Array of words.
+		 * @param bitsCount Number of the used bits in the array.
+		 */
+		GDINL static bool IsFull(Word const* const words, SizeTp const bitsCount)
+		{
+			auto const fullWordsCount = bitsCount / BitsPerWord;
+			for (SizeTp wordIndex = 0; wordIndex < fullWordsCount; ++wordIndex)
+			{
+				if (words[wordIndex] != ~Word(0))
+				{
+					return false;
+				}
+			}
+			return bitsCount % BitsPerWord == 0 || words[fullWordsCount] == GetLastWordMask(bitsCount);
+		}
+
+		/*!
+		 * Sets or clears the range of bits.
+		 *
+		 * @param words Array of words.
+		 * @param firstBit Index of the first bit in the range.
+		 * @param bitsCount Number of bits in the range.
+		 * @param value Value of the bits.
+		 */
+		GDINL static void SetRange(Word* const words, SizeTp const firstBit, SizeTp const bitsCount, bool const value)
+		{
+			if (bitsCount == 0)
+			{
+				return;
+			}
+			auto const lastBit = firstBit + bitsCount - 1;
+			auto const firstWordIndex = firstBit / BitsPerWord;
+			auto const lastWordIndex = lastBit / BitsPerWord;
+			auto firstWordMask = ~Word(0) << firstBit % BitsPerWord;
+			auto const lastWordMask = ~Word(0) >> (BitsPerWord - 1 - lastBit % BitsPerWord);
+			if (firstWordIndex == lastWordIndex)
+			{
+				firstWordMask &= lastWordMask;
+			}
+			else
+			{
+				// Inner words are filled completely.
+				CMemory::Memset(words + firstWordIndex + 1, value ? 0xFF : 0x00, (lastWordIndex - firstWordIndex - 1) * sizeof(Word));
+				words[lastWordIndex] = value ? words[lastWordIndex] | lastWordMask : words[lastWordIndex] & ~lastWordMask;
+			}
+			words[firstWordIndex] = value ? words[firstWordIndex] | firstWordMask : words[firstWordIndex] & ~firstWordMask;
+		}
+
+		/*!
+		 * Inverts all used bits of the array of words.
+		 *
+		 * @param words Array of words.
+		 * @param bitsCount Number of the used bits in the array.
+		 */
+		GDINL static void Flip(Word* const words, SizeTp const bitsCount)
+		{
+			auto const wordsCount = GetWordsCount(bitsCount);
+			for (SizeTp wordIndex = 0; wordIndex < wordsCount; ++wordIndex)
+			{
+				words[wordIndex] = ~words[wordIndex];
+			}
+			if (wordsCount != 0)
+			{
+				words[wordsCount - 1] &= GetLastWordMask(bitsCount);
+			}
+		}
+
+		/*!
+		 * Searches for the first set bit, starting from the specified one.
+		 *
+		 * @param words Array of words.
+		 * @param wordsCount Number of words in the array.
+		 * @param firstBit Index of the first bit to check.
+		 *
+		 * @returns Index of the found bit or @ref Npos if nothing was found.
+		 */
+		GDINL static SizeTp FindNextSet(Word const* const words, SizeTp const wordsCount, SizeTp const firstBit)
+		{
+			auto wordIndex = firstBit / BitsPerWord;
+			if (wordIndex >= wordsCount)
+			{
+				return Npos;
+			}
+			auto word = words[wordIndex] & (~Word(0) << firstBit % BitsPerWord);
+			while (word == 0)
+			{
+				if (++wordIndex == wordsCount)
+				{
+					return Npos;
+				}
+				word = words[wordIndex];
+			}
+			return wordIndex * BitsPerWord + GetLowestBit(word);
+		}
+
+		/*!
+		 * Searches for the first cleared bit, starting from the specified one.
+		 *
+		 * @param words Array of words.
+		 * @param bitsCount Number of the used bits in the array.
+		 * @param firstBit Index of the first bit to check.
+		 *
+		 * @returns Index of the found bit or @ref Npos if nothing was found.
+		 */
+		GDINL static SizeTp FindNextUnset(Word const* const words, SizeTp const bitsCount, SizeTp const firstBit)
+		{
+			auto const wordsCount = GetWordsCount(bitsCount);
+			auto wordIndex = firstBit / BitsPerWord;
+			if (wordIndex >= wordsCount)
+			{
+				return Npos;
+			}
+			auto word = ~words[wordIndex] & (~Word(0) << firstBit % BitsPerWord);
+			while (word == 0)
+			{
+				if (++wordIndex == wordsCount)
+				{
+					return Npos;
+				}
+				word = ~words[wordIndex];
+			}
+			auto const bit = wordIndex * BitsPerWord + GetLowestBit(word);
+			return bit < bitsCount ? bit : Npos;
+		}
+
+		/*!
+		 * Searches for the last set bit.
+		 *
+		 * @param words Array of words.
+		 * @param wordsCount Number of words in the array.
+		 *
+		 * @returns Index of the found bit or @ref Npos if nothing was found.
+		 */
+		GDINL static SizeTp FindLastSet(Word const* const words, SizeTp const wordsCount)
+		{
+			for (auto wordIndex = wordsCount; wordIndex != 0; --wordIndex)
+			{
+				if (words[wordIndex - 1] != 0)
+				{
+					return (wordIndex - 1) * BitsPerWord + GetHighestBit(words[wordIndex - 1]);
+				}
+			}
+			return Npos;
+		}
+
+		/*!
+		 * Invokes the predicate for indices of all set bits in the ascending order.
+		 *
+		 * @param words Array of words.
+		 * @param wordsCount Number of words in the array.
+		 * @param predicate Predicate, that accepts index of the bit.
+		 */
+		template<typename TPredicate>
+		GDINL static void ForEachSet(Word const* const words, SizeTp const wordsCount, TPredicate const& predicate)
+		{
+			for (SizeTp wordIndex = 0; wordIndex < wordsCount; ++wordIndex)
+			{
+				for (auto word = words[wordIndex]; word != 0; word &= word - 1)
+				{
+					predicate(wordIndex * BitsPerWord + GetLowestBit(word));
+				}
+			}
+		}
+	};	// class BitWords
+
+	// **------------------------------------------------------------------------------------------**
+	//! Dynamically sized array of bits with word-level set operations.
+	//! Unlike the Vector<bool> specialization, this container is intended to be used as a set of
+	//! indices: flags of the entities, dirty masks, visibility sets. Set algebra is performed
+	//! with bulk kernels, set bits are enumerated with bit scans.
+	// **------------------------------------------------------------------------------------------**
+	class BitVector final
+	{
+	public:
+		using Word = BitWords::Word;
+		SizeTp static const BitsPerWord = BitWords::BitsPerWord;
+		SizeTp static constexpr Npos = BitWords::Npos;
+
+	private:
+		Word*  m_Memory;
+		SizeTp m_Length;
+		SizeTp m_WordsCapacity;
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Constructors and destructor.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Initializes an empty bit vector.
+		 */
+		GDINL explicit BitVector()
+			: m_Memory(nullptr), m_Length(0), m_WordsCapacity(0)
+		{}
+
+		/*!
+		 * Initializes bit vector with specified number of bits.
+		 *
+		 * @param initialLength Number of bits been initialized.
+		 * @param initialValue Initial value of the bits.
+		 */
+		GDINL explicit BitVector(SizeTp const initialLength, bool const initialValue = false)
+			: BitVector()
+		{
+			Reserve(initialLength);
+			Resize(initialLength, initialValue);
+		}
+
+		/*!
+		 * Initializes bit vector with copy of other bit vector.
+		 * @param otherVector Bit vector would be copied.
+		 */
+		GDINL BitVector(BitVector const& otherVector)
+			: BitVector()
+		{
+			Reserve(otherVector.m_Length);
+			CopyWords(otherVector);
+		}
+
+		/*!
+		 * Moves other bit vector here.
+		 * @param otherVector Bit vector would be moved into current object.
+		 */
+		GDINL BitVector(BitVector&& otherVector) noexcept
+			: m_Memory(otherVector.m_Memory), m_Length(otherVector.m_Length), m_WordsCapacity(otherVector.m_WordsCapacity)
+		{
+			otherVector.m_Memory = nullptr;
+			otherVector.m_Length = 0;
+			otherVector.m_WordsCapacity = 0;
+		}
+
+		GDINL ~BitVector()
+		{
+			Clear();
+		}
+
+	private:
+
+		/*!
+		 * Copies bits of the other vector into this one, which has enough capacity.
+		 * @param otherVector Bit vector would be copied.
+		 */
+		GDINL void CopyWords(BitVector const& otherVector)
+		{
+			GD_ASSERT(GetCapacity() >= otherVector.m_Length, "Not enough capacity.");
+			auto const wordsCount = GetWordsCount();
+			auto const otherWordsCount = otherVector.GetWordsCount();
+			if (otherWordsCount != 0)
+			{
+				CMemory::Memcpy(m_Memory, otherVector.m_Memory, otherWordsCount * sizeof(Word));
+			}
+			if (wordsCount > otherWordsCount)
+			{
+				CMemory::Memset(m_Memory + otherWordsCount, 0, (wordsCount - otherWordsCount) * sizeof(Word));
+			}
+			m_Length = otherVector.m_Length;
+		}
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Dynamic size management.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Returns pointer to the words of the bit vector.
+		 */
+		//! @{
+		GDINL Word const* GetData() const
+		{
+			return m_Memory;
+		}
+		GDINL Word* GetData()
+		{
+			return m_Memory;
+		}
+		//! @}
+
+		/*!
+		 * Returns number of bits that exist in bit vector.
+		 */
+		GDINL SizeTp GetLength() const
+		{
+			return m_Length;
+		}
+
+		/*!
+		 * Returns number of words, used by the bits of the bit vector.
+		 */
+		GDINL SizeTp GetWordsCount() const
+		{
+			return BitWords::GetWordsCount(m_Length);
+		}
+
+		/*!
+		 * Returns number of bits that can be placed into bit vector without reallocation.
+		 */
+		GDINL SizeTp GetCapacity() const
+		{
+			return m_WordsCapacity * BitsPerWord;
+		}
+
+		/*!
+		 * Returns true if this bit vector is empty.
+		 */
+		GDINL bool IsEmpty() const
+		{
+			return m_Length == 0;
+		}
+
+		/*!
+		 * Resizes bit vector to make it able to contain specified number of bits.
+		 *
+		 * @param newLength New required length of the bit vector.
+		 * @param value Value of the appended bits.
+		 */
+		GDINL void Resize(SizeTp const newLength, bool const value = false)
+		{
+			if (m_Length < newLength)
+			{
+				ReserveToLength(newLength);
+				if (value)
+				{
+					BitWords::SetRange(m_Memory, m_Length, newLength - m_Length, true);
+				}
+				m_Length = newLength;
+			}
+			else if (m_Length > newLength)
+			{
+				// Bits after the last one are always kept cleared.
+				BitWords::SetRange(m_Memory, newLength, m_Length - newLength, false);
+				m_Length = newLength;
+			}
+		}
+
+		/*!
+		 * Reserves memory for bit vector to make it contain specified number of bits without
+		 * reallocation when calling Resize/InsertLast method.
+		 *
+		 * @param newCapacity New required capacity of the bit vector.
+		 */
+		GDINL void Reserve(SizeTp const newCapacity)
+		{
+			auto const newWordsCapacity = BitWords::GetWordsCount(newCapacity);
+			if (m_WordsCapacity != newWordsCapacity)
+			{
+				if (newCapacity < m_Length)
+				{
+					Resize(newCapacity);
+				}
+
+				Word* newMemory = nullptr;
+				if (newWordsCapacity != 0)
+				{
+					auto const wordsCount = GetWordsCount();
+					newMemory = GD_MALLOC_ARRAY_T(Word, newWordsCapacity);
+					if (wordsCount != 0)
+					{
+						CMemory::Memcpy(newMemory, m_Memory, wordsCount * sizeof(Word));
+					}
+					CMemory::Memset(newMemory + wordsCount, 0, (newWordsCapacity - wordsCount) * sizeof(Word));
+				}
+				if (m_Memory != nullptr)
+				{
+					GD_FREE(m_Memory);
+				}
+
+				m_Memory = newMemory;
+				m_WordsCapacity = newWordsCapacity;
+			}
+		}
+
+		/*!
+		 * Reserves memory for bit vector to make it contain best fitting number of bits
+		 * to predicted new size. This function incrementally grows capacity in 1.3 times.
+		 *
+		 * @param newLength New desired length.
+		 */
+		GDINL void ReserveToLength(SizeTp const newLength)
+		{
+			if (newLength > GetCapacity())
+			{
+				auto const newCapacity = 13 * newLength / 10;
+				Reserve(newCapacity);
+			}
+		}
+
+		/*!
+		 * Shrinks bit vector's capacity to the specified length.
+		 */
+		GDINL void ShrinkToFit()
+		{
+			Reserve(m_Length);
+		}
+
+		/*!
+		 * Removes all bits from the bit vector without memory deallocation.
+		 */
+		GDINL void Emptify()
+		{
+			Resize(0);
+		}
+
+		/*!
+		 * Removes all bits from the bit vector with memory deallocation.
+		 */
+		GDINL void Clear()
+		{
+			m_Length = 0;
+			Reserve(0);
+		}
+
+		/*!
+		 * Appends new bit to the bit vector.
+		 *
+		 * @param value Value of the new bit.
+		 * @returns Index at which new bit was inserted.
+		 */
+		GDINL SizeTp InsertLast(bool const value = false)
+		{
+			ReserveToLength(m_Length + 1);
+			if (value)
+			{
+				m_Memory[m_Length / BitsPerWord] |= Word(1) << m_Length % BitsPerWord;
+			}
+			return m_Length++;
+		}
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Bits access.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Returns value of the bit at the specified index.
+		 */
+		GDINL bool Get(SizeTp const index) const
+		{
+			GD_ASSERT(index < m_Length, "Index is out of bounds");
+			return ((m_Memory[index / BitsPerWord] >> index % BitsPerWord) & 1) != 0;
+		}
+
+		/*!
+		 * Sets value of the bit at the specified index.
+		 *
+		 * @param index Index of the bit.
+		 * @param value New value of the bit.
+		 */
+		GDINL void Set(SizeTp const index, bool const value = true)
+		{
+			GD_ASSERT(index < m_Length, "Index is out of bounds");
+			auto& word = m_Memory[index / BitsPerWord];
+			auto const mask = Word(1) << index % BitsPerWord;
+			word = value ? word | mask : word & ~mask;
+		}
+
+		/*!
+		 * Clears the bit at the specified index.
+		 */
+		GDINL void Reset(SizeTp const index)
+		{
+			Set(index, false);
+		}
+
+		/*!
+		 * Inverts the bit at the specified index.
+		 */
+		GDINL void Flip(SizeTp const index)
+		{
+			GD_ASSERT(index < m_Length, "Index is out of bounds");
+			m_Memory[index / BitsPerWord] ^= Word(1) << index % BitsPerWord;
+		}
+
+		/*!
+		 * Sets value of the range of bits.
+		 *
+		 * @param firstIndex Index of the first bit in the range.
+		 * @param count Number of bits in the range.
+		 * @param value New value of the bits.
+		 */
+		GDINL void SetRange(SizeTp const firstIndex, SizeTp const count, bool const value = true)
+		{
+			GD_ASSERT(firstIndex + count <= m_Length, "Index is out of bounds");
+			BitWords::SetRange(m_Memory, firstIndex, count, value);
+		}
+
+		/*!
+		 * Clears the range of bits.
+		 *
+		 * @param firstIndex Index of the first bit in the range.
+		 * @param count Number of bits in the range.
+		 */
+		GDINL void ResetRange(SizeTp const firstIndex, SizeTp const count)
+		{
+			SetRange(firstIndex, count, false);
+		}
+
+		/*!
+		 * Sets all bits of the bit vector.
+		 */
+		GDINL void SetAll()
+		{
+			BitWords::SetRange(m_Memory, 0, m_Length, true);
+		}
+
+		/*!
+		 * Clears all bits of the bit vector.
+		 */
+		GDINL void ResetAll()
+		{
+			if (m_Length != 0)
+			{
+				CMemory::Memset(m_Memory, 0, GetWordsCount() * sizeof(Word));
+			}
+		}
+
+		/*!
+		 * Inverts all bits of the bit vector.
+		 */
+		GDINL void FlipAll()
+		{
+			BitWords::Flip(m_Memory, m_Length);
+		}
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Queries.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Returns number of set bits.
+		 */
+		GDINL SizeTp CountSet() const
+		{
+			return BitWords::CountBits(m_Memory, GetWordsCount());
+		}
+
+		/*!
+		 * Returns true if at least one bit is set.
+		 */
+		GDINL bool IsAnySet() const
+		{
+			return !BitWords::IsZero(m_Memory, GetWordsCount());
+		}
+
+		/*!
+		 * Returns true if no bits are set.
+		 */
+		GDINL bool IsNoneSet() const
+		{
+			return BitWords::IsZero(m_Memory, GetWordsCount());
+		}
+
+		/*!
+		 * Returns true if all bits are set.
+		 */
+		GDINL bool AreAllSet() const
+		{
+			return BitWords::IsFull(m_Memory, m_Length);
+		}
+
+		/*!
+		 * Searches for the first set bit.
+		 * @returns Index of the found bit or @ref Npos if nothing was found.
+		 */
+		GDINL SizeTp FindFirstSet() const
+		{
+			return BitWords::FindNextSet(m_Memory, GetWordsCount(), 0);
+		}
+
+		/*!
+		 * Searches for the first set bit, starting from the specified one.
+		 *
+		 * @param firstIndex Index of the first bit to check.
+		 * @returns Index of the found bit or @ref Npos if nothing was found.
+		 */
+		GDINL SizeTp FindNextSet(SizeTp const firstIndex) const
+		{
+			return BitWords::FindNextSet(m_Memory, GetWordsCount(), firstIndex);
+		}
+
+		/*!
+		 * Searches for the last set bit.
+		 * @returns Index of the found bit or @ref Npos if nothing was found.
+		 */
+		GDINL SizeTp FindLastSet() const
+		{
+			return BitWords::FindLastSet(m_Memory, GetWordsCount());
+		}
+
+		/*!
+		 * Searches for the first cleared bit.
+		 * @returns Index of the found bit or @ref Npos if nothing was found.
+		 */
+		GDINL SizeTp FindFirstUnset() const
+		{
+			return BitWords::FindNextUnset(m_Memory, m_Length, 0);
+		}
+
+		/*!
+		 * Searches for the first cleared bit, starting from the specified one.
+		 *
+		 * @param firstIndex Index of the first bit to check.
+		 * @returns Index of the found bit or @ref Npos if nothing was found.
+		 */
+		GDINL SizeTp FindNextUnset(SizeTp const firstIndex) const
+		{
+			return BitWords::FindNextUnset(m_Memory, m_Length, firstIndex);
+		}
+
+		/*!
+		 * Invokes the predicate for indices of all set bits in the ascending order.
+		 * @param predicate Predicate, that accepts index of the bit.
+		 */
+		template<typename TPredicate>
+		GDINL void ForEachSet(TPredicate const& predicate) const
+		{
+			BitWords::ForEachSet(m_Memory, GetWordsCount(), predicate);
+		}
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Set operations.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Returns true if at least one bit is set in both bit vectors of the same length.
+		 */
+		GDINL bool Intersects(BitVector const& otherVector) const
+		{
+			GD_ASSERT(m_Length == otherVector.m_Length, "Bit vectors have different lengths.");
+			return BitWords::Intersects(m_Memory, otherVector.m_Memory, GetWordsCount());
+		}
+
+		/*!
+		 * Returns true if all bits, set in the other bit vector of the same length, are also set in this one.
+		 */
+		GDINL bool Includes(BitVector const& otherVector) const
+		{
+			GD_ASSERT(m_Length == otherVector.m_Length, "Bit vectors have different lengths.");
+			return BitWords::Includes(m_Memory, otherVector.m_Memory, GetWordsCount());
+		}
+
+		/*!
+		 * Clears all bits, that are set in the other bit vector of the same length.
+		 */
+		GDINL BitVector& AndNot(BitVector const& otherVector)
+		{
+			GD_ASSERT(m_Length == otherVector.m_Length, "Bit vectors have different lengths.");
+			BitWords::AndNot(m_Memory, otherVector.m_Memory, GetWordsCount());
+			return *this;
+		}
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Overloaded operators.
+		// ------------------------------------------------------------------------------------------
+
+		// bitvector = something
+		GDINL BitVector& operator= (BitVector&& otherVector) noexcept
+		{
+			if (&otherVector != this)
+			{
+				Clear();
+				m_Memory = otherVector.m_Memory;
+				m_Length = otherVector.m_Length;
+				m_WordsCapacity = otherVector.m_WordsCapacity;
+
+				otherVector.m_Memory = nullptr;
+				otherVector.m_Length = 0;
+				otherVector.m_WordsCapacity = 0;
+			}
+			return *this;
+		}
+		GDINL BitVector& operator= (BitVector const& otherVector)
+		{
+			if (&otherVector != this)
+			{
+				ReserveToLength(otherVector.m_Length);
+				CopyWords(otherVector);
+			}
+			return *this;
+		}
+
+		// bitvector[]
+		GDINL bool operator[] (SizeTp const index) const
+		{
+			return Get(index);
+		}
+
+		// bitvector == bitvector
+		GDINL friend bool operator== (BitVector const& lhs, BitVector const& rhs)
+		{
+			return lhs.m_Length == rhs.m_Length && (lhs.m_Length == 0 || CMemory::Memcmp(lhs.m_Memory, rhs.m_Memory, lhs.GetWordsCount() * sizeof(Word)) == 0);
+		}
+		GDINL friend bool operator!= (BitVector const& lhs, BitVector const& rhs)
+		{
+			return !(lhs == rhs);
+		}
+
+		// bitvector &= bitvector
+		GDINL BitVector& operator&= (BitVector const& otherVector)
+		{
+			GD_ASSERT(m_Length == otherVector.m_Length, "Bit vectors have different lengths.");
+			BitWords::And(m_Memory, otherVector.m_Memory, GetWordsCount());
+			return *this;
+		}
+		GDINL friend BitVector operator& (BitVector const& lhs, BitVector const& rhs)
+		{
+			BitVector result(lhs);
+			result &= rhs;
+			return result;
+		}
+
+		// bitvector |= bitvector
+		GDINL BitVector& operator|= (BitVector const& otherVector)
+		{
+			GD_ASSERT(m_Length == otherVector.m_Length, "Bit vectors have different lengths.");
+			BitWords::Or(m_Memory, otherVector.m_Memory, GetWordsCount());
+			return *this;
+		}
+		GDINL friend BitVector operator| (BitVector const& lhs, BitVector const& rhs)
+		{
+			BitVector result(lhs);
+			result |= rhs;
+			return result;
+		}
+
+		// bitvector ^= bitvector
+		GDINL BitVector& operator^= (BitVector const& otherVector)
+		{
+			GD_ASSERT(m_Length == otherVector.m_Length, "Bit vectors have different lengths.");
+			BitWords::Xor(m_Memory, otherVector.m_Memory, GetWordsCount());
+			return *this;
+		}
+		GDINL friend BitVector operator^ (BitVector const& lhs, BitVector const& rhs)
+		{
+			BitVector result(lhs);
+			result ^= rhs;
+			return result;
+		}
+
+		// ~bitvector
+		GDINL friend BitVector operator~ (BitVector const& vector)
+		{
+			BitVector result(vector);
+			result.FlipAll();
+			return result;
+		}
+	};	// class BitVector
+
+GD_NAMESPACE_END
@@ -0,0 +1,108 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/Containers/BitVector_Benchmarks.cpp
+ * Dynamically sized bit array class benchmarks.
+ */
+#include <GoddamnEngine/Core/Containers/BitVector.h>
+#include <GoddamnEngine/Core/Containers/Vector.h>
+
+GD_NAMESPACE_BEGIN
+
+#if GD_TESTING_ENABLED
+
+	SizeTp static const BitVectorBenchmarkLength = 4 * 1024 * 1024;
+
+	// Keeps results of the benchmarks, so that computations are not optimized away.
+	static SizeTp volatile g_BitVectorBenchmarkSink;
+
+	// Fills both containers with the same sparse random bits.
+	GDINL static void GenerateBitVectorBenchmarkInput(BitVector& vector, Vector<bool>& reference, UInt32 const seed)
+	{
+		vector = BitVector(BitVectorBenchmarkLength);
+		reference = Vector<bool>(BitVectorBenchmarkLength);
+		auto random = seed;
+		for (SizeTp cnt = 0; cnt < BitVectorBenchmarkLength; ++cnt)
+		{
+			random = random * 1664525 + 1013904223;
+			auto const bit = (random >> 16) % 16 == 0;
+			vector.Set(cnt, bit);
+			reference[cnt] = bit;
+		}
+	}
+
+	gd_testing_benchmark(BitVectorSetOperations, state)
+	{
+		BitVector lhs, rhs;
+		Vector<bool> lhsReference, rhsReference;
+		GenerateBitVectorBenchmarkInput(lhs, lhsReference, 1);
+		GenerateBitVectorBenchmarkInput(rhs, rhsReference, 2);
+
+		state.measure("Vector<bool>::operator&", BitVectorBenchmarkLength, [&]
+		{
+			for (SizeTp cnt = 0; cnt < BitVectorBenchmarkLength; ++cnt)
+			{
+				lhsReference[cnt] = lhsReference[cnt] && rhsReference[cnt];
+			}
+		});
+		state.measure("BitVector::operator&=", BitVectorBenchmarkLength, [&]
+		{
+			lhs &= rhs;
+		});
+		state.measure("BitVector::Intersects", BitVectorBenchmarkLength, [&]
+		{
+			g_BitVectorBenchmarkSink = lhs.AndNot(rhs).Intersects(rhs);
+		});
+	};
+
+	gd_testing_benchmark(BitVectorQueries, state)
+	{
+		BitVector vector;
+		Vector<bool> reference;
+		GenerateBitVectorBenchmarkInput(vector, reference, 1);
+
+		state.measure("Vector<bool> count", BitVectorBenchmarkLength, [&]
+		{
+			SizeTp count = 0;
+			for (SizeTp cnt = 0; cnt < BitVectorBenchmarkLength; ++cnt)
+			{
+				count += reference[cnt] ? 1 : 0;
+			}
+			g_BitVectorBenchmarkSink = count;
+		});
+		state.measure("BitVector::CountSet", BitVectorBenchmarkLength, [&]
+		{
+			g_BitVectorBenchmarkSink = vector.CountSet();
+		});
+		state.measure("Vector<bool> iteration", BitVectorBenchmarkLength, [&]
+		{
+			SizeTp indicesSum = 0;
+			for (SizeTp cnt = 0; cnt < BitVectorBenchmarkLength; ++cnt)
+			{
+				if (reference[cnt])
+				{
+					indicesSum += cnt;
+				}
+			}
+			g_BitVectorBenchmarkSink = indicesSum;
+		});
+		state.measure("BitVector::ForEachSet", BitVectorBenchmarkLength, [&]
+		{
+			SizeTp indicesSum = 0;
+			vector.ForEachSet([&](SizeTp const index)
+			{
+				indicesSum += index;
+			});
+			g_BitVectorBenchmarkSink = indicesSum;
+		});
+	};
+
+#endif	// if GD_TESTING_ENABLED
+
+GD_NAMESPACE_END
@@ -0,0 +1,274 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/Containers/BitVector_UnitTests.cpp
+ * Dynamically and fixed sized bit array classes tests.
+ */
+#include <GoddamnEngine/Core/Containers/BitVector.h>
+#include <GoddamnEngine/Core/Containers/BitSet.h>
+#include <GoddamnEngine/Core/Containers/Vector.h>
+
+GD_NAMESPACE_BEGIN
+
+#if GD_TESTING_ENABLED
+
+	// Lengths around the word and the vector boundaries.
+	SizeTp static const BitVectorTestLengths[] = { 0, 1, 63, 64, 65, 127, 128, 129, 255, 256, 257, 1000 };
+
+	// Fills the bit vector and the reference with random bits, set with the specified probability out of 8.
+	GDINL static void GenerateBitVectorTestInput(BitVector& vector, Vector<bool>& reference, SizeTp const length, UInt32 const density, UInt32& random)
+	{
+		vector = BitVector(length);
+		reference = Vector<bool>(length);
+		for (SizeTp cnt = 0; cnt < length; ++cnt)
+		{
+			random = random * 1664525 + 1013904223;
+			auto const bit = (random >> 16) % 8 < density;
+			vector.Set(cnt, bit);
+			reference[cnt] = bit;
+		}
+	}
+
+	// Returns true if the bit vector matches the reference.
+	GDINL static bool BitVectorTestMatches(BitVector const& vector, Vector<bool> const& reference)
+	{
+		if (vector.GetLength() != reference.GetLength())
+		{
+			return false;
+		}
+		for (SizeTp cnt = 0; cnt < vector.GetLength(); ++cnt)
+		{
+			if (vector[cnt] != static_cast<bool>(reference[cnt]))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	gd_testing_unit_test(BitVectorBaseOperations)
+	{
+		BitVector vector(100, true);
+		gd_testing_verify(vector.GetLength() == 100 && vector.GetWordsCount() == 2);
+		gd_testing_verify(vector.CountSet() == 100 && vector.AreAllSet());
+
+		vector.Reset(3);
+		vector.Flip(70);
+		gd_testing_verify(!vector[3] && !vector[70] && vector[4] && vector.CountSet() == 98);
+
+		// Bits, removed by the shrinking, are cleared when the vector grows back.
+		vector.Resize(50);
+		vector.Resize(130);
+		gd_testing_verify(vector.CountSet() == 49 && vector.FindLastSet() == 49 && vector.FindNextUnset(4) == 50);
+
+		// Appended bits cross the word boundaries.
+		BitVector appended;
+		for (SizeTp cnt = 0; cnt < 200; ++cnt)
+		{
+			gd_testing_verify(appended.InsertLast(cnt % 3 == 0) == cnt);
+		}
+		gd_testing_verify(appended.GetLength() == 200 && appended.CountSet() == 67);
+		gd_testing_verify(appended[0] && !appended[1] && appended[198] && !appended[199]);
+
+		BitVector appendedCopy(appended);
+		gd_testing_verify(appendedCopy == appended);
+		appendedCopy.Flip(199);
+		gd_testing_verify(appendedCopy != appended);
+
+		BitVector appendedMoved(Utils::Move(appendedCopy));
+		gd_testing_verify(appendedMoved.GetLength() == 200 && appendedCopy.IsEmpty());
+
+		// Assignment of the shorter vector does not keep the bits of the longer one.
+		appendedMoved = BitVector(10, false);
+		appendedMoved.Resize(200);
+		gd_testing_verify(appendedMoved.IsNoneSet());
+
+		appendedMoved.Clear();
+		gd_testing_verify(appendedMoved.IsEmpty() && appendedMoved.GetCapacity() == 0);
+	};
+
+	gd_testing_unit_test(BitVectorRanges)
+	{
+		for (SizeTp firstIndex = 0; firstIndex < 140; firstIndex += 3)
+		{
+			for (SizeTp count = 0; firstIndex + count <= 200; count += 7)
+			{
+				BitVector vector(200);
+				vector.SetRange(firstIndex, count);
+				gd_testing_verify(vector.CountSet() == count);
+				gd_testing_verify(count == 0 || (vector.FindFirstSet() == firstIndex && vector.FindLastSet() == firstIndex + count - 1));
+
+				vector.FlipAll();
+				vector.ResetRange(0, firstIndex);
+				gd_testing_verify(vector.CountSet() == 200 - firstIndex - count);
+
+				vector.SetAll();
+				gd_testing_verify(vector.AreAllSet() && vector.FindFirstUnset() == BitVector::Npos);
+				vector.ResetRange(firstIndex, count);
+				gd_testing_verify(vector.CountSet() == 200 - count && vector.AreAllSet() == (count == 0));
+			}
+		}
+	};
+
+	gd_testing_unit_test(BitVectorSetOperations)
+	{
+		UInt32 random = 1;
+		BitVector lhs, rhs;
+		Vector<bool> lhsReference, rhsReference, expected;
+		for (auto const length : BitVectorTestLengths)
+		{
+			for (UInt32 density = 0; density <= 8; density += 2)
+			{
+				GenerateBitVectorTestInput(lhs, lhsReference, length, density, random);
+				GenerateBitVectorTestInput(rhs, rhsReference, length, 8 - density / 2, random);
+
+				SizeTp count = 0;
+				auto intersects = false;
+				auto includes = true;
+				for (SizeTp cnt = 0; cnt < length; ++cnt)
+				{
+					count += lhsReference[cnt] ? 1 : 0;
+					intersects |= lhsReference[cnt] && rhsReference[cnt];
+					includes &= lhsReference[cnt] || !rhsReference[cnt];
+				}
+				gd_testing_verify(lhs.CountSet() == count);
+				gd_testing_verify(lhs.Intersects(rhs) == intersects && lhs.Includes(rhs) == includes);
+				gd_testing_verify(lhs.Includes(lhs) && lhs.Includes(BitVector(length)));
+
+				expected = Vector<bool>(length);
+				for (SizeTp cnt = 0; cnt < length; ++cnt)
+				{
+					expected[cnt] = lhsReference[cnt] && rhsReference[cnt];
+				}
+				gd_testing_verify(BitVectorTestMatches(lhs & rhs, expected));
+				for (SizeTp cnt = 0; cnt < length; ++cnt)
+				{
+					expected[cnt] = lhsReference[cnt] || rhsReference[cnt];
+				}
+				gd_testing_verify(BitVectorTestMatches(lhs | rhs, expected));
+				for (SizeTp cnt = 0; cnt < length; ++cnt)
+				{
+					expected[cnt] = lhsReference[cnt] != rhsReference[cnt];
+				}
+				gd_testing_verify(BitVectorTestMatches(lhs ^ rhs, expected));
+				for (SizeTp cnt = 0; cnt < length; ++cnt)
+				{
+					expected[cnt] = lhsReference[cnt] && !rhsReference[cnt];
+				}
+				gd_testing_verify(BitVectorTestMatches(BitVector(lhs).AndNot(rhs), expected));
+				for (SizeTp cnt = 0; cnt < length; ++cnt)
+				{
+					expected[cnt] = !lhsReference[cnt];
+				}
+				gd_testing_verify(BitVectorTestMatches(~lhs, expected) && (~lhs).CountSet() == length - count);
+			}
+		}
+	};
+
+	gd_testing_unit_test(BitVectorSearch)
+	{
+		UInt32 random = 1;
+		BitVector vector;
+		Vector<bool> reference;
+		for (auto const length : BitVectorTestLengths)
+		{
+			for (UInt32 density = 0; density <= 8; ++density)
+			{
+				GenerateBitVectorTestInput(vector, reference, length, density, random);
+
+				// Set bits are enumerated in the same order by the search and by the iteration.
+				Vector<SizeTp> expected, found, iterated;
+				for (SizeTp cnt = 0; cnt < length; ++cnt)
+				{
+					if (reference[cnt])
+					{
+						expected.InsertLast(cnt);
+					}
+				}
+				for (auto index = vector.FindFirstSet(); index != BitVector::Npos; index = vector.FindNextSet(index + 1))
+				{
+					found.InsertLast(index);
+				}
+				vector.ForEachSet([&](SizeTp const index)
+				{
+					iterated.InsertLast(index);
+				});
+				gd_testing_verify(found == expected && iterated == expected);
+				gd_testing_verify(vector.FindLastSet() == (expected.IsEmpty() ? BitVector::Npos : expected.GetLast()));
+
+				// Cleared bits never point after the last bit.
+				SizeTp unsetCount = 0;
+				for (auto index = vector.FindFirstUnset(); index != BitVector::Npos; index = vector.FindNextUnset(index + 1))
+				{
+					gd_testing_verify(index < length && !reference[index]);
+					++unsetCount;
+				}
+				gd_testing_verify(unsetCount == length - expected.GetLength());
+			}
+		}
+	};
+
+	// Verifies the fixed size bit set against the bit vector of the same length.
+	template<SizeTp TLength>
+	GDINL static bool BitSetTestOperations()
+	{
+		UInt32 random = 7;
+		BitSet<TLength> lhs, rhs;
+		BitVector lhsVector(TLength), rhsVector(TLength);
+		for (SizeTp cnt = 0; cnt < TLength; ++cnt)
+		{
+			random = random * 1664525 + 1013904223;
+			lhs.Set(cnt, (random >> 16) % 2 == 0);
+			lhsVector.Set(cnt, lhs[cnt]);
+			rhs.Set(cnt, (random >> 20) % 4 == 0);
+			rhsVector.Set(cnt, rhs[cnt]);
+		}
+
+		auto const matches = [](BitSet<TLength> const& set, BitVector const& vector)
+		{
+			return CMemory::Memcmp(set.GetData(), vector.GetData(), BitSet<TLength>::WordsCount * sizeof(BitWords::Word)) == 0;
+		};
+		auto result = matches(lhs & rhs, lhsVector & rhsVector) && matches(lhs | rhs, lhsVector | rhsVector)
+			&& matches(lhs ^ rhs, lhsVector ^ rhsVector) && matches(~lhs, ~lhsVector)
+			&& matches(BitSet<TLength>(lhs).AndNot(rhs), BitVector(lhsVector).AndNot(rhsVector));
+		result &= lhs.CountSet() == lhsVector.CountSet() && lhs.Intersects(rhs) == lhsVector.Intersects(rhsVector);
+		result &= lhs.Includes(rhs) == lhsVector.Includes(rhsVector) && (lhs | rhs).Includes(rhs);
+		result &= lhs.FindFirstSet() == lhsVector.FindFirstSet() && lhs.FindLastSet() == lhsVector.FindLastSet();
+		result &= lhs.FindFirstUnset() == lhsVector.FindFirstUnset() && lhs == lhs && lhs != ~lhs;
+
+		BitSet<TLength> full;
+		full.SetAll();
+		result &= full.AreAllSet() && full.CountSet() == TLength && full.FindFirstUnset() == BitSet<TLength>::Npos;
+		full.ResetRange(TLength / 2, TLength - TLength / 2);
+		result &= full.CountSet() == TLength / 2 && (TLength == 1 || full.FindFirstUnset() == TLength / 2);
+		return result;
+	}
+
+	gd_testing_unit_test(BitSetOperations)
+	{
+		gd_testing_verify(BitSetTestOperations<1>());
+		gd_testing_verify(BitSetTestOperations<64>());
+		gd_testing_verify(BitSetTestOperations<100>());
+		gd_testing_verify(BitSetTestOperations<256>());
+		gd_testing_verify(BitSetTestOperations<1000>());
+
+		BitSet<128> set{ 0, 5, 64, 127 };
+		SizeTp indicesSum = 0;
+		set.ForEachSet([&](SizeTp const index)
+		{
+			indicesSum += index;
+		});
+		gd_testing_verify(set.CountSet() == 4 && indicesSum == 0 + 5 + 64 + 127);
+		gd_testing_verify(set.Includes(BitSet<128>{ 5, 127 }) && !set.Includes(BitSet<128>{ 5, 126 }));
+		gd_testing_verify(set.Intersects(BitSet<128>{ 64 }) && !set.Intersects(BitSet<128>{ 63 }));
+	};
+
+#endif	// if GD_TESTING_ENABLED
+
+GD_NAMESPACE_END
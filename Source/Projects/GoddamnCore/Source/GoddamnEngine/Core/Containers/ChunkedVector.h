@@ -0,0 +1,499 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+
+/*!
+ * @file GoddamnEngine/Core/Containers/ChunkedVector.h
+ * Dynamically sized segmented array class.
+ */
+#pragma once
+
+#include <GoddamnEngine/Include.h>
+#include <GoddamnEngine/Core/Containers/Vector.h>
+
+GD_NAMESPACE_BEGIN
+
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+	// ******                             ChunkedVector<T, N> class.                           ******
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+
+	// **------------------------------------------------------------------------------------------**
+	//! Segmented dynamic array implementation.
+	//! Elements are stored in fixed-size chunks, so growing never relocates existing elements:
+	//! addresses of the elements stay valid until they are erased. Only the small table of chunk
+	//! pointers is reallocated on growth.
+	//!
+	//! @tparam TElement Vector element type.
+	//! @tparam TChunkLength Number of elements in a single chunk. Should be a power of two.
+	//! @tparam TAllocator Allocator used by this vector.
+	// **------------------------------------------------------------------------------------------**
+	template<typename TElement, SizeTp TChunkLength = 64, typename TAllocator = HeapAllocator>
+	class ChunkedVector : private TAllocator
+	{
+		static_assert(TChunkLength > 0 && (TChunkLength & (TChunkLength - 1)) == 0, "Chunk length of the 'ChunkedVector' should be a power of two.");
+
+	public:
+		SizeTp static const ChunkLength = TChunkLength;
+		using AllocatorType        = TAllocator;
+		using ElementType          = TElement;
+		using ConstElementType     = TElement const;
+		using ReferenceType        = TElement&;
+		using ConstReferenceType   = TElement const&;
+		using Iterator             = IndexedContainerIterator<ChunkedVector>;
+		using ConstIterator        = IndexedContainerIterator<ChunkedVector const>;
+		using ReverseIterator      = ReverseContainerIterator<Iterator>;
+		using ReverseConstIterator = ReverseContainerIterator<ConstIterator>;
+
+		GD_CONTAINER_DEFINE_ITERATION_SUPPORT(ChunkedVector)
+
+	private:
+		Vector<TElement*> m_Chunks;
+		SizeTp            m_Length;
+
+	private:
+		GDINL TElement* GetElementSlot(SizeTp const index) const
+		{
+			return m_Chunks[index / TChunkLength] + index % TChunkLength;
+		}
+
+		GDINL void FreeUnusedChunks()
+		{
+			auto const usedChunksCount = (m_Length + TChunkLength - 1) / TChunkLength;
+			while (m_Chunks.GetLength() > usedChunksCount)
+			{
+				GD_FREE(m_Chunks.GetLast());
+				m_Chunks.EraseLast();
+			}
+		}
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Constructors and destructor.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Initializes an empty vector.
+		 */
+		GDINL explicit ChunkedVector()
+			: m_Chunks(), m_Length(0)
+		{}
+
+		/*!
+		 * Initializes vector with specified number of initialized elements.
+		 * @param initialLength Number of elements been initialized.
+		 */
+		GDINL explicit ChunkedVector(SizeTp const initialLength)
+			: ChunkedVector()
+		{
+			Resize(initialLength);
+		}
+
+		/*!
+		 * Initializes vector with copy of values of specified iterators.
+		 *
+		 * @param startIterator First iterator would be copied.
+		 * @param endIterator Last iterator would be copied.
+		 */
+		template<typename TForwardIterator, typename = typename EnableIf<IteratorTraits<TForwardIterator>::IsForward>::Type>
+		GDINL ChunkedVector(TForwardIterator const startIterator, TForwardIterator const endIterator)
+			: ChunkedVector()
+		{
+			Reserve(static_cast<SizeTp>(endIterator - startIterator));
+			for (auto iterator = startIterator; iterator != endIterator; ++iterator)
+			{
+				InsertLast(*iterator);
+			}
+		}
+
+		/*!
+		 * Initializes vector with default C++11's initializer list. You should not use this constructor manually.
+		 * @param initializerList Initializer list passed by the compiler.
+		 */
+		GDINL ChunkedVector(InitializerList<TElement> const& initializerList)
+			: ChunkedVector(initializerList.begin(), initializerList.end())
+		{}
+
+		/*!
+		 * Initializes vector with copy of other vector.
+		 * @param otherVector Vector would be copied.
+		 */
+		GDINL ChunkedVector(ChunkedVector const& otherVector)
+			: ChunkedVector(otherVector.Begin(), otherVector.End())
+		{}
+
+		/*!
+		 * Moves other vector here. Chunks of the other vector are stolen, no elements are moved.
+		 * @param otherVector Vector would be moved into current object.
+		 */
+		GDINL ChunkedVector(ChunkedVector&& otherVector) noexcept
+			: m_Chunks(Utils::Move(otherVector.m_Chunks)), m_Length(otherVector.m_Length)
+		{
+			otherVector.m_Length = 0;
+		}
+
+		GDINL ~ChunkedVector()
+		{
+			Clear();
+		}
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Iteration API.
+		// ------------------------------------------------------------------------------------------
+
+		GDINL Iterator Begin()
+		{
+			return Iterator(*this);
+		}
+		GDINL ConstIterator Begin() const
+		{
+			return ConstIterator(*this);
+		}
+
+		GDINL Iterator End()
+		{
+			return Begin() + m_Length;
+		}
+		GDINL ConstIterator End() const
+		{
+			return Begin() + m_Length;
+		}
+
+		GDINL ReverseIterator ReverseBegin()
+		{
+			return ReverseIterator(End() - 1);
+		}
+		GDINL ReverseConstIterator ReverseBegin() const
+		{
+			return ReverseConstIterator(End() - 1);
+		}
+
+		GDINL ReverseIterator ReverseEnd()
+		{
+			return ReverseIterator(Begin() - 1);
+		}
+		GDINL ReverseConstIterator ReverseEnd() const
+		{
+			return ReverseConstIterator(Begin() - 1);
+		}
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Dynamic size management.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Returns number of elements that exist in vector.
+		 */
+		GDINL SizeTp GetLength() const
+		{
+			return m_Length;
+		}
+
+		/*!
+		 * Returns number of elements that can be placed into vector without allocation.
+		 */
+		GDINL SizeTp GetCapacity() const
+		{
+			return m_Chunks.GetLength() * TChunkLength;
+		}
+
+		/*!
+		 * Returns number of allocated chunks.
+		 */
+		GDINL SizeTp GetChunksCount() const
+		{
+			return m_Chunks.GetLength();
+		}
+
+		/*!
+		 * Returns pointer to the specified chunk of the vector.
+		 * Chunk contains @ref ChunkLength elements, last used chunk may be filled partially.
+		 *
+		 * @param chunkIndex Index of the chunk.
+		 */
+		//! @{
+		GDINL TElement const* GetChunk(SizeTp const chunkIndex) const
+		{
+			return m_Chunks[chunkIndex];
+		}
+		GDINL TElement* GetChunk(SizeTp const chunkIndex)
+		{
+			return m_Chunks[chunkIndex];
+		}
+		//! @}
+
+		/*!
+		 * Returns true if this vector is empty.
+		 */
+		GDINL bool IsEmpty() const
+		{
+			return m_Length == 0;
+		}
+
+		/*!
+		 * Resizes vector to make it able to contain specified number of elements.
+		 * @param newLength New required length of the vector.
+		 */
+		GDINL void Resize(SizeTp const newLength)
+		{
+			if (m_Length < newLength)
+			{
+				Reserve(newLength);
+				for (; m_Length < newLength; ++m_Length)
+				{
+					Algo::InitializeIterator(GetElementSlot(m_Length));
+				}
+			}
+			else
+			{
+				for (; m_Length > newLength; --m_Length)
+				{
+					Algo::DeinitializeIterator(GetElementSlot(m_Length - 1));
+				}
+			}
+		}
+
+		/*!
+		 * Allocates chunks to make vector contain specified number of elements without allocation.
+		 * Existing elements are never relocated.
+		 *
+		 * @param newCapacity New required capacity of the vector.
+		 */
+		GDINL void Reserve(SizeTp const newCapacity)
+		{
+			auto const newChunksCount = (newCapacity + TChunkLength - 1) / TChunkLength;
+			if (newChunksCount > m_Chunks.GetLength())
+			{
+				// Table of chunks grows geometrically, so appending stays amortized constant.
+				m_Chunks.ReserveToLength(newChunksCount);
+				while (m_Chunks.GetLength() < newChunksCount)
+				{
+					m_Chunks.InsertLast(GD_MALLOC_ARRAY_T(TElement, TChunkLength));
+				}
+			}
+		}
+
+		/*!
+		 * Deallocates chunks that contain no elements.
+		 */
+		GDINL void ShrinkToFit()
+		{
+			FreeUnusedChunks();
+			m_Chunks.ShrinkToFit();
+		}
+
+		/*!
+		 * Destroys all elements in the vector without memory deallocation.
+		 */
+		GDINL void Emptify()
+		{
+			Resize(0);
+		}
+
+		/*!
+		 * Destroys all elements in vector with memory deallocation.
+		 */
+		GDINL void Clear()
+		{
+			Emptify();
+			ShrinkToFit();
+		}
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Dynamic elements access.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Returns reference on last element in the vector.
+		 */
+		//! @{
+		GDINL TElement const& GetLast() const
+		{
+			return (*this)[m_Length - 1];
+		}
+		GDINL TElement& GetLast()
+		{
+			return const_cast<TElement&>(const_cast<ChunkedVector const*>(this)->GetLast());
+		}
+		//! @}
+
+		/*!
+		 * Appends new element to the vector. Existing elements are never relocated.
+		 *
+		 * @param newElement New element that would be inserted into the end of container.
+		 * @returns Index at which new element was inserted.
+		 */
+		//! @{
+		GDINL SizeTp InsertLast(TElement&& newElement = TElement())
+		{
+			Reserve(m_Length + 1);
+			Algo::InitializeIterator(GetElementSlot(m_Length), Utils::Forward<TElement>(newElement));
+			return m_Length++;
+		}
+		GDINL SizeTp InsertLast(TElement const& newElement)
+		{
+			Reserve(m_Length + 1);
+			Algo::InitializeIterator(GetElementSlot(m_Length), newElement);
+			return m_Length++;
+		}
+		//! @}
+
+		/*!
+		 * Appends all elements of the other vector to this one.
+		 * If this vector ends exactly on the chunk boundary, chunks of the other vector are adopted
+		 * without touching any element. Otherwise elements are moved one by one.
+		 *
+		 * @param otherVector Vector which elements would be appended.
+		 */
+		GDINL void InsertLast(ChunkedVector&& otherVector)
+		{
+			if (&otherVector == this)
+			{
+				return;
+			}
+			if (m_Length % TChunkLength == 0)
+			{
+				// Dropping our empty trailing chunks and splicing the other's ones.
+				FreeUnusedChunks();
+				m_Chunks.ReserveToLength(m_Chunks.GetLength() + otherVector.m_Chunks.GetLength());
+				for (auto const chunk : otherVector.m_Chunks)
+				{
+					m_Chunks.InsertLast(chunk);
+				}
+				m_Length += otherVector.m_Length;
+				otherVector.m_Chunks.Clear();
+				otherVector.m_Length = 0;
+			}
+			else
+			{
+				Reserve(m_Length + otherVector.m_Length);
+				for (auto& element : otherVector)
+				{
+					InsertLast(Utils::Move(element));
+				}
+				otherVector.Clear();
+			}
+		}
+
+		/*!
+		 * Removes last element from vector.
+		 */
+		GDINL void EraseLast()
+		{
+			GD_ASSERT(m_Length != 0, "vector size is zero");
+			Resize(m_Length - 1);
+		}
+
+		/*!
+		 * Searches for first element in vector by checking equality.
+		 *
+		 * @param element Object that function would be looking for.
+		 * @returns Index of found element or @c SizeTpMax if nothing was found.
+		 */
+		GDINL SizeTp FindFirst(TElement const& element) const
+		{
+			for (SizeTp cnt = 0; cnt < m_Length; ++cnt)
+			{
+				if ((*this)[cnt] == element)
+				{
+					return cnt;
+				}
+			}
+			return SizeTpMax;
+		}
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Overloaded operators.
+		// ------------------------------------------------------------------------------------------
+
+		// vector = something
+		GDINL ChunkedVector& operator= (ChunkedVector&& otherVector) noexcept
+		{
+			if (&otherVector != this)
+			{
+				Clear();
+				m_Chunks = Utils::Move(otherVector.m_Chunks);
+				m_Length = otherVector.m_Length;
+				otherVector.m_Length = 0;
+			}
+			return *this;
+		}
+		GDINL ChunkedVector& operator= (ChunkedVector const& otherVector)
+		{
+			if (&otherVector != this)
+			{
+				Emptify();
+				Reserve(otherVector.m_Length);
+				for (auto const& element : otherVector)
+				{
+					InsertLast(element);
+				}
+			}
+			return *this;
+		}
+
+		// vector[]
+		GDINL TElement const& operator[] (SizeTp const index) const
+		{
+			GD_ASSERT(index < m_Length, "Index is out of bounds");
+			return *GetElementSlot(index);
+		}
+		GDINL TElement& operator[] (SizeTp const index)
+		{
+			return const_cast<TElement&>(const_cast<ChunkedVector const&>(*this)[index]);
+		}
+
+		// vector == vector
+		GDINL friend bool operator== (ChunkedVector const& lhs, ChunkedVector const& rhs)
+		{
+			return lhs.m_Length == rhs.m_Length && Algo::LexicographicalCompare(lhs, rhs, TEqual<TElement>());
+		}
+		GDINL friend bool operator!= (ChunkedVector const& lhs, ChunkedVector const& rhs)
+		{
+			return !(lhs == rhs);
+		}
+
+		// vector += vector
+		GDINL friend ChunkedVector& operator+= (ChunkedVector& lhs, ChunkedVector&& rhs)
+		{
+			lhs.InsertLast(Utils::Move(rhs));
+			return lhs;
+		}
+		GDINL friend ChunkedVector& operator+= (ChunkedVector& lhs, ChunkedVector const& rhs)
+		{
+			lhs.Reserve(lhs.m_Length + rhs.m_Length);
+			for (auto const& element : rhs)
+			{
+				lhs.InsertLast(element);
+			}
+			return lhs;
+		}
+
+		// vector += Element
+		GDINL friend ChunkedVector& operator+= (ChunkedVector& lhs, TElement&& rhs)
+		{
+			lhs.InsertLast(Utils::Forward<TElement>(rhs));
+			return lhs;
+		}
+		GDINL friend ChunkedVector& operator+= (ChunkedVector& lhs, TElement const& rhs)
+		{
+			lhs.InsertLast(rhs);
+			return lhs;
+		}
+
+	};	// class ChunkedVector
+
+GD_NAMESPACE_END
@@ -0,0 +1,133 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/Containers/ChunkedVector_UnitTests.cpp
+ * Dynamically sized segmented array class tests.
+ */
+#include <GoddamnEngine/Core/Containers/ChunkedVector.h>
+
+GD_NAMESPACE_BEGIN
+
+#if GD_TESTING_ENABLED
+
+	using ChunkedVectorInt = ChunkedVector<int, 4>;
+
+	gd_testing_unit_test(ChunkedVectorIntBaseCtors)
+	{
+		ChunkedVectorInt vector{ 0, 1, 2, 3, 4, 5 };
+		gd_testing_verify(vector.GetLength() == 6 && vector.GetChunksCount() == 2);
+		gd_testing_verify(vector[0] == 0 && vector[3] == 3 && vector[5] == 5);
+
+		ChunkedVectorInt vectorCopy(vector);
+		gd_testing_verify(vectorCopy == vector && &vectorCopy[0] != &vector[0]);
+
+		ChunkedVectorInt vectorMoved(Utils::Move(vectorCopy));
+		gd_testing_verify(vectorMoved == vector && vectorCopy.IsEmpty());
+	};
+
+	gd_testing_unit_test(ChunkedVectorIntStableAddresses)
+	{
+		ChunkedVectorInt vector;
+		vector.InsertLast(0);
+		auto const firstElementAddress = &vector[0];
+		for (int cnt = 1; cnt < 100; ++cnt)
+		{
+			vector.InsertLast(cnt);
+		}
+		gd_testing_verify(&vector[0] == firstElementAddress);
+		gd_testing_verify(vector.GetLength() == 100 && vector.GetCapacity() == 100);
+
+		int expected = 0;
+		for (auto const element : vector)
+		{
+			gd_testing_verify(element == expected++);
+		}
+	};
+
+	gd_testing_unit_test(ChunkedVectorIntManyChunks)
+	{
+		ChunkedVectorInt vector;
+		vector.InsertLast(0);
+		auto const firstElementAddress = &vector[0];
+		for (int cnt = 1; cnt < 100000; ++cnt)
+		{
+			vector.InsertLast(cnt);
+		}
+		gd_testing_verify(&vector[0] == firstElementAddress);
+		gd_testing_verify(vector.GetLength() == 100000 && vector.GetChunksCount() == 25000);
+		gd_testing_verify(vector[4095] == 4095 && vector[99999] == 99999);
+
+		// Explicitly reserved chunks are kept on appending.
+		ChunkedVectorInt reserved;
+		reserved.Reserve(1000);
+		gd_testing_verify(reserved.GetChunksCount() == 250);
+		for (int cnt = 0; cnt < 1001; ++cnt)
+		{
+			reserved.InsertLast(cnt);
+		}
+		gd_testing_verify(reserved.GetChunksCount() == 251 && reserved.GetLast() == 1000);
+	};
+
+	gd_testing_unit_test(ChunkedVectorIntConcatenation)
+	{
+		{
+			// Chunk-aligned vector adopts chunks of the other one.
+			ChunkedVectorInt a{ 0, 1, 2, 3 };
+			ChunkedVectorInt b{ 4, 5, 6, 7, 8 };
+			auto const bFirstElementAddress = &b[0];
+
+			a += Utils::Move(b);
+			gd_testing_verify(a == ChunkedVectorInt{ 0, 1, 2, 3, 4, 5, 6, 7, 8 } && b.IsEmpty());
+			gd_testing_verify(&a[4] == bFirstElementAddress);
+		}
+
+		{
+			ChunkedVectorInt a{ 0, 1, 2 };
+			ChunkedVectorInt b{ 3, 4 };
+
+			a += Utils::Move(b);
+			gd_testing_verify(a == ChunkedVectorInt{ 0, 1, 2, 3, 4 } && b.IsEmpty());
+
+			a += ChunkedVectorInt{};
+			gd_testing_verify(a.GetLength() == 5);
+		}
+	};
+
+	gd_testing_unit_test(ChunkedVectorIntLengthAccess)
+	{
+		ChunkedVectorInt vector{ 0, 1, 2 };
+		vector.Resize(6);
+		gd_testing_verify(vector == ChunkedVectorInt{ 0, 1, 2, 0, 0, 0 });
+
+		vector.EraseLast();
+		vector.Resize(2);
+		gd_testing_verify(vector == ChunkedVectorInt{ 0, 1 } && vector.GetChunksCount() == 2);
+
+		vector.ShrinkToFit();
+		gd_testing_verify(vector.GetChunksCount() == 1 && vector.GetLast() == 1);
+		gd_testing_verify(vector.FindFirst(1) == 1 && vector.FindFirst(2) == SizeTpMax);
+
+		try
+		{
+			// This should fail.
+			vector[2];
+			gd_testing_verify(false);
+		}
+		catch (goddamn_testing::assertion_exception const&)
+		{
+			gd_testing_verify(true);
+		}
+
+		vector.Clear();
+		gd_testing_verify(vector.IsEmpty() && vector.GetCapacity() == 0);
+	};
+
+#endif	// if GD_TESTING_ENABLED
+
+GD_NAMESPACE_END
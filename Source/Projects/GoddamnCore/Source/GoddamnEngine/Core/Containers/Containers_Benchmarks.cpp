@@ -0,0 +1,502 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/Containers/Containers_Benchmarks.cpp
+ * Core containers versus standard library containers benchmarks.
+ */
+#include <GoddamnEngine/Core/Containers/Vector.h>
+#include <GoddamnEngine/Core/Containers/String.h>
+#include <GoddamnEngine/Core/Containers/StringBuilder.h>
+#include <GoddamnEngine/Core/Containers/Map.h>
+#include <GoddamnEngine/Core/Containers/Set.h>
+#include <GoddamnEngine/Core/Containers/UnorderedVectorMap.h>
+#include <GoddamnEngine/Core/Containers/List.h>
+
+#if GD_TESTING_ENABLED
+#	include <forward_list>
+#	include <map>
+#	include <set>
+#	include <string>
+#	include <unordered_map>
+#	include <vector>
+#endif	// if GD_TESTING_ENABLED
+
+GD_NAMESPACE_BEGIN
+
+#if GD_TESTING_ENABLED
+
+	// Node-based and contiguous containers are compared on the same lengths, vector-backed map - on
+	// the short ones it is meant for. Each case is named "<operation>/<length>/<container>".
+	SizeTp static const ContainersBenchmarkLengths[] = { 100, 10000, 1000000 };
+	SizeTp static const ContainersBenchmarkShortLengths[] = { 16, 256, 4096 };
+	SizeTp static const ContainersBenchmarkTextLengths[] = { 8, 64, 4096 };
+	SizeTp static const ContainersBenchmarkTextOperations = 100000;
+	SizeTp static const ContainersBenchmarkMoveOperations = 100000;
+	UInt32 static const ContainersBenchmarkRepetitions = 3;
+
+	// Keeps results of the benchmarks, so that computations are not optimized away.
+	static UInt64 volatile g_ContainersBenchmarkSink;
+
+	// Allocator of the standard containers, that allocates through the engine allocators, so that
+	// memory of both kinds of containers is accounted the same way.
+	template<typename TElement>
+	struct ContainersBenchmarkStdAllocator
+	{
+		using value_type = TElement;
+
+		GDINL ContainersBenchmarkStdAllocator() = default;
+		template<typename TOtherElement>
+		GDINL ContainersBenchmarkStdAllocator(ContainersBenchmarkStdAllocator<TOtherElement> const&) {}
+
+		GDINL TElement* allocate(std::size_t const count)
+		{
+			return GD_MALLOC_ARRAY_T(TElement, count);
+		}
+		GDINL void deallocate(TElement* const pointer, std::size_t const count)
+		{
+			GD_NOT_USED(count);
+			GD_FREE(pointer);
+		}
+
+		template<typename TOtherElement>
+		GDINL bool operator== (ContainersBenchmarkStdAllocator<TOtherElement> const&) const { return true; }
+		template<typename TOtherElement>
+		GDINL bool operator!= (ContainersBenchmarkStdAllocator<TOtherElement> const&) const { return false; }
+	};	// struct ContainersBenchmarkStdAllocator
+
+	using StdVector = std::vector<UInt32, ContainersBenchmarkStdAllocator<UInt32>>;
+	using StdString = std::basic_string<Char, std::char_traits<Char>, ContainersBenchmarkStdAllocator<Char>>;
+	using StdMap = std::map<UInt32, UInt32, std::less<UInt32>, ContainersBenchmarkStdAllocator<std::pair<UInt32 const, UInt32>>>;
+	using StdSet = std::set<UInt32, std::less<UInt32>, ContainersBenchmarkStdAllocator<UInt32>>;
+	using StdUnorderedMap = std::unordered_map<UInt32, UInt32, std::hash<UInt32>, std::equal_to<UInt32>, ContainersBenchmarkStdAllocator<std::pair<UInt32 const, UInt32>>>;
+	using StdForwardList = std::forward_list<UInt32, ContainersBenchmarkStdAllocator<UInt32>>;
+
+	// Keys are inserted in pseudo-random order: multiplication by odd number is a permutation.
+	GDINL static UInt32 ContainersBenchmarkKey(SizeTp const index)
+	{
+		return static_cast<UInt32>(index * 2654435761u);
+	}
+
+	// Measures the case, named after the operation, length and container.
+	template<typename TFunc>
+	GDINL static void ContainersBenchmarkMeasure(goddamn_testing::benchmark_state& state, CStr const operation, SizeTp const length, CStr const containerName
+		, SizeTp const itemsCount, TFunc const& caseFunction)
+	{
+		Char caseName[128];
+		CString::Snprintf(caseName, GetLength(caseName), "%s/%llu/%s", operation, static_cast<unsigned long long>(length), containerName);
+		state.measure(caseName, itemsCount, caseFunction, ContainersBenchmarkRepetitions);
+	}
+
+	// ------------------------------------------------------------------------------------------
+	// Adapters, that give Core and standard containers a common interface.
+	// ------------------------------------------------------------------------------------------
+
+	GDINL static void ContainersBenchmarkInsert(Vector<UInt32>& container, UInt32 const key) { container.InsertLast(key); }
+	GDINL static void ContainersBenchmarkInsert(StdVector& container, UInt32 const key) { container.push_back(key); }
+	GDINL static void ContainersBenchmarkInsert(Map<UInt32, UInt32>& container, UInt32 const key) { container.Insert(key, key); }
+	GDINL static void ContainersBenchmarkInsert(StdMap& container, UInt32 const key) { container.emplace(key, key); }
+	GDINL static void ContainersBenchmarkInsert(Set<UInt32>& container, UInt32 const key) { container.Insert(key); }
+	GDINL static void ContainersBenchmarkInsert(StdSet& container, UInt32 const key) { container.insert(key); }
+	GDINL static void ContainersBenchmarkInsert(UnorderedVectorMap<UInt32, UInt32>& container, UInt32 const key) { container.Insert(key, key); }
+	GDINL static void ContainersBenchmarkInsert(StdUnorderedMap& container, UInt32 const key) { container.emplace(key, key); }
+	GDINL static void ContainersBenchmarkInsert(LinkedList<UInt32>& container, UInt32 const key) { container.InsertFirst(key); }
+	GDINL static void ContainersBenchmarkInsert(StdForwardList& container, UInt32 const key) { container.push_front(key); }
+
+	// Vectors are looked up by index, associative containers - by key.
+	GDINL static UInt32 ContainersBenchmarkLookup(Vector<UInt32> const& container, UInt32 const key) { return container[key % container.GetLength()]; }
+	GDINL static UInt32 ContainersBenchmarkLookup(StdVector const& container, UInt32 const key) { return container[key % container.size()]; }
+	GDINL static UInt32 ContainersBenchmarkLookup(Map<UInt32, UInt32> const& container, UInt32 const key) { return *container.Find(key); }
+	GDINL static UInt32 ContainersBenchmarkLookup(StdMap const& container, UInt32 const key) { return container.find(key)->second; }
+	GDINL static UInt32 ContainersBenchmarkLookup(Set<UInt32> const& container, UInt32 const key) { return *container.Find(key); }
+	GDINL static UInt32 ContainersBenchmarkLookup(StdSet const& container, UInt32 const key) { return *container.find(key); }
+	GDINL static UInt32 ContainersBenchmarkLookup(UnorderedVectorMap<UInt32, UInt32> const& container, UInt32 const key) { return *container.Find(key); }
+	GDINL static UInt32 ContainersBenchmarkLookup(StdUnorderedMap const& container, UInt32 const key) { return container.find(key)->second; }
+
+	GDINL static void ContainersBenchmarkErase(Vector<UInt32>& container, UInt32 const key) { GD_NOT_USED(key); container.EraseLast(); }
+	GDINL static void ContainersBenchmarkErase(StdVector& container, UInt32 const key) { GD_NOT_USED(key); container.pop_back(); }
+	GDINL static void ContainersBenchmarkErase(Map<UInt32, UInt32>& container, UInt32 const key) { container.Erase(key); }
+	GDINL static void ContainersBenchmarkErase(StdMap& container, UInt32 const key) { container.erase(key); }
+	GDINL static void ContainersBenchmarkErase(Set<UInt32>& container, UInt32 const key) { container.Erase(key); }
+	GDINL static void ContainersBenchmarkErase(StdSet& container, UInt32 const key) { container.erase(key); }
+	GDINL static void ContainersBenchmarkErase(UnorderedVectorMap<UInt32, UInt32>& container, UInt32 const key) { container.Erase(key); }
+	GDINL static void ContainersBenchmarkErase(StdUnorderedMap& container, UInt32 const key) { container.erase(key); }
+	GDINL static void ContainersBenchmarkErase(LinkedList<UInt32>& container, UInt32 const key) { GD_NOT_USED(key); container.EraseFirst(); }
+	GDINL static void ContainersBenchmarkErase(StdForwardList& container, UInt32 const key) { GD_NOT_USED(key); container.pop_front(); }
+
+	GDINL static UInt32 ContainersBenchmarkValue(UInt32 const element) { return element; }
+	GDINL static UInt32 ContainersBenchmarkValue(MapPair<UInt32, UInt32> const& element) { return element.Value; }
+	GDINL static UInt32 ContainersBenchmarkValue(std::pair<UInt32 const, UInt32> const& element) { return element.second; }
+
+	template<typename TContainer>
+	GDINL static void ContainersBenchmarkFill(TContainer& container, SizeTp const length)
+	{
+		for (SizeTp cnt = 0; cnt < length; ++cnt)
+		{
+			ContainersBenchmarkInsert(container, ContainersBenchmarkKey(cnt));
+		}
+	}
+
+	// ------------------------------------------------------------------------------------------
+	// Operations, measured for each pair of containers.
+	// ------------------------------------------------------------------------------------------
+
+	template<typename TContainer>
+	GDINL static void ContainersBenchmarkInsertCase(goddamn_testing::benchmark_state& state, SizeTp const length, CStr const containerName)
+	{
+		ContainersBenchmarkMeasure(state, "Insert", length, containerName, length, [length]
+		{
+			TContainer container;
+			ContainersBenchmarkFill(container, length);
+			g_ContainersBenchmarkSink = ContainersBenchmarkValue(*begin(container));
+		});
+	}
+
+	template<typename TContainer>
+	GDINL static void ContainersBenchmarkLookupCase(goddamn_testing::benchmark_state& state, SizeTp const length, CStr const containerName)
+	{
+		TContainer container;
+		ContainersBenchmarkFill(container, length);
+		ContainersBenchmarkMeasure(state, "Lookup", length, containerName, length, [length, &container]
+		{
+			UInt64 sum = 0;
+			for (SizeTp cnt = 0; cnt < length; ++cnt)
+			{
+				sum += ContainersBenchmarkLookup(container, ContainersBenchmarkKey(cnt));
+			}
+			g_ContainersBenchmarkSink = sum;
+		});
+	}
+
+	template<typename TContainer>
+	GDINL static void ContainersBenchmarkIterateCase(goddamn_testing::benchmark_state& state, SizeTp const length, CStr const containerName)
+	{
+		TContainer container;
+		ContainersBenchmarkFill(container, length);
+		ContainersBenchmarkMeasure(state, "Iterate", length, containerName, length, [&container]
+		{
+			UInt64 sum = 0;
+			for (auto const& element : container)
+			{
+				sum += ContainersBenchmarkValue(element);
+			}
+			g_ContainersBenchmarkSink = sum;
+		});
+	}
+
+	// Containers are filled before the measurement, so that only erasure is timed.
+	template<typename TContainer>
+	GDINL static void ContainersBenchmarkEraseCase(goddamn_testing::benchmark_state& state, SizeTp const length, CStr const containerName)
+	{
+		TContainer containers[ContainersBenchmarkRepetitions];
+		for (auto& container : containers)
+		{
+			ContainersBenchmarkFill(container, length);
+		}
+		UInt32 repetition = 0;
+		ContainersBenchmarkMeasure(state, "Erase", length, containerName, length, [length, &containers, &repetition]
+		{
+			auto& container = containers[repetition++];
+			for (SizeTp cnt = 0; cnt < length; ++cnt)
+			{
+				ContainersBenchmarkErase(container, ContainersBenchmarkKey(cnt));
+			}
+		});
+	}
+
+	template<typename TContainer>
+	GDINL static void ContainersBenchmarkCopyCase(goddamn_testing::benchmark_state& state, SizeTp const length, CStr const containerName)
+	{
+		TContainer container;
+		ContainersBenchmarkFill(container, length);
+		ContainersBenchmarkMeasure(state, "Copy", length, containerName, length, [&container]
+		{
+			TContainer const containerCopy(container);
+			g_ContainersBenchmarkSink = ContainersBenchmarkValue(*begin(containerCopy));
+		});
+	}
+
+	template<typename TContainer>
+	GDINL static void ContainersBenchmarkMoveCase(goddamn_testing::benchmark_state& state, SizeTp const length, CStr const containerName)
+	{
+		TContainer container;
+		ContainersBenchmarkFill(container, length);
+		ContainersBenchmarkMeasure(state, "Move", length, containerName, ContainersBenchmarkMoveOperations, [&container]
+		{
+			for (SizeTp cnt = 0; cnt < ContainersBenchmarkMoveOperations; ++cnt)
+			{
+				TContainer movedContainer(Utils::Move(container));
+				container = Utils::Move(movedContainer);
+			}
+			g_ContainersBenchmarkSink = ContainersBenchmarkValue(*begin(container));
+		});
+	}
+
+	// ------------------------------------------------------------------------------------------
+	// Benchmarks.
+	// ------------------------------------------------------------------------------------------
+
+	gd_testing_benchmark(ContainersVector, state)
+	{
+		for (auto const length : ContainersBenchmarkLengths)
+		{
+			ContainersBenchmarkInsertCase<Vector<UInt32>>(state, length, "Vector");
+			ContainersBenchmarkInsertCase<StdVector>(state, length, "std::vector");
+			ContainersBenchmarkLookupCase<Vector<UInt32>>(state, length, "Vector");
+			ContainersBenchmarkLookupCase<StdVector>(state, length, "std::vector");
+			ContainersBenchmarkIterateCase<Vector<UInt32>>(state, length, "Vector");
+			ContainersBenchmarkIterateCase<StdVector>(state, length, "std::vector");
+			ContainersBenchmarkEraseCase<Vector<UInt32>>(state, length, "Vector");
+			ContainersBenchmarkEraseCase<StdVector>(state, length, "std::vector");
+			ContainersBenchmarkCopyCase<Vector<UInt32>>(state, length, "Vector");
+			ContainersBenchmarkCopyCase<StdVector>(state, length, "std::vector");
+			ContainersBenchmarkMoveCase<Vector<UInt32>>(state, length, "Vector");
+			ContainersBenchmarkMoveCase<StdVector>(state, length, "std::vector");
+		}
+	};
+
+	// Core associative containers and lists are not copyable, so copying is not compared.
+	gd_testing_benchmark(ContainersMap, state)
+	{
+		for (auto const length : ContainersBenchmarkLengths)
+		{
+			ContainersBenchmarkInsertCase<Map<UInt32, UInt32>>(state, length, "Map");
+			ContainersBenchmarkInsertCase<StdMap>(state, length, "std::map");
+			ContainersBenchmarkLookupCase<Map<UInt32, UInt32>>(state, length, "Map");
+			ContainersBenchmarkLookupCase<StdMap>(state, length, "std::map");
+			ContainersBenchmarkIterateCase<Map<UInt32, UInt32>>(state, length, "Map");
+			ContainersBenchmarkIterateCase<StdMap>(state, length, "std::map");
+			ContainersBenchmarkEraseCase<Map<UInt32, UInt32>>(state, length, "Map");
+			ContainersBenchmarkEraseCase<StdMap>(state, length, "std::map");
+			ContainersBenchmarkMoveCase<Map<UInt32, UInt32>>(state, length, "Map");
+			ContainersBenchmarkMoveCase<StdMap>(state, length, "std::map");
+		}
+	};
+
+	gd_testing_benchmark(ContainersSet, state)
+	{
+		for (auto const length : ContainersBenchmarkLengths)
+		{
+			ContainersBenchmarkInsertCase<Set<UInt32>>(state, length, "Set");
+			ContainersBenchmarkInsertCase<StdSet>(state, length, "std::set");
+			ContainersBenchmarkLookupCase<Set<UInt32>>(state, length, "Set");
+			ContainersBenchmarkLookupCase<StdSet>(state, length, "std::set");
+			ContainersBenchmarkIterateCase<Set<UInt32>>(state, length, "Set");
+			ContainersBenchmarkIterateCase<StdSet>(state, length, "std::set");
+			ContainersBenchmarkEraseCase<Set<UInt32>>(state, length, "Set");
+			ContainersBenchmarkEraseCase<StdSet>(state, length, "std::set");
+			ContainersBenchmarkMoveCase<Set<UInt32>>(state, length, "Set");
+			ContainersBenchmarkMoveCase<StdSet>(state, length, "std::set");
+		}
+	};
+
+	// Vector-backed map is searched linearly, so it is compared with the hash map on short lengths.
+	gd_testing_benchmark(ContainersUnorderedVectorMap, state)
+	{
+		for (auto const length : ContainersBenchmarkShortLengths)
+		{
+			ContainersBenchmarkInsertCase<UnorderedVectorMap<UInt32, UInt32>>(state, length, "UnorderedVectorMap");
+			ContainersBenchmarkInsertCase<StdUnorderedMap>(state, length, "std::unordered_map");
+			ContainersBenchmarkLookupCase<UnorderedVectorMap<UInt32, UInt32>>(state, length, "UnorderedVectorMap");
+			ContainersBenchmarkLookupCase<StdUnorderedMap>(state, length, "std::unordered_map");
+			ContainersBenchmarkIterateCase<UnorderedVectorMap<UInt32, UInt32>>(state, length, "UnorderedVectorMap");
+			ContainersBenchmarkIterateCase<StdUnorderedMap>(state, length, "std::unordered_map");
+			ContainersBenchmarkEraseCase<UnorderedVectorMap<UInt32, UInt32>>(state, length, "UnorderedVectorMap");
+			ContainersBenchmarkEraseCase<StdUnorderedMap>(state, length, "std::unordered_map");
+			ContainersBenchmarkMoveCase<UnorderedVectorMap<UInt32, UInt32>>(state, length, "UnorderedVectorMap");
+			ContainersBenchmarkMoveCase<StdUnorderedMap>(state, length, "std::unordered_map");
+		}
+	};
+
+	// Lists have no random access, so lookup is not compared.
+	gd_testing_benchmark(ContainersLinkedList, state)
+	{
+		for (auto const length : ContainersBenchmarkLengths)
+		{
+			ContainersBenchmarkInsertCase<LinkedList<UInt32>>(state, length, "LinkedList");
+			ContainersBenchmarkInsertCase<StdForwardList>(state, length, "std::forward_list");
+			ContainersBenchmarkIterateCase<LinkedList<UInt32>>(state, length, "LinkedList");
+			ContainersBenchmarkIterateCase<StdForwardList>(state, length, "std::forward_list");
+			ContainersBenchmarkEraseCase<LinkedList<UInt32>>(state, length, "LinkedList");
+			ContainersBenchmarkEraseCase<StdForwardList>(state, length, "std::forward_list");
+			ContainersBenchmarkMoveCase<LinkedList<UInt32>>(state, length, "LinkedList");
+			ContainersBenchmarkMoveCase<StdForwardList>(state, length, "std::forward_list");
+		}
+	};
+
+	// ------------------------------------------------------------------------------------------
+	// Strings.
+	// ------------------------------------------------------------------------------------------
+
+	GDINL static SizeTp ContainersBenchmarkFind(String const& text, Char const character) { return text.Find(character); }
+	GDINL static SizeTp ContainersBenchmarkFind(StdString const& text, Char const character) { return text.find(character); }
+
+	GDINL static String ContainersBenchmarkConcatenate(String const& text, Char const* const suffix) { return text + suffix; }
+	GDINL static StdString ContainersBenchmarkConcatenate(StdString const& text, Char const* const suffix) { return text + suffix; }
+
+	// Both strings are immutable in this case: removal produces a new string.
+	GDINL static String ContainersBenchmarkRemove(String const& text) { return text.RemoveLen(text.GetLength() / 4, text.GetLength() / 2); }
+	GDINL static StdString ContainersBenchmarkRemove(StdString const& text) { return StdString(text).erase(text.size() / 4, text.size() / 2); }
+
+	GDINL static SizeTp ContainersBenchmarkTextLength(String const& text) { return text.GetLength(); }
+	GDINL static SizeTp ContainersBenchmarkTextLength(StdString const& text) { return text.size(); }
+
+	// Strings of the specified length are processed many times, each case reports time of a single operation.
+	template<typename TString>
+	GDINL static void ContainersBenchmarkStringCases(goddamn_testing::benchmark_state& state, SizeTp const length, CStr const containerName)
+	{
+		StdString const source(length, 'a');
+		TString text(source.c_str(), length);
+		ContainersBenchmarkMeasure(state, "Construct", length, containerName, ContainersBenchmarkTextOperations, [length, &source]
+		{
+			SizeTp sum = 0;
+			for (SizeTp cnt = 0; cnt < ContainersBenchmarkTextOperations; ++cnt)
+			{
+				TString const newText(source.c_str(), length);
+				sum += ContainersBenchmarkTextLength(newText);
+			}
+			g_ContainersBenchmarkSink = sum;
+		});
+		ContainersBenchmarkMeasure(state, "Find", length, containerName, ContainersBenchmarkTextOperations, [&text]
+		{
+			SizeTp sum = 0;
+			for (SizeTp cnt = 0; cnt < ContainersBenchmarkTextOperations; ++cnt)
+			{
+				sum += ContainersBenchmarkFind(text, 'b');
+			}
+			g_ContainersBenchmarkSink = sum;
+		});
+		ContainersBenchmarkMeasure(state, "Iterate", length, containerName, ContainersBenchmarkTextOperations, [&text]
+		{
+			UInt64 sum = 0;
+			for (SizeTp cnt = 0; cnt < ContainersBenchmarkTextOperations; ++cnt)
+			{
+				for (auto const character : text)
+				{
+					sum += character;
+				}
+			}
+			g_ContainersBenchmarkSink = sum;
+		});
+		ContainersBenchmarkMeasure(state, "Concatenate", length, containerName, ContainersBenchmarkTextOperations, [&text]
+		{
+			SizeTp sum = 0;
+			for (SizeTp cnt = 0; cnt < ContainersBenchmarkTextOperations; ++cnt)
+			{
+				sum += ContainersBenchmarkTextLength(ContainersBenchmarkConcatenate(text, ".suffix"));
+			}
+			g_ContainersBenchmarkSink = sum;
+		});
+		ContainersBenchmarkMeasure(state, "Erase", length, containerName, ContainersBenchmarkTextOperations, [&text]
+		{
+			SizeTp sum = 0;
+			for (SizeTp cnt = 0; cnt < ContainersBenchmarkTextOperations; ++cnt)
+			{
+				sum += ContainersBenchmarkTextLength(ContainersBenchmarkRemove(text));
+			}
+			g_ContainersBenchmarkSink = sum;
+		});
+		ContainersBenchmarkMeasure(state, "Copy", length, containerName, ContainersBenchmarkTextOperations, [&text]
+		{
+			SizeTp sum = 0;
+			for (SizeTp cnt = 0; cnt < ContainersBenchmarkTextOperations; ++cnt)
+			{
+				TString const textCopy(text);
+				sum += ContainersBenchmarkTextLength(textCopy);
+			}
+			g_ContainersBenchmarkSink = sum;
+		});
+		ContainersBenchmarkMeasure(state, "Move", length, containerName, ContainersBenchmarkMoveOperations, [&text]
+		{
+			for (SizeTp cnt = 0; cnt < ContainersBenchmarkMoveOperations; ++cnt)
+			{
+				TString movedText(Utils::Move(text));
+				text = Utils::Move(movedText);
+			}
+			g_ContainersBenchmarkSink = ContainersBenchmarkTextLength(text);
+		});
+	}
+
+	gd_testing_benchmark(ContainersString, state)
+	{
+		for (auto const length : ContainersBenchmarkTextLengths)
+		{
+			ContainersBenchmarkStringCases<String>(state, length, "String");
+			ContainersBenchmarkStringCases<StdString>(state, length, "std::string");
+		}
+	};
+
+	GDINL static void ContainersBenchmarkAppend(StringBuilder& builder, Char const* const text, SizeTp const textLength) { builder.Append(text, textLength); }
+	GDINL static void ContainersBenchmarkAppend(StdString& builder, Char const* const text, SizeTp const textLength) { builder.append(text, textLength); }
+
+	GDINL static String ContainersBenchmarkToString(StringBuilder const& builder) { return builder.ToString(); }
+	GDINL static StdString ContainersBenchmarkToString(StdString const& builder) { return builder; }
+
+	GDINL static Char const* ContainersBenchmarkCStr(StringBuilder const& builder) { return builder.CStr(); }
+	GDINL static Char const* ContainersBenchmarkCStr(StdString const& builder) { return builder.c_str(); }
+
+	// Text is built from the short pieces, as log lines and generated sources are.
+	template<typename TBuilder>
+	GDINL static void ContainersBenchmarkStringBuilderCases(goddamn_testing::benchmark_state& state, SizeTp const length, CStr const containerName)
+	{
+		Char const piece[] = "piece, ";
+		SizeTp const pieceLength = GetLength(piece) - 1;
+		auto const fill = [length, &piece, pieceLength](TBuilder& builder)
+		{
+			for (SizeTp cnt = 0; cnt < length; ++cnt)
+			{
+				ContainersBenchmarkAppend(builder, piece, cnt % 4 == 3 ? 1 : pieceLength);
+			}
+		};
+
+		ContainersBenchmarkMeasure(state, "Append", length, containerName, length, [&fill]
+		{
+			TBuilder builder;
+			fill(builder);
+			g_ContainersBenchmarkSink = *ContainersBenchmarkCStr(builder);
+		});
+
+		TBuilder builder;
+		fill(builder);
+		ContainersBenchmarkMeasure(state, "Iterate", length, containerName, length, [&builder]
+		{
+			UInt64 sum = 0;
+			for (auto text = ContainersBenchmarkCStr(builder); *text != '\0'; ++text)
+			{
+				sum += *text;
+			}
+			g_ContainersBenchmarkSink = sum;
+		});
+		ContainersBenchmarkMeasure(state, "ToString", length, containerName, length, [&builder]
+		{
+			auto const text = ContainersBenchmarkToString(builder);
+			g_ContainersBenchmarkSink = ContainersBenchmarkTextLength(text);
+		});
+		ContainersBenchmarkMeasure(state, "Move", length, containerName, ContainersBenchmarkMoveOperations, [&builder]
+		{
+			for (SizeTp cnt = 0; cnt < ContainersBenchmarkMoveOperations; ++cnt)
+			{
+				TBuilder movedBuilder(Utils::Move(builder));
+				builder = Utils::Move(movedBuilder);
+			}
+			g_ContainersBenchmarkSink = *ContainersBenchmarkCStr(builder);
+		});
+	}
+
+	gd_testing_benchmark(ContainersStringBuilder, state)
+	{
+		for (auto const length : ContainersBenchmarkLengths)
+		{
+			ContainersBenchmarkStringBuilderCases<StringBuilder>(state, length, "StringBuilder");
+			ContainersBenchmarkStringBuilderCases<StdString>(state, length, "std::string");
+		}
+	};
+
+#endif	// if GD_TESTING_ENABLED
+
+GD_NAMESPACE_END
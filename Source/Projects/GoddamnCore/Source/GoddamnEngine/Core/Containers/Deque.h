@@ -0,0 +1,437 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/Containers/Deque.h
+ * Dynamically sized double-ended queue class.
+ */
+#pragma once
+
+#include <GoddamnEngine/Include.h>
+#include <GoddamnEngine/Core/Containers/Vector.h>
+
+GD_NAMESPACE_BEGIN
+
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+	// ******                                  Deque<T> class.                                 ******
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+
+	// **------------------------------------------------------------------------------------------**
+	//! Double-ended queue implementation over the growable ring buffer.
+	//! Elements are stored contiguously in a single allocation, that wraps around its end, so
+	//! insertion and removal on both ends take constant time and never allocate per element.
+	//! Capacity is always a power of two, growth doubles it and unwraps the elements.
+	//!
+	//! @tparam TElement Deque element type.
+	//! @tparam TAllocator Allocator used by this deque.
+	// **------------------------------------------------------------------------------------------**
+	template<typename TElement, typename TAllocator = HeapAllocator>
+	class Deque : private TAllocator
+	{
+	public:
+		using AllocatorType        = TAllocator;
+		using ElementType          = TElement;
+		using ConstElementType     = TElement const;
+		using ReferenceType        = TElement&;
+		using ConstReferenceType   = TElement const&;
+		using Iterator             = IndexedContainerIterator<Deque>;
+		using ConstIterator        = IndexedContainerIterator<Deque const>;
+		using ReverseIterator      = ReverseContainerIterator<Iterator>;
+		using ReverseConstIterator = ReverseContainerIterator<ConstIterator>;
+
+		GD_CONTAINER_DEFINE_ITERATION_SUPPORT(Deque)
+
+	private:
+		SizeTp static const MinCapacity = 8;
+
+	private:
+		TElement* m_Memory;
+		SizeTp    m_Head;
+		SizeTp    m_Length;
+		SizeTp    m_Capacity;
+
+	private:
+		GDINL TElement* GetElementSlot(SizeTp const index) const
+		{
+			return m_Memory + ((m_Head + index) & (m_Capacity - 1));
+		}
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Constructors and destructor.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Initializes an empty deque.
+		 */
+		GDINL explicit Deque()
+			: m_Memory(nullptr), m_Head(0), m_Length(0), m_Capacity(0)
+		{}
+
+		/*!
+		 * Initializes deque with copy of values of specified iterators.
+		 *
+		 * @param startIterator First iterator would be copied.
+		 * @param endIterator Last iterator would be copied.
+		 */
+		template<typename TForwardIterator, typename = typename EnableIf<IteratorTraits<TForwardIterator>::IsForward>::Type>
+		GDINL Deque(TForwardIterator const startIterator, TForwardIterator const endIterator)
+			: Deque()
+		{
+			Reserve(static_cast<SizeTp>(endIterator - startIterator));
+			for (auto iterator = startIterator; iterator != endIterator; ++iterator)
+			{
+				InsertLast(*iterator);
+			}
+		}
+
+		/*!
+		 * Initializes deque with default C++11's initializer list. You should not use this constructor manually.
+		 * @param initializerList Initializer list passed by the compiler.
+		 */
+		GDINL Deque(InitializerList<TElement> const& initializerList)
+			: Deque(initializerList.begin(), initializerList.end())
+		{}
+
+		/*!
+		 * Initializes deque with copy of other deque.
+		 * @param otherDeque Deque would be copied.
+		 */
+		GDINL Deque(Deque const& otherDeque)
+			: Deque(otherDeque.Begin(), otherDeque.End())
+		{}
+
+		/*!
+		 * Moves other deque here.
+		 * @param otherDeque Deque would be moved into current object.
+		 */
+		GDINL Deque(Deque&& otherDeque) noexcept
+			: m_Memory(otherDeque.m_Memory), m_Head(otherDeque.m_Head), m_Length(otherDeque.m_Length), m_Capacity(otherDeque.m_Capacity)
+		{
+			otherDeque.m_Memory = nullptr;
+			otherDeque.m_Head = 0;
+			otherDeque.m_Length = 0;
+			otherDeque.m_Capacity = 0;
+		}
+
+		GDINL ~Deque()
+		{
+			Clear();
+		}
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Iteration API.
+		// ------------------------------------------------------------------------------------------
+
+		GDINL Iterator Begin()
+		{
+			return Iterator(*this);
+		}
+		GDINL ConstIterator Begin() const
+		{
+			return ConstIterator(*this);
+		}
+
+		GDINL Iterator End()
+		{
+			return Begin() + m_Length;
+		}
+		GDINL ConstIterator End() const
+		{
+			return Begin() + m_Length;
+		}
+
+		GDINL ReverseIterator ReverseBegin()
+		{
+			return ReverseIterator(End() - 1);
+		}
+		GDINL ReverseConstIterator ReverseBegin() const
+		{
+			return ReverseConstIterator(End() - 1);
+		}
+
+		GDINL ReverseIterator ReverseEnd()
+		{
+			return ReverseIterator(Begin() - 1);
+		}
+		GDINL ReverseConstIterator ReverseEnd() const
+		{
+			return ReverseConstIterator(Begin() - 1);
+		}
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Dynamic size management.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Returns number of elements that exist in deque.
+		 */
+		GDINL SizeTp GetLength() const
+		{
+			return m_Length;
+		}
+
+		/*!
+		 * Returns number of elements that can be placed into deque without reallocation.
+		 */
+		GDINL SizeTp GetCapacity() const
+		{
+			return m_Capacity;
+		}
+
+		/*!
+		 * Returns true if this deque is empty.
+		 */
+		GDINL bool IsEmpty() const
+		{
+			return m_Length == 0;
+		}
+
+		/*!
+		 * Reserves memory for deque to make it contain specified number of elements without reallocation.
+		 * Capacity is rounded up to the power of two, elements are unwrapped to the start of the new buffer.
+		 *
+		 * @param newCapacity New required capacity of the deque.
+		 */
+		GDINL void Reserve(SizeTp const newCapacity)
+		{
+			if (newCapacity > m_Capacity)
+			{
+				auto roundedCapacity = m_Capacity != 0 ? m_Capacity : MinCapacity;
+				while (roundedCapacity < newCapacity)
+				{
+					roundedCapacity *= 2;
+				}
+
+				auto const newMemory = GD_MALLOC_ARRAY_T(TElement, roundedCapacity);
+				if (m_Length != 0)
+				{
+					// Elements occupy either a single segment, or the tail of the buffer followed by its head.
+					auto const firstSegmentLength = Min(m_Length, m_Capacity - m_Head);
+					Algo::RelocateRange(m_Memory + m_Head, m_Memory + m_Head + firstSegmentLength, newMemory);
+					Algo::RelocateRange(m_Memory, m_Memory + m_Length - firstSegmentLength, newMemory + firstSegmentLength);
+				}
+				GD_FREE(m_Memory);
+				m_Memory = newMemory;
+				m_Head = 0;
+				m_Capacity = roundedCapacity;
+			}
+		}
+
+		/*!
+		 * Destroys all elements in the deque without memory deallocation.
+		 */
+		GDINL void Emptify()
+		{
+			while (m_Length != 0)
+			{
+				EraseLast();
+			}
+			m_Head = 0;
+		}
+
+		/*!
+		 * Destroys all elements in deque with memory deallocation.
+		 */
+		GDINL void Clear()
+		{
+			Emptify();
+			GD_FREE(m_Memory);
+			m_Memory = nullptr;
+			m_Capacity = 0;
+		}
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Dynamic elements access.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Returns reference on first element in the deque.
+		 */
+		//! @{
+		GDINL TElement const& GetFirst() const
+		{
+			return (*this)[0];
+		}
+		GDINL TElement& GetFirst()
+		{
+			return const_cast<TElement&>(const_cast<Deque const*>(this)->GetFirst());
+		}
+		//! @}
+
+		/*!
+		 * Returns reference on last element in the deque.
+		 */
+		//! @{
+		GDINL TElement const& GetLast() const
+		{
+			return (*this)[m_Length - 1];
+		}
+		GDINL TElement& GetLast()
+		{
+			return const_cast<TElement&>(const_cast<Deque const*>(this)->GetLast());
+		}
+		//! @}
+
+		/*!
+		 * Prepends new element to the deque.
+		 * @param newElement New element that would be inserted into the beginning of container.
+		 */
+		//! @{
+		GDINL void InsertFirst(TElement&& newElement = TElement())
+		{
+			if (m_Length == m_Capacity)
+			{
+				// Element may reference this deque's memory, so moving it out before relocation.
+				TElement element(Utils::Forward<TElement>(newElement));
+				Reserve(m_Length + 1);
+				InsertFirst(Utils::Move(element));
+				return;
+			}
+			m_Head = (m_Head - 1) & (m_Capacity - 1);
+			Algo::InitializeIterator(m_Memory + m_Head, Utils::Forward<TElement>(newElement));
+			m_Length += 1;
+		}
+		GDINL void InsertFirst(TElement const& newElement)
+		{
+			if (m_Length == m_Capacity)
+			{
+				// Element may reference this deque's memory, so copying it before relocation.
+				TElement element(newElement);
+				Reserve(m_Length + 1);
+				InsertFirst(Utils::Move(element));
+				return;
+			}
+			m_Head = (m_Head - 1) & (m_Capacity - 1);
+			Algo::InitializeIterator(m_Memory + m_Head, newElement);
+			m_Length += 1;
+		}
+		//! @}
+
+		/*!
+		 * Appends new element to the deque.
+		 * @param newElement New element that would be inserted into the end of container.
+		 */
+		//! @{
+		GDINL void InsertLast(TElement&& newElement = TElement())
+		{
+			if (m_Length == m_Capacity)
+			{
+				// Element may reference this deque's memory, so moving it out before relocation.
+				TElement element(Utils::Forward<TElement>(newElement));
+				Reserve(m_Length + 1);
+				InsertLast(Utils::Move(element));
+				return;
+			}
+			Algo::InitializeIterator(GetElementSlot(m_Length), Utils::Forward<TElement>(newElement));
+			m_Length += 1;
+		}
+		GDINL void InsertLast(TElement const& newElement)
+		{
+			if (m_Length == m_Capacity)
+			{
+				// Element may reference this deque's memory, so copying it before relocation.
+				TElement element(newElement);
+				Reserve(m_Length + 1);
+				InsertLast(Utils::Move(element));
+				return;
+			}
+			Algo::InitializeIterator(GetElementSlot(m_Length), newElement);
+			m_Length += 1;
+		}
+		//! @}
+
+		/*!
+		 * Removes first element from deque.
+		 */
+		GDINL void EraseFirst()
+		{
+			GD_ASSERT(m_Length != 0, "Deque size is zero.");
+			Algo::DeinitializeIterator(m_Memory + m_Head);
+			m_Head = (m_Head + 1) & (m_Capacity - 1);
+			m_Length -= 1;
+		}
+
+		/*!
+		 * Removes last element from deque.
+		 */
+		GDINL void EraseLast()
+		{
+			GD_ASSERT(m_Length != 0, "Deque size is zero.");
+			Algo::DeinitializeIterator(GetElementSlot(m_Length - 1));
+			m_Length -= 1;
+		}
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Overloaded operators.
+		// ------------------------------------------------------------------------------------------
+
+		// deque = something
+		GDINL Deque& operator= (Deque&& otherDeque) noexcept
+		{
+			if (&otherDeque != this)
+			{
+				Clear();
+				m_Memory = otherDeque.m_Memory;
+				m_Head = otherDeque.m_Head;
+				m_Length = otherDeque.m_Length;
+				m_Capacity = otherDeque.m_Capacity;
+				otherDeque.m_Memory = nullptr;
+				otherDeque.m_Head = 0;
+				otherDeque.m_Length = 0;
+				otherDeque.m_Capacity = 0;
+			}
+			return *this;
+		}
+		GDINL Deque& operator= (Deque const& otherDeque)
+		{
+			if (&otherDeque != this)
+			{
+				Emptify();
+				Reserve(otherDeque.m_Length);
+				for (auto const& element : otherDeque)
+				{
+					InsertLast(element);
+				}
+			}
+			return *this;
+		}
+
+		// deque[]
+		GDINL TElement const& operator[] (SizeTp const index) const
+		{
+			GD_ASSERT(index < m_Length, "Index is out of bounds");
+			return *GetElementSlot(index);
+		}
+		GDINL TElement& operator[] (SizeTp const index)
+		{
+			return const_cast<TElement&>(const_cast<Deque const&>(*this)[index]);
+		}
+
+		// deque == deque
+		GDINL friend bool operator== (Deque const& lhs, Deque const& rhs)
+		{
+			return lhs.m_Length == rhs.m_Length && Algo::LexicographicalCompare(lhs, rhs, TEqual<TElement>());
+		}
+		GDINL friend bool operator!= (Deque const& lhs, Deque const& rhs)
+		{
+			return !(lhs == rhs);
+		}
+
+	};	// class Deque
+
+GD_NAMESPACE_END
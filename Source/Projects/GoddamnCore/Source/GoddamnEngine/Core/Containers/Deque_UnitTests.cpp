@@ -0,0 +1,166 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/Containers/Deque_UnitTests.cpp
+ * Dynamically sized double-ended queue class tests.
+ */
+#include <GoddamnEngine/Core/Containers/Deque.h>
+#include <GoddamnEngine/Core/Containers/String.h>
+
+GD_NAMESPACE_BEGIN
+
+#if GD_TESTING_ENABLED
+
+	gd_testing_unit_test(DequeBaseOperations)
+	{
+		Deque<Int32> deque{ 1, 2, 3 };
+		gd_testing_verify(deque.GetLength() == 3 && deque.GetFirst() == 1 && deque.GetLast() == 3);
+
+		deque.InsertFirst(0);
+		deque.InsertLast(4);
+		gd_testing_verify(deque.GetLength() == 5 && deque[0] == 0 && deque[4] == 4);
+
+		Int32 expected = 0;
+		for (auto const element : deque)
+		{
+			gd_testing_verify(element == expected++);
+		}
+		for (auto iterator = deque.ReverseBegin(); iterator != deque.ReverseEnd(); ++iterator)
+		{
+			gd_testing_verify(*iterator == --expected);
+		}
+
+		deque.EraseFirst();
+		deque.EraseLast();
+		gd_testing_verify(deque == Deque<Int32>({ 1, 2, 3 }));
+
+		Deque<Int32> dequeCopy(deque);
+		gd_testing_verify(dequeCopy == deque && &dequeCopy[0] != &deque[0]);
+		Deque<Int32> dequeMoved(Utils::Move(dequeCopy));
+		gd_testing_verify(dequeMoved == deque && dequeCopy.IsEmpty() && dequeCopy.GetCapacity() == 0);
+
+		// Elements of the full deque are inserted into it again.
+		Deque<String> strings;
+		for (SizeTp cnt = 0; strings.GetLength() != strings.GetCapacity() || cnt == 0; ++cnt)
+		{
+			strings.InsertLast(String(40, static_cast<Char>('a' + cnt)));
+		}
+		auto const stringsLength = strings.GetLength();
+		strings.InsertLast(Utils::Move(strings[0]));
+		gd_testing_verify(strings.GetLength() == stringsLength + 1 && strings.GetLast() == String(40, 'a'));
+		while (strings.GetLength() != strings.GetCapacity())
+		{
+			strings.InsertLast(String(40, 'z'));
+		}
+		strings.InsertFirst(Utils::Move(strings.GetLast()));
+		gd_testing_verify(strings.GetFirst() == String(40, 'z'));
+		while (strings.GetLength() != strings.GetCapacity())
+		{
+			strings.InsertLast(String(40, 'y'));
+		}
+		strings.InsertLast(strings[2]);
+		strings.InsertFirst(strings.GetLast());
+		gd_testing_verify(strings.GetFirst() == String(40, 'b') && strings.GetLast() == String(40, 'b'));
+
+		deque.Emptify();
+		gd_testing_verify(deque.IsEmpty() && deque.GetCapacity() != 0);
+		deque.Clear();
+		gd_testing_verify(deque.IsEmpty() && deque.GetCapacity() == 0);
+	};
+
+	gd_testing_unit_test(DequeWrapAround)
+	{
+		// Queue, that slides through the buffer, wraps around its end and never grows.
+		Deque<Int32> deque;
+		deque.Reserve(16);
+		gd_testing_verify(deque.GetCapacity() == 16);
+		for (Int32 cnt = 0; cnt < 10; ++cnt)
+		{
+			deque.InsertLast(cnt);
+		}
+		for (Int32 cnt = 10; cnt < 1000; ++cnt)
+		{
+			gd_testing_verify(deque.GetFirst() == cnt - 10);
+			deque.EraseFirst();
+			deque.InsertLast(cnt);
+		}
+		gd_testing_verify(deque.GetCapacity() == 16 && deque.GetLength() == 10);
+
+		// Growth of the wrapped buffer keeps the order of elements.
+		for (Int32 cnt = 1000; cnt < 1100; ++cnt)
+		{
+			deque.InsertLast(cnt);
+		}
+		gd_testing_verify(deque.GetCapacity() == 128 && deque.GetLength() == 110);
+		for (SizeTp cnt = 0; cnt < deque.GetLength(); ++cnt)
+		{
+			gd_testing_verify(deque[cnt] == static_cast<Int32>(cnt) + 990);
+		}
+	};
+
+	gd_testing_unit_test(DequeRandomOperations)
+	{
+		Deque<String> deque;
+		Vector<String> expected;
+		UInt32 random = 1;
+		for (UInt32 cnt = 0; cnt < 5000; ++cnt)
+		{
+			random = random * 1664525 + 1013904223;
+			auto const element = "element #" + String::FromUInt64(cnt);
+			switch ((random >> 16) % 5)
+			{
+				case 0:
+					deque.InsertFirst(element);
+					expected.InsertAt(0, element);
+					break;
+				case 1:
+				case 2:
+					deque.InsertLast(element);
+					expected.InsertLast(element);
+					break;
+				case 3:
+					if (!expected.IsEmpty())
+					{
+						gd_testing_verify(deque.GetFirst() == expected[0]);
+						deque.EraseFirst();
+						expected.EraseAt(0);
+					}
+					break;
+				default:
+					if (!expected.IsEmpty())
+					{
+						gd_testing_verify(deque.GetLast() == expected.GetLast());
+						deque.EraseLast();
+						expected.EraseLast();
+					}
+					break;
+			}
+		}
+
+		// Inserting copies of own elements survives the reallocation.
+		while (deque.GetLength() != deque.GetCapacity())
+		{
+			deque.InsertLast(deque.GetFirst());
+			expected.InsertLast(expected[0]);
+		}
+		deque.InsertLast(deque.GetFirst());
+		expected.InsertLast(expected[0]);
+		deque.InsertFirst(deque.GetLast());
+		expected.InsertAt(0, expected.GetLast());
+
+		gd_testing_verify(deque.GetLength() == expected.GetLength());
+		for (SizeTp cnt = 0; cnt < expected.GetLength(); ++cnt)
+		{
+			gd_testing_verify(deque[cnt] == expected[cnt]);
+		}
+	};
+
+#endif	// if GD_TESTING_ENABLED
+
+GD_NAMESPACE_END
@@ -0,0 +1,274 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/Containers/EytzingerVector.h
+ * Immutable sorted array in the Eytzinger layout.
+ */
+#pragma once
+
+#include <GoddamnEngine/Include.h>
+#include <GoddamnEngine/Core/CStdlib/CMemory.h>
+#include <GoddamnEngine/Core/Containers/Vector.h>
+
+#if GD_COMPILER_MSVC_COMPATIBLE
+#	include <intrin.h>
+#endif	// if GD_COMPILER_MSVC_COMPATIBLE
+
+GD_NAMESPACE_BEGIN
+
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+	// ******                             EytzingerVector<T> class.                            ******
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+
+	// **------------------------------------------------------------------------------------------**
+	//! Immutable sorted array, that stores elements in the breadth-first order of the implicit
+	//! binary search tree (Eytzinger layout). First levels of the tree share a few cache lines, 
+	//! and descendants of the node are adjacent, so they could be prefetched several steps ahead.
+	//! On large arrays searches are several times faster than the binary search.
+	//!
+	//! Search functions return indices in the original sorted array, so the vector could be used
+	//! as an index to the other data.
+	//!
+	//! @tparam TElement Container element type.
+	//! @tparam TAllocator Allocator used by this vector.
+	// **------------------------------------------------------------------------------------------**
+	template<typename TElement, typename TAllocator = DefaultContainerAllocator>
+	class EytzingerVector : public TNonCopyable
+	{
+	public:
+		using ElementType          = TElement;
+
+	private:
+		//! Number of the elements in one cache line, nodes are prefetched this amount of levels ahead.
+		SizeTp static const PrefetchStride = sizeof(TElement) < 64 ? 64 / sizeof(TElement) : 1;
+
+		Vector<TElement, TAllocator> m_Elements;
+		Vector<SizeTp, TAllocator>   m_SortedIndices;
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Constructor and destructor.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Initializes an empty vector.
+		 */
+		GDINL EytzingerVector() = default;
+
+		/*!
+		 * Moves other vector here.
+		 * @param otherVector Vector would be moved into current object.
+		 */
+		GDINL EytzingerVector(EytzingerVector&& otherVector) = default;
+
+		/*!
+		 * Initializes vector with the elements of the sorted range.
+		 *
+		 * @param startIterator Start of the sorted elements range.
+		 * @param endIterator End of the sorted elements range.
+		 */
+		template<typename TRandomAccessIterator>
+		GDINL EytzingerVector(TRandomAccessIterator const startIterator, TRandomAccessIterator const endIterator)
+		{
+			Assign(startIterator, endIterator);
+		}
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Vector manipulation.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Returns number of the elements in the vector.
+		 */
+		GDINL SizeTp GetLength() const
+		{
+			return m_Elements.GetLength();
+		}
+
+		/*!
+		 * Returns true if this vector is empty.
+		 */
+		GDINL bool IsEmpty() const
+		{
+			return m_Elements.IsEmpty();
+		}
+
+		/*!
+		 * Removes all elements from the vector.
+		 */
+		GDINL void Clear()
+		{
+			m_Elements.Clear();
+			m_SortedIndices.Clear();
+		}
+
+		/*!
+		 * Replaces contents of the vector with the elements of the sorted range.
+		 *
+		 * @param startIterator Start of the sorted elements range.
+		 * @param endIterator End of the sorted elements range.
+		 */
+		template<typename TRandomAccessIterator>
+		GDINL void Assign(TRandomAccessIterator const startIterator, TRandomAccessIterator const endIterator)
+		{
+			SizeTp const length = endIterator - startIterator;
+			m_Elements.Clear();
+			m_SortedIndices.Resize(length);
+			BuildSortedIndices(0, 0);
+
+			m_Elements.Reserve(length);
+			for (SizeTp layoutIndex = 0; layoutIndex < length; ++layoutIndex)
+			{
+				m_Elements.InsertLast(*(startIterator + m_SortedIndices[layoutIndex]));
+			}
+			for (SizeTp sortedIndex = 1; sortedIndex < length; ++sortedIndex)
+			{
+				GD_ASSERT(!(*(startIterator + sortedIndex) < *(startIterator + sortedIndex - 1)), "Elements should be sorted.");
+			}
+		}
+
+		/*!
+		 * Returns element with the specified index in the original sorted array.
+		 * Takes logarithmic time, since elements are not stored in the sorted order.
+		 *
+		 * @param sortedIndex Index of the element in the sorted array.
+		 */
+		GDINL TElement const& GetSortedElement(SizeTp const sortedIndex) const
+		{
+			GD_ASSERT(sortedIndex < m_Elements.GetLength(), "Index is out of bounds");
+			
+			// Descending the tree, same as during search, but the index is compared.
+			auto const length = m_Elements.GetLength();
+			SizeTp layoutIndex = 0;
+			while (m_SortedIndices[layoutIndex] != sortedIndex)
+			{
+				layoutIndex = 2 * layoutIndex + (m_SortedIndices[layoutIndex] < sortedIndex ? 2 : 1);
+				GD_ASSERT(layoutIndex < length, "Index is out of bounds");
+			}
+			return m_Elements[layoutIndex];
+		}
+
+		/*!
+		 * Returns index of the first element in the original sorted array, that is not less than
+		 * the specified value.
+		 *
+		 * @param value Value we are searching for.
+		 * @returns Index in the sorted array or length of the vector.
+		 */
+		template<typename TValue>
+		GDINL SizeTp LowerBound(TValue const& value) const
+		{
+			auto const layoutIndex = LowerBoundLayoutIndex(value);
+			return layoutIndex != m_Elements.GetLength() ? m_SortedIndices[layoutIndex] : layoutIndex;
+		}
+
+		/*!
+		 * Searches for the element, that is equal to the specified value.
+		 *
+		 * @param value Value we are searching for.
+		 * @returns Index in the sorted array or @c SizeTpMax if nothing was found.
+		 */
+		template<typename TValue>
+		GDINL SizeTp FindIndex(TValue const& value) const
+		{
+			auto const layoutIndex = LowerBoundLayoutIndex(value);
+			if (layoutIndex != m_Elements.GetLength() && !(value < m_Elements[layoutIndex]))
+			{
+				return m_SortedIndices[layoutIndex];
+			}
+			return SizeTpMax;
+		}
+
+		/*!
+		 * Searches for the element, that is equal to the specified value.
+		 *
+		 * @param value Value we are searching for.
+		 * @returns Pointer to the element if it was found and null pointer otherwise.
+		 */
+		template<typename TValue>
+		GDINL TElement const* Find(TValue const& value) const
+		{
+			auto const layoutIndex = LowerBoundLayoutIndex(value);
+			if (layoutIndex != m_Elements.GetLength() && !(value < m_Elements[layoutIndex]))
+			{
+				return &m_Elements[layoutIndex];
+			}
+			return nullptr;
+		}
+
+	private:
+
+		/*!
+		 * Fills the sorted indices of the subtree with in-order traversal.
+		 * @returns Next free sorted index.
+		 */
+		GDINL SizeTp BuildSortedIndices(SizeTp const layoutIndex, SizeTp sortedIndex)
+		{
+			if (layoutIndex < m_SortedIndices.GetLength())
+			{
+				sortedIndex = BuildSortedIndices(2 * layoutIndex + 1, sortedIndex);
+				m_SortedIndices[layoutIndex] = sortedIndex++;
+				sortedIndex = BuildSortedIndices(2 * layoutIndex + 2, sortedIndex);
+			}
+			return sortedIndex;
+		}
+
+		/*!
+		 * Returns index in the layout of the first element, that is not less than the specified value,
+		 * or length of the vector.
+		 */
+		template<typename TValue>
+		GDINL SizeTp LowerBoundLayoutIndex(TValue const& value) const
+		{
+			auto const elements = m_Elements.GetData();
+			auto const length = m_Elements.GetLength();
+
+			// Nodes are numbered from one here, so children of the node 'i' are '2i' and '2i + 1'.
+			SizeTp index = 1;
+			while (index <= length)
+			{
+				// Prefetch address may be out of bounds, it is never dereferenced.
+				CMemory::Prefetch(reinterpret_cast<CHandle>(reinterpret_cast<UIntPtr>(elements) + (index * PrefetchStride - 1) * sizeof(TElement)));
+				index = 2 * index + static_cast<SizeTp>(elements[index - 1] < value);
+			}
+
+			// Trailing ones of the index are right turns after the last left turn: dropping them
+			// together with the left turn gives the node, where the value was less than the element.
+			auto const inverseIndex = static_cast<UInt64>(~index);
+#if GD_COMPILER_MSVC_COMPATIBLE && (GD_ARCHITECTURE_X64 || GD_ARCHITECTURE_ARM64)
+			unsigned long trailingOnes;
+			_BitScanForward64(&trailingOnes, inverseIndex);
+#elif GD_COMPILER_MSVC_COMPATIBLE
+			unsigned long trailingOnes;
+			if (!_BitScanForward(&trailingOnes, static_cast<unsigned long>(inverseIndex)))
+			{
+				_BitScanForward(&trailingOnes, static_cast<unsigned long>(inverseIndex >> 32));
+				trailingOnes += 32;
+			}
+#else	// if GD_COMPILER_MSVC_COMPATIBLE
+			auto const trailingOnes = __builtin_ctzll(inverseIndex);
+#endif	// if GD_COMPILER_MSVC_COMPATIBLE
+			index >>= trailingOnes + 1;
+			return index != 0 ? index - 1 : length;
+		}
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Overloaded operators.
+		// ------------------------------------------------------------------------------------------
+
+		GDINL EytzingerVector& operator= (EytzingerVector&& otherVector) = default;
+
+	};	// class EytzingerVector
+
+GD_NAMESPACE_END
@@ -0,0 +1,78 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/Containers/EytzingerVector_UnitTests.cpp
+ * Immutable sorted array in the Eytzinger layout.
+ */
+#include <GoddamnEngine/Core/Containers/EytzingerVector.h>
+
+GD_NAMESPACE_BEGIN
+
+#if GD_TESTING_ENABLED
+
+	gd_testing_unit_test(EytzingerVectorSearch)
+	{
+		for (Int32 length = 0; length < 300; ++length)
+		{
+			// Odd values only, so that missing values could be searched for.
+			Vector<Int32> sorted;
+			for (Int32 cnt = 0; cnt < length; ++cnt)
+			{
+				sorted.InsertLast(2 * cnt + 1);
+			}
+
+			EytzingerVector<Int32> eytzinger(sorted.Begin(), sorted.End());
+			gd_testing_verify(eytzinger.GetLength() == static_cast<SizeTp>(length));
+			for (Int32 value = 0; value <= 2 * length + 1; ++value)
+			{
+				auto const expectedIndex = static_cast<SizeTp>(value / 2);
+				gd_testing_verify(eytzinger.LowerBound(value) == expectedIndex);
+				if (value % 2 != 0 && value < 2 * length)
+				{
+					gd_testing_verify(eytzinger.FindIndex(value) == expectedIndex);
+					gd_testing_verify(*eytzinger.Find(value) == value);
+					gd_testing_verify(eytzinger.GetSortedElement(expectedIndex) == value);
+				}
+				else
+				{
+					gd_testing_verify(eytzinger.FindIndex(value) == SizeTpMax);
+					gd_testing_verify(eytzinger.Find(value) == nullptr);
+				}
+			}
+		}
+	};
+
+	gd_testing_unit_test(EytzingerVectorDuplicates)
+	{
+		Int32 const sorted[] = { 1, 1, 1, 2, 2, 3, 3, 3, 3, 5 };
+		EytzingerVector<Int32> eytzinger(sorted, sorted + 10);
+		gd_testing_verify(eytzinger.LowerBound(1) == 0);
+		gd_testing_verify(eytzinger.LowerBound(2) == 3);
+		gd_testing_verify(eytzinger.LowerBound(3) == 5);
+		gd_testing_verify(eytzinger.LowerBound(4) == 9);
+		gd_testing_verify(eytzinger.LowerBound(6) == 10);
+	};
+
+	gd_testing_unit_test(EytzingerVectorUnsorted)
+	{
+		Int32 const unsorted[] = { 1, 3, 2 };
+		try
+		{
+			EytzingerVector<Int32> eytzinger(unsorted, unsorted + 3);
+			gd_testing_verify(false);
+		}
+		catch (goddamn_testing::assertion_exception const&)
+		{
+			gd_testing_verify(true);
+		}
+	};
+
+#endif	// if GD_TESTING_ENABLED
+
+GD_NAMESPACE_END
@@ -0,0 +1,246 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/Containers/FlatMap.h
+ * Dynamically sized sorted vector-based associative container class.
+ */
+#pragma once
+
+#include <GoddamnEngine/Include.h>
+#include <GoddamnEngine/Core/Containers/Map.h>
+#include <GoddamnEngine/Core/Containers/FlatTable/FlatTable.h>
+
+GD_NAMESPACE_BEGIN
+
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+	// ******                               FlatMap<K, V> class.                               ******
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+
+	// **------------------------------------------------------------------------------------------**
+	//! Key selector for the tables of key-value pairs.
+	// **------------------------------------------------------------------------------------------**
+	template<typename TKey, typename TValue>
+	struct FlatMapKeySelector final : public TNonCreatable
+	{
+	public:
+		GDINL static TKey const& GetKey(MapPair<TKey, TValue> const& pair)
+		{
+			return pair.Key;
+		}
+	};	// struct FlatMapKeySelector
+
+	// **------------------------------------------------------------------------------------------**
+	//! Dynamically sized associative container that is implemented with sorted dynamic array.
+	//! Drop-in replacement for the map class for the read-mostly data: pairs are stored
+	//! contiguously and are searched with binary search. Tables should be built with
+	//! @ref Assign or @ref InsertRange, since single insertions take linear time.
+	//!
+	//! Lookup functions accept any key type, that is comparable with the map keys, e.g. string
+	//! maps could be searched with C strings.
+	//!
+	//! @tparam TKey Key type, used for searching.
+	//! @tparam TValue Type of elements stored in the map.
+	//! @tparam TAllocator Allocator used by this map.
+	// **------------------------------------------------------------------------------------------**
+	template<typename TKey, typename TValue, typename TAllocator = DefaultContainerAllocator>
+	class FlatMap : public FlatTable<TKey, MapPair<TKey, TValue>, FlatMapKeySelector<TKey, TValue>, TAllocator>
+	{
+	public:
+		using PairType             = MapPair<TKey, TValue>;
+		using ElementType          = PairType;
+		using FlatTableType        = FlatTable<TKey, PairType, FlatMapKeySelector<TKey, TValue>, TAllocator>;
+		using Iterator             = typename FlatTableType::Iterator;
+		using ConstIterator        = typename FlatTableType::ConstIterator;
+		using ReverseIterator      = typename FlatTableType::ReverseIterator;
+		using ReverseConstIterator = typename FlatTableType::ReverseConstIterator;
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Constructor and destructor.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Initializes an empty map.
+		 */
+		GDINL FlatMap() = default;
+
+		/*!
+		 * Moves other map here.
+		 * @param otherMap Map would be moved into current object.
+		 */
+		GDINL FlatMap(FlatMap&& otherMap) = default;
+
+		/*!
+		 * Initializes map with default C++11's initializer list. You should not use this constructor manually.
+		 * @param initializerList Initializer list passed by the compiler.
+		 */
+		GDINL FlatMap(InitializerList<PairType> const& initializerList)
+		{
+			this->AssignElements(initializerList.begin(), initializerList.end());
+			GD_ASSERT(this->GetLength() == initializerList.size(), "Keys in the initializer list should be unique.");
+		}
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Map manipulation.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Queries for the iterator of the element with specified key.
+		 *
+		 * @param key The key of the element we are looking for.
+		 * @returns Iterator on the element if it was found and End Iterator otherwise.
+		 */
+		//! @{
+		template<typename TLookupKey>
+		GDINL ConstIterator FindIterator(TLookupKey const& key) const
+		{
+			return this->Begin() + this->FindIndex(key);
+		}
+		template<typename TLookupKey>
+		GDINL Iterator FindIterator(TLookupKey const& key)
+		{
+			return this->Begin() + this->FindIndex(key);
+		}
+		//! @}
+
+		/*!
+		 * Queries for the value of the element with specified key.
+		 *
+		 * @param key The key of the element we are looking for.
+		 * @returns Pointer to the element if it was found and null pointer otherwise.
+		 */
+		//! @{
+		template<typename TLookupKey>
+		GDINL TValue const* Find(TLookupKey const& key) const
+		{
+			auto const index = this->FindIndex(key);
+			return index != this->GetLength() ? &this->GetElement(index).Value : nullptr;
+		}
+		template<typename TLookupKey>
+		GDINL TValue* Find(TLookupKey const& key)
+		{
+			return const_cast<TValue*>(const_cast<FlatMap const*>(this)->Find(key));
+		}
+		//! @}
+
+		/*!
+		 * Determines whether the element with specified key exists in the map.
+		 *
+		 * @param key The key of the element we are looking for.
+		 * @returns True if element with specified key exists in the map, false otherwise.
+		 */
+		template<typename TLookupKey>
+		GDINL bool Contains(TLookupKey const& key) const
+		{
+			return this->FindIndex(key) != this->GetLength();
+		}
+
+		/*!
+		 * Inserts the specified key-value pair into the map. Takes linear time.
+		 *
+		 * @param key The key of the element that is going to be inserted.
+		 * @param value The value of the element that is going to be inserted.
+		 */
+		//! @{
+		GDINL TValue& Insert(TKey&& key, TValue&& value = TValue())
+		{
+			GD_ASSERT(!this->Contains(key), "Element with specified key already exists.");
+			auto const index = this->LowerBound(key);
+			return this->InsertElement(index, PairType(Utils::Forward<TKey>(key), Utils::Forward<TValue>(value))).Value;
+		}
+		GDINL TValue& Insert(TKey const& key, TValue const& value = TValue())
+		{
+			GD_ASSERT(!this->Contains(key), "Element with specified key already exists.");
+			auto const index = this->LowerBound(key);
+			return this->InsertElement(index, PairType(key, value)).Value;
+		}
+		//! @}
+
+		/*!
+		 * Replaces contents of the map with the key-value pairs in any order.
+		 * Pairs are sorted once, out of the pairs with equal keys the last one is kept.
+		 *
+		 * @param startIterator First iterator of the pairs range.
+		 * @param endIterator End iterator of the pairs range.
+		 */
+		template<typename TIterator>
+		GDINL void Assign(TIterator const startIterator, TIterator const endIterator)
+		{
+			this->AssignElements(startIterator, endIterator);
+		}
+
+		/*!
+		 * Inserts the key-value pairs in any order into the map. New pairs are sorted and merged
+		 * with the existing ones in O(n + m log m) time. Pairs with existing keys replace the
+		 * old ones, out of the new pairs with equal keys the last one is kept.
+		 *
+		 * @param startIterator First iterator of the pairs range.
+		 * @param endIterator End iterator of the pairs range.
+		 */
+		template<typename TIterator>
+		GDINL void InsertRange(TIterator const startIterator, TIterator const endIterator)
+		{
+			this->InsertElements(startIterator, endIterator);
+		}
+
+		/*!
+		 * Removes existing element with specified key from the map.
+		 * @param key The key of the element that is going to be removed.
+		 */
+		template<typename TLookupKey>
+		GDINL void Erase(TLookupKey const& key)
+		{
+			auto const index = this->FindIndex(key);
+			GD_ASSERT(index != this->GetLength(), "Element with specified key does not exist.");
+			this->EraseElement(index);
+		}
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Overloaded operators.
+		// ------------------------------------------------------------------------------------------
+
+		GDINL FlatMap& operator= (FlatMap&& otherMap) = default;
+
+		/*!
+		 * Returns reference on value of the element with specified key.
+		 *
+		 * @param key The key of the element we are looking for.
+		 * @returns Reference on some element, or a newly created instance of the value type, that was automatically added to the map.
+		 */
+		GDINL TValue& operator[] (TKey const& key)
+		{
+			auto const index = this->LowerBound(key);
+			if (index == this->GetLength() || key < this->GetElement(index).Key)
+			{
+				return this->InsertElement(index, PairType(key, TValue())).Value;
+			}
+			return this->GetElement(index).Value;
+		}
+
+		/*!
+		 * Returns reference on value of the element with specified key.
+		 *
+		 * @param key The key of the element we are looking for.
+		 * @returns Reference on some element.
+		 */
+		GDINL TValue const& operator[] (TKey const& key) const
+		{
+			auto const value = this->Find(key);
+			GD_ASSERT(value != nullptr, "Element with specified key does not exist.");
+			return *value;
+		}
+
+	};	// class FlatMap
+
+GD_NAMESPACE_END
@@ -0,0 +1,137 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/Containers/FlatMap_UnitTests.cpp
+ * Dynamically sized sorted vector-based associative container class.
+ */
+#include <GoddamnEngine/Core/Containers/String.h>
+#include <GoddamnEngine/Core/Containers/Vector.h>
+#include <GoddamnEngine/Core/Containers/FlatMap.h>
+#include <GoddamnEngine/Core/Containers/FlatSet.h>
+
+GD_NAMESPACE_BEGIN
+
+#if GD_TESTING_ENABLED
+
+	gd_testing_unit_test(FlatMapAssign)
+	{
+		// Pairs in reverse order, every key is repeated twice.
+		Vector<MapPair<Int32, Int32>> pairs;
+		for (Int32 cnt = 0; cnt < 500; ++cnt)
+		{
+			pairs.InsertLast(MapPair<Int32, Int32>(499 - cnt / 2, cnt));
+		}
+
+		FlatMap<Int32, Int32> map;
+		map.Assign(pairs.Begin(), pairs.End());
+		gd_testing_verify(map.GetLength() == 250);
+
+		Int32 expectedKey = 250;
+		for (auto const& pair : map)
+		{
+			// Out of the equal keys, the last one is kept.
+			gd_testing_verify(pair.Key == expectedKey);
+			gd_testing_verify(pair.Value == 2 * (499 - expectedKey) + 1);
+			++expectedKey;
+		}
+		gd_testing_verify(*map.Find(300) == 399);
+		gd_testing_verify(map.Find(249) == nullptr);
+		gd_testing_verify(map.Find(500) == nullptr);
+
+		map.Assign(pairs.Begin(), pairs.Begin());
+		gd_testing_verify(map.IsEmpty());
+	};
+
+	gd_testing_unit_test(FlatMapInsertRange)
+	{
+		FlatMap<Int32, Int32> map;
+		Vector<MapPair<Int32, Int32>> pairs;
+		for (Int32 cnt = 0; cnt < 100; ++cnt)
+		{
+			pairs.InsertLast(MapPair<Int32, Int32>(cnt * 2, 0));
+		}
+		map.InsertRange(pairs.Begin(), pairs.End());
+		gd_testing_verify(map.GetLength() == 100);
+
+		// Odd keys are new, keys divisible by four replace the existing ones.
+		pairs.Clear();
+		for (Int32 cnt = 0; cnt < 200; cnt += 4)
+		{
+			pairs.InsertLast(MapPair<Int32, Int32>(cnt + 1, 1));
+			pairs.InsertLast(MapPair<Int32, Int32>(cnt, 2));
+		}
+		map.InsertRange(pairs.Begin(), pairs.End());
+		gd_testing_verify(map.GetLength() == 150);
+
+		Int32 lastKey = -1;
+		for (auto const& pair : map)
+		{
+			gd_testing_verify(lastKey < pair.Key);
+			lastKey = pair.Key;
+			if (pair.Key % 2 != 0)
+			{
+				gd_testing_verify(pair.Value == 1);
+			}
+			else
+			{
+				gd_testing_verify(pair.Value == (pair.Key % 4 == 0 ? 2 : 0));
+			}
+		}
+	};
+
+	gd_testing_unit_test(FlatMapRandomInsertErase)
+	{
+		FlatSet<UInt32> flatSet;
+		bool expectedSet[1024] = {};
+		UInt32 random = 1;
+		for (SizeTp cnt = 0; cnt < 10000; ++cnt)
+		{
+			random = random * 1664525 + 1013904223;
+			auto const element = (random >> 8) % 1024;
+			if (expectedSet[element])
+			{
+				flatSet.Erase(element);
+			}
+			else
+			{
+				flatSet.Insert(element);
+			}
+			expectedSet[element] = !expectedSet[element];
+			gd_testing_verify(flatSet.Contains(element) == expectedSet[element]);
+		}
+
+		SizeTp expectedLength = 0;
+		UInt32 lastElement = 0;
+		for (auto const element : flatSet)
+		{
+			gd_testing_verify(expectedSet[element]);
+			gd_testing_verify(expectedLength == 0 || lastElement < element);
+			lastElement = element;
+			++expectedLength;
+		}
+		gd_testing_verify(flatSet.GetLength() == expectedLength);
+	};
+
+	gd_testing_unit_test(FlatMapHeterogeneousLookup)
+	{
+		FlatMap<String, Int32> map;
+		for (Int32 cnt = 0; cnt < 100; ++cnt)
+		{
+			map.Insert(String::FromInt64(cnt), cnt);
+		}
+		gd_testing_verify(*map.Find("42") == 42);
+		gd_testing_verify(map.Contains("7"));
+		gd_testing_verify(!map.Contains("100"));
+		map.Erase("42");
+		gd_testing_verify(!map.Contains("42"));
+	};
+
+#endif	// if GD_TESTING_ENABLED
+
+GD_NAMESPACE_END
@@ -0,0 +1,192 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/Containers/FlatSet.h
+ * Dynamically sized sorted vector-based set class.
+ */
+#pragma once
+
+#include <GoddamnEngine/Include.h>
+#include <GoddamnEngine/Core/Containers/InitializerList.h>
+#include <GoddamnEngine/Core/Containers/FlatTable/FlatTable.h>
+
+GD_NAMESPACE_BEGIN
+
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+	// ******                                 FlatSet<T> class.                                ******
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+
+	// **------------------------------------------------------------------------------------------**
+	//! Dynamically sized set that is implemented with sorted dynamic array.
+	//! Drop-in replacement for the set class for the read-mostly data: elements are stored
+	//! contiguously and are searched with binary search. Sets should be built with
+	//! @ref Assign or @ref InsertRange, since single insertions take linear time.
+	//!
+	//! @tparam TElement Container element type.
+	//! @tparam TAllocator Allocator used by this set.
+	// **------------------------------------------------------------------------------------------**
+	template<typename TElement, typename TAllocator = DefaultContainerAllocator>
+	class FlatSet : public FlatTable<TElement, TElement, FlatTableIdentityKeySelector<TElement>, TAllocator>
+	{
+	public:
+		using ElementType          = TElement;
+		using FlatTableType        = FlatTable<TElement, TElement, FlatTableIdentityKeySelector<TElement>, TAllocator>;
+		using Iterator             = typename FlatTableType::Iterator;
+		using ConstIterator        = typename FlatTableType::ConstIterator;
+		using ReverseIterator      = typename FlatTableType::ReverseIterator;
+		using ReverseConstIterator = typename FlatTableType::ReverseConstIterator;
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Constructor and destructor.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Initializes an empty set.
+		 */
+		GDINL FlatSet() = default;
+
+		/*!
+		 * Moves other set here.
+		 * @param otherSet Set would be moved into current object.
+		 */
+		GDINL FlatSet(FlatSet&& otherSet) = default;
+
+		/*!
+		 * Initializes set with default C++11's initializer list. You should not use this constructor manually.
+		 * @param initializerList Initializer list passed by the compiler.
+		 */
+		GDINL FlatSet(InitializerList<TElement> const& initializerList)
+		{
+			this->AssignElements(initializerList.begin(), initializerList.end());
+			GD_ASSERT(this->GetLength() == initializerList.size(), "Elements in the initializer list should be unique.");
+		}
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Set manipulation.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Queries for the Iterator of the specified element.
+		 *
+		 * @param element The element we are looking for.
+		 * @returns Iterator on the element if it was found and End Iterator otherwise.
+		 */
+		//! @{
+		template<typename TLookupElement>
+		GDINL ConstIterator FindIterator(TLookupElement const& element) const
+		{
+			return this->Begin() + this->FindIndex(element);
+		}
+		template<typename TLookupElement>
+		GDINL Iterator FindIterator(TLookupElement const& element)
+		{
+			return this->Begin() + this->FindIndex(element);
+		}
+		//! @}
+
+		/*!
+		 * Queries for the specified element.
+		 *
+		 * @param element The element we are looking for.
+		 * @returns Pointer to the element if it was found and null pointer otherwise.
+		 */
+		//! @{
+		template<typename TLookupElement>
+		GDINL TElement const* Find(TLookupElement const& element) const
+		{
+			auto const index = this->FindIndex(element);
+			return index != this->GetLength() ? &this->GetElement(index) : nullptr;
+		}
+		template<typename TLookupElement>
+		GDINL TElement* Find(TLookupElement const& element)
+		{
+			return const_cast<TElement*>(const_cast<FlatSet const*>(this)->Find(element));
+		}
+		//! @}
+
+		/*!
+		 * Determines whether the specified element exists in the set.
+		 * @param element The element we are looking for.
+		 */
+		template<typename TLookupElement>
+		GDINL bool Contains(TLookupElement const& element) const
+		{
+			return this->FindIndex(element) != this->GetLength();
+		}
+
+		/*!
+		 * Adds a new specified element to the set. Takes linear time.
+		 * @param element The element that would be inserted.
+		 */
+		//! @{
+		GDINL TElement& Insert(TElement&& element)
+		{
+			GD_ASSERT(!this->Contains(element), "Specified element already exists.");
+			auto const index = this->LowerBound(element);
+			return this->InsertElement(index, Utils::Forward<TElement>(element));
+		}
+		GDINL TElement& Insert(TElement const& element)
+		{
+			GD_ASSERT(!this->Contains(element), "Specified element already exists.");
+			auto const index = this->LowerBound(element);
+			return this->InsertElement(index, TElement(element));
+		}
+		//! @}
+
+		/*!
+		 * Replaces contents of the set with the elements in any order.
+		 * Elements are sorted once, duplicates are removed.
+		 *
+		 * @param startIterator First iterator of the elements range.
+		 * @param endIterator End iterator of the elements range.
+		 */
+		template<typename TIterator>
+		GDINL void Assign(TIterator const startIterator, TIterator const endIterator)
+		{
+			this->AssignElements(startIterator, endIterator);
+		}
+
+		/*!
+		 * Inserts the elements in any order into the set. New elements are sorted and merged
+		 * with the existing ones in O(n + m log m) time, duplicates are removed.
+		 *
+		 * @param startIterator First iterator of the elements range.
+		 * @param endIterator End iterator of the elements range.
+		 */
+		template<typename TIterator>
+		GDINL void InsertRange(TIterator const startIterator, TIterator const endIterator)
+		{
+			this->InsertElements(startIterator, endIterator);
+		}
+
+		/*!
+		 * Removes existing element from the set.
+		 * @param element The element that is going to be removed.
+		 */
+		template<typename TLookupElement>
+		GDINL void Erase(TLookupElement const& element)
+		{
+			auto const index = this->FindIndex(element);
+			GD_ASSERT(index != this->GetLength(), "Specified element does not exist.");
+			this->EraseElement(index);
+		}
+
+		// ------------------------------------------------------------------------------------------
+		// Overloaded operators.
+		// ------------------------------------------------------------------------------------------
+
+		GDINL FlatSet& operator= (FlatSet&&) = default;
+
+	};	// class FlatSet
+
+GD_NAMESPACE_END
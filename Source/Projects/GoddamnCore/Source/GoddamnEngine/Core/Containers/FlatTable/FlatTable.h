@@ -0,0 +1,416 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/Containers/FlatTable/FlatTable.h
+ * Sorted vector data structure interface.
+ */
+#pragma once
+
+#include <GoddamnEngine/Include.h>
+#include <GoddamnEngine/Core/Containers/Vector.h>
+#include <GoddamnEngine/Core/Templates/Algorithm.h>
+
+GD_NAMESPACE_BEGIN
+
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+	// ******                                FlatTable<T> class.                               ******
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+
+	// **------------------------------------------------------------------------------------------**
+	//! Key selector for the tables of plain elements.
+	// **------------------------------------------------------------------------------------------**
+	template<typename TElement>
+	struct FlatTableIdentityKeySelector final : public TNonCreatable
+	{
+	public:
+		GDINL static TElement const& GetKey(TElement const& element)
+		{
+			return element;
+		}
+	};	// struct FlatTableIdentityKeySelector
+
+	// **------------------------------------------------------------------------------------------**
+	//! Templated sorted vector. Elements are stored contiguously in ascending order of the keys,
+	//! lookups are binary searches. Single insertions and erasures are linear, so tables are
+	//! best suited for the read-mostly data that is built at once or in large batches.
+	//! Inserting and erasing elements invalidates iterators and pointers to other elements.
+	//!
+	//! @tparam TKey Type of the key, used for searching.
+	//! @tparam TElement Type of the elements stored in the table.
+	//! @tparam TKeySelector Type, that extracts keys from the elements.
+	//! @tparam TAllocator Allocator used by this table.
+	// **------------------------------------------------------------------------------------------**
+	template<typename TKey, typename TElement, typename TKeySelector, typename TAllocator = DefaultContainerAllocator>
+	class FlatTable : public TNonCopyable
+	{
+	private:
+		using VectorType           = Vector<TElement, TAllocator>;
+	public:
+		using KeyType              = TKey;
+		using ElementType          = TElement;
+		using Iterator             = typename VectorType::Iterator;
+		using ConstIterator        = typename VectorType::ConstIterator;
+		using ReverseIterator      = typename VectorType::ReverseIterator;
+		using ReverseConstIterator = typename VectorType::ReverseConstIterator;
+
+		GD_CONTAINER_DEFINE_ITERATION_SUPPORT(FlatTable)
+
+	private:
+		VectorType m_Elements;
+
+	protected:
+
+		// ------------------------------------------------------------------------------------------
+		// Constructor and destructor.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Initializes an empty table.
+		 */
+		GDINL FlatTable() = default;
+
+		/*!
+		 * Moves other table here.
+		 * @param other The other table to move here.
+		 */
+		GDINL FlatTable(FlatTable&& other) noexcept
+			: m_Elements(Utils::Move(other.m_Elements))
+		{
+		}
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Table iteration.
+		// ------------------------------------------------------------------------------------------
+
+		GDINL Iterator Begin()
+		{
+			return m_Elements.Begin();
+		}
+		GDINL ConstIterator Begin() const
+		{
+			return m_Elements.Begin();
+		}
+
+		GDINL Iterator End()
+		{
+			return m_Elements.End();
+		}
+		GDINL ConstIterator End() const
+		{
+			return m_Elements.End();
+		}
+
+		GDINL ReverseIterator ReverseBegin()
+		{
+			return m_Elements.ReverseBegin();
+		}
+		GDINL ReverseConstIterator ReverseBegin() const
+		{
+			return m_Elements.ReverseBegin();
+		}
+
+		GDINL ReverseIterator ReverseEnd()
+		{
+			return m_Elements.ReverseEnd();
+		}
+		GDINL ReverseConstIterator ReverseEnd() const
+		{
+			return m_Elements.ReverseEnd();
+		}
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Dynamic size management.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Returns pointer on the first element of the table.
+		 */
+		GDINL TElement const* GetData() const
+		{
+			return m_Elements.GetData();
+		}
+
+		/*!
+		 * Returns number of elements that exist in the table.
+		 */
+		GDINL SizeTp GetLength() const
+		{
+			return m_Elements.GetLength();
+		}
+
+		/*!
+		 * Returns number of elements that can be placed into the table without reallocation.
+		 */
+		GDINL SizeTp GetCapacity() const
+		{
+			return m_Elements.GetCapacity();
+		}
+
+		/*!
+		 * Returns true if this table is empty.
+		 */
+		GDINL bool IsEmpty() const
+		{
+			return m_Elements.IsEmpty();
+		}
+
+		/*!
+		 * Reserves memory for the table to make it contain specified number of elements without reallocation.
+		 * @param newCapacity New required capacity of the table.
+		 */
+		GDINL void Reserve(SizeTp const newCapacity)
+		{
+			if (newCapacity > m_Elements.GetLength())
+			{
+				m_Elements.Reserve(newCapacity);
+			}
+		}
+
+		/*!
+		 * Shrinks table's capacity to its length.
+		 */
+		GDINL void ShrinkToFit()
+		{
+			m_Elements.ShrinkToFit();
+		}
+
+		/*!
+		 * Removes all elements from the table.
+		 */
+		GDINL void Clear()
+		{
+			m_Elements.Clear();
+		}
+
+		/*!
+		 * Swaps two tables.
+		 * @param other The other table to swap with.
+		 */
+		GDINL void Swap(FlatTable& other)
+		{
+			auto temporary = Utils::Move(m_Elements);
+			m_Elements = Utils::Move(other.m_Elements);
+			other.m_Elements = Utils::Move(temporary);
+		}
+
+	protected:
+
+		// ------------------------------------------------------------------------------------------
+		// Table manipulation.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Returns index of the first element, whose key is not less than the specified one.
+		 * @param key The key we are looking for.
+		 */
+		template<typename TLookupKey>
+		GDINL SizeTp LowerBound(TLookupKey const& key) const
+		{
+			auto const elements = m_Elements.GetData();
+			return Algo::LowerBound(elements, elements + m_Elements.GetLength(), key, [](TElement const& element, TLookupKey const& lookupKey)
+			{
+				return TKeySelector::GetKey(element) < lookupKey;
+			}) - elements;
+		}
+
+		/*!
+		 * Searches for the element with the specified key.
+		 *
+		 * @param key The key of the element we are looking for.
+		 * @returns Index of the element or length of the table if nothing was found.
+		 */
+		template<typename TLookupKey>
+		GDINL SizeTp FindIndex(TLookupKey const& key) const
+		{
+			auto const index = LowerBound(key);
+			if (index != m_Elements.GetLength() && !(key < TKeySelector::GetKey(m_Elements[index])))
+			{
+				return index;
+			}
+			return m_Elements.GetLength();
+		}
+
+		/*!
+		 * Returns element at the specified index.
+		 * @param index Index of the element.
+		 */
+		//! @{
+		GDINL TElement const& GetElement(SizeTp const index) const
+		{
+			return m_Elements[index];
+		}
+		GDINL TElement& GetElement(SizeTp const index)
+		{
+			return m_Elements[index];
+		}
+		//! @}
+
+		/*!
+		 * Inserts a new element at the specified index. Order of the elements is not checked.
+		 *
+		 * @param index Index, where the element is placed.
+		 * @param element The element to insert.
+		 *
+		 * @returns Reference to the inserted element.
+		 */
+		GDINL TElement& InsertElement(SizeTp const index, TElement&& element)
+		{
+			m_Elements.InsertAt(index, Utils::Forward<TElement>(element));
+			return m_Elements[index];
+		}
+
+		/*!
+		 * Removes element at the specified index.
+		 * @param index Index of the element.
+		 */
+		GDINL void EraseElement(SizeTp const index)
+		{
+			m_Elements.EraseAt(index);
+		}
+
+		/*!
+		 * Replaces contents of the table with the elements of the specified range.
+		 * Elements are sorted once, out of the elements with equal keys the last one is kept.
+		 *
+		 * @param startIterator Start of the elements range.
+		 * @param endIterator End of the elements range.
+		 */
+		template<typename TForwardIterator>
+		GDINL void AssignElements(TForwardIterator const startIterator, TForwardIterator const endIterator)
+		{
+			m_Elements.Emptify();
+			for (auto iterator = startIterator; iterator != endIterator; ++iterator)
+			{
+				m_Elements.InsertLast(*iterator);
+			}
+			SortAndDeduplicate(m_Elements);
+		}
+
+		/*!
+		 * Inserts elements of the specified range into the table. New elements are sorted and
+		 * then merged with the existing ones in a single pass, which takes O(n + m log m) time.
+		 * Elements with the existing keys replace the old ones, out of the new elements with equal
+		 * keys the last one is kept.
+		 *
+		 * @param startIterator Start of the elements range.
+		 * @param endIterator End of the elements range.
+		 */
+		template<typename TForwardIterator>
+		GDINL void InsertElements(TForwardIterator const startIterator, TForwardIterator const endIterator)
+		{
+			VectorType newElements;
+			for (auto iterator = startIterator; iterator != endIterator; ++iterator)
+			{
+				newElements.InsertLast(*iterator);
+			}
+			if (newElements.IsEmpty())
+			{
+				return;
+			}
+			SortAndDeduplicate(newElements);
+
+			// Merging both sorted arrays into the new one.
+			auto const oldLength = m_Elements.GetLength(), newLength = newElements.GetLength();
+			VectorType mergedElements;
+			mergedElements.Reserve(oldLength + newLength);
+			SizeTp oldIndex = 0, newIndex = 0;
+			while (oldIndex != oldLength && newIndex != newLength)
+			{
+				auto const& oldKey = TKeySelector::GetKey(m_Elements[oldIndex]);
+				auto const& newKey = TKeySelector::GetKey(newElements[newIndex]);
+				if (oldKey < newKey)
+				{
+					mergedElements.InsertLast(Utils::Move(m_Elements[oldIndex++]));
+				}
+				else
+				{
+					if (!(newKey < oldKey))
+					{
+						++oldIndex;
+					}
+					mergedElements.InsertLast(Utils::Move(newElements[newIndex++]));
+				}
+			}
+			for (; oldIndex != oldLength; ++oldIndex)
+			{
+				mergedElements.InsertLast(Utils::Move(m_Elements[oldIndex]));
+			}
+			for (; newIndex != newLength; ++newIndex)
+			{
+				mergedElements.InsertLast(Utils::Move(newElements[newIndex]));
+			}
+			m_Elements = Utils::Move(mergedElements);
+		}
+
+		/*!
+		 * Checks whether elements of the table are strictly sorted by the keys.
+		 */
+		GDINL bool IsSorted() const
+		{
+			for (SizeTp index = 1; index < m_Elements.GetLength(); ++index)
+			{
+				if (!(TKeySelector::GetKey(m_Elements[index - 1]) < TKeySelector::GetKey(m_Elements[index])))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+	private:
+
+		/*!
+		 * Stably sorts elements by the keys and removes all the elements, for whose the following
+		 * element has the same key.
+		 */
+		GDINL static void SortAndDeduplicate(VectorType& elements)
+		{
+			Algo::StableSort(elements.Begin(), elements.End(), [](TElement const& lhs, TElement const& rhs)
+			{
+				return TKeySelector::GetKey(lhs) < TKeySelector::GetKey(rhs);
+			});
+
+			SizeTp uniqueLength = 0;
+			for (SizeTp index = 0; index < elements.GetLength(); ++index)
+			{
+				if (uniqueLength != 0 && !(TKeySelector::GetKey(elements[uniqueLength - 1]) < TKeySelector::GetKey(elements[index])))
+				{
+					elements[uniqueLength - 1] = Utils::Move(elements[index]);
+				}
+				else
+				{
+					if (uniqueLength != index)
+					{
+						elements[uniqueLength] = Utils::Move(elements[index]);
+					}
+					++uniqueLength;
+				}
+			}
+			elements.EraseAt(uniqueLength, elements.GetLength() - uniqueLength);
+		}
+
+	protected:
+
+		// ------------------------------------------------------------------------------------------
+		// Overloaded operators.
+		// ------------------------------------------------------------------------------------------
+
+		GDINL FlatTable& operator= (FlatTable&& other) noexcept
+		{
+			m_Elements = Utils::Move(other.m_Elements);
+			return *this;
+		}
+
+	};	// class FlatTable
+
+GD_NAMESPACE_END
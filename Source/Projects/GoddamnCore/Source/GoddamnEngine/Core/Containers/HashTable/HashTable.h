@@ -0,0 +1,498 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/Containers/HashTable/HashTable.h
+ * Open-addressing hash table data structure interface.
+ */
+#pragma once
+
+#include <GoddamnEngine/Include.h>
+#include <GoddamnEngine/Core/Templates/Utility.h>
+#include <GoddamnEngine/Core/Templates/Iterators.h>
+#include <GoddamnEngine/Core/Templates/Algorithm.h>
+#include <GoddamnEngine/Core/Misc/Hash.h>
+#include <GoddamnEngine/Core/Containers/HashTable/HashTableBase.h>
+
+GD_NAMESPACE_BEGIN
+
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+	// ******                              HashTable<T> class.                                 ******
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+
+	// **------------------------------------------------------------------------------------------**
+	//! Key selector for the tables, whose elements are keys themselves.
+	// **------------------------------------------------------------------------------------------**
+	template<typename TElement>
+	struct HashTableIdentityKeySelector final : public TNonCreatable
+	{
+	public:
+		GDINL static TElement const& GetKey(TElement const& element)
+		{
+			return element;
+		}
+	};	// struct HashTableIdentityKeySelector
+
+	// **------------------------------------------------------------------------------------------**
+	//! Iterator for hash table-based containers.
+	//! @tparam TTableContainer Type of container.
+	// **------------------------------------------------------------------------------------------**
+	template<typename TTableContainer>
+	struct HashTableIterator final
+	{
+	public:
+		using ContainerType = TTableContainer;
+		using ElementType   = Conditional<TypeTraits::IsConst<ContainerType>::Value, typename ContainerType::ElementType const, typename ContainerType::ElementType>;
+
+	private:
+		ContainerType& m_Container;
+		SizeTp         m_Index;
+
+	public:
+
+		/*!
+		 * Initializes Iterator that points on the specified slot of the table.
+		 *
+		 * @param container The container that is going to be iterated.
+		 * @param index Index of the start slot of the Iterator.
+		 */
+		GDINL HashTableIterator(ContainerType& container, SizeTp const index)
+			: m_Container(container), m_Index(index)
+		{
+		}
+
+	public:
+
+		/*!
+		 * Returns index of the slot associated with this Iterator.
+		 */
+		GDINL SizeTp GetIndex() const
+		{
+			return m_Index;
+		}
+
+		// ------------------------------------------------------------------------------------------
+		// Overloaded operators.
+		// ------------------------------------------------------------------------------------------
+
+		GDINL HashTableIterator& operator= (HashTableIterator const& other)
+		{
+			GD_ASSERT(&m_Container == &other.m_Container, "Iterators have different base containers.");
+			m_Index = other.m_Index;
+			return *this;
+		}
+
+		// iterator++
+		GDINL HashTableIterator& operator++ ()
+		{
+			GD_ASSERT(m_Index != m_Container.m_Capacity, "Iterator is out of range.");
+			m_Index = m_Container.FindNextFullSlot(m_Index + 1);
+			return *this;
+		}
+		GDINL HashTableIterator operator++ (int const unused)
+		{
+			GD_NOT_USED(unused);
+			auto copy(*this);
+			++(*this);
+			return copy;
+		}
+
+		// iterator--
+		GDINL HashTableIterator& operator-- ()
+		{
+			GD_ASSERT(m_Index != SizeTpMax, "Iterator is out of range.");
+			m_Index = m_Container.FindPrevFullSlot(m_Index - 1);
+			return *this;
+		}
+		GDINL HashTableIterator operator-- (int const unused)
+		{
+			GD_NOT_USED(unused);
+			auto copy(*this);
+			--(*this);
+			return copy;
+		}
+
+		// iterator + ptrdiff_t
+		GDINL HashTableIterator& operator+= (PtrDiffTp const offset)
+		{
+			if (offset > 0)
+			{
+				for (PtrDiffTp cnt = 0; cnt < offset; ++cnt)
+				{
+					++(*this);
+				}
+			}
+			else
+			{
+				for (PtrDiffTp cnt = 0; cnt < -offset; ++cnt)
+				{
+					--(*this);
+				}
+			}
+			return *this;
+		}
+		GDINL HashTableIterator operator+ (PtrDiffTp const offset) const
+		{
+			auto copy(*this);
+			return copy += offset;
+		}
+
+		// iterator - ptrdiff_t
+		GDINL HashTableIterator& operator-= (PtrDiffTp const offset)
+		{
+			return *this += -offset;
+		}
+		GDINL HashTableIterator operator- (PtrDiffTp const offset) const
+		{
+			auto copy(*this);
+			return copy -= offset;
+		}
+
+		// iterator == iterator
+		GDINL bool operator== (HashTableIterator const& other) const
+		{
+			return (&m_Container == &other.m_Container) && (m_Index == other.m_Index);
+		}
+		GDINL bool operator!= (HashTableIterator const& other) const
+		{
+			return (&m_Container != &other.m_Container) || (m_Index != other.m_Index);
+		}
+
+		// *iterator
+		GDINL ElementType& operator* () const
+		{
+			GD_ASSERT(m_Index < m_Container.m_Capacity && m_Container.IsSlotFull(m_Index), "Iterator is out of range.");
+			return m_Container.m_Slots[m_Index];
+		}
+		GDINL ElementType* operator-> () const
+		{
+			return &**this;
+		}
+
+	};	// struct HashTableIterator
+
+	// **------------------------------------------------------------------------------------------**
+	//! Templated open-addressing hash table. Elements are stored in the single memory block right
+	//! after the control bytes, so lookups and iteration do not chase any pointers.
+	//!
+	//! @tparam TKey Type of the key, used for searching.
+	//! @tparam TElement Type of the elements stored in the table.
+	//! @tparam TKeySelector Type, that extracts keys from the elements.
+	//! @tparam THasher Type, that computes hashes of the keys.
+	//! @tparam TAllocator Allocator used by this table.
+	// **------------------------------------------------------------------------------------------**
+	template<typename TKey, typename TElement, typename TKeySelector, typename THasher, typename TAllocator = DefaultContainerAllocator>
+	class HashTable : public HashTableBase, public TAllocator
+	{
+		template<typename>
+		friend struct HashTableIterator;
+
+	public:
+		using KeyType              = TKey;
+		using ElementType          = TElement;
+		using HasherType           = THasher;
+		using Iterator             = HashTableIterator<HashTable>;
+		using ConstIterator        = HashTableIterator<HashTable const>;
+		using ReverseIterator      = ReverseContainerIterator<Iterator>;
+		using ReverseConstIterator = ReverseContainerIterator<ConstIterator>;
+
+		GD_CONTAINER_DEFINE_ITERATION_SUPPORT(HashTable)
+
+	private:
+		TElement* m_Slots = nullptr;
+
+	protected:
+
+		// ------------------------------------------------------------------------------------------
+		// Constructor and destructor.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Initializes an empty hash table.
+		 */
+		GDINL HashTable() = default;
+
+		/*!
+		 * Moves other hash table here.
+		 * @param other The other table to move here.
+		 */
+		GDINL HashTable(HashTable&& other) noexcept
+		{
+			Swap(other);
+		}
+
+		GDINL ~HashTable()
+		{
+			Clear();
+			GD_FREE(m_Controls);
+		}
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Table iteration.
+		// ------------------------------------------------------------------------------------------
+
+		GDINL Iterator Begin()
+		{
+			return Iterator(*this, FindNextFullSlot(0));
+		}
+		GDINL ConstIterator Begin() const
+		{
+			return ConstIterator(*this, FindNextFullSlot(0));
+		}
+
+		GDINL Iterator End()
+		{
+			return Iterator(*this, m_Capacity);
+		}
+		GDINL ConstIterator End() const
+		{
+			return ConstIterator(*this, m_Capacity);
+		}
+
+		GDINL ReverseIterator ReverseBegin()
+		{
+			return ReverseIterator(End() - 1);
+		}
+		GDINL ReverseConstIterator ReverseBegin() const
+		{
+			return ReverseConstIterator(End() - 1);
+		}
+
+		GDINL ReverseIterator ReverseEnd()
+		{
+			return ReverseIterator(Iterator(*this, SizeTpMax));
+		}
+		GDINL ReverseConstIterator ReverseEnd() const
+		{
+			return ReverseConstIterator(ConstIterator(*this, SizeTpMax));
+		}
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Dynamic size management.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Removes all elements from the table. Memory of the table is kept.
+		 */
+		GDINL void Clear()
+		{
+			if (!TypeTraits::IsPOD<TElement>::Value)
+			{
+				for (auto index = FindNextFullSlot(0); index != m_Capacity; index = FindNextFullSlot(index + 1))
+				{
+					Algo::DeinitializeIterator(m_Slots + index);
+				}
+			}
+			ResetControls();
+		}
+
+		/*!
+		 * Allocates memory for the specified amount of elements, so no rehashing happens until
+		 * the table grows bigger.
+		 *
+		 * @param length Amount of elements, that should fit the table.
+		 */
+		GDINL void Reserve(SizeTp const length)
+		{
+			auto const newCapacity = GetCapacityForLength(length);
+			if (newCapacity > m_Capacity)
+			{
+				Rehash(newCapacity);
+			}
+		}
+
+		/*!
+		 * Swaps two tables.
+		 * @param other The other table to swap with.
+		 */
+		GDINL void Swap(HashTable& other)
+		{
+			GD::Swap(m_Controls, other.m_Controls);
+			GD::Swap(m_Capacity, other.m_Capacity);
+			GD::Swap(m_Length, other.m_Length);
+			GD::Swap(m_GrowthLeft, other.m_GrowthLeft);
+			GD::Swap(m_Slots, other.m_Slots);
+		}
+
+	protected:
+
+		// ------------------------------------------------------------------------------------------
+		// Table manipulation.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Computes hash of the key. Key could be of any type, that is supported by the hasher and
+		 * is comparable with the table keys.
+		 */
+		template<typename TLookupKey>
+		GDINL static UInt64 ComputeHash(TLookupKey const& key)
+		{
+			return THasher()(key);
+		}
+
+		/*!
+		 * Searches for the slot, that contains the element with the specified key.
+		 *
+		 * @param key The key of the element we are looking for.
+		 * @returns Index of the slot or capacity if nothing was found.
+		 */
+		template<typename TLookupKey>
+		GDINL SizeTp FindSlot(TLookupKey const& key) const
+		{
+			if (m_Length == 0)
+			{
+				return m_Capacity;
+			}
+
+			auto const hash = ComputeHash(key);
+			auto const controlBits = GetControlBits(hash);
+			for (auto position = GetProbeStart(hash);; position = (position + HashTableGroup::Width) & (m_Capacity - 1))
+			{
+				HashTableGroup const group(m_Controls + position);
+				for (auto matchingSlots = group.Match(controlBits); matchingSlots; matchingSlots.ClearLowest())
+				{
+					auto const index = (position + matchingSlots.GetLowest()) & (m_Capacity - 1);
+					if (TKeySelector::GetKey(m_Slots[index]) == key)
+					{
+						return index;
+					}
+				}
+
+				// Without tombstones, an empty slot terminates the probe sequence.
+				if (group.MatchEmpty())
+				{
+					return m_Capacity;
+				}
+			}
+		}
+
+		/*!
+		 * Constructs a new element in the table. Element with the same key should not exist.
+		 *
+		 * @param hash Hash of the element's key, computed with @c ComputeHash.
+		 * @param arguments Arguments for the element's constructor.
+		 *
+		 * @returns Index of the slot with the element.
+		 */
+		template<typename... TArguments>
+		GDINL SizeTp InsertSlot(UInt64 const hash, TArguments&&... arguments)
+		{
+			if (m_GrowthLeft == 0)
+			{
+				Rehash(GetCapacityForLength(m_Length + 1));
+			}
+
+			auto const index = FindFirstEmptySlot(hash);
+			new (m_Slots + index) TElement(Utils::Forward<TArguments>(arguments)...);
+			SetControl(index, GetControlBits(hash));
+			++m_Length;
+			--m_GrowthLeft;
+			return index;
+		}
+
+		/*!
+		 * Destroys the element in the specified slot. Following elements of the probe sequence
+		 * are shifted backwards to fill the hole.
+		 *
+		 * @param index Index of the slot.
+		 */
+		GDINL void EraseSlot(SizeTp const index)
+		{
+			GD_ASSERT(index < m_Capacity && IsSlotFull(index), "Slot is empty.");
+
+			auto const capacityMask = m_Capacity - 1;
+			auto holeIndex = index;
+			Algo::DeinitializeIterator(m_Slots + holeIndex);
+			for (auto nextIndex = (index + 1) & capacityMask; IsSlotFull(nextIndex); nextIndex = (nextIndex + 1) & capacityMask)
+			{
+				// Element could fill the hole only if its probe sequence starts before the hole.
+				auto const probeStart = GetProbeStart(ComputeHash(TKeySelector::GetKey(m_Slots[nextIndex])));
+				if (((nextIndex - probeStart) & capacityMask) >= ((nextIndex - holeIndex) & capacityMask))
+				{
+					Algo::RelocateRange(m_Slots + nextIndex, m_Slots + nextIndex + 1, m_Slots + holeIndex);
+					SetControl(holeIndex, m_Controls[nextIndex]);
+					holeIndex = nextIndex;
+				}
+			}
+			SetControl(holeIndex, HashTableControlEmpty);
+			--m_Length;
+			++m_GrowthLeft;
+		}
+
+		/*!
+		 * Returns element in the specified slot.
+		 */
+		//! @{
+		GDINL TElement const& GetSlot(SizeTp const index) const
+		{
+			GD_ASSERT(index < m_Capacity && IsSlotFull(index), "Slot is empty.");
+			return m_Slots[index];
+		}
+		GDINL TElement& GetSlot(SizeTp const index)
+		{
+			return const_cast<TElement&>(const_cast<HashTable const*>(this)->GetSlot(index));
+		}
+		//! @}
+
+	private:
+
+		/*!
+		 * Moves all elements into the new memory block with the specified amount of slots.
+		 * @param newCapacity New amount of slots. Should be a power of two.
+		 */
+		GDINT void Rehash(SizeTp const newCapacity)
+		{
+			auto const oldControls = m_Controls;
+			auto const oldSlots = m_Slots;
+			auto const oldCapacity = m_Capacity;
+			auto const oldLength = m_Length;
+
+			auto const slotsOffset = GetSlotsOffset(newCapacity, alignof(TElement));
+			auto const newMemory = GD_MALLOC(slotsOffset + newCapacity * sizeof(TElement));
+			InitializeControls(newMemory, newCapacity);
+			m_Slots = reinterpret_cast<TElement*>(static_cast<Byte*>(newMemory) + slotsOffset);
+
+			for (SizeTp oldIndex = 0; oldIndex < oldCapacity; ++oldIndex)
+			{
+				if (oldControls[oldIndex] >= 0)
+				{
+					auto const hash = ComputeHash(TKeySelector::GetKey(oldSlots[oldIndex]));
+					auto const newIndex = FindFirstEmptySlot(hash);
+					Algo::RelocateRange(oldSlots + oldIndex, oldSlots + oldIndex + 1, m_Slots + newIndex);
+					SetControl(newIndex, GetControlBits(hash));
+				}
+			}
+			m_Length = oldLength;
+			m_GrowthLeft -= oldLength;
+			GD_FREE(oldControls);
+		}
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Overloaded operators.
+		// ------------------------------------------------------------------------------------------
+
+		GDINL HashTable& operator= (HashTable&& other) noexcept
+		{
+			if (&other != this)
+			{
+				HashTable emptyTable;
+				Swap(emptyTable);
+				Swap(other);
+			}
+			return *this;
+		}
+
+	};	// class HashTable
+
+GD_NAMESPACE_END
@@ -0,0 +1,94 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/Containers/HashTable/HashTableBase.cpp
+ * Open-addressing hash table control bytes management.
+ */
+#include <GoddamnEngine/Core/Containers/HashTable/HashTableBase.h>
+#include <GoddamnEngine/Core/Templates/Algorithm.h>
+
+GD_NAMESPACE_BEGIN
+
+	// ------------------------------------------------------------------------------------------
+	// HashTableBase class.
+	// ------------------------------------------------------------------------------------------
+
+	/*!
+	 * Searches for the next full slot, starting with the specified one.
+	 * @returns Index of the slot or capacity if no slots were found.
+	 */
+	GDAPI SizeTp HashTableBase::FindNextFullSlot(SizeTp const index) const
+	{
+		for (auto position = index; position < m_Capacity; position += HashTableGroup::Width)
+		{
+			// Cloned control bytes are loaded past the end of the table, so results beyond capacity are ignored.
+			auto const fullSlots = HashTableGroup(m_Controls + position).MatchFull();
+			if (fullSlots)
+			{
+				return Min(position + fullSlots.GetLowest(), m_Capacity);
+			}
+		}
+		return m_Capacity;
+	}
+
+	/*!
+	 * Searches for the previous full slot, starting with the specified one.
+	 * @returns Index of the slot or SizeTpMax if no slots were found.
+	 */
+	GDAPI SizeTp HashTableBase::FindPrevFullSlot(SizeTp const index) const
+	{
+		auto position = index;
+		while (position != SizeTpMax && !IsSlotFull(position))
+		{
+			--position;
+		}
+		return position;
+	}
+
+	/*!
+	 * Returns the smallest capacity, that fits the specified amount of elements.
+	 */
+	GDAPI SizeTp HashTableBase::GetCapacityForLength(SizeTp const length)
+	{
+		// Table should be at least as big as the group, so cloned control bytes never overlap.
+		SizeTp capacity = HashTableGroup::Width;
+		while (GetMaxLengthForCapacity(capacity) < length)
+		{
+			capacity *= 2;
+		}
+		return capacity;
+	}
+
+	/*!
+	 * Initializes control bytes of the newly allocated table memory.
+	 *
+	 * @param memory Table memory block.
+	 * @param capacity Amount of slots in the table.
+	 */
+	GDAPI void HashTableBase::InitializeControls(Handle const memory, SizeTp const capacity)
+	{
+		m_Controls = static_cast<Int8*>(memory);
+		m_Capacity = capacity;
+		ResetControls();
+	}
+
+	/*!
+	 * Marks all slots as empty, keeping the memory.
+	 */
+	GDAPI void HashTableBase::ResetControls()
+	{
+		if (m_Capacity != 0)
+		{
+			CMemory::Memset(m_Controls, static_cast<Byte>(HashTableControlEmpty), m_Capacity + HashTableGroup::Width - 1);
+		}
+		m_Length = 0;
+		m_GrowthLeft = GetMaxLengthForCapacity(m_Capacity);
+	}
+
+GD_NAMESPACE_END
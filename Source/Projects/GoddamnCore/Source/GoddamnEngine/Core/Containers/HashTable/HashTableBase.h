@@ -0,0 +1,336 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/Containers/HashTable/HashTableBase.h
+ * Open-addressing hash table control bytes.
+ */
+#pragma once
+
+#include <GoddamnEngine/Include.h>
+#include <GoddamnEngine/Core/CStdlib/CMemory.h>
+#include <GoddamnEngine/Core/Templates/TypeTraits.h>
+
+#if (GD_ARCHITECTURE_X64 || GD_ARCHITECTURE_X86) && !GD_PLATFORM_HTML5
+#	define GD_HASH_TABLE_SSE2 GD_TRUE
+#	include <emmintrin.h>
+#else	// if (GD_ARCHITECTURE_X64 || GD_ARCHITECTURE_X86) && !GD_PLATFORM_HTML5
+#	define GD_HASH_TABLE_SSE2 GD_FALSE
+#endif	// if (GD_ARCHITECTURE_X64 || GD_ARCHITECTURE_X86) && !GD_PLATFORM_HTML5
+#if GD_COMPILER_MSVC_COMPATIBLE
+#	include <intrin.h>
+#endif	// if GD_COMPILER_MSVC_COMPATIBLE
+
+GD_NAMESPACE_BEGIN
+
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+	// ******                         HashTableGroup & HashTableBase classes.                  ******
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+
+	//! Control byte of the empty slot. Full slots store the lower 7 bits of the hash.
+	Int8 static const HashTableControlEmpty = -128;
+
+	// **------------------------------------------------------------------------------------------**
+	//! Set of the slots found by the group query. Each slot is represented by a bit (or by a byte
+	//! with the set high bit for the portable implementation).
+	// **------------------------------------------------------------------------------------------**
+	struct HashTableBitMask final
+	{
+	private:
+		UInt64 m_Mask;
+
+	public:
+		GDINL explicit HashTableBitMask(UInt64 const mask)
+			: m_Mask(mask)
+		{
+		}
+
+		/*!
+		 * Returns true if at least one slot is in this set.
+		 */
+		GDINL explicit operator bool() const
+		{
+			return m_Mask != 0;
+		}
+
+		/*!
+		 * Returns offset of the first slot in the set.
+		 */
+		GDINL SizeTp GetLowest() const
+		{
+			GD_ASSERT(m_Mask != 0, "Bit mask is empty.");
+#if GD_COMPILER_MSVC_COMPATIBLE && (GD_ARCHITECTURE_X64 || GD_ARCHITECTURE_ARM64)
+			unsigned long index;
+			_BitScanForward64(&index, m_Mask);
+#elif GD_COMPILER_MSVC_COMPATIBLE
+			unsigned long index;
+			if (!_BitScanForward(&index, static_cast<unsigned long>(m_Mask)))
+			{
+				_BitScanForward(&index, static_cast<unsigned long>(m_Mask >> 32));
+				index += 32;
+			}
+#else	// if GD_COMPILER_MSVC_COMPATIBLE
+			auto const index = __builtin_ctzll(m_Mask);
+#endif	// if GD_COMPILER_MSVC_COMPATIBLE
+#if GD_HASH_TABLE_SSE2
+			return static_cast<SizeTp>(index);
+#else	// if GD_HASH_TABLE_SSE2
+			return static_cast<SizeTp>(index) / 8;
+#endif	// if GD_HASH_TABLE_SSE2
+		}
+
+		/*!
+		 * Removes the first slot from the set.
+		 */
+		GDINL void ClearLowest()
+		{
+			m_Mask &= m_Mask - 1;
+		}
+	};	// struct HashTableBitMask
+
+	// **------------------------------------------------------------------------------------------**
+	//! Group of the consecutive control bytes that are probed at once.
+	//! SSE2 is used to compare 16 control bytes with a single instruction, other architectures
+	//! process 8 control bytes inside of a general purpose register.
+	// **------------------------------------------------------------------------------------------**
+	struct HashTableGroup final
+	{
+	public:
+#if GD_HASH_TABLE_SSE2
+		SizeTp static const Width = 16;
+#else	// if GD_HASH_TABLE_SSE2
+		SizeTp static const Width = 8;
+#endif	// if GD_HASH_TABLE_SSE2
+
+	private:
+#if GD_HASH_TABLE_SSE2
+		__m128i m_Controls;
+#else	// if GD_HASH_TABLE_SSE2
+		UInt64 m_Controls;
+		UInt64 static const LowBits  = 0x0101010101010101ull;
+		UInt64 static const HighBits = 0x8080808080808080ull;
+#endif	// if GD_HASH_TABLE_SSE2
+
+	public:
+
+		/*!
+		 * Loads the group of control bytes. Memory should not be aligned.
+		 * @param controls Pointer to the first control byte of the group.
+		 */
+		GDINL explicit HashTableGroup(Int8 const* const controls)
+		{
+#if GD_HASH_TABLE_SSE2
+			m_Controls = _mm_loadu_si128(reinterpret_cast<__m128i const*>(controls));
+#else	// if GD_HASH_TABLE_SSE2
+			CMemory::Memcpy(&m_Controls, controls, sizeof m_Controls);
+#endif	// if GD_HASH_TABLE_SSE2
+		}
+
+		/*!
+		 * Returns set of the full slots, whose control bytes match the specified hash bits.
+		 * Portable implementation may report false positives, that are filtered by the key comparison.
+		 *
+		 * @param hashBits Lower 7 bits of the hash.
+		 */
+		GDINL HashTableBitMask Match(Int8 const hashBits) const
+		{
+#if GD_HASH_TABLE_SSE2
+			auto const matches = _mm_cmpeq_epi8(_mm_set1_epi8(hashBits), m_Controls);
+			return HashTableBitMask(static_cast<UInt32>(_mm_movemask_epi8(matches)));
+#else	// if GD_HASH_TABLE_SSE2
+			auto const matches = m_Controls ^ (LowBits * static_cast<UInt8>(hashBits));
+			return HashTableBitMask((matches - LowBits) & ~matches & HighBits);
+#endif	// if GD_HASH_TABLE_SSE2
+		}
+
+		/*!
+		 * Returns set of the empty slots.
+		 */
+		GDINL HashTableBitMask MatchEmpty() const
+		{
+#if GD_HASH_TABLE_SSE2
+			return HashTableBitMask(static_cast<UInt32>(_mm_movemask_epi8(m_Controls)));
+#else	// if GD_HASH_TABLE_SSE2
+			return HashTableBitMask(m_Controls & HighBits);
+#endif	// if GD_HASH_TABLE_SSE2
+		}
+
+		/*!
+		 * Returns set of the full slots.
+		 */
+		GDINL HashTableBitMask MatchFull() const
+		{
+#if GD_HASH_TABLE_SSE2
+			return HashTableBitMask(static_cast<UInt32>(_mm_movemask_epi8(m_Controls)) ^ 0xFFFF);
+#else	// if GD_HASH_TABLE_SSE2
+			return HashTableBitMask(~m_Controls & HighBits);
+#endif	// if GD_HASH_TABLE_SSE2
+		}
+	};	// struct HashTableGroup
+
+	// **------------------------------------------------------------------------------------------**
+	//! Basic open-addressing hash table. Contains type-independent control bytes management.
+	//!
+	//! Table uses linear probing over the groups of control bytes: each slot has a control byte,
+	//! that is either empty or contains 7 bits of the element's hash, so most of mismatching
+	//! elements are rejected without touching the slots. Control bytes of the first group are
+	//! cloned past the end of the table, so the group could be loaded at any position.
+	//! Erasing shifts the following elements backwards, so table never contains tombstones.
+	//! Both the slot index and the control bits are taken from the hash, so hashers should produce
+	//! well-distributed 64-bit values, like the 'Hasher' class does.
+	// **------------------------------------------------------------------------------------------**
+	class HashTableBase : public TNonCopyable
+	{
+	protected:
+		Int8*  m_Controls;
+		SizeTp m_Capacity;
+		SizeTp m_Length;
+		SizeTp m_GrowthLeft;
+
+	protected:
+		GDINL HashTableBase()
+			: m_Controls(nullptr), m_Capacity(0), m_Length(0), m_GrowthLeft(0)
+		{
+		}
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Dynamic size management.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Returns number of elements that exist in the table.
+		 */
+		GDINL SizeTp GetLength() const
+		{
+			return m_Length;
+		}
+
+		/*!
+		 * Returns number of slots, allocated for the table.
+		 */
+		GDINL SizeTp GetCapacity() const
+		{
+			return m_Capacity;
+		}
+
+		/*!
+		 * Returns true if this table is empty.
+		 */
+		GDINL bool IsEmpty() const
+		{
+			return m_Length == 0;
+		}
+
+	protected:
+
+		// ------------------------------------------------------------------------------------------
+		// Control bytes management.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Returns position, from which probing of the specified hash starts.
+		 */
+		GDINL SizeTp GetProbeStart(UInt64 const hash) const
+		{
+			return static_cast<SizeTp>(hash >> 7) & (m_Capacity - 1);
+		}
+
+		/*!
+		 * Returns control bits of the specified hash.
+		 */
+		GDINL static Int8 GetControlBits(UInt64 const hash)
+		{
+			return static_cast<Int8>(hash & 0x7F);
+		}
+
+		/*!
+		 * Returns true if slot with specified index contains an element.
+		 */
+		GDINL bool IsSlotFull(SizeTp const index) const
+		{
+			return m_Controls[index] >= 0;
+		}
+
+		/*!
+		 * Updates control byte of the slot and its clone.
+		 */
+		GDINL void SetControl(SizeTp const index, Int8 const control)
+		{
+			m_Controls[index] = control;
+			if (index < HashTableGroup::Width - 1)
+			{
+				m_Controls[m_Capacity + index] = control;
+			}
+		}
+
+		/*!
+		 * Searches for the first empty slot in the probe sequence of the specified hash.
+		 */
+		GDINL SizeTp FindFirstEmptySlot(UInt64 const hash) const
+		{
+			for (auto position = GetProbeStart(hash);; position = (position + HashTableGroup::Width) & (m_Capacity - 1))
+			{
+				auto const emptySlots = HashTableGroup(m_Controls + position).MatchEmpty();
+				if (emptySlots)
+				{
+					return (position + emptySlots.GetLowest()) & (m_Capacity - 1);
+				}
+			}
+		}
+
+		/*!
+		 * Searches for the next full slot, starting with the specified one.
+		 * @returns Index of the slot or capacity if no slots were found.
+		 */
+		GDAPI SizeTp FindNextFullSlot(SizeTp const index) const;
+
+		/*!
+		 * Searches for the previous full slot, starting with the specified one.
+		 * @returns Index of the slot or SizeTpMax if no slots were found.
+		 */
+		GDAPI SizeTp FindPrevFullSlot(SizeTp const index) const;
+
+		/*!
+		 * Returns the smallest capacity, that fits the specified amount of elements.
+		 */
+		GDAPI static SizeTp GetCapacityForLength(SizeTp const length);
+
+		/*!
+		 * Returns amount of elements that could be stored in a table with the specified capacity.
+		 */
+		GDINL static SizeTp GetMaxLengthForCapacity(SizeTp const capacity)
+		{
+			return capacity - capacity / 8;
+		}
+
+		/*!
+		 * Returns offset of the slots inside of the table memory block.
+		 */
+		GDINL static SizeTp GetSlotsOffset(SizeTp const capacity, SizeTp const slotAlignment)
+		{
+			return (capacity + HashTableGroup::Width + slotAlignment - 1) & ~(slotAlignment - 1);
+		}
+
+		/*!
+		 * Initializes control bytes of the newly allocated table memory.
+		 *
+		 * @param memory Table memory block.
+		 * @param capacity Amount of slots in the table.
+		 */
+		GDAPI void InitializeControls(Handle const memory, SizeTp const capacity);
+
+		/*!
+		 * Marks all slots as empty, keeping the memory.
+		 */
+		GDAPI void ResetControls();
+
+	};	// class HashTableBase
+
+GD_NAMESPACE_END
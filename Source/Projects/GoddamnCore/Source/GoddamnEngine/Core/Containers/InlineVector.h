@@ -0,0 +1,576 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/Containers/InlineVector.h
+ * Dynamically sized array class with inline storage.
+ */
+#pragma once
+
+#include <GoddamnEngine/Include.h>
+#include <GoddamnEngine/Core/CStdlib/CMemory.h>
+#include <GoddamnEngine/Core/Templates/Algorithm.h>
+#include <GoddamnEngine/Core/Templates/Iterators.h>
+#include <GoddamnEngine/Core/Containers/InitializerList.h>
+
+GD_NAMESPACE_BEGIN
+
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+	// ******                             InlineVector<T, N> class.                            ******
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+
+	// **------------------------------------------------------------------------------------------**
+	//! Dynamic array implementation with small buffer optimization.
+	//! First N elements are stored inside the vector object itself, heap memory is allocated only
+	//! when length exceeds the inline capacity.
+	//!
+	//! @tparam TElement Vector element type.
+	//! @tparam TInlineCapacity Number of elements stored without heap allocation.
+	//! @tparam TAllocator Allocator used by this vector.
+	// **------------------------------------------------------------------------------------------**
+	template<typename TElement, SizeTp TInlineCapacity, typename TAllocator = HeapAllocator>
+	class InlineVector : private TAllocator
+	{
+		static_assert(TInlineCapacity > 0, "Inline capacity of the 'InlineVector' should be positive.");
+
+	public:
+		SizeTp static const InlineCapacity = TInlineCapacity;
+		using AllocatorType        = TAllocator;
+		using ElementType          = TElement;
+		using ConstElementType     = TElement const;
+		using ReferenceType        = TElement&;
+		using ConstReferenceType   = TElement const&;
+		using Iterator             = IndexedContainerIterator<InlineVector>;
+		using ConstIterator        = IndexedContainerIterator<InlineVector const>;
+		using ReverseIterator      = ReverseContainerIterator<Iterator>;
+		using ReverseConstIterator = ReverseContainerIterator<ConstIterator>;
+
+		GD_CONTAINER_DEFINE_ITERATION_SUPPORT(InlineVector)
+
+	private:
+		TElement* m_Memory;
+		SizeTp    m_Length;
+		SizeTp    m_Capacity;
+		alignas(TElement) Byte m_InlineMemory[TInlineCapacity * sizeof(TElement)];
+
+	private:
+		GDINL TElement* GetInlineMemory()
+		{
+			return reinterpret_cast<TElement*>(m_InlineMemory);
+		}
+		GDINL TElement const* GetInlineMemory() const
+		{
+			return reinterpret_cast<TElement const*>(m_InlineMemory);
+		}
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Constructors and destructor.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Initializes an empty vector.
+		 */
+		GDINL explicit InlineVector()
+			: m_Memory(GetInlineMemory()), m_Length(0), m_Capacity(TInlineCapacity)
+		{}
+
+		/*!
+		 * Initializes vector with specified number of initialized elements.
+		 * @param initialLength Number of elements been initialized.
+		 */
+		GDINL explicit InlineVector(SizeTp const initialLength)
+			: InlineVector()
+		{
+			Resize(initialLength);
+		}
+
+		/*!
+		 * Initializes vector with specified number of allocated and initialized elements.
+		 *
+		 * @param initialLength Number of elements been initialized.
+		 * @param initialCapacity Initial capacity of vector.
+		 */
+		GDINL explicit InlineVector(SizeTp const initialLength, SizeTp const initialCapacity)
+			: InlineVector()
+		{
+			Reserve(initialCapacity);
+			Resize(initialLength);
+		}
+
+		/*!
+		 * Initializes vector with copy of values of specified iterators.
+		 *
+		 * @param startIterator First iterator would be copied.
+		 * @param endIterator Last iterator would be copied.
+		 */
+		template<typename TForwardIterator, typename = typename EnableIf<IteratorTraits<TForwardIterator>::IsForward>::Type>
+		GDINL InlineVector(TForwardIterator const startIterator, TForwardIterator const endIterator)
+			: InlineVector()
+		{
+			auto const newLength = static_cast<SizeTp>(endIterator - startIterator);
+			Reserve(newLength);
+			Algo::CopyRange(startIterator, endIterator, m_Memory);
+			m_Length = newLength;
+		}
+
+		/*!
+		 * Initializes vector with default C++11's initializer list. You should not use this constructor manually.
+		 * @param initializerList Initializer list passed by the compiler.
+		 */
+		GDINL InlineVector(InitializerList<TElement> const& initializerList)
+			: InlineVector(initializerList.begin(), initializerList.end())
+		{}
+
+		/*!
+		 * Initializes vector with copy of other vector.
+		 * @param otherVector Vector would be copied.
+		 */
+		//! @{
+		GDINL InlineVector(InlineVector const& otherVector)
+			: InlineVector(otherVector.GetData(), otherVector.GetData() + otherVector.GetLength())
+		{}
+		template<SizeTp TOtherInlineCapacity, typename TOtherAllocator>
+		GDINL implicit InlineVector(InlineVector<TElement, TOtherInlineCapacity, TOtherAllocator> const& otherVector)
+			: InlineVector(otherVector.GetData(), otherVector.GetData() + otherVector.GetLength())
+		{}
+		//! @}
+
+		/*!
+		 * Moves other vector here.
+		 * Heap memory of the other vector is stolen, inline elements are moved one by one.
+		 *
+		 * @param otherVector Vector would be moved into current object.
+		 */
+		GDINL InlineVector(InlineVector&& otherVector) noexcept
+			: InlineVector()
+		{
+			StealFrom(otherVector);
+		}
+
+		GDINL ~InlineVector()
+		{
+			Clear();
+		}
+
+	private:
+
+		/*!
+		 * Moves contents of the other vector into this empty vector.
+		 * @param otherVector Vector would be moved into current object.
+		 */
+		GDINL void StealFrom(InlineVector& otherVector)
+		{
+			GD_ASSERT(m_Length == 0 && IsInline(), "Stealing into a non-empty vector.");
+			if (otherVector.IsInline())
+			{
+				Algo::RelocateRange(otherVector.m_Memory, otherVector.m_Memory + otherVector.m_Length, m_Memory);
+				m_Length = otherVector.m_Length;
+			}
+			else
+			{
+				m_Memory = otherVector.m_Memory;
+				m_Length = otherVector.m_Length;
+				m_Capacity = otherVector.m_Capacity;
+				otherVector.m_Memory = otherVector.GetInlineMemory();
+				otherVector.m_Capacity = TInlineCapacity;
+			}
+			otherVector.m_Length = 0;
+		}
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Iteration API.
+		// ------------------------------------------------------------------------------------------
+
+		GDINL Iterator Begin()
+		{
+			return Iterator(*this);
+		}
+		GDINL ConstIterator Begin() const
+		{
+			return ConstIterator(*this);
+		}
+
+		GDINL Iterator End()
+		{
+			return Begin() + m_Length;
+		}
+		GDINL ConstIterator End() const
+		{
+			return Begin() + m_Length;
+		}
+
+		GDINL ReverseIterator ReverseBegin()
+		{
+			return ReverseIterator(End() - 1);
+		}
+		GDINL ReverseConstIterator ReverseBegin() const
+		{
+			return ReverseConstIterator(End() - 1);
+		}
+
+		GDINL ReverseIterator ReverseEnd()
+		{
+			return ReverseIterator(Begin() - 1);
+		}
+		GDINL ReverseConstIterator ReverseEnd() const
+		{
+			return ReverseConstIterator(Begin() - 1);
+		}
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Dynamic size management.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Returns pointer to the data stored in vector.
+		 */
+		//! @{
+		GDINL TElement const* GetData() const
+		{
+			return m_Memory;
+		}
+		GDINL TElement* GetData()
+		{
+			return m_Memory;
+		}
+		//! @}
+
+		/*!
+		 * Returns number of elements that exist in vector.
+		 */
+		GDINL SizeTp GetLength() const
+		{
+			return m_Length;
+		}
+
+		/*!
+		 * Returns number of elements that can be placed into vector without reallocation.
+		 */
+		GDINL SizeTp GetCapacity() const
+		{
+			return m_Capacity;
+		}
+
+		/*!
+		 * Returns true if this vector is empty.
+		 */
+		GDINL bool IsEmpty() const
+		{
+			return m_Length == 0;
+		}
+
+		/*!
+		 * Returns true if elements of this vector are stored inline, without heap allocation.
+		 */
+		GDINL bool IsInline() const
+		{
+			return m_Memory == GetInlineMemory();
+		}
+
+		/*!
+		 * Resizes vector to make it able to contain specified number of elements.
+		 * @param newLength New required length of the vector.
+		 */
+		GDINL void Resize(SizeTp const newLength)
+		{
+			if (m_Length != newLength)
+			{
+				if (m_Length < newLength)
+				{
+					ReserveToLength(newLength);
+					Algo::InitializeRange(m_Memory + m_Length, m_Memory + newLength);
+				}
+				else
+				{
+					Algo::DeinitializeRange(m_Memory + newLength, m_Memory + m_Length);
+				}
+				m_Length = newLength;
+			}
+		}
+
+		/*!
+		 * Reserves memory for vector to make it contain specified number of elements without
+		 * reallocation when calling Resize/Insert/InsertLast method. Capacity never gets less
+		 * than the inline capacity: reserving less moves elements back into the inline storage.
+		 *
+		 * @param newCapacity New required capacity of the vector.
+		 */
+		GDINL void Reserve(SizeTp newCapacity)
+		{
+			if (newCapacity < TInlineCapacity)
+			{
+				newCapacity = TInlineCapacity;
+			}
+			if (m_Capacity != newCapacity)
+			{
+				if (newCapacity < m_Length)
+				{
+					Resize(newCapacity);
+				}
+
+				auto const newMemory = newCapacity == TInlineCapacity ? GetInlineMemory() : GD_MALLOC_ARRAY_T(TElement, newCapacity);
+				Algo::RelocateRange(m_Memory, m_Memory + m_Length, newMemory);
+				if (!IsInline())
+				{
+					GD_FREE(m_Memory);
+				}
+
+				m_Memory = newMemory;
+				m_Capacity = newCapacity;
+			}
+		}
+
+		/*!
+		 * Reserves memory for vector to make it contain best fitting number of elements
+		 * to predicted new size. This function incrementally grows capacity in 1.3 times.
+		 *
+		 * @param newLength New desired length.
+		 */
+		GDINL void ReserveToLength(SizeTp const newLength)
+		{
+			if (newLength > m_Capacity)
+			{
+				auto const newCapacity = 13 * newLength / 10;
+				Reserve(newCapacity);
+			}
+		}
+
+		/*!
+		 * Shrinks vector's capacity to the specified length.
+		 */
+		GDINL void ShrinkToFit()
+		{
+			Reserve(m_Length);
+		}
+
+		/*!
+		 * Destroys all elements in the vector without memory deallocation.
+		 */
+		GDINL void Emptify()
+		{
+			Resize(0);
+		}
+
+		/*!
+		 * Destroys all elements in vector with memory deallocation.
+		 */
+		GDINL void Clear()
+		{
+			Emptify();
+			Reserve(0);
+		}
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Dynamic elements access.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Returns reference on last element in the vector.
+		 */
+		//! @{
+		GDINL TElement const& GetLast() const
+		{
+			return (*this)[m_Length - 1];
+		}
+		GDINL TElement& GetLast()
+		{
+			return const_cast<TElement&>(const_cast<InlineVector const*>(this)->GetLast());
+		}
+		//! @}
+
+		/*!
+		 * Inserts specified element into collection at desired index.
+		 *
+		 * @param index At this index new element would be inserted. All existing elements would be shifted to right.
+		 * @param element New element that would be inserted.
+		 *
+		 * @returns Index at which new element was inserted, or the value of @ref index parameter.
+		 */
+		//! @{
+		GDINL SizeTp InsertAt(SizeTp const index, TElement&& element = TElement())
+		{
+			GD_ASSERT(index <= m_Length, "Index is out of bounds");
+
+			ReserveToLength(m_Length + 1);
+			Algo::RelocateRange(m_Memory + index, m_Memory + m_Length, m_Memory + index + 1);
+			Algo::InitializeIterator(m_Memory + index, Utils::Forward<TElement>(element));
+			m_Length += 1;
+			return index;
+		}
+		GDINL SizeTp InsertAt(SizeTp const index, TElement const& element)
+		{
+			// Element may reference this vector's memory, so copying it before shifting.
+			return InsertAt(index, TElement(element));
+		}
+		//! @}
+
+		/*!
+		 * Appends new element to the vector.
+		 *
+		 * @param newElement New element that would be inserted into the end of container.
+		 * @returns Index at which new element was inserted.
+		 */
+		//! @{
+		GDINL SizeTp InsertLast(TElement&& newElement = TElement())
+		{
+			ReserveToLength(m_Length + 1);
+			Algo::InitializeIterator(m_Memory + m_Length, Utils::Forward<TElement>(newElement));
+			return m_Length++;
+		}
+		GDINL SizeTp InsertLast(TElement const& newElement)
+		{
+			ReserveToLength(m_Length + 1);
+			Algo::InitializeIterator(m_Memory + m_Length, newElement);
+			return m_Length++;
+		}
+		//! @}
+
+		/*!
+		 * Removes existing element from array at specified index.
+		 *
+		 * @param index Element at this index would be removed. All other elements would be shifted to left.
+		 * @param amount An amount of elements to remove.
+		 */
+		GDINL void EraseAt(SizeTp const index, SizeTp const amount = 1)
+		{
+			GD_ASSERT(index + amount <= m_Length, "Index is out of bounds");
+			Algo::DeinitializeRange(m_Memory + index, m_Memory + index + amount);
+			Algo::RelocateRange(m_Memory + index + amount, m_Memory + m_Length, m_Memory + index);
+			m_Length -= amount;
+		}
+
+		/*!
+		 * Removes last element from vector.
+		 */
+		GDINL void EraseLast()
+		{
+			GD_ASSERT(m_Length != 0, "vector size is zero");
+			Resize(m_Length - 1);
+		}
+
+		/*!
+		 * Searches for first element in vector by checking equality.
+		 *
+		 * @param element Object that function would be looking for.
+		 * @returns Index of found element or @c SizeTpMax if nothing was found.
+		 */
+		GDINL SizeTp FindFirst(TElement const& element) const
+		{
+			for (SizeTp cnt = 0; cnt < m_Length; ++cnt)
+			{
+				if (m_Memory[cnt] == element)
+				{
+					return cnt;
+				}
+			}
+			return SizeTpMax;
+		}
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Overloaded operators.
+		// ------------------------------------------------------------------------------------------
+
+		// vector = something
+		GDINL InlineVector& operator= (InlineVector&& otherVector) noexcept
+		{
+			if (&otherVector != this)
+			{
+				Clear();
+				StealFrom(otherVector);
+			}
+			return *this;
+		}
+		GDINL InlineVector& operator= (InlineVector const& otherVector)
+		{
+			if (&otherVector != this)
+			{
+				Emptify();
+				Reserve(otherVector.m_Length);
+				Algo::CopyRange(otherVector.m_Memory, otherVector.m_Memory + otherVector.m_Length, m_Memory);
+				m_Length = otherVector.m_Length;
+			}
+			return *this;
+		}
+		template<SizeTp TOtherInlineCapacity, typename TOtherAllocator>
+		GDINL InlineVector& operator= (InlineVector<TElement, TOtherInlineCapacity, TOtherAllocator> const& otherVector)
+		{
+			Emptify();
+			Reserve(otherVector.GetLength());
+			Algo::CopyRange(otherVector.GetData(), otherVector.GetData() + otherVector.GetLength(), m_Memory);
+			m_Length = otherVector.GetLength();
+			return *this;
+		}
+		GDINL InlineVector& operator= (InitializerList<TElement> const& initializerList)
+		{
+			Emptify();
+			Reserve(initializerList.size());
+			Algo::CopyRange(initializerList.begin(), initializerList.end(), m_Memory);
+			m_Length = initializerList.size();
+			return *this;
+		}
+
+		// vector[]
+		GDINL TElement const& operator[] (SizeTp const index) const
+		{
+			GD_ASSERT(index < m_Length, "Index is out of bounds");
+			return m_Memory[index];
+		}
+		GDINL TElement& operator[] (SizeTp const index)
+		{
+			return const_cast<TElement&>(const_cast<InlineVector const&>(*this)[index]);
+		}
+
+		// vector == vector
+		template<SizeTp TOtherInlineCapacity, typename TOtherAllocator>
+		GDINL friend bool operator== (InlineVector const& lhs, InlineVector<TElement, TOtherInlineCapacity, TOtherAllocator> const& rhs)
+		{
+			return lhs.GetLength() == rhs.GetLength() && Algo::LexicographicalCompare(lhs, rhs, TEqual<TElement>());
+		}
+		template<SizeTp TOtherInlineCapacity, typename TOtherAllocator>
+		GDINL friend bool operator!= (InlineVector const& lhs, InlineVector<TElement, TOtherInlineCapacity, TOtherAllocator> const& rhs)
+		{
+			return !(lhs == rhs);
+		}
+
+		// vector += vector
+		template<SizeTp TOtherInlineCapacity, typename TOtherAllocator>
+		GDINL friend InlineVector& operator+= (InlineVector& lhs, InlineVector<TElement, TOtherInlineCapacity, TOtherAllocator> const& rhs)
+		{
+			lhs.ReserveToLength(lhs.m_Length + rhs.GetLength());
+			for (auto iterator = rhs.Begin(); iterator != rhs.End(); ++iterator)
+			{
+				lhs.InsertLast(*iterator);
+			}
+			return lhs;
+		}
+
+		// vector += Element
+		GDINL friend InlineVector& operator+= (InlineVector& lhs, TElement&& rhs)
+		{
+			lhs.InsertLast(Utils::Forward<TElement>(rhs));
+			return lhs;
+		}
+		GDINL friend InlineVector& operator+= (InlineVector& lhs, TElement const& rhs)
+		{
+			lhs.InsertLast(rhs);
+			return lhs;
+		}
+
+	};	// class InlineVector
+
+GD_NAMESPACE_END
@@ -0,0 +1,143 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+
+/*!
+ * @file GoddamnEngine/Core/Containers/InlineVector.cpp
+ * Dynamically sized array class with inline storage.
+ */
+#include <GoddamnEngine/Core/Containers/InlineVector.h>
+#include <GoddamnEngine/Core/Containers/Vector.h>
+
+GD_NAMESPACE_BEGIN
+
+#if GD_TESTING_ENABLED
+
+	using InlineVectorInt = InlineVector<int, 4>;
+
+	gd_testing_unit_test(InlineVectorIntBaseCtors)
+	{
+		InlineVectorInt vector{ 0, 1 };
+		gd_testing_verify(vector.GetData()[0] == 0 && vector.GetData()[1] == 1);
+		gd_testing_verify(vector.IsInline() && vector.GetCapacity() == 4);
+	};
+
+	gd_testing_unit_test(InlineVectorIntEqualsNotEqualsOperators)
+	{
+		InlineVectorInt a{ 0, 1, 2 };
+		InlineVectorInt b{ 1, 2, 3 };
+		InlineVectorInt c{ 0, 1, 2 };
+		InlineVector<int, 2> d{ 0, 1, 2 };
+
+		gd_testing_verify(a != b);
+		gd_testing_verify(a == c);
+		gd_testing_verify(a == d);
+	};
+
+	gd_testing_unit_test(InlineVectorIntSpillToHeap)
+	{
+		InlineVectorInt vector;
+		for (int cnt = 0; cnt < 4; ++cnt)
+		{
+			vector.InsertLast(cnt);
+		}
+		gd_testing_verify(vector.IsInline());
+
+		vector.InsertLast(4);
+		gd_testing_verify(!vector.IsInline() && vector.GetCapacity() >= 5);
+		gd_testing_verify(vector == InlineVectorInt{ 0, 1, 2, 3, 4 });
+
+		vector.Resize(2);
+		vector.ShrinkToFit();
+		gd_testing_verify(vector.IsInline() && vector.GetCapacity() == 4);
+		gd_testing_verify(vector == InlineVectorInt{ 0, 1 });
+
+		vector.Clear();
+		gd_testing_verify(vector.IsInline() && vector.IsEmpty());
+	};
+
+	gd_testing_unit_test(InlineVectorIntAssigmentOperators)
+	{
+		{
+			InlineVectorInt vectorOriginal{ 0, 1, 2 };
+			InlineVectorInt vectorCopy;
+			InlineVectorInt vectorMoved;
+
+			vectorCopy = vectorOriginal;
+			gd_testing_verify(vectorOriginal == vectorCopy && vectorOriginal.GetData() != vectorCopy.GetData());
+
+			vectorMoved = Utils::Move(vectorOriginal);
+			gd_testing_verify(vectorOriginal.IsEmpty() && vectorMoved == vectorCopy && vectorMoved.IsInline());
+		}
+
+		{
+			InlineVectorInt vectorOriginal{ 0, 1, 2, 3, 4, 5 };
+			auto const originalData = vectorOriginal.GetData();
+
+			InlineVectorInt vectorMoved(Utils::Move(vectorOriginal));
+			gd_testing_verify(vectorMoved.GetData() == originalData && vectorMoved == InlineVectorInt{ 0, 1, 2, 3, 4, 5 });
+			gd_testing_verify(vectorOriginal.IsEmpty() && vectorOriginal.IsInline());
+		}
+	};
+
+	gd_testing_unit_test(InlineVectorIntElementsAccess)
+	{
+		{
+			InlineVectorInt vector{ 0, 1 };
+			gd_testing_verify(vector.GetLast() == 1);
+
+			try
+			{
+				// This should fail.
+				vector[2];
+				gd_testing_verify(false);
+			}
+			catch (goddamn_testing::assertion_exception const&)
+			{
+				gd_testing_verify(true);
+			}
+		}
+
+		{
+			InlineVectorInt vector{ 0, 1, 3 };
+			vector.InsertAt(2, 2);
+			gd_testing_verify(vector == InlineVectorInt{ 0, 1, 2, 3 });
+
+			vector.InsertAt(0, -1);
+			gd_testing_verify(vector == InlineVectorInt{ -1, 0, 1, 2, 3 });
+
+			vector.EraseAt(1, 2);
+			gd_testing_verify(vector == InlineVectorInt{ -1, 2, 3 });
+
+			vector.EraseLast();
+			gd_testing_verify(vector == InlineVectorInt{ -1, 2 });
+			gd_testing_verify(vector.FindFirst(2) == 1 && vector.FindFirst(3) == SizeTpMax);
+		}
+	};
+
+	gd_testing_unit_test(InlineVectorNonTrivialElements)
+	{
+		using VectorInt = Vector<int>;
+
+		InlineVector<VectorInt, 2> vector;
+		vector.InsertLast(VectorInt{ 0 });
+		vector.InsertLast(VectorInt{ 1, 1 });
+		vector.InsertLast(VectorInt{ 2, 2, 2 });
+		gd_testing_verify(!vector.IsInline() && vector.GetLength() == 3);
+
+		vector.EraseAt(0);
+		vector.ShrinkToFit();
+		gd_testing_verify(vector.IsInline() && vector[0] == VectorInt{ 1, 1 } && vector[1] == VectorInt{ 2, 2, 2 });
+
+		InlineVector<VectorInt, 2> vectorMoved(Utils::Move(vector));
+		gd_testing_verify(vector.IsEmpty() && vectorMoved.GetLength() == 2 && vectorMoved[1] == VectorInt{ 2, 2, 2 });
+	};
+
+#endif	// if GD_TESTING_ENABLED
+
+GD_NAMESPACE_END
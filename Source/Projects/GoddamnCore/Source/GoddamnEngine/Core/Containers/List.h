@@ -46,7 +46,7 @@ GD_NAMESPACE_BEGIN
 		 */
 		template<typename... TArguments>
 		GDINL explicit LinkedListNode(LinkedListNode* const next, TArguments&&... arguments)
-			: m_Next(next), m_Element(Utils::Forward<TElement&&>(arguments)...)
+			: m_Next(next), m_Element(Utils::Forward<TArguments>(arguments)...)
 		{}
 
 	public:
@@ -292,7 +292,7 @@ GD_NAMESPACE_BEGIN
 		}
 		GDINL TElement& GetFirst()
 		{
-			return const_cast<TElement&>(const_cast<LinkedList const*>(this)->GetLast());
+			return const_cast<TElement&>(const_cast<LinkedList const*>(this)->GetFirst());
 		}
 		//! @}
 
@@ -307,6 +307,7 @@ GD_NAMESPACE_BEGIN
 			new (newNode) LinkedListNodeType(m_FirstNode, Utils::Forward<TElement>(element));
 
 			m_FirstNode = newNode;
+			m_Length += 1;
 			return newNode->GetElement();
 		}
 		GDINL TElement& InsertFirst(TElement const& element)
@@ -315,10 +316,25 @@ GD_NAMESPACE_BEGIN
 			new (newNode) LinkedListNodeType(m_FirstNode, element);
 
 			m_FirstNode = newNode;
+			m_Length += 1;
 			return newNode->GetElement();
 		}
 		//! @}
 
+		/*!
+		 * Removes first element from the list.
+		 */
+		GDINL void EraseFirst()
+		{
+			GD_ASSERT(m_FirstNode != nullptr, "List is empty.");
+			auto const remNode = m_FirstNode;
+			m_FirstNode = m_FirstNode->GetNextNode();
+			m_Length -= 1;
+
+			remNode->~LinkedListNodeType();
+			GD_FREE(remNode);
+		}
+
 		/*!
 		 * Inserts the node after the specified node.
 		 * @param node Node that would be inserted.
@@ -346,7 +362,7 @@ GD_NAMESPACE_BEGIN
 		 */
 		GDINL void InsertAfter(TElement&& element = TElement(), LinkedListNodeType* const after = nullptr)
 		{
-			this->InsertNodeAfter(new LinkedListNodeType(Forward<TElement>(element), after));
+			this->InsertNodeAfter(new LinkedListNodeType(Utils::Forward<TElement>(element), after));
 		}
 		GDINL void InsertAfter(TElement const& element, LinkedListNodeType* const after = nullptr)
 		{
@@ -416,13 +432,6 @@ GD_NAMESPACE_BEGIN
 
 	}; // class LinkedList
 
-	template<typename TElement, SizeTp TCapacity = InlineAllocatorCapacityNormal>
-	using TempLinkedList = LinkedList<TElement, InlineFixedSizedPoolAllocator<sizeof LinkedListNode<TElement>, InlineAllocatorCapacityNormal>>;
-	template<typename TElement>
-	using TempTinyLinkedList = TempLinkedList<TElement, InlineAllocatorCapacityTiny>;
-	template<typename TElement>
-	using TempHugeLinkedList = TempLinkedList<TElement, InlineAllocatorCapacityHuge>;
-
 	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
 	// ******    DoubleLinkedList, DoubleLinkedListIterator & DoubleLinkedListNode classes.    ******
 	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
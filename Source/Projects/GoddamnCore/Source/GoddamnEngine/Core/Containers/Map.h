@@ -73,6 +73,14 @@ GD_NAMESPACE_BEGIN
 
 	};	// struct MapPair
 
+	namespace TypeTraits
+	{
+		template<typename TKey, typename TValue>
+		struct IsTriviallyRelocatable<MapPair<TKey, TValue>> 
+			: public Internal::TypeTraitsBase<IsTriviallyRelocatable<TKey>::Value && IsTriviallyRelocatable<TValue>::Value>
+		{};
+	}	// namespace TypeTraits
+
 	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
 	// ******                                 Map<K, V> class.                                 ******
 	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
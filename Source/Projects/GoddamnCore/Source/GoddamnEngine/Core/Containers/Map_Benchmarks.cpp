@@ -0,0 +1,151 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/Containers/Map_Benchmarks.cpp
+ * Ordered associative containers benchmarks: red-black tree versus B-tree.
+ */
+#include <GoddamnEngine/Core/Containers/Map.h>
+#include <GoddamnEngine/Core/Containers/BTreeMap.h>
+#include <GoddamnEngine/Core/Containers/Vector.h>
+
+GD_NAMESPACE_BEGIN
+
+#if GD_TESTING_ENABLED
+
+	SizeTp static const MapBenchmarkLengths[] = { 10000, 100000, 1000000, 10000000 };
+	char const* const MapBenchmarkCases[][4] = {
+		{ "Map 10k", "Map 100k", "Map 1M", "Map 10M" },
+		{ "BTreeMap 10k", "BTreeMap 100k", "BTreeMap 1M", "BTreeMap 10M" },
+	};
+
+	// Keeps results of the benchmarks, so that computations are not optimized away.
+	static UInt64 volatile g_MapBenchmarkSink;
+
+	// Keys are inserted in pseudo-random order: multiplication by odd number is a permutation.
+	GDINL static UInt32 MapBenchmarkKey(SizeTp const index)
+	{
+		return static_cast<UInt32>(index * 2654435761u);
+	}
+
+	template<typename TMap>
+	GDINL static void MapBenchmarkFill(TMap& map, SizeTp const length)
+	{
+		for (SizeTp cnt = 0; cnt < length; ++cnt)
+		{
+			map.Insert(MapBenchmarkKey(cnt), static_cast<UInt32>(cnt));
+		}
+	}
+
+	template<typename TMap>
+	GDINL static void MapBenchmarkInsert(goddamn_testing::benchmark_state& state, char const* const (&caseNames)[4])
+	{
+		for (SizeTp lengthIndex = 0; lengthIndex < 4; ++lengthIndex)
+		{
+			auto const length = MapBenchmarkLengths[lengthIndex];
+			state.measure(caseNames[lengthIndex], length, [length]
+			{
+				TMap map;
+				MapBenchmarkFill(map, length);
+				g_MapBenchmarkSink = map.GetLength();
+			}, 3);
+		}
+	}
+
+	template<typename TMap>
+	GDINL static void MapBenchmarkLookup(goddamn_testing::benchmark_state& state, char const* const (&caseNames)[4])
+	{
+		for (SizeTp lengthIndex = 0; lengthIndex < 4; ++lengthIndex)
+		{
+			auto const length = MapBenchmarkLengths[lengthIndex];
+			TMap map;
+			MapBenchmarkFill(map, length);
+			state.measure(caseNames[lengthIndex], length, [&map, length]
+			{
+				UInt64 sum = 0;
+				for (SizeTp cnt = 0; cnt < length; ++cnt)
+				{
+					sum += *map.Find(MapBenchmarkKey(cnt * 40503 % length));
+				}
+				g_MapBenchmarkSink = sum;
+			});
+		}
+	}
+
+	template<typename TMap>
+	GDINL static void MapBenchmarkIteration(goddamn_testing::benchmark_state& state, char const* const (&caseNames)[4])
+	{
+		for (SizeTp lengthIndex = 0; lengthIndex < 4; ++lengthIndex)
+		{
+			auto const length = MapBenchmarkLengths[lengthIndex];
+			TMap map;
+			MapBenchmarkFill(map, length);
+			state.measure(caseNames[lengthIndex], length, [&map]
+			{
+				UInt64 sum = 0;
+				for (auto const& pair : map)
+				{
+					sum += pair.Value;
+				}
+				g_MapBenchmarkSink = sum;
+			});
+		}
+	}
+
+	gd_testing_benchmark(MapInsert, state)
+	{
+		MapBenchmarkInsert<Map<UInt32, UInt32>>(state, MapBenchmarkCases[0]);
+		MapBenchmarkInsert<BTreeMap<UInt32, UInt32>>(state, MapBenchmarkCases[1]);
+	};
+
+	gd_testing_benchmark(MapAssignSorted, state)
+	{
+		for (SizeTp lengthIndex = 0; lengthIndex < 4; ++lengthIndex)
+		{
+			auto const length = MapBenchmarkLengths[lengthIndex];
+			Vector<MapPair<UInt32, UInt32>> sortedPairs;
+			sortedPairs.Reserve(length);
+			for (SizeTp cnt = 0; cnt < length; ++cnt)
+			{
+				sortedPairs.InsertLast(MapPair<UInt32, UInt32>(static_cast<UInt32>(cnt), static_cast<UInt32>(cnt)));
+			}
+
+			// Red-black tree has no bulk-loading, so sorted pairs are inserted one by one.
+			state.measure(MapBenchmarkCases[0][lengthIndex], length, [&sortedPairs]
+			{
+				Map<UInt32, UInt32> map;
+				for (auto const& pair : sortedPairs)
+				{
+					map.Insert(pair.Key, pair.Value);
+				}
+				g_MapBenchmarkSink = map.GetLength();
+			}, 3);
+			state.measure(MapBenchmarkCases[1][lengthIndex], length, [&sortedPairs]
+			{
+				BTreeMap<UInt32, UInt32> map;
+				map.AssignSorted(sortedPairs.Begin(), sortedPairs.End());
+				g_MapBenchmarkSink = map.GetLength();
+			}, 3);
+		}
+	};
+
+	gd_testing_benchmark(MapLookup, state)
+	{
+		MapBenchmarkLookup<Map<UInt32, UInt32>>(state, MapBenchmarkCases[0]);
+		MapBenchmarkLookup<BTreeMap<UInt32, UInt32>>(state, MapBenchmarkCases[1]);
+	};
+
+	gd_testing_benchmark(MapIteration, state)
+	{
+		MapBenchmarkIteration<Map<UInt32, UInt32>>(state, MapBenchmarkCases[0]);
+		MapBenchmarkIteration<BTreeMap<UInt32, UInt32>>(state, MapBenchmarkCases[1]);
+	};
+
+#endif	// if GD_TESTING_ENABLED
+
+GD_NAMESPACE_END
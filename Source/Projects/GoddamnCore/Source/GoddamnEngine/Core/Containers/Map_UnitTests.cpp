@@ -11,6 +11,8 @@
  * Dynamically sized associative container class.
  */
 #include <GoddamnEngine/Core/Containers/Map.h>
+#include <GoddamnEngine/Core/Containers/BTreeMap.h>
+#include <GoddamnEngine/Core/Containers/FlatMap.h>
 #include <GoddamnEngine/Core/Containers/UnorderedMap.h>
 #include <GoddamnEngine/Core/Containers/UnorderedVectorMap.h>
 
@@ -44,10 +46,12 @@ GD_NAMESPACE_BEGIN
 	};
 
 	using MapIntFloat = Map<int, float>;
+	using BTreeMapIntFloat = BTreeMap<int, float>;
+	using FlatMapIntFloat = FlatMap<int, float>;
 	using UnorderedMapIntFloat = UnorderedMap<int, float>;
 	using UnorderedVectorMapIntFloat = UnorderedVectorMap<int, float>;
 
-	gd_testing_unit_test_foreach(MapIntFloatInsert, TMapType, MapIntFloat, UnorderedMapIntFloat, UnorderedVectorMapIntFloat)
+	gd_testing_unit_test_foreach(MapIntFloatInsert, TMapType, MapIntFloat, BTreeMapIntFloat, FlatMapIntFloat, UnorderedMapIntFloat, UnorderedVectorMapIntFloat)
 	{
 		TMapType map;
 		map.Insert(1, 10.0f);
@@ -68,7 +72,7 @@ GD_NAMESPACE_BEGIN
 		}
 	};
 
-	gd_testing_unit_test_foreach(MapIntFloatIteration, TMapType, MapIntFloat, UnorderedMapIntFloat, UnorderedVectorMapIntFloat)
+	gd_testing_unit_test_foreach(MapIntFloatIteration, TMapType, MapIntFloat, BTreeMapIntFloat, FlatMapIntFloat, UnorderedMapIntFloat, UnorderedVectorMapIntFloat)
 	{
 		TMapType map{ { 2, 20.0f }, { 1, 10.0f }, { 0, 0.0f }, { 3, 30.0f } };
 		std::array<float, 4> stdMap = { -100.0f };
@@ -94,7 +98,7 @@ GD_NAMESPACE_BEGIN
 		}
 	};
 
-	gd_testing_unit_test_foreach(MapIntFloatLengthAccess, TMapType, MapIntFloat, UnorderedMapIntFloat, UnorderedVectorMapIntFloat)
+	gd_testing_unit_test_foreach(MapIntFloatLengthAccess, TMapType, MapIntFloat, BTreeMapIntFloat, FlatMapIntFloat, UnorderedMapIntFloat, UnorderedVectorMapIntFloat)
 	{
 		TMapType map1;
 		gd_testing_verify(map1.GetLength() == 0);
@@ -105,7 +109,7 @@ GD_NAMESPACE_BEGIN
 		gd_testing_verify(!map2.IsEmpty());
 	};
 
-	gd_testing_unit_test_foreach(MapIntFloatMoveCtor, TMapType, MapIntFloat, UnorderedMapIntFloat/*, UnorderedVectorMapIntFloat*/)
+	gd_testing_unit_test_foreach(MapIntFloatMoveCtor, TMapType, MapIntFloat, BTreeMapIntFloat, FlatMapIntFloat, UnorderedMapIntFloat/*, UnorderedVectorMapIntFloat*/)
 	{
 		TMapType map1{ { 2, 20.0f }, { 3, 30.0f }, { 4, 40.0f }, { 5, 50.0f } };
 		TMapType map2(Utils::Move(map1));
@@ -115,7 +119,7 @@ GD_NAMESPACE_BEGIN
 		GD_STUBBED(UnorderedVectorMapIntFloatMoveCtor);
 	};
 
-	gd_testing_unit_test_foreach(MapIntFloatMoveAssignmentOperator, TMapType, MapIntFloat, UnorderedMapIntFloat/*, UnorderedVectorMapIntFloat*/)
+	gd_testing_unit_test_foreach(MapIntFloatMoveAssignmentOperator, TMapType, MapIntFloat, BTreeMapIntFloat, FlatMapIntFloat, UnorderedMapIntFloat/*, UnorderedVectorMapIntFloat*/)
 	{
 		TMapType map1{ { 2, 20.0f }, { 3, 30.0f }, { 4, 40.0f }, { 5, 50.0f } };
 		TMapType map2{ { 7, 70.0f } };
@@ -127,7 +131,7 @@ GD_NAMESPACE_BEGIN
 		GD_STUBBED(UnorderedVectorMapIntFloatMoveAssignmentOperator);
 	};
 
-	gd_testing_unit_test_foreach(MapIntFindIterator, TMapType, MapIntFloat, UnorderedMapIntFloat, UnorderedVectorMapIntFloat)
+	gd_testing_unit_test_foreach(MapIntFindIterator, TMapType, MapIntFloat, BTreeMapIntFloat, FlatMapIntFloat, UnorderedMapIntFloat, UnorderedVectorMapIntFloat)
 	{
 		TMapType map{ { 1, 10.0f }, { 2, 20.0f }, { 3, 30.0f } };
 		gd_testing_verify(map.FindIterator(1)->Value == 10.0f);
@@ -136,7 +140,7 @@ GD_NAMESPACE_BEGIN
 		gd_testing_verify(map.FindIterator(4) == map.End());
 	};
 
-	gd_testing_unit_test_foreach(MapIntFind, TMapType, MapIntFloat, UnorderedMapIntFloat, UnorderedVectorMapIntFloat)
+	gd_testing_unit_test_foreach(MapIntFind, TMapType, MapIntFloat, BTreeMapIntFloat, FlatMapIntFloat, UnorderedMapIntFloat, UnorderedVectorMapIntFloat)
 	{
 		TMapType map{ { 1, 10.0f }, { 2, 20.0f }, { 3, 30.0f } };
 		gd_testing_verify(*map.Find(1) == 10.0f);
@@ -145,7 +149,7 @@ GD_NAMESPACE_BEGIN
 		gd_testing_verify( map.Find(4) == nullptr);
 	};
 
-	gd_testing_unit_test_foreach(MapIntContains, TMapType, MapIntFloat, UnorderedMapIntFloat, UnorderedVectorMapIntFloat)
+	gd_testing_unit_test_foreach(MapIntContains, TMapType, MapIntFloat, BTreeMapIntFloat, FlatMapIntFloat, UnorderedMapIntFloat, UnorderedVectorMapIntFloat)
 	{
 		TMapType map{ { 1, 10.0f }, { 2, 20.0f }, { 3, 30.0f } };
 		gd_testing_verify(map.Contains(1));
@@ -154,7 +158,7 @@ GD_NAMESPACE_BEGIN
 		gd_testing_verify(!map.Contains(4));
 	};
 
-	gd_testing_unit_test_foreach(MapIntErase, TMapType, MapIntFloat, UnorderedMapIntFloat, UnorderedVectorMapIntFloat)
+	gd_testing_unit_test_foreach(MapIntErase, TMapType, MapIntFloat, BTreeMapIntFloat, FlatMapIntFloat, UnorderedMapIntFloat, UnorderedVectorMapIntFloat)
 	{
 		TMapType map{ { 1, 10.0f }, { 2, 20.0f }, { 3, 30.0f },
 					  { 4, 40.0f }, { 5, 50.0f }, { 6, 60.0f }, 
@@ -0,0 +1,302 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/Containers/Name.cpp
+ * Interned string names.
+ */
+#include <GoddamnEngine/Core/Containers/Name.h>
+#include <GoddamnEngine/Core/Concurrency/CriticalSection.h>
+#include <GoddamnEngine/Core/Misc/MemoryTracker.h>
+
+GD_NAMESPACE_BEGIN
+
+	UInt32 static const NameChunkSizeLog2 = 12;
+	UInt32 static const NameChunkSize = 1u << NameChunkSizeLog2;
+	UInt32 static const NameMaxChunks = 1024;
+	SizeTp static const NameTableInitialCapacity = 1024;
+
+	// ------------------------------------------------------------------------------------------
+	// Name table.
+	// ------------------------------------------------------------------------------------------
+
+	/*!
+	 * Interned string.
+	 */
+	struct NameEntry final
+	{
+		UInt64 Hash;
+		UInt32 Length;
+		Char   Chars[1];
+	};	// struct NameEntry
+
+	/*!
+	 * Open-addressing table of the name indices. Each non-empty slot contains high 32 bits of the hash 
+	 * in the high half and the index of the name in the low half, so most of mismatches are rejected
+	 * without touching the strings.
+	 */
+	struct NameTableSlots final
+	{
+		SizeTp          Mask;
+		UInt64 volatile Slots[1];
+	};	// struct NameTableSlots
+
+	/*!
+	 * Global name table.
+	 *
+	 * Entries are addressed by the index through the two-level chunk array, so entries are never moved.
+	 * Slot tables are replaced, when they become half full: new table is filled and only then published,
+	 * old tables are leaked, because lock-free readers could still access them.
+	 */
+	struct NameTableState final : public TNonCopyable
+	{
+		NameEntry* volatile* volatile Chunks[NameMaxChunks];
+		NameTableSlots* volatile      Slots;
+		UInt32 volatile               NumNames;
+		CriticalSection               Lock;
+
+		GDINL NameTableState()
+			: Chunks(), Slots(nullptr), NumNames(1)
+		{
+			// Zero index is reserved for the none name, that is represented with empty string.
+			NameEntry static noneEntry = { Name::ComputeHash("", 0), 0, { '\0' } };
+			Chunks[0] = static_cast<NameEntry**>(CMemory::Memset(GD_MALLOC_ARRAY_T(NameEntry*, NameChunkSize), 0, NameChunkSize * sizeof(NameEntry*)));
+			Chunks[0][0] = &noneEntry;
+			Slots = AllocateSlots(NameTableInitialCapacity);
+		}
+
+		GDINL static NameTableSlots* AllocateSlots(SizeTp const capacity)
+		{
+			auto const slotsSize = sizeof(NameTableSlots) + (capacity - 1) * sizeof(UInt64);
+			auto const slots = static_cast<NameTableSlots*>(CMemory::Memset(GD_MALLOC(slotsSize), 0, slotsSize));
+			slots->Mask = capacity - 1;
+			return slots;
+		}
+	};	// struct NameTableState
+
+	/*!
+	 * Returns the name table, creating it on the first use.
+	 * Table is intentionally never destroyed: names could be used during static destruction.
+	 */
+	GDINT static NameTableState& GetNameTableState()
+	{
+		alignas(NameTableState) static Byte stateMemory[sizeof(NameTableState)];
+		static NameTableState* const state = new (stateMemory) NameTableState();
+		return *state;
+	}
+
+	/*!
+	 * Reads the value, published with the 'PublishNameValue' function, so that everything written
+	 * before the publication is visible. Lock-free.
+	 */
+	template<typename TValue>
+	GDINL static TValue ReadNameValue(TValue const volatile& value)
+	{
+#if GD_COMPILER_GCC_COMPATIBLE
+		return __atomic_load_n(&value, __ATOMIC_ACQUIRE);
+#else	// if GD_COMPILER_GCC_COMPATIBLE
+		// Volatile reads have acquire semantics with Microsoft compilers.
+		return value;
+#endif	// if GD_COMPILER_GCC_COMPATIBLE
+	}
+
+	/*!
+	 * Stores the value, so that readers observe everything written before it.
+	 */
+	template<typename TValue>
+	GDINL static void PublishNameValue(TValue volatile& destination, TValue const value)
+	{
+#if GD_COMPILER_GCC_COMPATIBLE
+		__atomic_store_n(&destination, value, __ATOMIC_RELEASE);
+#else	// if GD_COMPILER_GCC_COMPATIBLE
+		// Volatile writes have release semantics with Microsoft compilers.
+		destination = value;
+#endif	// if GD_COMPILER_GCC_COMPATIBLE
+	}
+
+	/*!
+	 * Returns entry of the name with specified index. Lock-free.
+	 */
+	GDINL static NameEntry const* GetNameEntry(NameTableState const& state, UInt32 const index)
+	{
+		GD_ASSERT(index < ReadNameValue(state.NumNames), "Name index is out of bounds.");
+		return ReadNameValue(ReadNameValue(state.Chunks[index >> NameChunkSizeLog2])[index & (NameChunkSize - 1)]);
+	}
+
+	/*!
+	 * Searches for the index of the interned string. Lock-free.
+	 * @returns Index of the name or zero, if the string was not found.
+	 */
+	GDINT static UInt32 FindNameIndex(NameTableState const& state, Char const* const string, SizeTp const length, UInt64 const hash)
+	{
+		auto const slots = ReadNameValue(state.Slots);
+		auto const slotTag = hash >> 32;
+		for (auto slotIndex = static_cast<SizeTp>(hash) & slots->Mask;; slotIndex = (slotIndex + 1) & slots->Mask)
+		{
+			auto const slot = ReadNameValue(slots->Slots[slotIndex]);
+			if (slot == 0)
+			{
+				return 0;
+			}
+			if (slot >> 32 == slotTag)
+			{
+				auto const index = static_cast<UInt32>(slot);
+				auto const entry = GetNameEntry(state, index);
+				if (entry->Length == length && CMemory::Memcmp(entry->Chars, string, length) == 0)
+				{
+					return index;
+				}
+			}
+		}
+	}
+
+	/*!
+	 * Inserts the slot into the slot table, that has enough free space.
+	 */
+	GDINL static void InsertNameSlot(NameTableSlots* const slots, UInt64 const hash, UInt32 const index)
+	{
+		auto slotIndex = static_cast<SizeTp>(hash) & slots->Mask;
+		while (slots->Slots[slotIndex] != 0)
+		{
+			slotIndex = (slotIndex + 1) & slots->Mask;
+		}
+		PublishNameValue(slots->Slots[slotIndex], (hash >> 32 << 32) | index);
+	}
+
+	/*!
+	 * Interns a new string. Should be called under the lock.
+	 * @returns Index of the new name.
+	 */
+	GDINT static UInt32 InsertName(NameTableState& state, Char const* const string, SizeTp const length, UInt64 const hash)
+	{
+		MemoryTagScope const memoryTagScope(MemoryTag::Strings);
+
+		auto const index = state.NumNames;
+		GD_VERIFY(index < NameMaxChunks * NameChunkSize, "Name table overflow.");
+
+		// Allocating the entry and publishing it to the readers.
+		auto const chunkIndex = index >> NameChunkSizeLog2;
+		if (state.Chunks[chunkIndex] == nullptr)
+		{
+			auto const chunk = static_cast<NameEntry* volatile*>(CMemory::Memset(GD_MALLOC_ARRAY_T(NameEntry*, NameChunkSize), 0, NameChunkSize * sizeof(NameEntry*)));
+			PublishNameValue(state.Chunks[chunkIndex], chunk);
+		}
+		auto const entry = static_cast<NameEntry*>(GD_MALLOC(sizeof(NameEntry) + length));
+		entry->Hash = hash;
+		entry->Length = static_cast<UInt32>(length);
+		CMemory::CMemcpy(entry->Chars, string, length);
+		entry->Chars[length] = '\0';
+		PublishNameValue(state.Chunks[chunkIndex][index & (NameChunkSize - 1)], entry);
+		PublishNameValue(state.NumNames, index + 1);
+
+		// Growing the slot table, when it becomes half full.
+		auto slots = state.Slots;
+		if ((index + 1) * 2 > slots->Mask + 1)
+		{
+			auto const newSlots = NameTableState::AllocateSlots((slots->Mask + 1) * 2);
+			for (SizeTp slotIndex = 0; slotIndex <= slots->Mask; ++slotIndex)
+			{
+				auto const slot = slots->Slots[slotIndex];
+				if (slot != 0)
+				{
+					auto const slotNameIndex = static_cast<UInt32>(slot);
+					InsertNameSlot(newSlots, GetNameEntry(state, slotNameIndex)->Hash, slotNameIndex);
+				}
+			}
+			PublishNameValue(state.Slots, newSlots);
+			slots = newSlots;
+		}
+		InsertNameSlot(slots, hash, index);
+		return index;
+	}
+
+	// ------------------------------------------------------------------------------------------
+	// Name class.
+	// ------------------------------------------------------------------------------------------
+
+	/*!
+	 * Interns the specified string with precomputed hash.
+	 *
+	 * @param string The string to intern.
+	 * @param length Length of the string.
+	 * @param hash Hash of the string, computed with the 'ComputeHash' function.
+	 */
+	GDAPI Name::Name(Char const* const string, SizeTp const length, UInt64 const hash)
+		: m_Index(0)
+	{
+		GD_ASSERT(hash == ComputeHash(string, length), "Invalid hash of the name.");
+		if (length != 0)
+		{
+			auto& state = GetNameTableState();
+			m_Index = FindNameIndex(state, string, length, hash);
+			if (m_Index == 0)
+			{
+				// Somebody could have interned same string, while we were waiting for the lock.
+				ScopedCriticalSection const lock(state.Lock);
+				m_Index = FindNameIndex(state, string, length, hash);
+				if (m_Index == 0)
+				{
+					m_Index = InsertName(state, string, length, hash);
+				}
+			}
+		}
+	}
+
+	/*!
+	 * Searches for the already interned string. Does not intern the string.
+	 *
+	 * @param string The string to search.
+	 * @param length Length of the string.
+	 * @param hash Hash of the string, computed with the 'ComputeHash' function.
+	 *
+	 * @returns Interned name or the none name, if the string was never interned.
+	 */
+	GDAPI Name Name::Find(Char const* const string, SizeTp const length, UInt64 const hash)
+	{
+		GD_ASSERT(hash == ComputeHash(string, length), "Invalid hash of the name.");
+		Name name;
+		if (length != 0)
+		{
+			name.m_Index = FindNameIndex(GetNameTableState(), string, length, hash);
+		}
+		return name;
+	}
+
+	/*!
+	 * Returns total amount of the interned names.
+	 */
+	GDAPI UInt32 Name::GetNumNames()
+	{
+		return ReadNameValue(GetNameTableState().NumNames) - 1;
+	}
+
+	/*!
+	 * Returns pointer to the null-terminated interned string.
+	 */
+	GDAPI Char const* Name::CStr() const
+	{
+		return GetNameEntry(GetNameTableState(), m_Index)->Chars;
+	}
+
+	/*!
+	 * Returns length of the interned string.
+	 */
+	GDAPI SizeTp Name::GetLength() const
+	{
+		return GetNameEntry(GetNameTableState(), m_Index)->Length;
+	}
+
+	/*!
+	 * Returns hash of the interned string.
+	 */
+	GDAPI UInt64 Name::GetHash() const
+	{
+		return GetNameEntry(GetNameTableState(), m_Index)->Hash;
+	}
+
+GD_NAMESPACE_END
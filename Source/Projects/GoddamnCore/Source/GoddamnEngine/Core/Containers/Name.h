@@ -0,0 +1,274 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/Containers/Name.h
+ * Interned string names.
+ */
+#pragma once
+
+#include <GoddamnEngine/Include.h>
+#include <GoddamnEngine/Core/Containers/String.h>
+#include <GoddamnEngine/Core/Containers/StringView.h>
+
+GD_NAMESPACE_BEGIN
+
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+	// ******                                    Name class.                                   ******
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+
+	// **------------------------------------------------------------------------------------------**
+	//! Immutable interned string, that is represented with 32-bit index into the global name table.
+	//! Names are compared and hashed as integers, so they should be used as identifiers of
+	//! classes, properties and other entities, that are looked up by the string keys.
+	//!
+	//! Lookups in the name table are lock-free, interning of the new names is serialized.
+	//! Interned strings are never freed. Names are case-sensitive.
+	//!
+	//! @code
+	//!		Name const name("Position");
+	//!		GD_ASSERT(name == GD_NAME("Position"), "Names are interned.");
+	//! @endcode
+	// **------------------------------------------------------------------------------------------**
+	class Name final
+	{
+	private:
+		UInt32 m_Index;
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Constructors.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Initializes the none name.
+		 */
+		GDINL Name()
+			: m_Index(0)
+		{
+		}
+
+		/*!
+		 * Interns the specified string with precomputed hash.
+		 *
+		 * @param string The string to intern.
+		 * @param length Length of the string.
+		 * @param hash Hash of the string, computed with the 'ComputeHash' function.
+		 */
+		GDAPI explicit Name(Char const* const string, SizeTp const length, UInt64 const hash);
+
+		/*!
+		 * Interns the specified string.
+		 *
+		 * @param string The string to intern.
+		 * @param length Length of the string.
+		 */
+		GDINL explicit Name(Char const* const string, SizeTp const length)
+			: Name(string, length, ComputeHash(string, length))
+		{
+		}
+
+		/*!
+		 * Interns the specified string.
+		 * @param string The string to intern.
+		 */
+		//! @{
+		GDINL explicit Name(Char const* const string)
+			: Name(string, CString::Strlen(string))
+		{
+		}
+		GDINL explicit Name(StringView const string)
+			: Name(string.GetData(), string.GetLength())
+		{
+		}
+		//! @}
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Name table lookups.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Computes hash of the string, that is used by the name table.
+		 * Could be evaluated at compile time.
+		 *
+		 * @param string The string to hash.
+		 * @param length Length of the string.
+		 *
+		 * @returns 64-bit FNV-1a hash of the string.
+		 */
+		//! @{
+		GDINL static constexpr UInt64 ComputeHash(Char const* const string, SizeTp const length)
+		{
+			UInt64 hash = 0xCBF29CE484222325ull;
+			for (SizeTp cnt = 0; cnt < length; ++cnt)
+			{
+				hash = (hash ^ static_cast<UInt8>(string[cnt])) * 0x100000001B3ull;
+			}
+			return hash;
+		}
+		GDINL static constexpr UInt64 ComputeHash(Char const* const string)
+		{
+			UInt64 hash = 0xCBF29CE484222325ull;
+			for (SizeTp cnt = 0; string[cnt] != '\0'; ++cnt)
+			{
+				hash = (hash ^ static_cast<UInt8>(string[cnt])) * 0x100000001B3ull;
+			}
+			return hash;
+		}
+		//! @}
+
+		/*!
+		 * Searches for the already interned string. Does not intern the string.
+		 *
+		 * @param string The string to search.
+		 * @param length Length of the string.
+		 * @param hash Hash of the string, computed with the 'ComputeHash' function.
+		 *
+		 * @returns Interned name or the none name, if the string was never interned.
+		 */
+		GDAPI static Name Find(Char const* const string, SizeTp const length, UInt64 const hash);
+
+		/*!
+		 * Searches for the already interned string. Does not intern the string.
+		 *
+		 * @param string The string to search.
+		 * @param length Length of the string.
+		 *
+		 * @returns Interned name or the none name, if the string was never interned.
+		 */
+		GDINL static Name Find(Char const* const string, SizeTp const length)
+		{
+			return Find(string, length, ComputeHash(string, length));
+		}
+
+		/*!
+		 * Searches for the already interned string. Does not intern the string.
+		 *
+		 * @param string The string to search.
+		 * @returns Interned name or the none name, if the string was never interned.
+		 */
+		//! @{
+		GDINL static Name Find(Char const* const string)
+		{
+			return Find(string, CString::Strlen(string));
+		}
+		GDINL static Name Find(StringView const string)
+		{
+			return Find(string.GetData(), string.GetLength());
+		}
+		//! @}
+
+		/*!
+		 * Returns total amount of the interned names.
+		 */
+		GDAPI static UInt32 GetNumNames();
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Name accessors.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Returns index of this name in the name table. The none name has zero index.
+		 */
+		GDINL UInt32 GetIndex() const
+		{
+			return m_Index;
+		}
+
+		/*!
+		 * Returns true if this is the none name.
+		 */
+		GDINL bool IsNone() const
+		{
+			return m_Index == 0;
+		}
+
+		/*!
+		 * Returns pointer to the null-terminated interned string.
+		 * Pointer stays valid till the end of the program.
+		 */
+		GDAPI Char const* CStr() const;
+
+		/*!
+		 * Returns length of the interned string.
+		 */
+		GDAPI SizeTp GetLength() const;
+
+		/*!
+		 * Returns hash of the interned string, computed with the 'ComputeHash' function.
+		 */
+		GDAPI UInt64 GetHash() const;
+
+		/*!
+		 * Returns copy of the interned string.
+		 */
+		GDINL String ToString() const
+		{
+			return String(CStr(), GetLength());
+		}
+
+		/*!
+		 * Returns hash code of this name.
+		 */
+		GDINL HashCode GetHashCode() const
+		{
+			return HashCode(m_Index);
+		}
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Overloaded operators.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Compares two names. Names are ordered by the index, not lexicographically.
+		 */
+		//! @{
+		GDINL friend bool operator== (Name const& lhs, Name const& rhs)
+		{
+			return lhs.m_Index == rhs.m_Index;
+		}
+		GDINL friend bool operator!= (Name const& lhs, Name const& rhs)
+		{
+			return lhs.m_Index != rhs.m_Index;
+		}
+		GDINL friend bool operator< (Name const& lhs, Name const& rhs)
+		{
+			return lhs.m_Index < rhs.m_Index;
+		}
+		//! @}
+	};	// class Name
+
+	// **------------------------------------------------------------------------------------------**
+	//! Forces compile-time evaluation of the name hash.
+	// **------------------------------------------------------------------------------------------**
+	template<UInt64 THash>
+	struct NameConstantHash final : public TNonCreatable
+	{
+		UInt64 static const Value = THash;
+	};	// struct NameConstantHash
+
+	/*!
+	 * Returns name of the string literal. Hash of the literal is computed at compile time,
+	 * literal is interned once, on the first evaluation of the expression.
+	 * @param literal The string literal.
+	 */
+	#define GD_NAME(literal) \
+		([]() -> GD::Name const& \
+		{ \
+			static GD::Name const name(literal, sizeof(literal) - 1, GD::NameConstantHash<GD::Name::ComputeHash(literal, sizeof(literal) - 1)>::Value); \
+			return name; \
+		}())
+
+GD_NAMESPACE_END
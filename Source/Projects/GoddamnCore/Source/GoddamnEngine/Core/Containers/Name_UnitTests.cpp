@@ -0,0 +1,143 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/Containers/Name_UnitTests.cpp
+ * Interned string names.
+ */
+#include <GoddamnEngine/Core/Containers/Name.h>
+#include <GoddamnEngine/Core/Containers/Vector.h>
+#include <GoddamnEngine/Core/Containers/UnorderedMap.h>
+
+#if GD_TESTING_ENABLED
+#	include <thread>
+#endif	// if GD_TESTING_ENABLED
+
+GD_NAMESPACE_BEGIN
+
+#if GD_TESTING_ENABLED
+
+	gd_testing_unit_test(NameIntern)
+	{
+		Name const none;
+		gd_testing_verify(none.IsNone());
+		gd_testing_verify(none == Name(""));
+		gd_testing_verify(CString::Strcmp(none.CStr(), "") == 0);
+		gd_testing_verify(none.GetLength() == 0);
+
+		Name const position("NameTestPosition");
+		gd_testing_verify(!position.IsNone());
+		gd_testing_verify(position == Name(String("NameTestPosition")));
+		gd_testing_verify(position == Name("NameTestPositionAndRotation", 16));
+		gd_testing_verify(position != Name("NameTestRotation"));
+		gd_testing_verify(position != Name("nametestposition"));
+		gd_testing_verify(position.GetLength() == 16);
+		gd_testing_verify(position.ToString() == "NameTestPosition");
+		gd_testing_verify(position.GetHash() == Name::ComputeHash("NameTestPosition"));
+
+		// Interned string is null-terminated, even if it was a part of a longer string.
+		Name const scale("NameTestScale123", 13);
+		gd_testing_verify(CString::Strcmp(scale.CStr(), "NameTestScale") == 0);
+	};
+
+	gd_testing_unit_test(NameFind)
+	{
+		gd_testing_verify(Name::Find("NameTestNeverInterned").IsNone());
+		gd_testing_verify(Name::Find("NameTestNeverInterned").IsNone());
+
+		auto const numNames = Name::GetNumNames();
+		Name const interned("NameTestInterned");
+		gd_testing_verify(Name::GetNumNames() == numNames + 1);
+		gd_testing_verify(Name::Find("NameTestInterned") == interned);
+		gd_testing_verify(Name::Find(String("NameTestInterned")) == interned);
+		gd_testing_verify(Name::GetNumNames() == numNames + 1);
+	};
+
+	gd_testing_unit_test(NameLiteral)
+	{
+		static_assert(Name::ComputeHash("Literal") == Name::ComputeHash("Literal", 7), "Invalid compile-time hash.");
+		static_assert(Name::ComputeHash("Literal") != Name::ComputeHash("literal"), "Invalid compile-time hash.");
+
+		auto const& literal = GD_NAME("NameTestLiteral");
+		gd_testing_verify(literal == Name("NameTestLiteral"));
+		gd_testing_verify(literal.GetHash() == Name::ComputeHash("NameTestLiteral", 15));
+		gd_testing_verify(GD_NAME("NameTestLiteral") == GD_NAME("NameTestLiteral"));
+	};
+
+	gd_testing_unit_test(NameManyNames)
+	{
+		// Enough names to grow the table several times.
+		Vector<Name> names;
+		for (UInt32 cnt = 0; cnt < 20000; ++cnt)
+		{
+			names.InsertLast(Name(String("NameTestMany") + String::FromInt64(cnt)));
+		}
+		for (UInt32 cnt = 0; cnt < 20000; ++cnt)
+		{
+			auto const string = String("NameTestMany") + String::FromInt64(cnt);
+			gd_testing_verify(Name::Find(string) == names[cnt]);
+			gd_testing_verify(names[cnt].ToString() == string);
+			gd_testing_verify(cnt == 0 || names[cnt] != names[cnt - 1]);
+		}
+
+		// Names are keys of the hash tables.
+		UnorderedMap<Name, UInt32> indices;
+		for (UInt32 cnt = 0; cnt < 1000; ++cnt)
+		{
+			indices.Insert(names[cnt], cnt);
+		}
+		for (UInt32 cnt = 0; cnt < 1000; ++cnt)
+		{
+			gd_testing_verify(*indices.Find(Name(String("NameTestMany") + String::FromInt64(cnt))) == cnt);
+		}
+	};
+
+	gd_testing_unit_test(NameConcurrentIntern)
+	{
+		SizeTp static const numThreads = 8;
+		UInt32 static const numNames = 4096;
+
+		// Threads intern the same strings in different orders, while other threads grow the table.
+		Vector<Name> names[numThreads];
+		bool succeeded[numThreads] = {};
+		std::thread threads[numThreads];
+		for (SizeTp thread = 0; thread < numThreads; ++thread)
+		{
+			threads[thread] = std::thread([&names, &succeeded, thread]()
+			{
+				names[thread].Resize(numNames);
+				succeeded[thread] = true;
+				for (UInt32 cnt = 0; cnt < numNames; ++cnt)
+				{
+					auto const index = (cnt * 2654435761u + static_cast<UInt32>(thread) * 977) % numNames;
+					auto const string = String("NameTestConcurrent") + String::FromInt64(index);
+					names[thread][index] = Name(string);
+					succeeded[thread] &= Name::Find(string) == names[thread][index] && names[thread][index].ToString() == string;
+				}
+			});
+		}
+		for (auto& thread : threads)
+		{
+			thread.join();
+		}
+
+		for (SizeTp thread = 0; thread < numThreads; ++thread)
+		{
+			gd_testing_verify(succeeded[thread]);
+			gd_testing_verify(names[thread] == names[0]);
+		}
+		for (UInt32 cnt = 0; cnt < numNames; ++cnt)
+		{
+			gd_testing_verify(names[0][cnt] == Name::Find(String("NameTestConcurrent") + String::FromInt64(cnt)));
+			gd_testing_verify(cnt == 0 || names[0][cnt] != names[0][cnt - 1]);
+		}
+	};
+
+#endif	// if GD_TESTING_ENABLED
+
+GD_NAMESPACE_END
@@ -0,0 +1,178 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/Containers/Path.cpp
+ * File system paths in the native encoding.
+ */
+#include <GoddamnEngine/Core/Containers/Path.h>
+#include <GoddamnEngine/Core/Platform/PlatformEncoding.h>
+
+GD_NAMESPACE_BEGIN
+
+#if GD_PLATFORM_API_MICROSOFT
+	PathChar const Path::Separator = GD_TEXT(PathChar, '\\');
+#else	// if GD_PLATFORM_API_MICROSOFT
+	PathChar const Path::Separator = GD_TEXT(PathChar, '/');
+#endif	// if GD_PLATFORM_API_MICROSOFT
+
+	GDINL static bool IsPathSeparator(PathChar const character)
+	{
+		return character == GD_TEXT(PathChar, '/') || character == GD_TEXT(PathChar, '\\');
+	}
+
+	/*!
+	 * Returns index of the first character of the file name in the path.
+	 */
+	GDINL static SizeTp FindPathFileName(PathStringView const path)
+	{
+		auto const lastSeparator = path.FindLastOf(GD_TEXT(PathChar, "/\\"));
+		return lastSeparator == PathStringView::Npos ? 0 : lastSeparator + 1;
+	}
+
+	// ------------------------------------------------------------------------------------------
+	// Constructors.
+	// ------------------------------------------------------------------------------------------
+
+#if !GD_PLATFORM_API_MICROSOFT
+	/*!
+	 * Initializes a path with the wide-character string, that is transcoded to UTF-8.
+	 * @param path The wide-character path string.
+	 */
+	GDAPI Path::Path(WideStringView const path)
+		: m_Native(StringConv::EncodeUTF8(path))
+	{
+	}
+#endif	// if !GD_PLATFORM_API_MICROSOFT
+
+	// ------------------------------------------------------------------------------------------
+	// Path accessors.
+	// ------------------------------------------------------------------------------------------
+
+	/*!
+	 * Returns file and extension part of this path.
+	 * E.g. "directory/file.ext" -> "file.ext"
+	 */
+	GDAPI PathStringView Path::GetFileName() const
+	{
+		auto const path = GetView();
+		return path.Substring(FindPathFileName(path));
+	}
+
+	/*!
+	 * Returns file part of this path, without extension.
+	 * E.g. "directory/file.ext" -> "file"
+	 */
+	GDAPI PathStringView Path::GetFileNameWithoutExtension() const
+	{
+		auto const fileName = GetFileName();
+		return fileName.ChopEnd(GetExtension().GetLength());
+	}
+
+	/*!
+	 * Returns extension of the file name, including the dot, or an empty view if file name has no extension.
+	 * E.g. "directory/file.ext" -> ".ext", "directory.ext/file" -> ""
+	 */
+	GDAPI PathStringView Path::GetExtension() const
+	{
+		auto const fileName = GetFileName();
+		auto const lastDot = fileName.ReverseFind(GD_TEXT(PathChar, '.'));
+		return lastDot == PathStringView::Npos ? fileName.Substring(fileName.GetLength()) : fileName.Substring(lastDot);
+	}
+
+	/*!
+	 * Returns directory part of this path, including the trailing separator, or an empty view if path has no directory.
+	 * E.g. "directory/file.ext" -> "directory/"
+	 */
+	GDAPI PathStringView Path::GetDirectoryName() const
+	{
+		auto const path = GetView();
+		return path.SubstringLen(0, FindPathFileName(path));
+	}
+
+	/*!
+	 * Returns copy of this path as the wide-character string.
+	 * @param resultPtr Pointer to the function call result. If no parameter presented and function fails it will throw.
+	 */
+	GDAPI WideString Path::ToWideString(bool* const resultPtr) const
+	{
+#if GD_PLATFORM_API_MICROSOFT
+		if (resultPtr != nullptr)
+		{
+			*resultPtr = true;
+		}
+		return m_Native;
+#else	// if GD_PLATFORM_API_MICROSOFT
+		return StringConv::DecodeUTF8(m_Native.CStr(), m_Native.GetLength(), resultPtr);
+#endif	// if GD_PLATFORM_API_MICROSOFT
+	}
+
+	// ------------------------------------------------------------------------------------------
+	// Path operations.
+	// ------------------------------------------------------------------------------------------
+
+	/*!
+	 * Combines this path with the other one. Separator is inserted only if this path does not
+	 * end with a separator, leading separator of the other path is skipped. Empty path combined
+	 * with the other one is the other path, so that relative paths stay relative.
+	 * Combined path is allocated once.
+	 *
+	 * @param other Path to append.
+	 * @returns Combination of two paths.
+	 */
+	GDAPI Path Path::Combine(PathStringView const other) const
+	{
+		if (IsEmpty())
+		{
+			return Path(other);
+		}
+
+		auto const otherRelative = !other.IsEmpty() && IsPathSeparator(other.GetFirst()) ? other.ChopFront(1) : other;
+		auto const needsSeparator = !IsPathSeparator(m_Native.GetLast());
+		auto const firstLength = m_Native.GetLength() + (needsSeparator ? 1 : 0);
+
+		PathString combined(firstLength + otherRelative.GetLength());
+		CMemory::Memcpy(combined.CStr(), m_Native.CStr(), m_Native.GetLength() * sizeof(PathChar));
+		if (needsSeparator)
+		{
+			combined.CStr()[m_Native.GetLength()] = Separator;
+		}
+		CMemory::Memcpy(combined.CStr() + firstLength, otherRelative.GetData(), otherRelative.GetLength() * sizeof(PathChar));
+		return Path(Utils::Move(combined));
+	}
+
+	// ------------------------------------------------------------------------------------------
+	// Interned paths.
+	// ------------------------------------------------------------------------------------------
+
+	/*!
+	 * Interns the specified path.
+	 * @param path The path to intern.
+	 */
+	GDAPI InternedPath::InternedPath(Path const& path)
+#if GD_PLATFORM_API_MICROSOFT
+		: m_Name(StringConv::EncodeUTF8(path.GetView()))
+#else	// if GD_PLATFORM_API_MICROSOFT
+		: m_Name(path.CStr(), path.GetLength())
+#endif	// if GD_PLATFORM_API_MICROSOFT
+	{
+	}
+
+	/*!
+	 * Returns copy of the interned path in the native encoding.
+	 */
+	GDAPI Path InternedPath::ToPath() const
+	{
+#if GD_PLATFORM_API_MICROSOFT
+		return StringConv::DecodeUTF8(m_Name.CStr(), m_Name.GetLength());
+#else	// if GD_PLATFORM_API_MICROSOFT
+		return PathStringView(m_Name.CStr(), m_Name.GetLength());
+#endif	// if GD_PLATFORM_API_MICROSOFT
+	}
+
+GD_NAMESPACE_END
@@ -0,0 +1,338 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/Containers/Path.h
+ * File system paths in the native encoding.
+ */
+#pragma once
+
+#include <GoddamnEngine/Include.h>
+#include <GoddamnEngine/Core/Containers/String.h>
+#include <GoddamnEngine/Core/Containers/StringView.h>
+#include <GoddamnEngine/Core/Containers/Name.h>
+
+GD_NAMESPACE_BEGIN
+
+#if GD_PLATFORM_API_MICROSOFT
+	using PathChar = WideChar;
+#else	// if GD_PLATFORM_API_MICROSOFT
+	using PathChar = Char;
+#endif	// if GD_PLATFORM_API_MICROSOFT
+
+	/*!
+	 * String and string view in the native path encoding.
+	 */
+	//! @{
+	using PathString = BaseString<PathChar>;
+	using PathStringView = BaseStringView<PathChar>;
+	//! @}
+
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+	// ******                                    Path class.                                   ******
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+
+	// **------------------------------------------------------------------------------------------**
+	//! File system path, that is stored in the encoding of the system calls: UTF-8 on the POSIX
+	//! platforms and UTF-16 on Windows. Wide-character paths are transcoded once, on construction,
+	//! so the path could be passed to the system calls without any conversions.
+	//!
+	//! Both slashes and backslashes are treated as separators, like in the 'Paths' helpers.
+	//! Path components are returned as views into the path storage and are not allocated.
+	//!
+	//! @code
+	//!		Path const path(L"Assets/Textures");
+	//!		auto const texturePath = path / GD_TEXT(PathChar, "Stone.png");
+	//!		GD_ASSERT(texturePath.GetExtension() == GD_TEXT(PathChar, ".png"));
+	//! @endcode
+	// **------------------------------------------------------------------------------------------**
+	class Path final
+	{
+	private:
+		PathString m_Native;
+
+	public:
+
+		/*!
+		 * Native path separator.
+		 */
+		PathChar static const Separator;
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Constructors.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Initializes an empty path.
+		 */
+		GDINL Path()
+		{
+		}
+
+		/*!
+		 * Initializes a path with the native string.
+		 * @param path The native path string.
+		 */
+		//! @{
+		GDINL implicit Path(PathStringView const path)  // NOLINT
+			: m_Native(path.GetData(), path.GetLength())
+		{
+		}
+		GDINL implicit Path(PathChar const* const path)  // NOLINT
+			: m_Native(path)
+		{
+		}
+		GDINL implicit Path(PathString const& path)  // NOLINT
+			: m_Native(path)
+		{
+		}
+		GDINL implicit Path(PathString&& path) noexcept  // NOLINT
+			: m_Native(Utils::Move(path))
+		{
+		}
+		//! @}
+
+#if !GD_PLATFORM_API_MICROSOFT
+		/*!
+		 * Initializes a path with the wide-character string, that is transcoded to UTF-8.
+		 * @param path The wide-character path string.
+		 */
+		//! @{
+		GDAPI implicit Path(WideStringView const path);  // NOLINT
+		GDINL implicit Path(WideChar const* const path)  // NOLINT
+			: Path(WideStringView(path))
+		{
+		}
+		GDINL implicit Path(WideString const& path)  // NOLINT
+			: Path(WideStringView(path))
+		{
+		}
+		//! @}
+#endif	// if !GD_PLATFORM_API_MICROSOFT
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Path accessors.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Returns pointer to the null-terminated native path string, that could be passed to the system calls.
+		 */
+		GDINL PathChar const* CStr() const
+		{
+			return m_Native.CStr();
+		}
+
+		/*!
+		 * Returns length of the native path string.
+		 */
+		GDINL SizeTp GetLength() const
+		{
+			return m_Native.GetLength();
+		}
+
+		/*!
+		 * Returns true if this path is empty.
+		 */
+		GDINL bool IsEmpty() const
+		{
+			return m_Native.GetLength() == 0;
+		}
+
+		/*!
+		 * Returns view of the whole native path string.
+		 */
+		GDINL PathStringView GetView() const
+		{
+			return PathStringView(m_Native.CStr(), m_Native.GetLength());
+		}
+
+		/*!
+		 * Returns file and extension part of this path.
+		 * E.g. "directory/file.ext" -> "file.ext"
+		 */
+		GDAPI PathStringView GetFileName() const;
+
+		/*!
+		 * Returns file part of this path, without extension.
+		 * E.g. "directory/file.ext" -> "file"
+		 */
+		GDAPI PathStringView GetFileNameWithoutExtension() const;
+
+		/*!
+		 * Returns extension of the file name, including the dot, or an empty view if file name has no extension.
+		 * E.g. "directory/file.ext" -> ".ext", "directory.ext/file" -> ""
+		 */
+		GDAPI PathStringView GetExtension() const;
+
+		/*!
+		 * Returns directory part of this path, including the trailing separator, or an empty view if path has no directory.
+		 * E.g. "directory/file.ext" -> "directory/"
+		 */
+		GDAPI PathStringView GetDirectoryName() const;
+
+		/*!
+		 * Returns copy of this path as the wide-character string.
+		 * @param resultPtr Pointer to the function call result. If no parameter presented and function fails it will throw.
+		 */
+		GDAPI WideString ToWideString(bool* const resultPtr = nullptr) const;
+
+		/*!
+		 * Returns hash code of this path.
+		 */
+		GDINL HashCode GetHashCode() const
+		{
+			return m_Native.GetHashCode();
+		}
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Path operations.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Combines this path with the other one. Separator is inserted only if this path does not
+		 * end with a separator, leading separator of the other path is skipped. Empty path combined
+		 * with the other one is the other path, so that relative paths stay relative.
+		 * Combined path is allocated once.
+		 *
+		 * @param other Path to append.
+		 * @returns Combination of two paths.
+		 */
+		GDAPI Path Combine(PathStringView const other) const;
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Overloaded operators.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Combines two paths.
+		 */
+		GDINL friend Path operator/ (Path const& lhs, PathStringView const rhs)
+		{
+			return lhs.Combine(rhs);
+		}
+
+		/*!
+		 * Compares native strings of two paths.
+		 */
+		//! @{
+		GDINL friend bool operator== (Path const& lhs, Path const& rhs)
+		{
+			return lhs.GetView() == rhs.GetView();
+		}
+		GDINL friend bool operator!= (Path const& lhs, Path const& rhs)
+		{
+			return lhs.GetView() != rhs.GetView();
+		}
+		GDINL friend bool operator< (Path const& lhs, Path const& rhs)
+		{
+			return lhs.GetView() < rhs.GetView();
+		}
+		//! @}
+	};	// class Path
+
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+	// ******                                InternedPath class.                               ******
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+
+	// **------------------------------------------------------------------------------------------**
+	//! Immutable path, that is interned in the global name table as UTF-8 string.
+	//! Equal paths share the single copy of the string, interned path itself is a 32-bit index,
+	//! so it should be used to keep large amounts of paths (e.g. paths of the assets) in memory.
+	//!
+	//! Interned paths are never freed, so paths of the temporary files should not be interned.
+	// **------------------------------------------------------------------------------------------**
+	class InternedPath final
+	{
+	private:
+		Name m_Name;
+
+	public:
+
+		/*!
+		 * Initializes an empty path.
+		 */
+		GDINL InternedPath()
+		{
+		}
+
+		/*!
+		 * Interns the specified path.
+		 * @param path The path to intern.
+		 */
+		GDAPI explicit InternedPath(Path const& path);
+
+	public:
+
+		/*!
+		 * Returns true if this path is empty.
+		 */
+		GDINL bool IsEmpty() const
+		{
+			return m_Name.IsNone();
+		}
+
+		/*!
+		 * Returns pointer to the null-terminated interned UTF-8 path string.
+		 * Pointer stays valid till the end of the program.
+		 */
+		GDINL Char const* CStr() const
+		{
+			return m_Name.CStr();
+		}
+
+		/*!
+		 * Returns length of the interned UTF-8 path string.
+		 */
+		GDINL SizeTp GetLength() const
+		{
+			return m_Name.GetLength();
+		}
+
+		/*!
+		 * Returns copy of the interned path in the native encoding.
+		 */
+		GDAPI Path ToPath() const;
+
+		/*!
+		 * Returns hash code of this path.
+		 */
+		GDINL HashCode GetHashCode() const
+		{
+			return m_Name.GetHashCode();
+		}
+
+	public:
+
+		/*!
+		 * Compares two interned paths. Paths are ordered by the index in the name table, not lexicographically.
+		 */
+		//! @{
+		GDINL friend bool operator== (InternedPath const& lhs, InternedPath const& rhs)
+		{
+			return lhs.m_Name == rhs.m_Name;
+		}
+		GDINL friend bool operator!= (InternedPath const& lhs, InternedPath const& rhs)
+		{
+			return lhs.m_Name != rhs.m_Name;
+		}
+		GDINL friend bool operator< (InternedPath const& lhs, InternedPath const& rhs)
+		{
+			return lhs.m_Name < rhs.m_Name;
+		}
+		//! @}
+	};	// class InternedPath
+
+GD_NAMESPACE_END
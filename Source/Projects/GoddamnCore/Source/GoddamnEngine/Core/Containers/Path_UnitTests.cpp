@@ -0,0 +1,104 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/Containers/Path_UnitTests.cpp
+ * File system paths in the native encoding.
+ */
+#include <GoddamnEngine/Core/Containers/Path.h>
+
+#if GD_TESTING_ENABLED
+
+GD_NAMESPACE_BEGIN
+
+	gd_testing_unit_test(PathComponents)
+	{
+		Path const path(GD_TEXT(PathChar, "Assets/Textures.old/Stone.png"));
+		gd_testing_verify(path.GetFileName() == GD_TEXT(PathChar, "Stone.png"));
+		gd_testing_verify(path.GetFileNameWithoutExtension() == GD_TEXT(PathChar, "Stone"));
+		gd_testing_verify(path.GetExtension() == GD_TEXT(PathChar, ".png"));
+		gd_testing_verify(path.GetDirectoryName() == GD_TEXT(PathChar, "Assets/Textures.old/"));
+
+		// Components are views into the path storage.
+		gd_testing_verify(path.GetFileName().GetData() == path.CStr() + 20);
+		gd_testing_verify(path.GetDirectoryName().GetData() == path.CStr());
+
+		// Dots in the directory names are not extensions.
+		Path const directory(GD_TEXT(PathChar, "Assets\\Textures.old\\Stone"));
+		gd_testing_verify(directory.GetFileName() == GD_TEXT(PathChar, "Stone"));
+		gd_testing_verify(directory.GetFileNameWithoutExtension() == GD_TEXT(PathChar, "Stone"));
+		gd_testing_verify(directory.GetExtension().IsEmpty());
+		gd_testing_verify(directory.GetDirectoryName() == GD_TEXT(PathChar, "Assets\\Textures.old\\"));
+
+		Path const fileName(GD_TEXT(PathChar, "Stone.png"));
+		gd_testing_verify(fileName.GetFileName() == GD_TEXT(PathChar, "Stone.png"));
+		gd_testing_verify(fileName.GetDirectoryName().IsEmpty());
+
+		Path const empty;
+		gd_testing_verify(empty.IsEmpty());
+		gd_testing_verify(empty.GetFileName().IsEmpty() && empty.GetExtension().IsEmpty() && empty.GetDirectoryName().IsEmpty());
+	};
+
+	gd_testing_unit_test(PathCombine)
+	{
+		Path const directory(GD_TEXT(PathChar, "Assets"));
+		auto const expected = PathString(GD_TEXT(PathChar, "Assets")) + Path::Separator + GD_TEXT(PathChar, "Stone.png");
+		gd_testing_verify(directory.Combine(GD_TEXT(PathChar, "Stone.png")).GetView() == expected);
+		gd_testing_verify((directory / GD_TEXT(PathChar, "/Stone.png")).GetView() == expected);
+		gd_testing_verify(Path(GD_TEXT(PathChar, "Assets/")) / GD_TEXT(PathChar, "Stone.png") == Path(GD_TEXT(PathChar, "Assets/Stone.png")));
+		gd_testing_verify(Path(GD_TEXT(PathChar, "Assets\\")) / GD_TEXT(PathChar, "\\Stone.png") == Path(GD_TEXT(PathChar, "Assets\\Stone.png")));
+		gd_testing_verify((directory / GD_TEXT(PathChar, "")).GetView() == PathString(GD_TEXT(PathChar, "Assets")) + Path::Separator);
+
+		// Empty path is built up without becoming absolute.
+		gd_testing_verify(Path().Combine(GD_TEXT(PathChar, "Assets")) == directory);
+		gd_testing_verify(Path() / GD_TEXT(PathChar, "Assets") / GD_TEXT(PathChar, "Stone.png") == directory / GD_TEXT(PathChar, "Stone.png"));
+		gd_testing_verify((Path() / GD_TEXT(PathChar, "/Assets")).GetView() == GD_TEXT(PathChar, "/Assets"));
+		gd_testing_verify((Path() / GD_TEXT(PathChar, "")).IsEmpty());
+
+		// Long paths are stored on the heap.
+		auto longPath = directory;
+		for (SizeTp cnt = 0; cnt < 20; ++cnt)
+		{
+			longPath = longPath / GD_TEXT(PathChar, "Directory");
+		}
+		gd_testing_verify(longPath.GetLength() == 6 + 20 * 10);
+		gd_testing_verify(longPath.GetFileName() == GD_TEXT(PathChar, "Directory"));
+	};
+
+	gd_testing_unit_test(PathWideStrings)
+	{
+		// Wide-character paths are transcoded on construction.
+		Path const path(L"Assets/Текстуры/石.png");
+		gd_testing_verify(path.ToWideString() == L"Assets/Текстуры/石.png");
+		gd_testing_verify(path.GetExtension() == GD_TEXT(PathChar, ".png"));
+		gd_testing_verify(Path(path.GetFileName()).ToWideString() == L"石.png");
+#if !GD_PLATFORM_API_MICROSOFT
+		gd_testing_verify(path.GetLength() == 7 + 8 * 2 + 1 + 3 + 4);
+		gd_testing_verify(path == Path("Assets/\xD0\xA2\xD0\xB5\xD0\xBA\xD1\x81\xD1\x82\xD1\x83\xD1\x80\xD1\x8B/\xE7\x9F\xB3.png"));
+#endif	// if !GD_PLATFORM_API_MICROSOFT
+	};
+
+	gd_testing_unit_test(PathInterned)
+	{
+		Path const path(GD_TEXT(PathChar, "PathTestAssets/Stone.png"));
+		InternedPath const interned(path);
+		gd_testing_verify(!interned.IsEmpty());
+		gd_testing_verify(interned == InternedPath(Path(GD_TEXT(PathChar, "PathTestAssets/Stone.png"))));
+		gd_testing_verify(interned != InternedPath(Path(GD_TEXT(PathChar, "PathTestAssets/Grass.png"))));
+		gd_testing_verify(interned.ToPath() == path);
+		gd_testing_verify(CString::Strcmp(interned.CStr(), "PathTestAssets/Stone.png") == 0);
+		gd_testing_verify(interned.GetLength() == 24);
+		gd_testing_verify(InternedPath().IsEmpty());
+
+		// Interned strings are shared between the equal paths.
+		gd_testing_verify(InternedPath(Path(L"PathTestAssets/Stone.png")).CStr() == interned.CStr());
+	};
+
+GD_NAMESPACE_END
+
+#endif	// if GD_TESTING_ENABLED
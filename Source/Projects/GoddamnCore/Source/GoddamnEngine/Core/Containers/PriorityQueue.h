@@ -0,0 +1,598 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/Containers/PriorityQueue.h
+ * Heap-based priority queue classes.
+ */
+#pragma once
+
+#include <GoddamnEngine/Include.h>
+#include <GoddamnEngine/Core/Containers/Vector.h>
+#include <GoddamnEngine/Core/Containers/SlotMap.h>
+
+GD_NAMESPACE_BEGIN
+
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+	// ******                              PriorityQueue<T> class.                             ******
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+
+	// **------------------------------------------------------------------------------------------**
+	//! Priority queue implementation over the implicit d-ary heap, stored in the vector.
+	//! Top element is the greatest one by the predicate, so the default @ref TLess predicate
+	//! gives the max-queue and @ref TGreater gives the min-queue.
+	//!
+	//! Default arity of four makes the heap twice shallower than the binary one, and children of
+	//! a node share a cache line, which speeds up removal at the cost of a few more comparisons.
+	//!
+	//! @tparam TElement Queue element type.
+	//! @tparam TPredicate Ordering predicate, returns true if the first element has lower priority.
+	//! @tparam TArity Number of children of the heap node.
+	// **------------------------------------------------------------------------------------------**
+	template<typename TElement, typename TPredicate = TLess<TElement>, SizeTp TArity = 4>
+	class PriorityQueue final
+	{
+		static_assert(TArity >= 2, "Arity of the 'PriorityQueue' should be at least two.");
+
+	public:
+		using ElementType   = TElement;
+		using PredicateType = TPredicate;
+
+	private:
+		Vector<TElement> m_Elements;
+		TPredicate       m_Predicate;
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Constructors and destructor.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Initializes an empty priority queue.
+		 * @param predicate Ordering predicate.
+		 */
+		GDINL explicit PriorityQueue(TPredicate const& predicate = TPredicate())
+			: m_Elements(), m_Predicate(predicate)
+		{}
+
+		/*!
+		 * Initializes priority queue with copy of values of specified iterators.
+		 * Heap is built in linear time.
+		 *
+		 * @param startIterator First iterator would be copied.
+		 * @param endIterator Last iterator would be copied.
+		 * @param predicate Ordering predicate.
+		 */
+		template<typename TForwardIterator, typename = typename EnableIf<IteratorTraits<TForwardIterator>::IsForward>::Type>
+		GDINL PriorityQueue(TForwardIterator const startIterator, TForwardIterator const endIterator, TPredicate const& predicate = TPredicate())
+			: m_Elements(startIterator, endIterator), m_Predicate(predicate)
+		{
+			Heapify();
+		}
+
+		/*!
+		 * Initializes priority queue with default C++11's initializer list. You should not use this constructor manually.
+		 * @param initializerList Initializer list passed by the compiler.
+		 */
+		GDINL PriorityQueue(InitializerList<TElement> const& initializerList)
+			: PriorityQueue(initializerList.begin(), initializerList.end())
+		{}
+
+		GDINL PriorityQueue(PriorityQueue const& otherQueue) = default;
+		GDINL PriorityQueue(PriorityQueue&& otherQueue) = default;
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Dynamic size management.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Returns pointer to the elements in the heap order.
+		 */
+		GDINL TElement const* GetData() const
+		{
+			return m_Elements.GetData();
+		}
+
+		/*!
+		 * Returns number of elements that exist in priority queue.
+		 */
+		GDINL SizeTp GetLength() const
+		{
+			return m_Elements.GetLength();
+		}
+
+		/*!
+		 * Returns true if this priority queue is empty.
+		 */
+		GDINL bool IsEmpty() const
+		{
+			return m_Elements.IsEmpty();
+		}
+
+		/*!
+		 * Reserves memory for priority queue to make it contain specified number of elements without reallocation.
+		 * @param newCapacity New required capacity of the priority queue.
+		 */
+		GDINL void Reserve(SizeTp const newCapacity)
+		{
+			m_Elements.Reserve(newCapacity);
+		}
+
+		/*!
+		 * Destroys all elements in the priority queue without memory deallocation.
+		 */
+		GDINL void Emptify()
+		{
+			m_Elements.Emptify();
+		}
+
+		/*!
+		 * Destroys all elements in the priority queue with memory deallocation.
+		 */
+		GDINL void Clear()
+		{
+			m_Elements.Clear();
+		}
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Dynamic elements access.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Returns reference on the element with the highest priority.
+		 */
+		GDINL TElement const& GetTop() const
+		{
+			GD_ASSERT(!m_Elements.IsEmpty(), "Priority queue is empty.");
+			return m_Elements[0];
+		}
+
+		/*!
+		 * Inserts the element into the priority queue.
+		 * @param element The element that is going to be inserted.
+		 */
+		//! @{
+		GDINL void Insert(TElement&& element = TElement())
+		{
+			SiftUp(m_Elements.InsertLast(Utils::Forward<TElement>(element)));
+		}
+		GDINL void Insert(TElement const& element)
+		{
+			SiftUp(m_Elements.InsertLast(element));
+		}
+		//! @}
+
+		/*!
+		 * Removes the element with the highest priority.
+		 */
+		GDINL void EraseTop()
+		{
+			GD_ASSERT(!m_Elements.IsEmpty(), "Priority queue is empty.");
+			if (m_Elements.GetLength() > 1)
+			{
+				m_Elements[0] = Utils::Move(m_Elements.GetLast());
+				m_Elements.EraseLast();
+				SiftDown(0);
+			}
+			else
+			{
+				m_Elements.EraseLast();
+			}
+		}
+
+		/*!
+		 * Removes the element with the highest priority and returns it.
+		 */
+		GDINL TElement ExtractTop()
+		{
+			GD_ASSERT(!m_Elements.IsEmpty(), "Priority queue is empty.");
+			TElement topElement(Utils::Move(m_Elements[0]));
+			EraseTop();
+			return topElement;
+		}
+
+	private:
+
+		// Moves the element towards the root, while it has higher priority than its parent.
+		GDINL void SiftUp(SizeTp index)
+		{
+			auto element = Utils::Move(m_Elements[index]);
+			while (index > 0)
+			{
+				auto const parentIndex = (index - 1) / TArity;
+				if (!m_Predicate(m_Elements[parentIndex], element))
+				{
+					break;
+				}
+				m_Elements[index] = Utils::Move(m_Elements[parentIndex]);
+				index = parentIndex;
+			}
+			m_Elements[index] = Utils::Move(element);
+		}
+
+		// Moves the element towards the leaves, while it has lower priority than any of its children.
+		GDINL void SiftDown(SizeTp index)
+		{
+			auto const length = m_Elements.GetLength();
+			auto element = Utils::Move(m_Elements[index]);
+			for (auto firstChildIndex = TArity * index + 1; firstChildIndex < length; firstChildIndex = TArity * index + 1)
+			{
+				auto bestChildIndex = firstChildIndex;
+				auto const endChildIndex = Min(firstChildIndex + TArity, length);
+				for (auto childIndex = firstChildIndex + 1; childIndex < endChildIndex; ++childIndex)
+				{
+					if (m_Predicate(m_Elements[bestChildIndex], m_Elements[childIndex]))
+					{
+						bestChildIndex = childIndex;
+					}
+				}
+				if (!m_Predicate(element, m_Elements[bestChildIndex]))
+				{
+					break;
+				}
+				m_Elements[index] = Utils::Move(m_Elements[bestChildIndex]);
+				index = bestChildIndex;
+			}
+			m_Elements[index] = Utils::Move(element);
+		}
+
+		// Builds the heap bottom-up, https://en.wikipedia.org/wiki/Binary_heap#Building_a_heap
+		GDINL void Heapify()
+		{
+			auto const length = m_Elements.GetLength();
+			for (auto index = length > 1 ? (length - 2) / TArity + 1 : 0; index-- > 0;)
+			{
+				SiftDown(index);
+			}
+		}
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Overloaded operators.
+		// ------------------------------------------------------------------------------------------
+
+		GDINL PriorityQueue& operator= (PriorityQueue const& otherQueue) = default;
+		GDINL PriorityQueue& operator= (PriorityQueue&& otherQueue) = default;
+	};	// class PriorityQueue
+
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+	// ******                          IndexedPriorityQueue<T> class.                          ******
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+
+	// **------------------------------------------------------------------------------------------**
+	//! Priority queue, that references its elements with generational handles.
+	//! Handles allow changing priority of the queued element (decrease-key) and removing it from the
+	//! middle of the queue in logarithmic time. Positions of the elements in the heap are tracked
+	//! in the @ref SlotTable, so handles of the removed elements are detected as stale.
+	//!
+	//! @tparam TElement Queue element type.
+	//! @tparam TPredicate Ordering predicate, returns true if the first element has lower priority.
+	//! @tparam TArity Number of children of the heap node.
+	//! @tparam THandle Type of handles, either @ref SlotHandle32 or @ref SlotHandle64.
+	// **------------------------------------------------------------------------------------------**
+	template<typename TElement, typename TPredicate = TLess<TElement>, SizeTp TArity = 4, typename THandle = SlotHandle64>
+	class IndexedPriorityQueue final
+	{
+		static_assert(TArity >= 2, "Arity of the 'IndexedPriorityQueue' should be at least two.");
+
+	public:
+		using HandleType    = THandle;
+		using ElementType   = TElement;
+		using PredicateType = TPredicate;
+
+	private:
+		struct Entry final
+		{
+			TElement Element;
+			UInt32   Slot;
+		};	// struct Entry
+
+	private:
+		Vector<Entry>      m_Entries;
+		SlotTable<THandle> m_Slots;
+		TPredicate         m_Predicate;
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Constructors and destructor.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Initializes an empty priority queue.
+		 * @param predicate Ordering predicate.
+		 */
+		GDINL explicit IndexedPriorityQueue(TPredicate const& predicate = TPredicate())
+			: m_Entries(), m_Slots(), m_Predicate(predicate)
+		{}
+
+		/*!
+		 * Initializes priority queue with copy of other priority queue. Handles of the other priority queue refer to the copies.
+		 * @param otherQueue Priority queue would be copied.
+		 */
+		GDINL IndexedPriorityQueue(IndexedPriorityQueue const& otherQueue) = default;
+
+		/*!
+		 * Moves other priority queue here. Handles of the other priority queue refer to the moved elements.
+		 * @param otherQueue Priority queue would be moved into current object.
+		 */
+		GDINL IndexedPriorityQueue(IndexedPriorityQueue&& otherQueue) = default;
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Dynamic size management.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Returns number of elements that exist in priority queue.
+		 */
+		GDINL SizeTp GetLength() const
+		{
+			return m_Entries.GetLength();
+		}
+
+		/*!
+		 * Returns true if this priority queue is empty.
+		 */
+		GDINL bool IsEmpty() const
+		{
+			return m_Entries.IsEmpty();
+		}
+
+		/*!
+		 * Reserves memory for priority queue to make it contain specified number of elements without reallocation.
+		 * @param newCapacity New required capacity of the priority queue.
+		 */
+		GDINL void Reserve(SizeTp const newCapacity)
+		{
+			m_Entries.Reserve(newCapacity);
+			m_Slots.Reserve(newCapacity);
+		}
+
+		/*!
+		 * Destroys all elements in the priority queue with memory deallocation.
+		 * Slots are kept, so that handles of the removed elements remain stale.
+		 */
+		GDINL void Clear()
+		{
+			for (auto const& entry : m_Entries)
+			{
+				m_Slots.Release(entry.Slot);
+			}
+			m_Entries.Clear();
+		}
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Dynamic elements access.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Returns reference on the element with the highest priority.
+		 */
+		GDINL TElement const& GetTop() const
+		{
+			GD_ASSERT(!m_Entries.IsEmpty(), "Priority queue is empty.");
+			return m_Entries[0].Element;
+		}
+
+		/*!
+		 * Returns handle of the element with the highest priority.
+		 */
+		GDINL THandle GetTopHandle() const
+		{
+			GD_ASSERT(!m_Entries.IsEmpty(), "Priority queue is empty.");
+			return m_Slots.GetHandle(m_Entries[0].Slot);
+		}
+
+		/*!
+		 * Queries for the element with the specified handle.
+		 *
+		 * @param handle Handle of the element.
+		 * @returns Pointer to the element if handle is not stale and null pointer otherwise.
+		 */
+		GDINL TElement const* Find(THandle const handle) const
+		{
+			auto const index = m_Slots.GetIndex(handle);
+			return index != SizeTpMax ? &m_Entries[index].Element : nullptr;
+		}
+
+		/*!
+		 * Returns true if the element with the specified handle exists in the priority queue.
+		 * @param handle Handle of the element.
+		 */
+		GDINL bool Contains(THandle const handle) const
+		{
+			return m_Slots.GetIndex(handle) != SizeTpMax;
+		}
+
+		/*!
+		 * Inserts the element into the priority queue.
+		 *
+		 * @param element The element that is going to be inserted.
+		 * @returns Handle of the inserted element.
+		 */
+		//! @{
+		GDINL THandle Insert(TElement&& element = TElement())
+		{
+			auto const index = m_Entries.GetLength();
+			auto const slotIndex = m_Slots.Acquire(index);
+			m_Entries.InsertLast(Entry{ Utils::Forward<TElement>(element), slotIndex });
+			SiftUp(index);
+			return m_Slots.GetHandle(slotIndex);
+		}
+		GDINL THandle Insert(TElement const& element)
+		{
+			return Insert(TElement(element));
+		}
+		//! @}
+
+		/*!
+		 * Changes priority of the existing element with the specified handle.
+		 *
+		 * @param handle Handle of the element.
+		 * @param element New value of the element.
+		 */
+		//! @{
+		GDINL void Update(THandle const handle, TElement&& element)
+		{
+			auto const index = m_Slots.GetIndex(handle);
+			GD_ASSERT(index != SizeTpMax, "Element with specified handle does not exist.");
+			m_Entries[index].Element = Utils::Forward<TElement>(element);
+			Restore(index);
+		}
+		GDINL void Update(THandle const handle, TElement const& element)
+		{
+			Update(handle, TElement(element));
+		}
+		//! @}
+
+		/*!
+		 * Removes existing element with the specified handle from the priority queue.
+		 * @param handle Handle of the element that is going to be removed.
+		 */
+		GDINL void Erase(THandle const handle)
+		{
+			auto const index = m_Slots.GetIndex(handle);
+			GD_ASSERT(index != SizeTpMax, "Element with specified handle does not exist.");
+			EraseAt(index);
+		}
+
+		/*!
+		 * Removes the element with the highest priority.
+		 */
+		GDINL void EraseTop()
+		{
+			GD_ASSERT(!m_Entries.IsEmpty(), "Priority queue is empty.");
+			EraseAt(0);
+		}
+
+		/*!
+		 * Removes the element with the highest priority and returns it.
+		 */
+		GDINL TElement ExtractTop()
+		{
+			GD_ASSERT(!m_Entries.IsEmpty(), "Priority queue is empty.");
+			TElement topElement(Utils::Move(m_Entries[0].Element));
+			EraseAt(0);
+			return topElement;
+		}
+
+	private:
+
+		// Places the entry into the heap position and updates its slot.
+		GDINL void Place(SizeTp const index, Entry&& entry)
+		{
+			m_Slots.SetIndex(entry.Slot, index);
+			m_Entries[index] = Utils::Move(entry);
+		}
+
+		// Replaces the entry with the last one and restores the heap property.
+		GDINL void EraseAt(SizeTp const index)
+		{
+			auto const slotIndex = m_Entries[index].Slot;
+			auto const lastIndex = m_Entries.GetLength() - 1;
+			if (index != lastIndex)
+			{
+				Place(index, Utils::Move(m_Entries[lastIndex]));
+				m_Entries.EraseLast();
+				Restore(index);
+			}
+			else
+			{
+				m_Entries.EraseLast();
+			}
+			m_Slots.Release(slotIndex);
+		}
+
+		// Moves the changed entry either towards the root or towards the leaves.
+		GDINL void Restore(SizeTp const index)
+		{
+			if (index > 0 && m_Predicate(m_Entries[(index - 1) / TArity].Element, m_Entries[index].Element))
+			{
+				SiftUp(index);
+			}
+			else
+			{
+				SiftDown(index);
+			}
+		}
+
+		// Moves the entry towards the root, while it has higher priority than its parent.
+		GDINL void SiftUp(SizeTp index)
+		{
+			auto entry = Utils::Move(m_Entries[index]);
+			while (index > 0)
+			{
+				auto const parentIndex = (index - 1) / TArity;
+				if (!m_Predicate(m_Entries[parentIndex].Element, entry.Element))
+				{
+					break;
+				}
+				Place(index, Utils::Move(m_Entries[parentIndex]));
+				index = parentIndex;
+			}
+			Place(index, Utils::Move(entry));
+		}
+
+		// Moves the entry towards the leaves, while it has lower priority than any of its children.
+		GDINL void SiftDown(SizeTp index)
+		{
+			auto const length = m_Entries.GetLength();
+			auto entry = Utils::Move(m_Entries[index]);
+			for (auto firstChildIndex = TArity * index + 1; firstChildIndex < length; firstChildIndex = TArity * index + 1)
+			{
+				auto bestChildIndex = firstChildIndex;
+				auto const endChildIndex = Min(firstChildIndex + TArity, length);
+				for (auto childIndex = firstChildIndex + 1; childIndex < endChildIndex; ++childIndex)
+				{
+					if (m_Predicate(m_Entries[bestChildIndex].Element, m_Entries[childIndex].Element))
+					{
+						bestChildIndex = childIndex;
+					}
+				}
+				if (!m_Predicate(entry.Element, m_Entries[bestChildIndex].Element))
+				{
+					break;
+				}
+				Place(index, Utils::Move(m_Entries[bestChildIndex]));
+				index = bestChildIndex;
+			}
+			Place(index, Utils::Move(entry));
+		}
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Overloaded operators.
+		// ------------------------------------------------------------------------------------------
+
+		GDINL IndexedPriorityQueue& operator= (IndexedPriorityQueue const& otherQueue) = default;
+		GDINL IndexedPriorityQueue& operator= (IndexedPriorityQueue&& otherQueue) = default;
+
+		/*!
+		 * Returns reference on the element with the specified handle, that should not be stale.
+		 * @param handle Handle of the element.
+		 */
+		GDINL TElement const& operator[] (THandle const handle) const
+		{
+			auto const element = Find(handle);
+			GD_ASSERT(element != nullptr, "Element with specified handle does not exist.");
+			return *element;
+		}
+	};	// class IndexedPriorityQueue
+
+GD_NAMESPACE_END
@@ -0,0 +1,150 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/Containers/PriorityQueue_UnitTests.cpp
+ * Heap-based priority queue classes tests.
+ */
+#include <GoddamnEngine/Core/Containers/PriorityQueue.h>
+#include <GoddamnEngine/Core/Containers/String.h>
+
+GD_NAMESPACE_BEGIN
+
+#if GD_TESTING_ENABLED
+
+	gd_testing_unit_test(PriorityQueueBaseOperations)
+	{
+		PriorityQueue<Int32> maxQueue{ 5, 1, 4, 2, 3 };
+		gd_testing_verify(maxQueue.GetLength() == 5 && maxQueue.GetTop() == 5);
+		maxQueue.Insert(7);
+		maxQueue.Insert(0);
+		for (Int32 const expected : { 7, 5, 4, 3, 2, 1, 0 })
+		{
+			gd_testing_verify(maxQueue.ExtractTop() == expected);
+		}
+		gd_testing_verify(maxQueue.IsEmpty());
+
+		PriorityQueue<String, TGreater<String>> minQueue;
+		minQueue.Insert("beta");
+		minQueue.Insert("gamma");
+		minQueue.Insert("alpha");
+		gd_testing_verify(minQueue.GetTop() == "alpha");
+		minQueue.EraseTop();
+		gd_testing_verify(minQueue.ExtractTop() == "beta" && minQueue.ExtractTop() == "gamma" && minQueue.IsEmpty());
+	};
+
+	gd_testing_unit_test_foreach(PriorityQueueRandomOperations, TQueue, PriorityQueue<UInt32, TLess<UInt32>, 2>, PriorityQueue<UInt32, TLess<UInt32>, 4>, PriorityQueue<UInt32, TLess<UInt32>, 7>)
+	{
+		Vector<UInt32> elements;
+		UInt32 random = 1;
+		for (UInt32 cnt = 0; cnt < 3000; ++cnt)
+		{
+			random = random * 1664525 + 1013904223;
+			elements.InsertLast((random >> 8) % 1000);
+		}
+
+		// Heap, built from the range, and heap, built by insertions, yield the same sequence.
+		TQueue builtQueue(elements.Begin(), elements.End());
+		TQueue insertedQueue;
+		for (auto const element : elements)
+		{
+			insertedQueue.Insert(element);
+		}
+		Algo::UnstableSort(elements.Begin(), elements.End(), TGreater<UInt32>());
+		for (auto const element : elements)
+		{
+			gd_testing_verify(builtQueue.ExtractTop() == element && insertedQueue.ExtractTop() == element);
+		}
+		gd_testing_verify(builtQueue.IsEmpty() && insertedQueue.IsEmpty());
+	};
+
+	gd_testing_unit_test(IndexedPriorityQueueBaseOperations)
+	{
+		IndexedPriorityQueue<Int32, TGreater<Int32>> queue;
+		auto const ten = queue.Insert(10);
+		auto const twenty = queue.Insert(20);
+		auto const thirty = queue.Insert(30);
+		gd_testing_verify(queue.GetTop() == 10 && queue.GetTopHandle() == ten);
+
+		// Decrease-key moves the element to the top, increase-key moves it down.
+		queue.Update(thirty, 5);
+		gd_testing_verify(queue.GetTopHandle() == thirty && queue[thirty] == 5);
+		queue.Update(thirty, 25);
+		gd_testing_verify(queue.GetTopHandle() == ten && *queue.Find(thirty) == 25);
+
+		queue.Erase(twenty);
+		gd_testing_verify(queue.GetLength() == 2 && !queue.Contains(twenty) && queue.Find(twenty) == nullptr);
+		gd_testing_verify(queue.ExtractTop() == 10 && !queue.Contains(ten));
+		gd_testing_verify(queue.ExtractTop() == 25 && queue.IsEmpty());
+
+		auto const forty = queue.Insert(40);
+		queue.Clear();
+		gd_testing_verify(queue.IsEmpty() && !queue.Contains(forty));
+	};
+
+	gd_testing_unit_test_foreach(IndexedPriorityQueueRandomOperations, THandle, SlotHandle32, SlotHandle64)
+	{
+		IndexedPriorityQueue<UInt32, TLess<UInt32>, 4, THandle> queue;
+		Vector<THandle> liveHandles, staleHandles;
+		Vector<UInt32> liveValues;
+		UInt32 random = 1;
+		for (UInt32 cnt = 0; cnt < 20000; ++cnt)
+		{
+			random = random * 1664525 + 1013904223;
+			auto const value = (random >> 4) % 5000;
+			auto const index = liveHandles.IsEmpty() ? 0 : (random >> 8) % liveHandles.GetLength();
+			switch ((random >> 16) % 4)
+			{
+				case 0:
+				case 1:
+					liveHandles.InsertLast(queue.Insert(value));
+					liveValues.InsertLast(value);
+					break;
+				case 2:
+					if (!liveHandles.IsEmpty())
+					{
+						queue.Update(liveHandles[index], value);
+						liveValues[index] = value;
+					}
+					break;
+				default:
+					if (!liveHandles.IsEmpty())
+					{
+						queue.Erase(liveHandles[index]);
+						staleHandles.InsertLast(liveHandles[index]);
+						liveHandles[index] = liveHandles.GetLast();
+						liveValues[index] = liveValues.GetLast();
+						liveHandles.EraseLast();
+						liveValues.EraseLast();
+					}
+					break;
+			}
+		}
+
+		gd_testing_verify(queue.GetLength() == liveHandles.GetLength());
+		for (SizeTp cnt = 0; cnt < liveHandles.GetLength(); ++cnt)
+		{
+			gd_testing_verify(queue.Contains(liveHandles[cnt]) && queue[liveHandles[cnt]] == liveValues[cnt]);
+		}
+		for (auto const staleHandle : staleHandles)
+		{
+			gd_testing_verify(!queue.Contains(staleHandle));
+		}
+
+		Algo::UnstableSort(liveValues.Begin(), liveValues.End(), TGreater<UInt32>());
+		for (auto const value : liveValues)
+		{
+			auto const topHandle = queue.GetTopHandle();
+			gd_testing_verify(queue[topHandle] == value && queue.ExtractTop() == value && !queue.Contains(topHandle));
+		}
+		gd_testing_verify(queue.IsEmpty());
+	};
+
+#endif	// if GD_TESTING_ENABLED
+
+GD_NAMESPACE_END
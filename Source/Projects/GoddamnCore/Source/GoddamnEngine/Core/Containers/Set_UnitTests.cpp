@@ -11,6 +11,8 @@
  * Dynamically sized set class.
  */
 #include <GoddamnEngine/Core/Containers/Set.h>
+#include <GoddamnEngine/Core/Containers/BTreeSet.h>
+#include <GoddamnEngine/Core/Containers/FlatSet.h>
 #include <GoddamnEngine/Core/Containers/UnorderedSet.h>
 #include <GoddamnEngine/Core/Containers/UnorderedVectorSet.h>
 
@@ -23,10 +25,12 @@ GD_NAMESPACE_BEGIN
 #if GD_TESTING_ENABLED
 
 	using SetInt = Set<int>;
+	using BTreeSetInt = BTreeSet<int>;
+	using FlatSetInt = FlatSet<int>;
 	using UnorderedSetInt = UnorderedSet<int>;
 	using UnorderedVectorSetInt = UnorderedVectorSet<int>;
 
-	gd_testing_unit_test_foreach(SetIntInsert, TSetType, SetInt, UnorderedSetInt, UnorderedVectorSetInt)
+	gd_testing_unit_test_foreach(SetIntInsert, TSetType, SetInt, BTreeSetInt, FlatSetInt, UnorderedSetInt, UnorderedVectorSetInt)
 	{
 		TSetType set;
 		set.Insert(1);
@@ -47,7 +51,7 @@ GD_NAMESPACE_BEGIN
 		}
 	};
 
-	gd_testing_unit_test_foreach(SetIntIteration, TSetType, SetInt, UnorderedSetInt, UnorderedVectorSetInt)
+	gd_testing_unit_test_foreach(SetIntIteration, TSetType, SetInt, BTreeSetInt, FlatSetInt, UnorderedSetInt, UnorderedVectorSetInt)
 	{
 		TSetType set{ 2, 1, 0, 3 };
 		std::array<bool, 4> stdSet = { false };
@@ -73,7 +77,7 @@ GD_NAMESPACE_BEGIN
 		}
 	};
 
-	gd_testing_unit_test_foreach(SetIntLengthAccess, TSetType, SetInt, UnorderedSetInt, UnorderedVectorSetInt)
+	gd_testing_unit_test_foreach(SetIntLengthAccess, TSetType, SetInt, BTreeSetInt, FlatSetInt, UnorderedSetInt, UnorderedVectorSetInt)
 	{
 		TSetType set1;
 		gd_testing_verify(set1.GetLength() == 0);
@@ -84,7 +88,7 @@ GD_NAMESPACE_BEGIN
 		gd_testing_verify(!set2.IsEmpty());
 	};
 
-	gd_testing_unit_test_foreach(SetIntMoveCtor, TSetType, SetInt, UnorderedSetInt/*, UnorderedVectorSetInt*/)
+	gd_testing_unit_test_foreach(SetIntMoveCtor, TSetType, SetInt, BTreeSetInt, FlatSetInt, UnorderedSetInt/*, UnorderedVectorSetInt*/)
 	{
 		TSetType set1{ 2, 3, 4, 5 };
 		TSetType set2(Utils::Move(set1));
@@ -94,7 +98,7 @@ GD_NAMESPACE_BEGIN
 		GD_STUBBED(UnorderedVectorSetIntMoveCtor);
 	};
 
-	gd_testing_unit_test_foreach(SetIntMoveAssignmentOperator, TSetType, SetInt, UnorderedSetInt/*, UnorderedVectorSetInt*/)
+	gd_testing_unit_test_foreach(SetIntMoveAssignmentOperator, TSetType, SetInt, BTreeSetInt, FlatSetInt, UnorderedSetInt/*, UnorderedVectorSetInt*/)
 	{
 		TSetType set1{ 2, 3, 4, 5 };
 		TSetType set2{ 7 };
@@ -106,7 +110,7 @@ GD_NAMESPACE_BEGIN
 		GD_STUBBED(UnorderedVectorSetIntMoveAssignmentOperator);
 	};
 
-	gd_testing_unit_test_foreach(SetIntClear, TSetType, SetInt, UnorderedSetInt, UnorderedVectorSetInt)
+	gd_testing_unit_test_foreach(SetIntClear, TSetType, SetInt, BTreeSetInt, FlatSetInt, UnorderedSetInt, UnorderedVectorSetInt)
 	{
 		TSetType set{ 2, 3, 4, 5 };
 		gd_testing_verify(set.GetLength() == 4);
@@ -116,7 +120,7 @@ GD_NAMESPACE_BEGIN
 		gd_testing_verify(set.IsEmpty());
 	};
 
-	gd_testing_unit_test_foreach(SetIntFindIterator, TSetType, SetInt, UnorderedSetInt, UnorderedVectorSetInt)
+	gd_testing_unit_test_foreach(SetIntFindIterator, TSetType, SetInt, BTreeSetInt, FlatSetInt, UnorderedSetInt, UnorderedVectorSetInt)
 	{
 		TSetType set{ 1, 2, 3 };
 		gd_testing_verify(set.FindIterator(1) != set.End());
@@ -125,7 +129,7 @@ GD_NAMESPACE_BEGIN
 		gd_testing_verify(set.FindIterator(4) == set.End());
 	};
 
-	gd_testing_unit_test_foreach(SetIntFind, TSetType, SetInt, UnorderedSetInt, UnorderedVectorSetInt)
+	gd_testing_unit_test_foreach(SetIntFind, TSetType, SetInt, BTreeSetInt, FlatSetInt, UnorderedSetInt, UnorderedVectorSetInt)
 	{
 		TSetType set{ 1, 2, 3 };
 		gd_testing_verify(set.Find(1) != nullptr);
@@ -134,7 +138,7 @@ GD_NAMESPACE_BEGIN
 		gd_testing_verify(set.Find(4) == nullptr);
 	};
 
-	gd_testing_unit_test_foreach(SetIntContains, TSetType, SetInt, UnorderedSetInt, UnorderedVectorSetInt)
+	gd_testing_unit_test_foreach(SetIntContains, TSetType, SetInt, BTreeSetInt, FlatSetInt, UnorderedSetInt, UnorderedVectorSetInt)
 	{
 		TSetType set{ 1, 2, 3 };
 		gd_testing_verify(set.Contains(1));
@@ -143,7 +147,7 @@ GD_NAMESPACE_BEGIN
 		gd_testing_verify(!set.Contains(4));
 	};
 
-	gd_testing_unit_test_foreach(SetIntErase, TSetType, SetInt, UnorderedSetInt, UnorderedVectorSetInt)
+	gd_testing_unit_test_foreach(SetIntErase, TSetType, SetInt, BTreeSetInt, FlatSetInt, UnorderedSetInt, UnorderedVectorSetInt)
 	{
 		TSetType set{ 1, 2, 3, 4, 5, 6, 7 };
 		
@@ -0,0 +1,562 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/Containers/SlotMap.h
+ * Dense container with generational handles.
+ */
+#pragma once
+
+#include <GoddamnEngine/Include.h>
+#include <GoddamnEngine/Core/Containers/Vector.h>
+
+GD_NAMESPACE_BEGIN
+
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+	// ******                         SlotHandle & SlotMap<T> classes.                         ******
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+
+	// **------------------------------------------------------------------------------------------**
+	//! Handle of the element in the slot map.
+	//! Lower bits contain index of the slot, higher bits contain generation of the slot, which is
+	//! incremented each time the element is removed. Generation zero is never issued, so the
+	//! default handle never refers to an element.
+	//!
+	//! @tparam TValue Unsigned integer type, that stores the handle.
+	//! @tparam TIndexBits Number of bits, used by the index of the slot.
+	// **------------------------------------------------------------------------------------------**
+	template<typename TValue, SizeTp TIndexBits>
+	struct SlotHandle final
+	{
+		static_assert(TIndexBits <= 32 && sizeof(TValue) * 8 - TIndexBits <= 32, "Index and generation of the slot should fit into 32 bits.");
+
+	public:
+		using ValueType = TValue;
+		SizeTp static const IndexBits = TIndexBits;
+		SizeTp static const GenerationBits = sizeof(TValue) * 8 - TIndexBits;
+		UInt32 static const MaxIndex = static_cast<UInt32>((UInt64(1) << IndexBits) - 1);
+		UInt32 static const MaxGeneration = static_cast<UInt32>((UInt64(1) << GenerationBits) - 1);
+
+	private:
+		TValue m_Value;
+
+	public:
+
+		/*!
+		 * Initializes a handle, that does not refer to any element.
+		 */
+		GDINL SlotHandle()
+			: m_Value(0)
+		{}
+
+		/*!
+		 * Initializes a handle with the value, returned by @ref GetValue.
+		 * @param value Value of the handle.
+		 */
+		GDINL explicit SlotHandle(TValue const value)
+			: m_Value(value)
+		{}
+
+		/*!
+		 * Initializes a handle with the index and the generation of the slot.
+		 *
+		 * @param index Index of the slot.
+		 * @param generation Generation of the slot.
+		 */
+		GDINL SlotHandle(UInt32 const index, UInt32 const generation)
+			: m_Value(static_cast<TValue>(generation) << TIndexBits | index)
+		{
+			GD_ASSERT(index <= MaxIndex && generation <= MaxGeneration, "Slot handle is out of range.");
+		}
+
+	public:
+
+		/*!
+		 * Returns value of the handle.
+		 */
+		GDINL TValue GetValue() const
+		{
+			return m_Value;
+		}
+
+		/*!
+		 * Returns index of the slot.
+		 */
+		GDINL UInt32 GetIndex() const
+		{
+			return static_cast<UInt32>(m_Value & MaxIndex);
+		}
+
+		/*!
+		 * Returns generation of the slot.
+		 */
+		GDINL UInt32 GetGeneration() const
+		{
+			return static_cast<UInt32>(m_Value >> TIndexBits);
+		}
+
+		/*!
+		 * Returns true if this handle was issued by the slot map. Handle may still be stale.
+		 */
+		GDINL bool IsValid() const
+		{
+			return m_Value != 0;
+		}
+
+		/*!
+		 * Returns hash code of this handle.
+		 */
+		GDINL HashCode GetHashCode() const
+		{
+			return HashCode(m_Value);
+		}
+
+		GDINL friend bool operator== (SlotHandle const lhs, SlotHandle const rhs)
+		{
+			return lhs.m_Value == rhs.m_Value;
+		}
+		GDINL friend bool operator!= (SlotHandle const lhs, SlotHandle const rhs)
+		{
+			return lhs.m_Value != rhs.m_Value;
+		}
+	};	// struct SlotHandle
+
+	//! Handle with 20 bits of the index and 12 bits of the generation.
+	using SlotHandle32 = SlotHandle<UInt32, 20>;
+	//! Handle with 32 bits of the index and 32 bits of the generation.
+	using SlotHandle64 = SlotHandle<UInt64, 32>;
+
+	// **------------------------------------------------------------------------------------------**
+	//! Table of the generational slots, that map handles to the indices in the dense storage.
+	//! Removal of the element increments generation of its slot, so handles of the removed
+	//! elements are detected as stale. Slots, whose generation is exhausted, are retired and
+	//! never reused. Free slots are linked into the intrusive list.
+	//!
+	//! @tparam THandle Type of handles, either @ref SlotHandle32 or @ref SlotHandle64.
+	// **------------------------------------------------------------------------------------------**
+	template<typename THandle>
+	class SlotTable
+	{
+	private:
+		UInt32 static const NoSlot = UInt32Max;
+
+		// Index of the element for occupied slots, index of the next free slot otherwise.
+		struct Slot final
+		{
+			UInt32 Index;
+			UInt32 Generation;
+		};	// struct Slot
+
+	private:
+		Vector<Slot> m_Slots;
+		UInt32       m_FreeSlot;
+
+	public:
+
+		/*!
+		 * Initializes an empty slot table.
+		 */
+		GDINL SlotTable()
+			: m_FreeSlot(NoSlot)
+		{}
+
+		GDINL SlotTable(SlotTable const& otherTable) = default;
+		GDINL SlotTable(SlotTable&& otherTable) noexcept
+			: m_Slots(Utils::Move(otherTable.m_Slots)), m_FreeSlot(otherTable.m_FreeSlot)
+		{
+			otherTable.m_FreeSlot = NoSlot;
+		}
+
+	public:
+
+		/*!
+		 * Reserves memory for the specified number of slots.
+		 * @param newCapacity New required number of slots.
+		 */
+		GDINL void Reserve(SizeTp const newCapacity)
+		{
+			if (newCapacity > m_Slots.GetLength())
+			{
+				m_Slots.Reserve(newCapacity);
+			}
+		}
+
+		/*!
+		 * Returns index of the element, referenced by the handle.
+		 *
+		 * @param handle Handle of the element.
+		 * @returns Index of the element or @c SizeTpMax if handle is stale.
+		 */
+		GDINL SizeTp GetIndex(THandle const handle) const
+		{
+			auto const slotIndex = handle.GetIndex();
+			if (slotIndex < m_Slots.GetLength())
+			{
+				auto const& slot = m_Slots[slotIndex];
+				if (slot.Generation == handle.GetGeneration())
+				{
+					return slot.Index;
+				}
+			}
+			return SizeTpMax;
+		}
+
+		/*!
+		 * Updates index of the element in the occupied slot.
+		 *
+		 * @param slotIndex Index of the slot.
+		 * @param index New index of the element.
+		 */
+		GDINL void SetIndex(UInt32 const slotIndex, SizeTp const index)
+		{
+			m_Slots[slotIndex].Index = static_cast<UInt32>(index);
+		}
+
+		/*!
+		 * Returns handle of the occupied slot.
+		 * @param slotIndex Index of the slot.
+		 */
+		GDINL THandle GetHandle(UInt32 const slotIndex) const
+		{
+			return THandle(slotIndex, m_Slots[slotIndex].Generation);
+		}
+
+		/*!
+		 * Takes the slot from the free list or appends a new one.
+		 *
+		 * @param index Index of the element in the new slot.
+		 * @returns Index of the slot.
+		 */
+		GDINL UInt32 Acquire(SizeTp const index)
+		{
+			UInt32 slotIndex;
+			if (m_FreeSlot != NoSlot)
+			{
+				slotIndex = m_FreeSlot;
+				m_FreeSlot = m_Slots[slotIndex].Index;
+			}
+			else
+			{
+				GD_ASSERT(m_Slots.GetLength() < THandle::MaxIndex, "Slot table has run out of slots.");
+				Slot const newSlot = { 0, 1 };
+				slotIndex = static_cast<UInt32>(m_Slots.InsertLast(newSlot));
+			}
+			SetIndex(slotIndex, index);
+			return slotIndex;
+		}
+
+		/*!
+		 * Invalidates handles of the slot and returns it to the free list.
+		 * Slots with the last generation are retired: this generation is never issued, so no handles match them.
+		 *
+		 * @param slotIndex Index of the slot.
+		 */
+		GDINL void Release(UInt32 const slotIndex)
+		{
+			auto& slot = m_Slots[slotIndex];
+			if (++slot.Generation != THandle::MaxGeneration)
+			{
+				slot.Index = m_FreeSlot;
+				m_FreeSlot = slotIndex;
+			}
+		}
+
+	public:
+
+		GDINL SlotTable& operator= (SlotTable const& otherTable) = default;
+		GDINL SlotTable& operator= (SlotTable&& otherTable) noexcept
+		{
+			if (&otherTable != this)
+			{
+				m_Slots = Utils::Move(otherTable.m_Slots);
+				m_FreeSlot = otherTable.m_FreeSlot;
+				otherTable.m_FreeSlot = NoSlot;
+			}
+			return *this;
+		}
+	};	// class SlotTable
+
+	// **------------------------------------------------------------------------------------------**
+	//! Container, that stores elements contiguously and references them with generational handles.
+	//! Handles point to the slots, slots point to the elements. Removal moves the last element
+	//! into the place of the removed one, handles of the removed elements become stale.
+	//!
+	//! Insertion, removal and lookup take constant time. Elements are iterated in the dense order,
+	//! which changes on removals.
+	//!
+	//! @tparam TElement Type of elements stored in the slot map.
+	//! @tparam THandle Type of handles, either @ref SlotHandle32 or @ref SlotHandle64.
+	// **------------------------------------------------------------------------------------------**
+	template<typename TElement, typename THandle = SlotHandle64>
+	class SlotMap
+	{
+	public:
+		using HandleType           = THandle;
+		using ElementType          = TElement;
+		using Iterator             = typename Vector<TElement>::Iterator;
+		using ConstIterator        = typename Vector<TElement>::ConstIterator;
+		using ReverseIterator      = typename Vector<TElement>::ReverseIterator;
+		using ReverseConstIterator = typename Vector<TElement>::ReverseConstIterator;
+
+		GD_CONTAINER_DEFINE_ITERATION_SUPPORT(SlotMap)
+
+	private:
+		Vector<TElement>   m_Elements;
+		Vector<UInt32>     m_ElementSlots;
+		SlotTable<THandle> m_Slots;
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Constructors and destructor.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Initializes an empty slot map.
+		 */
+		GDINL SlotMap() = default;
+
+		/*!
+		 * Initializes slot map with copy of other slot map. Handles of the other slot map refer to the copies.
+		 * @param otherMap Slot map would be copied.
+		 */
+		GDINL SlotMap(SlotMap const& otherMap) = default;
+
+		/*!
+		 * Moves other slot map here. Handles of the other slot map refer to the moved elements.
+		 * @param otherMap Slot map would be moved into current object.
+		 */
+		GDINL SlotMap(SlotMap&& otherMap) = default;
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Iteration API.
+		// ------------------------------------------------------------------------------------------
+
+		GDINL Iterator Begin()
+		{
+			return m_Elements.Begin();
+		}
+		GDINL ConstIterator Begin() const
+		{
+			return m_Elements.Begin();
+		}
+
+		GDINL Iterator End()
+		{
+			return m_Elements.End();
+		}
+		GDINL ConstIterator End() const
+		{
+			return m_Elements.End();
+		}
+
+		GDINL ReverseIterator ReverseBegin()
+		{
+			return m_Elements.ReverseBegin();
+		}
+		GDINL ReverseConstIterator ReverseBegin() const
+		{
+			return m_Elements.ReverseBegin();
+		}
+
+		GDINL ReverseIterator ReverseEnd()
+		{
+			return m_Elements.ReverseEnd();
+		}
+		GDINL ReverseConstIterator ReverseEnd() const
+		{
+			return m_Elements.ReverseEnd();
+		}
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Dynamic size management.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Returns pointer to the densely stored elements.
+		 */
+		//! @{
+		GDINL TElement const* GetData() const
+		{
+			return m_Elements.GetData();
+		}
+		GDINL TElement* GetData()
+		{
+			return m_Elements.GetData();
+		}
+		//! @}
+
+		/*!
+		 * Returns number of elements that exist in slot map.
+		 */
+		GDINL SizeTp GetLength() const
+		{
+			return m_Elements.GetLength();
+		}
+
+		/*!
+		 * Returns true if this slot map is empty.
+		 */
+		GDINL bool IsEmpty() const
+		{
+			return m_Elements.IsEmpty();
+		}
+
+		/*!
+		 * Reserves memory for slot map to make it contain specified number of elements without reallocation.
+		 * @param newCapacity New required capacity of the slot map.
+		 */
+		GDINL void Reserve(SizeTp const newCapacity)
+		{
+			m_Elements.Reserve(newCapacity);
+			m_ElementSlots.Reserve(newCapacity);
+			m_Slots.Reserve(newCapacity);
+		}
+
+		/*!
+		 * Removes all elements from the slot map with memory deallocation.
+		 * Slots are kept, so that handles of the removed elements remain stale.
+		 */
+		GDINL void Clear()
+		{
+			for (auto const slotIndex : m_ElementSlots)
+			{
+				m_Slots.Release(slotIndex);
+			}
+			m_Elements.Clear();
+			m_ElementSlots.Clear();
+		}
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Handles.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Returns handle of the element at the specified position in the dense order.
+		 * @param index Index of the element.
+		 */
+		GDINL THandle GetHandle(SizeTp const index) const
+		{
+			return m_Slots.GetHandle(m_ElementSlots[index]);
+		}
+
+		/*!
+		 * Returns position of the element with the specified handle in the dense order.
+		 *
+		 * @param handle Handle of the element.
+		 * @returns Index of the element or @c SizeTpMax if handle is stale.
+		 */
+		GDINL SizeTp GetIndex(THandle const handle) const
+		{
+			return m_Slots.GetIndex(handle);
+		}
+
+		/*!
+		 * Queries for the element with the specified handle.
+		 *
+		 * @param handle Handle of the element.
+		 * @returns Pointer to the element if handle is not stale and null pointer otherwise.
+		 */
+		//! @{
+		GDINL TElement const* Find(THandle const handle) const
+		{
+			auto const index = GetIndex(handle);
+			return index != SizeTpMax ? &m_Elements[index] : nullptr;
+		}
+		GDINL TElement* Find(THandle const handle)
+		{
+			return const_cast<TElement*>(const_cast<SlotMap const*>(this)->Find(handle));
+		}
+		//! @}
+
+		/*!
+		 * Returns true if the element with the specified handle exists in the slot map.
+		 * @param handle Handle of the element.
+		 */
+		GDINL bool Contains(THandle const handle) const
+		{
+			return GetIndex(handle) != SizeTpMax;
+		}
+
+		/*!
+		 * Inserts the element into the slot map.
+		 *
+		 * @param element The element that is going to be inserted.
+		 * @returns Handle of the inserted element.
+		 */
+		//! @{
+		GDINL THandle Insert(TElement&& element = TElement())
+		{
+			auto const slotIndex = m_Slots.Acquire(m_Elements.InsertLast(Utils::Forward<TElement>(element)));
+			m_ElementSlots.InsertLast(slotIndex);
+			return m_Slots.GetHandle(slotIndex);
+		}
+		GDINL THandle Insert(TElement const& element)
+		{
+			return Insert(TElement(element));
+		}
+		//! @}
+
+		/*!
+		 * Removes existing element with the specified handle from the slot map.
+		 * Last element in the dense order is moved into the place of the removed one.
+		 *
+		 * @param handle Handle of the element that is going to be removed.
+		 */
+		GDINL void Erase(THandle const handle)
+		{
+			auto const index = GetIndex(handle);
+			GD_ASSERT(index != SizeTpMax, "Element with specified handle does not exist.");
+
+			auto const lastIndex = m_Elements.GetLength() - 1;
+			if (index != lastIndex)
+			{
+				auto const lastSlotIndex = m_ElementSlots[lastIndex];
+				m_Elements[index] = Utils::Move(m_Elements[lastIndex]);
+				m_ElementSlots[index] = lastSlotIndex;
+				m_Slots.SetIndex(lastSlotIndex, index);
+			}
+			m_Elements.EraseLast();
+			m_ElementSlots.EraseLast();
+			m_Slots.Release(handle.GetIndex());
+		}
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Overloaded operators.
+		// ------------------------------------------------------------------------------------------
+
+		GDINL SlotMap& operator= (SlotMap const& otherMap) = default;
+		GDINL SlotMap& operator= (SlotMap&& otherMap) = default;
+
+		/*!
+		 * Returns reference on the element with the specified handle, that should not be stale.
+		 * @param handle Handle of the element.
+		 */
+		//! @{
+		GDINL TElement const& operator[] (THandle const handle) const
+		{
+			auto const element = Find(handle);
+			GD_ASSERT(element != nullptr, "Element with specified handle does not exist.");
+			return *element;
+		}
+		GDINL TElement& operator[] (THandle const handle)
+		{
+			return const_cast<TElement&>(const_cast<SlotMap const&>(*this)[handle]);
+		}
+		//! @}
+	};	// class SlotMap
+
+GD_NAMESPACE_END
@@ -0,0 +1,132 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/Containers/SlotMap_Benchmarks.cpp
+ * Dense container with generational handles benchmarks.
+ */
+#include <GoddamnEngine/Core/Containers/SlotMap.h>
+#include <GoddamnEngine/Core/Containers/Map.h>
+#include <GoddamnEngine/Core/Containers/UnorderedMap.h>
+
+GD_NAMESPACE_BEGIN
+
+#if GD_TESTING_ENABLED
+
+	SizeTp static const SlotMapBenchmarkLength = 100000;
+
+	// Keeps results of the benchmarks, so that computations are not optimized away.
+	static UInt64 volatile g_SlotMapBenchmarkSink;
+
+	// Component-like payload.
+	struct SlotMapBenchmarkElement final
+	{
+		Float32 Position[3];
+		UInt64  Key;
+	};	// struct SlotMapBenchmarkElement
+
+	gd_testing_benchmark(SlotMapLookup, state)
+	{
+		// Elements are looked up in the shuffled order.
+		SlotMap<SlotMapBenchmarkElement> slotMap;
+		Map<UInt64, SlotMapBenchmarkElement> map;
+		UnorderedMap<UInt64, SlotMapBenchmarkElement> unorderedMap;
+		Vector<SlotHandle64> handles;
+		Vector<UInt64> keys;
+		UInt64 random = 1;
+		for (SizeTp cnt = 0; cnt < SlotMapBenchmarkLength; ++cnt)
+		{
+			random = random * 6364136223846793005ull + 1442695040888963407ull;
+			SlotMapBenchmarkElement const element = { { 0.0f, 1.0f, 2.0f }, random };
+			handles.InsertLast(slotMap.Insert(element));
+			map.Insert(random, element);
+			unorderedMap.Insert(random, element);
+			keys.InsertLast(random);
+		}
+		for (SizeTp cnt = SlotMapBenchmarkLength - 1; cnt > 0; --cnt)
+		{
+			random = random * 6364136223846793005ull + 1442695040888963407ull;
+			auto const swapIndex = static_cast<SizeTp>(random >> 33) % (cnt + 1);
+			Swap(handles[cnt], handles[swapIndex]);
+			Swap(keys[cnt], keys[swapIndex]);
+		}
+
+		state.measure("Map::Find", SlotMapBenchmarkLength, [&]
+		{
+			UInt64 sum = 0;
+			for (auto const key : keys)
+			{
+				sum += map.Find(key)->Key;
+			}
+			g_SlotMapBenchmarkSink = sum;
+		});
+		state.measure("UnorderedMap::Find", SlotMapBenchmarkLength, [&]
+		{
+			UInt64 sum = 0;
+			for (auto const key : keys)
+			{
+				sum += unorderedMap.Find(key)->Key;
+			}
+			g_SlotMapBenchmarkSink = sum;
+		});
+		state.measure("SlotMap::Find", SlotMapBenchmarkLength, [&]
+		{
+			UInt64 sum = 0;
+			for (auto const handle : handles)
+			{
+				sum += slotMap.Find(handle)->Key;
+			}
+			g_SlotMapBenchmarkSink = sum;
+		});
+		state.measure("SlotMap iteration", SlotMapBenchmarkLength, [&]
+		{
+			UInt64 sum = 0;
+			for (auto const& element : slotMap)
+			{
+				sum += element.Key;
+			}
+			g_SlotMapBenchmarkSink = sum;
+		});
+	};
+
+	gd_testing_benchmark(SlotMapInsertErase, state)
+	{
+		state.measure("SlotMap", SlotMapBenchmarkLength, []
+		{
+			SlotMap<SlotMapBenchmarkElement> slotMap;
+			Vector<SlotHandle64> handles;
+			for (SizeTp cnt = 0; cnt < SlotMapBenchmarkLength; ++cnt)
+			{
+				SlotMapBenchmarkElement const element = { { 0.0f, 1.0f, 2.0f }, cnt };
+				handles.InsertLast(slotMap.Insert(element));
+			}
+			for (SizeTp cnt = 0; cnt < SlotMapBenchmarkLength; cnt += 2)
+			{
+				slotMap.Erase(handles[cnt]);
+			}
+			g_SlotMapBenchmarkSink = slotMap.GetLength();
+		});
+		state.measure("UnorderedMap", SlotMapBenchmarkLength, []
+		{
+			UnorderedMap<UInt64, SlotMapBenchmarkElement> unorderedMap;
+			for (SizeTp cnt = 0; cnt < SlotMapBenchmarkLength; ++cnt)
+			{
+				SlotMapBenchmarkElement const element = { { 0.0f, 1.0f, 2.0f }, cnt };
+				unorderedMap.Insert(cnt, element);
+			}
+			for (SizeTp cnt = 0; cnt < SlotMapBenchmarkLength; cnt += 2)
+			{
+				unorderedMap.Erase(cnt);
+			}
+			g_SlotMapBenchmarkSink = unorderedMap.GetLength();
+		});
+	};
+
+#endif	// if GD_TESTING_ENABLED
+
+GD_NAMESPACE_END
@@ -0,0 +1,124 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/Containers/SlotMap_UnitTests.cpp
+ * Dense container with generational handles tests.
+ */
+#include <GoddamnEngine/Core/Containers/SlotMap.h>
+#include <GoddamnEngine/Core/Containers/String.h>
+
+GD_NAMESPACE_BEGIN
+
+#if GD_TESTING_ENABLED
+
+	gd_testing_unit_test(SlotMapBaseOperations)
+	{
+		SlotMap<String> map;
+		gd_testing_verify(!SlotHandle64().IsValid() && !map.Contains(SlotHandle64()));
+
+		auto const first = map.Insert("first");
+		auto const second = map.Insert("second");
+		auto const third = map.Insert("third");
+		gd_testing_verify(map.GetLength() == 3 && first.IsValid() && first != second);
+		gd_testing_verify(map[first] == "first" && *map.Find(second) == "second" && map.Contains(third));
+
+		// Last element is moved into the place of the removed one.
+		map.Erase(first);
+		gd_testing_verify(map.GetLength() == 2 && !map.Contains(first) && map.Find(first) == nullptr);
+		gd_testing_verify(map.GetData()[0] == "third" && map.GetIndex(third) == 0 && map.GetHandle(0) == third);
+		gd_testing_verify(map[second] == "second" && map[third] == "third");
+
+		// Slot of the removed element is reused with the next generation.
+		auto const fourth = map.Insert("fourth");
+		gd_testing_verify(fourth.GetIndex() == first.GetIndex() && fourth.GetGeneration() == first.GetGeneration() + 1);
+		gd_testing_verify(!map.Contains(first) && map[fourth] == "fourth");
+
+		SizeTp iterated = 0;
+		for (auto const& element : map)
+		{
+			gd_testing_verify(map[map.GetHandle(iterated++)] == element);
+		}
+		gd_testing_verify(iterated == 3);
+
+		SlotMap<String> mapCopy(map);
+		gd_testing_verify(mapCopy[fourth] == "fourth" && &mapCopy[fourth] != &map[fourth]);
+		SlotMap<String> mapMoved(Utils::Move(mapCopy));
+		gd_testing_verify(mapMoved[second] == "second" && mapCopy.IsEmpty() && !mapCopy.Contains(second));
+
+		// Handles of the cleared elements are stale.
+		map.Clear();
+		gd_testing_verify(map.IsEmpty() && !map.Contains(second) && !map.Contains(third) && !map.Contains(fourth));
+		auto const fifth = map.Insert("fifth");
+		gd_testing_verify(map.GetLength() == 1 && map[fifth] == "fifth" && !map.Contains(fourth));
+	};
+
+	gd_testing_unit_test_foreach(SlotMapRandomOperations, THandle, SlotHandle32, SlotHandle64)
+	{
+		SlotMap<UInt32, THandle> map;
+		Vector<THandle> liveHandles, staleHandles;
+		Vector<UInt32> liveValues;
+		UInt32 random = 1;
+		for (UInt32 cnt = 0; cnt < 20000; ++cnt)
+		{
+			random = random * 1664525 + 1013904223;
+			if ((random >> 16) % 3 != 0 || liveHandles.IsEmpty())
+			{
+				liveHandles.InsertLast(map.Insert(cnt));
+				liveValues.InsertLast(cnt);
+			}
+			else
+			{
+				auto const index = (random >> 8) % liveHandles.GetLength();
+				map.Erase(liveHandles[index]);
+				staleHandles.InsertLast(liveHandles[index]);
+				liveHandles[index] = liveHandles.GetLast();
+				liveValues[index] = liveValues.GetLast();
+				liveHandles.EraseLast();
+				liveValues.EraseLast();
+			}
+		}
+
+		gd_testing_verify(map.GetLength() == liveHandles.GetLength());
+		for (SizeTp cnt = 0; cnt < liveHandles.GetLength(); ++cnt)
+		{
+			gd_testing_verify(map.Contains(liveHandles[cnt]) && map[liveHandles[cnt]] == liveValues[cnt]);
+		}
+		for (auto const staleHandle : staleHandles)
+		{
+			gd_testing_verify(!map.Contains(staleHandle));
+		}
+		for (SizeTp cnt = 0; cnt < map.GetLength(); ++cnt)
+		{
+			gd_testing_verify(map.GetIndex(map.GetHandle(cnt)) == cnt);
+		}
+	};
+
+	gd_testing_unit_test(SlotMapGenerationsExhaustion)
+	{
+		SlotMap<Int32, SlotHandle32> map;
+		auto const firstHandle = map.Insert(0);
+		auto handle = firstHandle;
+		for (UInt32 generation = 1; generation < SlotHandle32::MaxGeneration - 1; ++generation)
+		{
+			map.Erase(handle);
+			handle = map.Insert(static_cast<Int32>(generation));
+			gd_testing_verify(handle.GetIndex() == 0 && !map.Contains(firstHandle));
+		}
+		gd_testing_verify(handle.GetGeneration() == SlotHandle32::MaxGeneration - 1);
+
+		// Slot with exhausted generations is retired, the next element occupies a new slot.
+		map.Erase(handle);
+		auto const newHandle = map.Insert(42);
+		gd_testing_verify(newHandle.GetIndex() == 1 && newHandle.GetGeneration() == 1);
+		gd_testing_verify(!map.Contains(handle) && !map.Contains(firstHandle) && map[newHandle] == 42);
+	};
+
+#endif	// if GD_TESTING_ENABLED
+
+GD_NAMESPACE_END
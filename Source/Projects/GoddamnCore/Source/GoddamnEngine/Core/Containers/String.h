@@ -14,10 +14,13 @@
 
 #include <GoddamnEngine/Include.h>
 #include <GoddamnEngine/Core/CStdlib/CChar.h>
+#include <GoddamnEngine/Core/CStdlib/CFormat.h>
+#include <GoddamnEngine/Core/CStdlib/CParse.h>
 #include <GoddamnEngine/Core/CStdlib/CString.h>
 #include <GoddamnEngine/Core/CStdlib/CMemory.h>
 #include <GoddamnEngine/Core/Templates/Algorithm.h>
 #include <GoddamnEngine/Core/Templates/Iterators.h>
+#include <GoddamnEngine/Core/Misc/Hash.h>
 
 GD_NAMESPACE_BEGIN
 
@@ -309,12 +312,7 @@ GD_NAMESPACE_BEGIN
 		 */
 		GDINL HashCode GetHashCode() const
 		{
-			auto computed = 0;
-			for (auto const character : (*this))
-			{
-				computed = 65599 * computed + character;
-			}
-			return HashCode(computed >> 16 ^ computed);
+			return HashCode(Hash::ComputeBytes(CStr(), GetLength() * sizeof(TChar)));
 		}
 
 		// ------------------------------------------------------------------------------------------
@@ -508,25 +506,31 @@ GD_NAMESPACE_BEGIN
 		 * Searches for first occurrence of the specified text in the string.
 		 *
 		 * @param text Text we are looking for.
+		 * @param textLength Length of the text we are looking for.
+		 *
 		 * @returns Index of the first occurrence of the text in the string or @c Npos if nothing was found.
 		 */
 		//! @{
 		GDINL SizeTp Find(TChar const text) const
 		{
 			auto const cstring = CStr();
-			auto const location = CString::Strchr(cstring, text);
+			auto const location = CStringSearch::Find(cstring, m_Length, text);
 			return location != nullptr ? static_cast<SizeTp>(location - cstring) : Npos;
 		}
-		GDINL SizeTp Find(TChar const* const text) const
+		GDINL SizeTp Find(TChar const* const text, SizeTp const textLength) const
 		{
 			auto const cstring = CStr();
-			auto const location = CString::Strstr(CStr(), text);
+			auto const location = CStringSearch::Find(cstring, m_Length, text, textLength);
 			return location != nullptr ? static_cast<SizeTp>(location - cstring) : Npos;
 		}
+		GDINL SizeTp Find(TChar const* const text) const
+		{
+			return this->Find(text, CStringSearch::Strlen(text));
+		}
 		template<SizeTp TOtherInlineLength>
 		GDINL SizeTp Find(BaseString<TChar, TOtherInlineLength> const& text) const
 		{
-			return this->Find(text.CStr());
+			return this->Find(text.CStr(), text.GetLength());
 		}
 		//! @}
 
@@ -534,25 +538,31 @@ GD_NAMESPACE_BEGIN
 		 * Searches for last occurrence of the C string in the string.
 		 *
 		 * @param text Text we are looking for.
+		 * @param textLength Length of the text we are looking for.
+		 *
 		 * @returns Index of the last occurrence of the text in the string or @c Npos if nothing was found.
 		 */
 		//! @{
 		GDINL SizeTp ReverseFind(TChar const text) const
 		{
 			auto const cstring = CStr();
-			auto const location = CString::Strrchr(cstring, text);
+			auto const location = CStringSearch::ReverseFind(cstring, m_Length, text);
 			return location != nullptr ? static_cast<SizeTp>(location - cstring) : Npos;
 		}
-		GDINL SizeTp ReverseFind(TChar const* const text) const
+		GDINL SizeTp ReverseFind(TChar const* const text, SizeTp const textLength) const
 		{
 			auto const cstring = CStr();
-			auto const location = CString::Strrstr(cstring, text);
+			auto const location = CStringSearch::ReverseFind(cstring, m_Length, text, textLength);
 			return location != nullptr ? static_cast<SizeTp>(location - cstring) : Npos;
 		}
+		GDINL SizeTp ReverseFind(TChar const* const text) const
+		{
+			return this->ReverseFind(text, CStringSearch::Strlen(text));
+		}
 		template<SizeTp TOtherInlineLength>
 		GDINL SizeTp ReverseFind(BaseString<TChar, TOtherInlineLength> const& text) const
 		{
-			return this->ReverseFind(text.CStr());
+			return this->ReverseFind(text.CStr(), text.GetLength());
 		}
 		//! @}
 
@@ -630,9 +640,33 @@ GD_NAMESPACE_BEGIN
 		 */
 		GDINL static BaseString FormatVa(TChar const* const format, va_list list)
 		{
-			TChar buffer[15000] = {};
-			CString::Vsnprintf(buffer, GD::GetLength(buffer), format, list);
-			return BaseString(buffer);
+			// Short strings are formatted on the stack, long ones directly into the allocated memory.
+			TChar buffer[256];
+			va_list listCopy;
+			va_copy(listCopy, list);
+			auto const formattedLength = CString::Vsnprintf(buffer, GD::GetLength(buffer), format, listCopy);
+			va_end(listCopy);
+			if (formattedLength >= 0 && static_cast<SizeTp>(formattedLength) < GD::GetLength(buffer))
+			{
+				return BaseString(buffer, formattedLength);
+			}
+
+			// Narrow formatting reports the required length, wide one only reports the failure.
+			for (SizeTp length = formattedLength >= 0 ? formattedLength : 2 * GD::GetLength(buffer);; length *= 2)
+			{
+				BaseString string(length);
+				va_copy(listCopy, list);
+				auto const stringLength = CString::Vsnprintf(string.CStr(), length + 1, format, listCopy);
+				va_end(listCopy);
+				if (stringLength >= 0 && static_cast<SizeTp>(stringLength) <= length)
+				{
+					if (static_cast<SizeTp>(stringLength) == length)
+					{
+						return string;
+					}
+					return BaseString(string.CStr(), stringLength);
+				}
+			}
 		}
 
 		/*!
@@ -727,11 +761,11 @@ GD_NAMESPACE_BEGIN
 		 */
 		GDINL Int64 ToInt64(bool* const succeeded = nullptr) const
 		{
-			TChar const* endPtr = nullptr;
-			auto const value = CString::Strtoi64(CStr(), &endPtr, 0);
+			Int64 value;
+			auto const result = CParse::ParseInt64(CStr(), GetLength(), value, 0);
 			if (succeeded != nullptr)
 			{
-				*succeeded = endPtr == &*End();
+				*succeeded = result.Succeeded() && result.Length == GetLength();
 			}
 			return value; 
 		}
@@ -740,34 +774,19 @@ GD_NAMESPACE_BEGIN
 		 * Returns unsigned integer representation of this string.
 		 *
 		 * @param succeeded Would be written true if conversion succeeded.
-		 * @param valueBase The base in which value is represented.
+		 * @param valueBase The base in which value is represented. Hexadecimals may have the '0x' prefix.
 		 */
 		GDINL Int64 ToUInt64(bool* const succeeded = nullptr, Base const valueBase = Base::Decimal) const
 		{
 			GD_ASSERT(valueBase < Base::Unknown);
 
-			Int64 value = 0; 
-			TChar const* endPtr = nullptr;
-			auto cstring = CStr();
-			switch (valueBase) // NOLINT
-			{
-				case Base::Hexadecimal:
-					if (cstring[0] == GD_TEXT(TChar, '0') 
-						&& (cstring[1] == GD_TEXT(TChar, 'x') || cstring[1] == GD_TEXT(TChar, 'X')))
-					{
-						// Skipping the leading '0x' prefix.
-						cstring += 2;
-					}
-				case Base::Decimal:
-				case Base::Octal:
-					value = CString::Strtoi64(cstring, &endPtr, static_cast<SizeTp>(valueBase));
-					break;
-			}
+			UInt64 value;
+			auto const result = CParse::ParseUInt64(CStr(), GetLength(), value, static_cast<UInt32>(valueBase));
 			if (succeeded != nullptr)
 			{
-				*succeeded = endPtr == &*End();
+				*succeeded = result.Succeeded() && result.Length == GetLength();
 			}
-			return value; 
+			return static_cast<Int64>(value); 
 		}
 
 		/*!
@@ -776,7 +795,8 @@ GD_NAMESPACE_BEGIN
 		 */
 		GDINL static BaseString FromInt64(Int64 const value)
 		{
-			return Format(GD_TEXT(TChar, "%lld"), value);
+			TChar buffer[CFormat::MaxIntegerLength];
+			return BaseString(buffer, CFormat::FormatInt64(buffer, value));
 		}
 
 		/*!
@@ -789,14 +809,21 @@ GD_NAMESPACE_BEGIN
 		GDINL static BaseString FromUInt64(UInt64 const value, Base const valueBase = Base::Decimal, bool const valueBasePrefix = false)
 		{
 			GD_ASSERT(valueBase < Base::Unknown);
+			TChar buffer[CFormat::MaxIntegerLength + 2];
 			switch (valueBase)
 			{
 				case Base::Decimal:
-					return Format(GD_TEXT(TChar, "%llu"), value);
+					return BaseString(buffer, CFormat::FormatUInt64(buffer, value));
 				case Base::Octal:
 					return Format(valueBasePrefix ? GD_TEXT(TChar, "0%llo") : GD_TEXT(TChar, "%llo"), value);
 				case Base::Hexadecimal:
-					return Format(valueBasePrefix ? GD_TEXT(TChar, "0x%llx") : GD_TEXT(TChar, "%llx"), value);
+					if (valueBasePrefix)
+					{
+						buffer[0] = GD_TEXT(TChar, '0');
+						buffer[1] = GD_TEXT(TChar, 'x');
+						return BaseString(buffer, CFormat::FormatUInt64Hex(buffer + 2, value) + 2);
+					}
+					return BaseString(buffer, CFormat::FormatUInt64Hex(buffer, value));
 				default:
 					GD_NOT_SUPPORTED();
 			}
@@ -808,22 +835,24 @@ GD_NAMESPACE_BEGIN
 		 */
 		GDINL Float64 ToFloat64(bool* const succeeded = nullptr) const
 		{
-			TChar const* endPtr = nullptr;
-			auto const value = CString::Strtof64(CStr(), &endPtr);
+			Float64 value;
+			auto const result = CParse::ParseFloat64(CStr(), GetLength(), value);
 			if (succeeded != nullptr)
 			{
-				*succeeded = endPtr == &*End();
+				*succeeded = result.Succeeded() && result.Length == GetLength();
 			}
 			return value;
 		}
 
 		/*!
-		 * Returns string representation of the specified floating point number.
+		 * Returns the shortest string representation of the specified floating point number, 
+		 * that is parsed back to the same number.
 		 * @param value Value to convert.
 		 */
 		GDINL static BaseString FromFloat64(Float64 const value)
 		{
-			return Format(GD_TEXT(TChar, "%f"), value);
+			TChar buffer[CFormat::MaxFloatLength];
+			return BaseString(buffer, CFormat::FormatFloat64(buffer, value));
 		}
 
 		// ------------------------------------------------------------------------------------------
@@ -1010,68 +1039,68 @@ GD_NAMESPACE_BEGIN
 		template<SizeTp TInlineLengthLhs, SizeTp TInlineLengthRhs>
 		GDINL friend bool operator> (BaseString<TChar, TInlineLengthLhs> const& lhs, BaseString<TChar, TInlineLengthRhs> const& rhs)
 		{
-			return CString::Strncmp(lhs.CStr(), rhs.CStr(), lhs.GetLength()) > 0;
+			return CString::Strncmp(lhs.CStr(), rhs.CStr(), lhs.GetLength() + 1) > 0;
 		}
 		template<SizeTp TInlineLengthLhs, SizeTp TInlineLengthRhs>
 		GDINL friend bool operator>= (BaseString<TChar, TInlineLengthLhs> const& lhs, BaseString<TChar, TInlineLengthRhs> const& rhs)
 		{
-			return CString::Strncmp(lhs.CStr(), rhs.CStr(), lhs.GetLength()) >= 0;
+			return CString::Strncmp(lhs.CStr(), rhs.CStr(), lhs.GetLength() + 1) >= 0;
 		}
 
 		// string < string
 		template<SizeTp TInlineLengthLhs, SizeTp TInlineLengthRhs>
 		GDINL friend bool operator< (BaseString<TChar, TInlineLengthLhs> const& lhs, BaseString<TChar, TInlineLengthRhs> const& rhs)
 		{
-			return CString::Strncmp(lhs.CStr(), rhs.CStr(), lhs.GetLength()) < 0;
+			return CString::Strncmp(lhs.CStr(), rhs.CStr(), lhs.GetLength() + 1) < 0;
 		}
 		template<SizeTp TInlineLengthLhs, SizeTp TInlineLengthRhs>
 		GDINL friend bool operator<= (BaseString<TChar, TInlineLengthLhs> const& lhs, BaseString<TChar, TInlineLengthRhs> const& rhs)
 		{
-			return CString::Strncmp(lhs.CStr(), rhs.CStr(), lhs.GetLength()) <= 0;
+			return CString::Strncmp(lhs.CStr(), rhs.CStr(), lhs.GetLength() + 1) <= 0;
 		}
 
 		// string > char*
 		template<SizeTp TInlineLengthLhs>
 		GDINL friend bool operator> (BaseString<TChar, TInlineLengthLhs> const& lhs, TChar const* const rhs)
 		{
-			return CString::Strncmp(lhs.CStr(), rhs, lhs.GetLength()) > 0;
+			return CString::Strncmp(lhs.CStr(), rhs, lhs.GetLength() + 1) > 0;
 		}
 		template<SizeTp TInlineLengthRhs>
 		GDINL friend bool operator> (TChar const* const lhs, BaseString<TChar, TInlineLengthRhs> const& rhs)
 		{
-			return CString::Strncmp(lhs, rhs.CStr(), rhs.GetLength()) > 0;
+			return CString::Strncmp(lhs, rhs.CStr(), rhs.GetLength() + 1) > 0;
 		}
 		template<SizeTp TInlineLengthLhs>
 		GDINL friend bool operator>= (BaseString<TChar, TInlineLengthLhs> const& lhs, TChar const* const rhs)
 		{
-			return CString::Strncmp(lhs.CStr(), rhs, lhs.GetLength()) >= 0;
+			return CString::Strncmp(lhs.CStr(), rhs, lhs.GetLength() + 1) >= 0;
 		}
 		template<SizeTp TInlineLengthRhs>
 		GDINL friend bool operator>= (TChar const* const lhs, BaseString<TChar, TInlineLengthRhs> const& rhs)
 		{
-			return CString::Strncmp(lhs, rhs.CStr(), rhs.GetLength()) >= 0;
+			return CString::Strncmp(lhs, rhs.CStr(), rhs.GetLength() + 1) >= 0;
 		}
 
 		// string < char*
 		template<SizeTp TInlineLengthLhs>
 		GDINL friend bool operator< (BaseString<TChar, TInlineLengthLhs> const& lhs, TChar const* const rhs)
 		{
-			return CString::Strncmp(lhs.CStr(), rhs, lhs.GetLength()) < 0;
+			return CString::Strncmp(lhs.CStr(), rhs, lhs.GetLength() + 1) < 0;
 		}
 		template<SizeTp TInlineLengthRhs>
 		GDINL friend bool operator< (TChar const* const lhs, BaseString<TChar, TInlineLengthRhs> const& rhs)
 		{
-			return CString::Strncmp(lhs, rhs.CStr(), rhs.GetLength()) < 0;
+			return CString::Strncmp(lhs, rhs.CStr(), rhs.GetLength() + 1) < 0;
 		}
 		template<SizeTp TInlineLengthLhs>
 		GDINL friend bool operator<= (BaseString<TChar, TInlineLengthLhs> const& lhs, TChar const* const rhs)
 		{
-			return CString::Strncmp(lhs.CStr(), rhs, lhs.GetLength()) <= 0;
+			return CString::Strncmp(lhs.CStr(), rhs, lhs.GetLength() + 1) <= 0;
 		}
 		template<SizeTp TInlineLengthRhs>
 		GDINL friend bool operator<= (TChar const* const lhs, BaseString<TChar, TInlineLengthRhs> const& rhs)
 		{
-			return CString::Strncmp(lhs, rhs.CStr(), rhs.GetLength()) <= 0;
+			return CString::Strncmp(lhs, rhs.CStr(), rhs.GetLength() + 1) <= 0;
 		}
 
 		// string + string
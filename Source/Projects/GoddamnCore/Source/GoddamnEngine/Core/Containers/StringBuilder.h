@@ -144,7 +144,8 @@ GD_NAMESPACE_BEGIN
 		{
 			auto const startPos = m_Container.GetLength() - 1;
 			m_Container.Resize(m_Container.GetLength() + textLength);
-			CMemory::Memcpy(m_Container.GetData() + startPos, text, (textLength + 1) * sizeof(TChar));
+			CMemory::Memcpy(m_Container.GetData() + startPos, text, textLength * sizeof(TChar));
+			m_Container.GetLast() = GD_TEXT(TChar, '\0');
 			return *this;
 		}
 
@@ -178,6 +179,37 @@ GD_NAMESPACE_BEGIN
 		}
 		//! @}
 
+		/*!
+		 * Appends formatable string to this string builder.
+		 *
+		 * @param format Standard printf-like format.
+		 * @param list Format arguments.
+		 * @returns this.
+		 */
+		GDINL BaseStringBuilder& AppendFormatVa(TChar const* const format, va_list list)
+		{
+			// Text is formatted directly into the builder storage, which grows until the text fits.
+			// First attempt is kept short, since resizing initializes the whole attempted range.
+			auto const startPos = m_Container.GetLength() - 1;
+			SizeTp availableLength = 256;
+			for (;;)
+			{
+				m_Container.Resize(startPos + availableLength);
+				va_list listCopy;
+				va_copy(listCopy, list);
+				auto const formattedLength = CString::Vsnprintf(m_Container.GetData() + startPos, availableLength, format, listCopy);
+				va_end(listCopy);
+				if (formattedLength >= 0 && static_cast<SizeTp>(formattedLength) < availableLength)
+				{
+					m_Container.Resize(startPos + formattedLength + 1);
+					return *this;
+				}
+
+				// Narrow formatting reports the required length, wide one only reports the failure.
+				availableLength = formattedLength >= 0 ? formattedLength + 1 : availableLength * 2;
+			}
+		}
+
 		/*!
 		 * Appends formatable string to this string builder.
 		 *
@@ -187,13 +219,10 @@ GD_NAMESPACE_BEGIN
 		 */
 		GDINL BaseStringBuilder& AppendFormat(TChar const* const format, ...)
 		{
-			//! @todo Optimize this code. possibly try to format everything inline in the builder.
-			va_list args;
-			va_start(args, format);
-			BaseStringType const formatted = BaseStringType::FormatVa(format, args);
-			Append(formatted);
-			va_end(args);
-
+			va_list list;
+			va_start(list, format);
+			AppendFormatVa(format, list);
+			va_end(list);
 			return *this;
 		}
 
@@ -0,0 +1,51 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/Containers/StringFormat.cpp
+ * Type-safe string formatting.
+ */
+#include <GoddamnEngine/Core/Containers/StringFormat.h>
+#include <GoddamnEngine/Core/IO/Stream.h>
+
+GD_NAMESPACE_BEGIN
+
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+	// ******                             StringFormatStream class.                            ******
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+
+	/*!
+	 * Writes the buffered text into the stream.
+	 */
+	GDAPI void StringFormatStream::Flush()
+	{
+		if (m_Length != 0)
+		{
+			m_Stream.Write(m_Buffer, sizeof(Char), m_Length);
+			m_Length = 0;
+		}
+	}
+
+	/*!
+	 * Appends text, that does not fit into the buffer.
+	 */
+	GDAPI void StringFormatStream::AppendSlow(Char const* const text, SizeTp const textLength)
+	{
+		Flush();
+		if (textLength < BufferLength)
+		{
+			CMemory::Memcpy(m_Buffer, text, textLength);
+			m_Length = textLength;
+		}
+		else
+		{
+			m_Stream.Write(text, sizeof(Char), textLength);
+		}
+	}
+
+GD_NAMESPACE_END
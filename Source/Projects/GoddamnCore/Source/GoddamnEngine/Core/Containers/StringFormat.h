@@ -0,0 +1,894 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/Containers/StringFormat.h
+ * Type-safe string formatting.
+ */
+#pragma once
+
+#include <GoddamnEngine/Include.h>
+#include <GoddamnEngine/Core/CStdlib/CFormat.h>
+#include <GoddamnEngine/Core/Containers/String.h>
+#include <GoddamnEngine/Core/Containers/StringView.h>
+#include <GoddamnEngine/Core/Templates/TypeTraits.h>
+
+GD_NAMESPACE_BEGIN
+
+	class OutputStream;
+
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+	// ******                                Format arguments.                                 ******
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+
+	/*!
+	 * Type of the formatted argument.
+	 */
+	enum class StringFormatArgumentType : UInt8
+	{
+		Signed,
+		Unsigned,
+		Float32,
+		Float64,
+		Bool,
+		Character,
+		String,
+		Pointer,
+		Unknown,
+	};	// enum class StringFormatArgumentType
+
+	// **------------------------------------------------------------------------------------------**
+	//! Type-erased formatted argument.
+	//! @tparam TChar character type of the format string.
+	// **------------------------------------------------------------------------------------------**
+	template<typename TChar>
+	struct BaseStringFormatArgument final
+	{
+		StringFormatArgumentType Type;
+		union
+		{
+			Int64       ValueSigned;
+			UInt64      ValueUnsigned;
+			Float32     ValueFloat32;
+			Float64     ValueFloat64;
+			bool        ValueBool;
+			TChar       ValueCharacter;
+			void const* ValuePointer;
+			struct
+			{
+				TChar const* Text;
+				SizeTp       Length;
+			} ValueString;
+		};	// anonymous union
+
+	public:
+		GDINL BaseStringFormatArgument()
+			: Type(StringFormatArgumentType::Unknown), ValueUnsigned(0)
+		{
+		}
+	};	// struct BaseStringFormatArgument
+
+	// **------------------------------------------------------------------------------------------**
+	//! Describes how the value of the specified type is formatted.
+	//! Specializations define the argument 'Type' and the 'Make' function, that erases the value.
+	//! @tparam TChar character type of the format string.
+	//! @tparam TValue type of the formatted value.
+	// **------------------------------------------------------------------------------------------**
+	template<typename TChar, typename TValue>
+	struct StringFormatArgumentTraits;
+
+#define GD_STRING_FORMAT_ARGUMENT_TRAITS(TValue, TType, TMember, TMemberType) \
+	template<typename TChar> \
+	struct StringFormatArgumentTraits<TChar, TValue> final : public TNonCreatable \
+	{ \
+		StringFormatArgumentType static constexpr Type = StringFormatArgumentType::TType; \
+		GDINL static BaseStringFormatArgument<TChar> Make(TValue const value) \
+		{ \
+			BaseStringFormatArgument<TChar> argument; \
+			argument.Type = Type; \
+			argument.TMember = static_cast<TMemberType>(value); \
+			return argument; \
+		} \
+	}	// struct StringFormatArgumentTraits
+
+	GD_STRING_FORMAT_ARGUMENT_TRAITS(signed char, Signed, ValueSigned, Int64);
+	GD_STRING_FORMAT_ARGUMENT_TRAITS(signed short, Signed, ValueSigned, Int64);
+	GD_STRING_FORMAT_ARGUMENT_TRAITS(signed int, Signed, ValueSigned, Int64);
+	GD_STRING_FORMAT_ARGUMENT_TRAITS(signed long, Signed, ValueSigned, Int64);
+	GD_STRING_FORMAT_ARGUMENT_TRAITS(signed long long, Signed, ValueSigned, Int64);
+	GD_STRING_FORMAT_ARGUMENT_TRAITS(unsigned char, Unsigned, ValueUnsigned, UInt64);
+	GD_STRING_FORMAT_ARGUMENT_TRAITS(unsigned short, Unsigned, ValueUnsigned, UInt64);
+	GD_STRING_FORMAT_ARGUMENT_TRAITS(unsigned int, Unsigned, ValueUnsigned, UInt64);
+	GD_STRING_FORMAT_ARGUMENT_TRAITS(unsigned long, Unsigned, ValueUnsigned, UInt64);
+	GD_STRING_FORMAT_ARGUMENT_TRAITS(unsigned long long, Unsigned, ValueUnsigned, UInt64);
+	GD_STRING_FORMAT_ARGUMENT_TRAITS(float, Float32, ValueFloat32, Float32);
+	GD_STRING_FORMAT_ARGUMENT_TRAITS(double, Float64, ValueFloat64, Float64);
+	GD_STRING_FORMAT_ARGUMENT_TRAITS(bool, Bool, ValueBool, bool);
+	GD_STRING_FORMAT_ARGUMENT_TRAITS(void*, Pointer, ValuePointer, void const*);
+	GD_STRING_FORMAT_ARGUMENT_TRAITS(void const*, Pointer, ValuePointer, void const*);
+	GD_STRING_FORMAT_ARGUMENT_TRAITS(decltype(nullptr), Pointer, ValuePointer, void const*);
+
+#undef GD_STRING_FORMAT_ARGUMENT_TRAITS
+
+	/*!
+	 * Characters are formatted as is, narrow characters are also accepted by the wide format strings.
+	 */
+	//! @{
+	template<typename TChar, typename TValue>
+	struct StringFormatCharacterArgumentTraits : public TNonCreatable
+	{
+		StringFormatArgumentType static constexpr Type = StringFormatArgumentType::Character;
+		GDINL static BaseStringFormatArgument<TChar> Make(TValue const value)
+		{
+			BaseStringFormatArgument<TChar> argument;
+			argument.Type = Type;
+			argument.ValueCharacter = static_cast<TChar>(value);
+			return argument;
+		}
+	};	// struct StringFormatCharacterArgumentTraits
+	template<>
+	struct StringFormatArgumentTraits<Char, Char> final : public StringFormatCharacterArgumentTraits<Char, Char> {};
+	template<>
+	struct StringFormatArgumentTraits<WideChar, WideChar> final : public StringFormatCharacterArgumentTraits<WideChar, WideChar> {};
+	template<>
+	struct StringFormatArgumentTraits<WideChar, Char> final : public StringFormatCharacterArgumentTraits<WideChar, Char> {};
+	//! @}
+
+	/*!
+	 * Strings of the same character type as the format string.
+	 */
+	//! @{
+	template<typename TChar>
+	struct StringFormatStringArgumentTraits : public TNonCreatable
+	{
+		StringFormatArgumentType static constexpr Type = StringFormatArgumentType::String;
+		GDINL static BaseStringFormatArgument<TChar> Make(BaseStringView<TChar> const value)
+		{
+			BaseStringFormatArgument<TChar> argument;
+			argument.Type = Type;
+			argument.ValueString.Text = value.GetData();
+			argument.ValueString.Length = value.GetLength();
+			return argument;
+		}
+	};	// struct StringFormatStringArgumentTraits
+	template<typename TChar>
+	struct StringFormatArgumentTraits<TChar, TChar*> final : public StringFormatStringArgumentTraits<TChar> {};
+	template<typename TChar>
+	struct StringFormatArgumentTraits<TChar, TChar const*> final : public StringFormatStringArgumentTraits<TChar> {};
+	template<typename TChar, SizeTp TLength>
+	struct StringFormatArgumentTraits<TChar, TChar[TLength]> final : public StringFormatStringArgumentTraits<TChar> {};
+	template<typename TChar, SizeTp TInlineLength>
+	struct StringFormatArgumentTraits<TChar, BaseString<TChar, TInlineLength>> final : public StringFormatStringArgumentTraits<TChar> {};
+	template<typename TChar>
+	struct StringFormatArgumentTraits<TChar, BaseStringView<TChar>> final : public StringFormatStringArgumentTraits<TChar> {};
+	//! @}
+
+	/*!
+	 * List of the argument types, terminated with the unknown type.
+	 * @tparam TChar character type of the format string.
+	 * @tparam TArgs types of the formatted values.
+	 */
+	template<typename TChar, typename... TArgs>
+	struct StringFormatArgumentTypes final : public TNonCreatable
+	{
+		StringFormatArgumentType static constexpr Values[sizeof...(TArgs) + 1] = { StringFormatArgumentTraits<TChar, TArgs>::Type..., StringFormatArgumentType::Unknown };
+	};	// struct StringFormatArgumentTypes
+	template<typename TChar, typename... TArgs>
+	StringFormatArgumentType constexpr StringFormatArgumentTypes<TChar, TArgs...>::Values[sizeof...(TArgs) + 1];
+
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+	// ******                                  Format sinks.                                   ******
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+
+	// Formatting writes into any sink with the 'Append(TChar const* text, SizeTp textLength)' method, 
+	// e.g. the string builder, the fixed buffer or the output stream below.
+
+	// **------------------------------------------------------------------------------------------**
+	//! Formatting sink, that writes into the fixed caller-provided buffer, e.g. on the stack.
+	//! Text, that does not fit, is truncated. Buffer is always null-terminated.
+	//! @tparam TChar character type of the buffer.
+	// **------------------------------------------------------------------------------------------**
+	template<typename TChar>
+	class BaseStringFormatBuffer final : public TNonCopyable
+	{
+	private:
+		TChar* m_Buffer;
+		SizeTp m_Capacity;
+		SizeTp m_Length;
+		bool   m_IsTruncated;
+
+	public:
+
+		/*!
+		 * Initializes an empty formatting buffer.
+		 *
+		 * @param buffer The destination buffer.
+		 * @param bufferLength Length of the destination buffer, including the null-terminator.
+		 */
+		//! @{
+		GDINL BaseStringFormatBuffer(TChar* const buffer, SizeTp const bufferLength)
+			: m_Buffer(buffer), m_Capacity(bufferLength - 1), m_Length(0), m_IsTruncated(false)
+		{
+			GD_ASSERT(buffer != nullptr && bufferLength != 0, "Empty buffer specified.");
+			m_Buffer[0] = GD_TEXT(TChar, '\0');
+		}
+		template<SizeTp TLength>
+		GDINL explicit BaseStringFormatBuffer(TChar(&buffer)[TLength])
+			: BaseStringFormatBuffer(buffer, TLength)
+		{
+		}
+		//! @}
+
+	public:
+
+		/*!
+		 * Returns the formatted null-terminated text.
+		 */
+		GDINL TChar const* CStr() const
+		{
+			return m_Buffer;
+		}
+
+		/*!
+		 * Returns length of the formatted text.
+		 */
+		GDINL SizeTp GetLength() const
+		{
+			return m_Length;
+		}
+
+		/*!
+		 * Returns true if some text did not fit into the buffer.
+		 */
+		GDINL bool IsTruncated() const
+		{
+			return m_IsTruncated;
+		}
+
+		/*!
+		 * Returns view on the formatted text.
+		 */
+		GDINL BaseStringView<TChar> GetView() const
+		{
+			return BaseStringView<TChar>(m_Buffer, m_Length);
+		}
+
+		/*!
+		 * Appends specified text to this buffer.
+		 *
+		 * @param text Text to append.
+		 * @param textLength Length of text to append.
+		 */
+		GDINL BaseStringFormatBuffer& Append(TChar const* const text, SizeTp const textLength)
+		{
+			auto appendLength = textLength;
+			if (appendLength > m_Capacity - m_Length)
+			{
+				appendLength = m_Capacity - m_Length;
+				m_IsTruncated = true;
+			}
+			CMemory::Memcpy(m_Buffer + m_Length, text, appendLength * sizeof(TChar));
+			m_Length += appendLength;
+			m_Buffer[m_Length] = GD_TEXT(TChar, '\0');
+			return *this;
+		}
+	};	// class BaseStringFormatBuffer
+
+	using StringFormatBuffer = BaseStringFormatBuffer<Char>;
+	using WideStringFormatBuffer = BaseStringFormatBuffer<WideChar>;
+
+	// **------------------------------------------------------------------------------------------**
+	//! Formatting sink, that counts the formatted characters.
+	//! @tparam TChar character type of the format string.
+	// **------------------------------------------------------------------------------------------**
+	template<typename TChar>
+	class BaseStringFormatCounter final
+	{
+	private:
+		SizeTp m_Length = 0;
+
+	public:
+
+		/*!
+		 * Returns number of the formatted characters.
+		 */
+		GDINL SizeTp GetLength() const
+		{
+			return m_Length;
+		}
+
+		/*!
+		 * Counts the specified text.
+		 *
+		 * @param text Text to append.
+		 * @param textLength Length of text to append.
+		 */
+		GDINL BaseStringFormatCounter& Append(TChar const* const text, SizeTp const textLength)
+		{
+			GD_NOT_USED(text);
+			m_Length += textLength;
+			return *this;
+		}
+	};	// class BaseStringFormatCounter
+
+	// **------------------------------------------------------------------------------------------**
+	//! Formatting sink, that writes into the output stream through the small internal buffer.
+	//! Buffered text is written, when the buffer is full, on flush and on destruction.
+	// **------------------------------------------------------------------------------------------**
+	class StringFormatStream final : public TNonCopyable
+	{
+	public:
+		SizeTp static const BufferLength = 256;
+
+	private:
+		OutputStream& m_Stream;
+		SizeTp        m_Length;
+		Char          m_Buffer[BufferLength];
+
+	public:
+
+		/*!
+		 * Initializes the formatting sink.
+		 * @param stream The stream to write into.
+		 */
+		GDINL explicit StringFormatStream(OutputStream& stream)
+			: m_Stream(stream), m_Length(0)
+		{
+		}
+
+		GDINL ~StringFormatStream()
+		{
+			Flush();
+		}
+
+	public:
+
+		/*!
+		 * Appends specified text to this stream.
+		 *
+		 * @param text Text to append.
+		 * @param textLength Length of text to append.
+		 */
+		GDINL StringFormatStream& Append(Char const* const text, SizeTp const textLength)
+		{
+			if (textLength <= BufferLength - m_Length)
+			{
+				CMemory::Memcpy(m_Buffer + m_Length, text, textLength);
+				m_Length += textLength;
+			}
+			else
+			{
+				AppendSlow(text, textLength);
+			}
+			return *this;
+		}
+
+		/*!
+		 * Writes the buffered text into the stream.
+		 */
+		GDAPI void Flush();
+
+	private:
+		GDAPI void AppendSlow(Char const* const text, SizeTp const textLength);
+	};	// class StringFormatStream
+
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+	// ******                                StringFormat class.                               ******
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+
+	/*!
+	 * Base class of the format string literals, that are checked at compile time.
+	 * @see GD_FORMAT
+	 */
+	struct StringFormatLiteral
+	{
+	};	// struct StringFormatLiteral
+
+	/*!
+	 * Wraps the format string literal, so that the format string and the argument types are 
+	 * checked at compile time, e.g. 'StringFormat::Format(GD_FORMAT("{} of {}"), index, count)'.
+	 * @param format The format string literal.
+	 */
+#define GD_FORMAT(format) \
+	([] \
+	{ \
+		struct FormatLiteral final : public GD::StringFormatLiteral \
+		{ \
+			GDINL static constexpr decltype(&*(format)) Get() \
+			{ \
+				return format; \
+			} \
+		}; \
+		return FormatLiteral(); \
+	}())
+
+	// **------------------------------------------------------------------------------------------**
+	//! Type-safe string formatting.
+	//! 
+	//! Each '{}' placeholder of the format string is replaced with the next argument, '{{' and '}}' 
+	//! are replaced with the braces. Placeholders could contain the specification after the colon:
+	//! '{:[[fill]align][0][width][.precision][x|X]}', where the alignment is '<', '>' or '^'. 
+	//! Numbers are right-aligned by default and '0' pads them with zeros after the sign. Precision 
+	//! is the number of the fractional digits for floating point numbers and the maximum length 
+	//! for strings. Fractional digits are rounded from the exact value half to even, like printf 
+	//! does. 'x' and 'X' write integers and pointers in the hexadecimal notation.
+	//! Floating point numbers are written in the shortest form, that is parsed back to the same value.
+	// **------------------------------------------------------------------------------------------**
+	class StringFormat final : public TNonCreatable
+	{
+	private:
+		template<typename TChar>
+		struct FormatSpec final
+		{
+			TChar  Fill;
+			TChar  Align;
+			bool   ZeroPad;
+			bool   Hex;
+			bool   UpperCase;
+			SizeTp Width;
+			SizeTp Precision;
+
+		public:
+			GDINL constexpr FormatSpec()
+				: Fill(' '), Align('\0'), ZeroPad(false), Hex(false), UpperCase(false), Width(0), Precision(SizeTpMax)
+			{
+			}
+		};	// struct FormatSpec
+
+		template<typename TChar>
+		struct FormatPiece final
+		{
+			TChar const* Text;
+			SizeTp       Length;
+		};	// struct FormatPiece
+
+		// Enough for the sign, prefix and digits of integers and the shortest floating point numbers.
+		SizeTp static const FormatBufferLength = 32;
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Format string validation.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Parses the specification of the placeholder.
+		 *
+		 * @param format Pointer after the opening brace. Is advanced after the closing brace.
+		 * @param spec Parsed specification.
+		 *
+		 * @returns True if the specification is valid.
+		 */
+		template<typename TChar>
+		GDINL static constexpr bool ParseSpec(TChar const*& format, FormatSpec<TChar>& spec)
+		{
+			if (*format == ':')
+			{
+				++format;
+				if (format[0] != '\0' && format[0] != '{' && format[0] != '}' && IsAlign(format[1]))
+				{
+					spec.Fill = format[0];
+					spec.Align = format[1];
+					format += 2;
+				}
+				else if (IsAlign(format[0]))
+				{
+					spec.Align = format[0];
+					++format;
+				}
+				if (*format == '0')
+				{
+					spec.ZeroPad = true;
+					++format;
+				}
+				for (; *format >= '0' && *format <= '9'; ++format)
+				{
+					spec.Width = spec.Width * 10 + static_cast<SizeTp>(*format - '0');
+				}
+				if (*format == '.')
+				{
+					++format;
+					if (*format < '0' || *format > '9')
+					{
+						return false;
+					}
+					for (spec.Precision = 0; *format >= '0' && *format <= '9'; ++format)
+					{
+						spec.Precision = spec.Precision * 10 + static_cast<SizeTp>(*format - '0');
+					}
+				}
+				if (*format == 'x' || *format == 'X')
+				{
+					spec.Hex = true;
+					spec.UpperCase = *format == 'X';
+					++format;
+				}
+			}
+			if (*format != '}')
+			{
+				return false;
+			}
+			++format;
+			return true;
+		}
+
+		/*!
+		 * Returns true if the specification could be applied to the argument of the specified type.
+		 */
+		template<typename TChar>
+		GDINL static constexpr bool IsSpecCompatible(FormatSpec<TChar> const& spec, StringFormatArgumentType const type)
+		{
+			return type != StringFormatArgumentType::Unknown
+				&& (!spec.Hex || type == StringFormatArgumentType::Signed || type == StringFormatArgumentType::Unsigned || type == StringFormatArgumentType::Pointer)
+				&& (spec.Precision == SizeTpMax || type == StringFormatArgumentType::Float32 || type == StringFormatArgumentType::Float64 || type == StringFormatArgumentType::String);
+		}
+
+		/*!
+		 * Checks the format string against the types of the arguments.
+		 *
+		 * @param format The format string.
+		 * @param types Types of the arguments.
+		 * @param typesCount Number of the arguments.
+		 *
+		 * @returns True if the format string is valid and has a placeholder for each argument.
+		 */
+		template<typename TChar>
+		GDINL static constexpr bool Validate(TChar const* format, StringFormatArgumentType const* const types, SizeTp const typesCount)
+		{
+			SizeTp index = 0;
+			while (*format != '\0')
+			{
+				if (format[0] == '{' && format[1] != '{')
+				{
+					++format;
+					FormatSpec<TChar> spec;
+					if (!ParseSpec(format, spec) || index >= typesCount || !IsSpecCompatible(spec, types[index]))
+					{
+						return false;
+					}
+					++index;
+				}
+				else if (format[0] == '{' || format[0] == '}')
+				{
+					if (format[1] != format[0])
+					{
+						return false;
+					}
+					format += 2;
+				}
+				else
+				{
+					++format;
+				}
+			}
+			return index == typesCount;
+		}
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Formatting.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Formats the arguments into the sink.
+		 *
+		 * @param sink The sink to write into, e.g. string builder or the format buffer.
+		 * @param format The format string, wrapped with the 'GD_FORMAT' macro for compile-time checks.
+		 * @param args Format arguments.
+		 */
+		//! @{
+		template<typename TSink, typename TFormat, typename... TArgs>
+		GDINL static typename EnableIf<TypeTraits::IsBase<StringFormatLiteral, TFormat>::Value>::Type FormatTo(TSink& sink, TFormat const format, TArgs const&... args)
+		{
+			using TChar = TypeTraits::RemoveConst<TypeTraits::RemovePointer<decltype(TFormat::Get())>>;
+			static_assert(Validate(TFormat::Get(), StringFormatArgumentTypes<TChar, TArgs...>::Values, sizeof...(TArgs)), "Invalid format string or argument types.");
+			GD_NOT_USED(format);
+			FormatTo(sink, TFormat::Get(), args...);
+		}
+		template<typename TSink, typename TChar, typename... TArgs>
+		GDINL static void FormatTo(TSink& sink, TChar const* const format, TArgs const&... args)
+		{
+			BaseStringFormatArgument<TChar> const arguments[sizeof...(TArgs) + 1] = { StringFormatArgumentTraits<TChar, TArgs>::Make(args)..., BaseStringFormatArgument<TChar>() };
+			FormatArguments(sink, format, arguments, sizeof...(TArgs));
+		}
+		//! @}
+
+		/*!
+		 * Formats the arguments into the new string.
+		 *
+		 * @param format The format string, wrapped with the 'GD_FORMAT' macro for compile-time checks.
+		 * @param args Format arguments.
+		 */
+		//! @{
+		template<typename TFormat, typename... TArgs>
+		GDINL static auto Format(TFormat const format, TArgs const&... args) -> typename EnableIf<TypeTraits::IsBase<StringFormatLiteral, TFormat>::Value, BaseString<TypeTraits::RemoveConst<TypeTraits::RemovePointer<decltype(TFormat::Get())>>>>::Type
+		{
+			using TChar = TypeTraits::RemoveConst<TypeTraits::RemovePointer<decltype(TFormat::Get())>>;
+			static_assert(Validate(TFormat::Get(), StringFormatArgumentTypes<TChar, TArgs...>::Values, sizeof...(TArgs)), "Invalid format string or argument types.");
+			GD_NOT_USED(format);
+			return Format(TFormat::Get(), args...);
+		}
+		template<typename TChar, typename... TArgs>
+		GDINL static BaseString<TChar> Format(TChar const* const format, TArgs const&... args)
+		{
+			BaseStringFormatArgument<TChar> const arguments[sizeof...(TArgs) + 1] = { StringFormatArgumentTraits<TChar, TArgs>::Make(args)..., BaseStringFormatArgument<TChar>() };
+			return FormatArgumentsToString(format, arguments, sizeof...(TArgs));
+		}
+		//! @}
+
+	private:
+
+		// ------------------------------------------------------------------------------------------
+		// Formatting implementation.
+		// ------------------------------------------------------------------------------------------
+
+		template<typename TChar>
+		GDINL static constexpr bool IsAlign(TChar const character)
+		{
+			return character == '<' || character == '>' || character == '^';
+		}
+
+		/*!
+		 * Formats the type-erased arguments into the new string with a single allocation.
+		 */
+		template<typename TChar>
+		GDINL static BaseString<TChar> FormatArgumentsToString(TChar const* const format, BaseStringFormatArgument<TChar> const* const arguments, SizeTp const argumentsCount)
+		{
+			// Short strings are formatted on the stack, long ones are measured first.
+			TChar buffer[256];
+			BaseStringFormatBuffer<TChar> bufferSink(buffer);
+			FormatArguments(bufferSink, format, arguments, argumentsCount);
+			if (!bufferSink.IsTruncated())
+			{
+				return BaseString<TChar>(bufferSink.CStr(), bufferSink.GetLength());
+			}
+
+			BaseStringFormatCounter<TChar> counterSink;
+			FormatArguments(counterSink, format, arguments, argumentsCount);
+			BaseString<TChar> result(counterSink.GetLength());
+			BaseStringFormatBuffer<TChar> resultSink(result.CStr(), result.GetLength() + 1);
+			FormatArguments(resultSink, format, arguments, argumentsCount);
+			return result;
+		}
+
+		/*!
+		 * Formats the type-erased arguments into the sink.
+		 */
+		template<typename TSink, typename TChar>
+		GDINL static void FormatArguments(TSink& sink, TChar const* format, BaseStringFormatArgument<TChar> const* const arguments, SizeTp const argumentsCount)
+		{
+			SizeTp argumentIndex = 0;
+			for (;;)
+			{
+				auto const text = format;
+				while (*format != '\0' && *format != '{' && *format != '}')
+				{
+					++format;
+				}
+				if (format != text)
+				{
+					sink.Append(text, static_cast<SizeTp>(format - text));
+				}
+				if (*format == '\0')
+				{
+					break;
+				}
+				if (format[0] == format[1])
+				{
+					// Escaped brace.
+					sink.Append(format, 1);
+					format += 2;
+					continue;
+				}
+				if (*format == '}')
+				{
+					GD_ASSERT_FALSE("Unmatched closing brace in the format string.");
+					return;
+				}
+
+				++format;
+				FormatSpec<TChar> spec;
+				if (!ParseSpec(format, spec) || argumentIndex >= argumentsCount)
+				{
+					GD_ASSERT_FALSE("Invalid placeholder or not enough arguments for the format string.");
+					return;
+				}
+				GD_ASSERT(IsSpecCompatible(spec, arguments[argumentIndex].Type), "Format specification does not match the argument type.");
+				FormatArgument(sink, spec, arguments[argumentIndex++]);
+			}
+			GD_ASSERT(argumentIndex == argumentsCount, "Too many arguments for the format string.");
+		}
+
+		/*!
+		 * Appends the specified number of the same characters.
+		 */
+		template<typename TSink, typename TChar>
+		GDINL static void AppendRepeated(TSink& sink, TChar const character, SizeTp count)
+		{
+			if (count != 0)
+			{
+				TChar run[16];
+				for (auto& runCharacter : run)
+				{
+					runCharacter = character;
+				}
+				for (; count > GD::GetLength(run); count -= GD::GetLength(run))
+				{
+					sink.Append(run, GD::GetLength(run));
+				}
+				sink.Append(run, count);
+			}
+		}
+
+		/*!
+		 * Appends the prefix and the body pieces of the formatted value with the padding.
+		 * Pieces without text are runs of zeros.
+		 */
+		template<typename TSink, typename TChar>
+		GDINL static void AppendPieces(TSink& sink, FormatSpec<TChar> const& spec, TChar const* const buffer, SizeTp const prefixLength, FormatPiece<TChar> const* const pieces, SizeTp const piecesCount, bool const isNumeric)
+		{
+			auto length = prefixLength;
+			for (SizeTp cnt = 0; cnt < piecesCount; ++cnt)
+			{
+				length += pieces[cnt].Length;
+			}
+			auto const padding = spec.Width > length ? spec.Width - length : 0;
+			auto const zeroPadding = isNumeric && spec.ZeroPad && spec.Align == '\0' ? padding : 0;
+			auto const align = spec.Align != '\0' ? spec.Align : isNumeric ? '>' : '<';
+			auto const leftPadding = zeroPadding != 0 ? 0 : align == '>' ? padding : align == '^' ? padding / 2 : 0;
+			auto const rightPadding = padding - zeroPadding - leftPadding;
+
+			AppendRepeated(sink, spec.Fill, leftPadding);
+			if (prefixLength != 0)
+			{
+				sink.Append(buffer, prefixLength);
+			}
+			AppendRepeated(sink, static_cast<TChar>('0'), zeroPadding);
+			for (SizeTp cnt = 0; cnt < piecesCount; ++cnt)
+			{
+				if (pieces[cnt].Text != nullptr)
+				{
+					sink.Append(pieces[cnt].Text, pieces[cnt].Length);
+				}
+				else
+				{
+					AppendRepeated(sink, static_cast<TChar>('0'), pieces[cnt].Length);
+				}
+			}
+			AppendRepeated(sink, spec.Fill, rightPadding);
+		}
+
+		/*!
+		 * Formats the floating point number with the fixed number of the fractional digits into the sink.
+		 * Never inlined, so that only these numbers need the stack for all digits of the value.
+		 */
+		template<typename TSink, typename TChar>
+		GD_NOINLINE static void FormatFixed(TSink& sink, FormatSpec<TChar> const& spec, TChar* const buffer, SizeTp const prefixLength, Float64 const value)
+		{
+			// Digits are written into the separate buffer, the point and the leading zero follow the prefix.
+			TChar digits[CFormat::MaxFixedDigitsLength];
+			auto const precision = spec.Precision;
+			Int32 exponent;
+			auto const length = static_cast<Int32>(CFormat::GetFixedDecimal(digits, value, precision, exponent));
+			auto const point = buffer + prefixLength;
+			point[0] = '0';
+			point[1] = '.';
+
+			auto const integralLength = length + exponent;
+			FormatPiece<TChar> pieces[4];
+			SizeTp count = 0;
+			if (exponent >= 0)
+			{
+				pieces[count++] = { digits, static_cast<SizeTp>(length) };
+				pieces[count++] = { nullptr, static_cast<SizeTp>(exponent) };
+				if (precision != 0)
+				{
+					pieces[count++] = { point + 1, 1 };
+					pieces[count++] = { nullptr, precision };
+				}
+			}
+			else if (integralLength > 0)
+			{
+				pieces[count++] = { digits, static_cast<SizeTp>(integralLength) };
+				pieces[count++] = { point + 1, 1 };
+				pieces[count++] = { digits + integralLength, static_cast<SizeTp>(-exponent) };
+				pieces[count++] = { nullptr, precision - static_cast<SizeTp>(-exponent) };
+			}
+			else
+			{
+				pieces[count++] = { point, 2 };
+				pieces[count++] = { nullptr, static_cast<SizeTp>(-integralLength) };
+				pieces[count++] = { digits, static_cast<SizeTp>(length) };
+				pieces[count++] = { nullptr, precision - static_cast<SizeTp>(-exponent) };
+			}
+			AppendPieces(sink, spec, buffer, prefixLength, pieces, count, true);
+		}
+
+		/*!
+		 * Formats the single type-erased argument into the sink.
+		 */
+		template<typename TSink, typename TChar>
+		GDINL static void FormatArgument(TSink& sink, FormatSpec<TChar> const& spec, BaseStringFormatArgument<TChar> const& argument)
+		{
+			// Formatted value consists of the sign or prefix, that precedes the zero padding, and the body pieces.
+			// Pieces without text are runs of zeros.
+			TChar buffer[FormatBufferLength];
+			SizeTp prefixLength = 0;
+			FormatPiece<TChar> pieces[4];
+			SizeTp piecesCount = 0;
+			auto isNumeric = true;
+			switch (argument.Type)
+			{
+				case StringFormatArgumentType::Signed:
+				case StringFormatArgumentType::Unsigned:
+				case StringFormatArgumentType::Pointer:
+				{
+					auto magnitude = argument.Type == StringFormatArgumentType::Pointer ? reinterpret_cast<UIntPtr>(argument.ValuePointer) : argument.ValueUnsigned;
+					if (argument.Type == StringFormatArgumentType::Signed && argument.ValueSigned < 0)
+					{
+						buffer[prefixLength++] = '-';
+						magnitude = 0 - magnitude;
+					}
+					if (argument.Type == StringFormatArgumentType::Pointer)
+					{
+						buffer[prefixLength++] = '0';
+						buffer[prefixLength++] = 'x';
+					}
+					auto const digits = buffer + prefixLength;
+					auto const length = spec.Hex || argument.Type == StringFormatArgumentType::Pointer 
+						? CFormat::FormatUInt64Hex(digits, magnitude, spec.UpperCase) : CFormat::FormatUInt64(digits, magnitude);
+					pieces[piecesCount++] = { digits, length };
+				} break;
+
+				case StringFormatArgumentType::Float32:
+				case StringFormatArgumentType::Float64:
+				{
+					auto const isFloat32 = argument.Type == StringFormatArgumentType::Float32;
+					auto const value = isFloat32 ? static_cast<Float64>(argument.ValueFloat32) : argument.ValueFloat64;
+					if (value < 0.0 || (value == 0.0 && 1.0 / value < 0.0))
+					{
+						buffer[prefixLength++] = '-';
+					}
+					if (spec.Precision != SizeTpMax && value - value == 0.0)
+					{
+						FormatFixed(sink, spec, buffer, prefixLength, value);
+						return;
+					}
+					else
+					{
+						// Sign is written again and skipped, so that it precedes the zero padding.
+						auto const length = isFloat32 ? CFormat::FormatFloat32(buffer, argument.ValueFloat32) : CFormat::FormatFloat64(buffer, argument.ValueFloat64);
+						pieces[piecesCount++] = { buffer + prefixLength, length - prefixLength };
+					}
+				} break;
+
+				case StringFormatArgumentType::Bool:
+					isNumeric = false;
+					pieces[piecesCount++] = argument.ValueBool ? FormatPiece<TChar>{ GD_TEXT(TChar, "true"), 4 } : FormatPiece<TChar>{ GD_TEXT(TChar, "false"), 5 };
+					break;
+
+				case StringFormatArgumentType::Character:
+					isNumeric = false;
+					pieces[piecesCount++] = { &argument.ValueCharacter, 1 };
+					break;
+
+				case StringFormatArgumentType::String:
+					isNumeric = false;
+					pieces[piecesCount++] = { argument.ValueString.Text, argument.ValueString.Length < spec.Precision ? argument.ValueString.Length : spec.Precision };
+					break;
+
+				default:
+					GD_ASSERT_FALSE("Invalid argument type.");
+			}
+
+			AppendPieces(sink, spec, buffer, prefixLength, pieces, piecesCount, isNumeric);
+		}
+	};	// class StringFormat
+
+GD_NAMESPACE_END
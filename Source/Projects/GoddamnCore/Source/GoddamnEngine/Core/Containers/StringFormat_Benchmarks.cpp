@@ -0,0 +1,123 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/Containers/StringFormat_Benchmarks.cpp
+ * Type-safe string formatting benchmarks against the C library.
+ */
+#include <GoddamnEngine/Core/Containers/StringFormat.h>
+#include <GoddamnEngine/Core/Containers/StringBuilder.h>
+#include <GoddamnEngine/Core/Containers/Vector.h>
+
+#include <cstdio>
+
+GD_NAMESPACE_BEGIN
+
+#if GD_TESTING_ENABLED
+
+	SizeTp static const StringFormatBenchmarkCount = 100000;
+
+	// Keeps results of the benchmarks, so that computations are not optimized away.
+	static UInt64 volatile g_StringFormatBenchmarkSink;
+
+	// Generates random integers of all lengths and random floating point numbers of all magnitudes.
+	GDINL static void GenerateStringFormatBenchmarkValues(Vector<Int64>& integers, Vector<Float64>& floats)
+	{
+		UInt64 random = 1;
+		for (SizeTp cnt = 0; cnt < StringFormatBenchmarkCount; ++cnt)
+		{
+			random = random * 6364136223846793005u + 1442695040888963407u;
+			integers.InsertLast(static_cast<Int64>(random >> (random % 64)));
+			floats.InsertLast(static_cast<Float64>(random >> 11) / static_cast<Float64>(UInt64(1) << (random % 64)));
+		}
+	}
+
+	// Measures a case, that formats each of the benchmark values.
+	template<typename TFunc>
+	GDINL static void MeasureStringFormat(goddamn_testing::benchmark_state& state, char const* const caseName, TFunc const& caseFunction)
+	{
+		state.measure(caseName, StringFormatBenchmarkCount, [&]
+		{
+			for (SizeTp cnt = 0; cnt < StringFormatBenchmarkCount; ++cnt)
+			{
+				g_StringFormatBenchmarkSink = g_StringFormatBenchmarkSink + static_cast<UInt64>(caseFunction(cnt));
+			}
+		});
+	}
+
+	gd_testing_benchmark(StringFormatIntegers, state)
+	{
+		Vector<Int64> integers;
+		Vector<Float64> floats;
+		GenerateStringFormatBenchmarkValues(integers, floats);
+
+		Char buffer[64];
+		MeasureStringFormat(state, "snprintf %lld", [&](SizeTp const index) { return ::snprintf(buffer, sizeof buffer, "%lld", static_cast<long long>(integers[index])); });
+		MeasureStringFormat(state, "CFormat::FormatInt64", [&](SizeTp const index) { return CFormat::FormatInt64(buffer, integers[index]); });
+		MeasureStringFormat(state, "String::FromInt64", [&](SizeTp const index) { return String::FromInt64(integers[index]).GetLength(); });
+	};
+
+	gd_testing_benchmark(StringFormatFloats, state)
+	{
+		Vector<Int64> integers;
+		Vector<Float64> floats;
+		GenerateStringFormatBenchmarkValues(integers, floats);
+
+		// '%.17g' is the shortest C library format, that always round-trips.
+		Char buffer[64];
+		MeasureStringFormat(state, "snprintf %.17g", [&](SizeTp const index) { return ::snprintf(buffer, sizeof buffer, "%.17g", floats[index]); });
+		MeasureStringFormat(state, "snprintf %f", [&](SizeTp const index) { return ::snprintf(buffer, sizeof buffer, "%f", floats[index]); });
+		MeasureStringFormat(state, "CFormat::FormatFloat64", [&](SizeTp const index) { return CFormat::FormatFloat64(buffer, floats[index]); });
+		MeasureStringFormat(state, "String::FromFloat64", [&](SizeTp const index) { return String::FromFloat64(floats[index]).GetLength(); });
+	};
+
+	gd_testing_benchmark(StringFormatMessages, state)
+	{
+		Vector<Int64> integers;
+		Vector<Float64> floats;
+		GenerateStringFormatBenchmarkValues(integers, floats);
+
+		// Typical log message.
+		Char buffer[256];
+		MeasureStringFormat(state, "snprintf", [&](SizeTp const index)
+		{
+			return ::snprintf(buffer, sizeof buffer, "Entity %lld at %.17g is %s", static_cast<long long>(integers[index]), floats[index], "visible");
+		});
+		MeasureStringFormat(state, "String::Format", [&](SizeTp const index)
+		{
+			return String::Format("Entity %lld at %.17g is %s", static_cast<long long>(integers[index]), floats[index], "visible").GetLength();
+		});
+		MeasureStringFormat(state, "StringFormat::FormatTo (buffer)", [&](SizeTp const index)
+		{
+			StringFormatBuffer bufferSink(buffer);
+			StringFormat::FormatTo(bufferSink, GD_FORMAT("Entity {} at {} is {}"), integers[index], floats[index], "visible");
+			return bufferSink.GetLength();
+		});
+		MeasureStringFormat(state, "StringFormat::Format", [&](SizeTp const index)
+		{
+			return StringFormat::Format(GD_FORMAT("Entity {} at {} is {}"), integers[index], floats[index], "visible").GetLength();
+		});
+
+		// Writing into the same builder.
+		StringBuilder builder;
+		MeasureStringFormat(state, "StringBuilder::AppendFormat", [&](SizeTp const index)
+		{
+			builder.AppendFormat("Entity %lld at %.17g is %s\n", static_cast<long long>(integers[index]), floats[index], "visible");
+			return builder.GetLength();
+		});
+		builder = StringBuilder();
+		MeasureStringFormat(state, "StringFormat::FormatTo (builder)", [&](SizeTp const index)
+		{
+			StringFormat::FormatTo(builder, GD_FORMAT("Entity {} at {} is {}\n"), integers[index], floats[index], "visible");
+			return builder.GetLength();
+		});
+	};
+
+#endif	// if GD_TESTING_ENABLED
+
+GD_NAMESPACE_END
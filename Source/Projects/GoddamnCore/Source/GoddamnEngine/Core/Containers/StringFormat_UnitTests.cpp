@@ -0,0 +1,133 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/Containers/StringFormat_UnitTests.cpp
+ * Type-safe string formatting tests.
+ */
+#include <GoddamnEngine/Core/Containers/StringFormat.h>
+#include <GoddamnEngine/Core/Containers/StringBuilder.h>
+#include <GoddamnEngine/Core/IO/MemoryStream.h>
+#if GD_TESTING_ENABLED
+
+GD_NAMESPACE_BEGIN
+
+	// Format strings are validated at compile time.
+	static_assert(StringFormat::Validate("{} of {:>4}", StringFormatArgumentTypes<Char, int, unsigned>::Values, 2), "Valid format string.");
+	static_assert(StringFormat::Validate("{{{}}}", StringFormatArgumentTypes<Char, Char const*>::Values, 1), "Escaped braces.");
+	static_assert(!StringFormat::Validate("{} of {}", StringFormatArgumentTypes<Char, int>::Values, 1), "Not enough arguments.");
+	static_assert(!StringFormat::Validate("{}", StringFormatArgumentTypes<Char, int, int>::Values, 2), "Too many arguments.");
+	static_assert(!StringFormat::Validate("{:x}", StringFormatArgumentTypes<Char, double>::Values, 1), "Hexadecimal floating point number.");
+	static_assert(!StringFormat::Validate("{:.2}", StringFormatArgumentTypes<Char, int>::Values, 1), "Precision of the integer.");
+	static_assert(!StringFormat::Validate("{:>4", StringFormatArgumentTypes<Char, int>::Values, 1), "Unterminated placeholder.");
+	static_assert(!StringFormat::Validate("}", StringFormatArgumentTypes<Char>::Values, 0), "Unmatched closing brace.");
+
+	gd_testing_unit_test(StringFormatArguments)
+	{
+		gd_testing_verify(StringFormat::Format(GD_FORMAT("plain text")) == "plain text");
+		gd_testing_verify(StringFormat::Format(GD_FORMAT("{{{}}}"), 1) == "{1}");
+		gd_testing_verify(StringFormat::Format(GD_FORMAT("{} {} {} {}"), -3, 10u, Int64Min, UInt64Max) == "-3 10 -9223372036854775808 18446744073709551615");
+		gd_testing_verify(StringFormat::Format(GD_FORMAT("{} {} {}"), 0.5f, 0.1, -1e100) == "0.5 0.1 -1e+100");
+		gd_testing_verify(StringFormat::Format(GD_FORMAT("{} {} {}"), true, false, 'c') == "true false c");
+		gd_testing_verify(StringFormat::Format(GD_FORMAT("{}-{}-{}"), "literal", String("string"), StringView("view")) == "literal-string-view");
+		gd_testing_verify(StringFormat::Format(GD_FORMAT("{} {:X}"), reinterpret_cast<void const*>(0xBEEF), reinterpret_cast<void*>(0xBEEF)) == "0xbeef 0xBEEF");
+		gd_testing_verify(StringFormat::Format(GD_FORMAT("{}"), nullptr) == "0x0");
+		gd_testing_verify(StringFormat::Format(GD_FORMAT(L"{} {} {}"), L"wide", L'c', 'n') == L"wide c n");
+
+		// Runtime format strings are checked with the assertions.
+		Char const* const runtimeFormat = "{}/{}";
+		gd_testing_verify(StringFormat::Format(runtimeFormat, 1, 2) == "1/2");
+	};
+
+	gd_testing_unit_test(StringFormatSpecifications)
+	{
+		gd_testing_verify(StringFormat::Format(GD_FORMAT("[{:5}]"), 42) == "[   42]");
+		gd_testing_verify(StringFormat::Format(GD_FORMAT("[{:<5}]"), 42) == "[42   ]");
+		gd_testing_verify(StringFormat::Format(GD_FORMAT("[{:^6}]"), 42) == "[  42  ]");
+		gd_testing_verify(StringFormat::Format(GD_FORMAT("[{:*^7}]"), "ab") == "[**ab***]");
+		gd_testing_verify(StringFormat::Format(GD_FORMAT("[{:5}]"), "ab") == "[ab   ]");
+		gd_testing_verify(StringFormat::Format(GD_FORMAT("[{:05}]"), -42) == "[-0042]");
+		gd_testing_verify(StringFormat::Format(GD_FORMAT("[{:08x}]"), 0xBEEFu) == "[0000beef]");
+		gd_testing_verify(StringFormat::Format(GD_FORMAT("[{:X}]"), -255) == "[-FF]");
+		gd_testing_verify(StringFormat::Format(GD_FORMAT("[{:2}]"), 12345) == "[12345]");
+		gd_testing_verify(StringFormat::Format(GD_FORMAT("[{:.3}]"), "abcdef") == "[abc]");
+
+		// Fixed number of the fractional digits.
+		gd_testing_verify(StringFormat::Format(GD_FORMAT("{:.2}"), 3.14159) == "3.14");
+		gd_testing_verify(StringFormat::Format(GD_FORMAT("{:.0}"), 2.5) == "2");
+		gd_testing_verify(StringFormat::Format(GD_FORMAT("{:.0}"), 3.5) == "4");
+		gd_testing_verify(StringFormat::Format(GD_FORMAT("{:.3}"), 1.5f) == "1.500");
+		gd_testing_verify(StringFormat::Format(GD_FORMAT("{:.3}"), 1e3) == "1000.000");
+		gd_testing_verify(StringFormat::Format(GD_FORMAT("{:.4}"), 0.00125) == "0.0013");
+		gd_testing_verify(StringFormat::Format(GD_FORMAT("{:.2}"), 0.001) == "0.00");
+		gd_testing_verify(StringFormat::Format(GD_FORMAT("{:.2}"), 0.009) == "0.01");
+		gd_testing_verify(StringFormat::Format(GD_FORMAT("{:.1}"), 9.96) == "10.0");
+		gd_testing_verify(StringFormat::Format(GD_FORMAT("{:.1}"), -0.04) == "-0.0");
+		gd_testing_verify(StringFormat::Format(GD_FORMAT("{:08.2}"), -3.14159) == "-0003.14");
+		gd_testing_verify(StringFormat::Format(GD_FORMAT("{:.2}"), 1e20) == "100000000000000000000.00");
+		gd_testing_verify(StringFormat::Format(GD_FORMAT("{:.2}"), 1e308 * 10.0) == "inf");
+
+		// Fractional digits are rounded from the exact binary value, half to even.
+		gd_testing_verify(StringFormat::Format(GD_FORMAT("{:.2}"), 2.675) == "2.67");
+		gd_testing_verify(StringFormat::Format(GD_FORMAT("{:.2}"), 1.005) == "1.00");
+		gd_testing_verify(StringFormat::Format(GD_FORMAT("{:.2}"), 0.125) == "0.12");
+		gd_testing_verify(StringFormat::Format(GD_FORMAT("{:.2}"), 0.375) == "0.38");
+		gd_testing_verify(StringFormat::Format(GD_FORMAT("{:.2}"), 9.995) == "9.99");
+		gd_testing_verify(StringFormat::Format(GD_FORMAT("{:.2}"), 43.705) == "43.70");
+		gd_testing_verify(StringFormat::Format(GD_FORMAT("{:.2}"), 2.675f) == "2.67");
+		gd_testing_verify(StringFormat::Format(GD_FORMAT(L"{:.2}"), 0.125) == L"0.12");
+		gd_testing_verify(StringFormat::Format(GD_FORMAT("{:.20}"), 0.1) == "0.10000000000000000555");
+		gd_testing_verify(StringFormat::Format(GD_FORMAT("{:.0}"), 1.7976931348623157e308) == "179769313486231570814527423731704356798070567525844996598917476803157260780028538760589558632766878171540458953514382464234321326889464182768467546703537516986049910576551282076245490090389328944075868508455133942304583236903222948165808559332123348274797826204144723168738177180919299881250404026184124858368");
+		auto const smallest = StringFormat::Format(GD_FORMAT("{:.1074}"), 4.9406564584124654e-324);
+		gd_testing_verify(smallest.GetLength() == 1076 && smallest.StartsWith("0.0000") && smallest.EndsWith("4940656458412465441765687928682213723650598026143247644255856825006755072702087518652998363616359923797965646954457177309266567103559397963987747960107818781263007131903114045278458171678489821036887186360569987307230500063874091535649843873124733972731696151400317153853980741262385655911710266585566867681870395603106249319452715914924553293054565444011274801297099995419319894090804165633245247571478690147267801593552386115501348035264934720193790268107107491703332226844753335720832431936092382893458368060106011506169809753078342277318329247904982524730776375927247874656084778203734469699533647017972677717585125660551199131504891101451037862738167250955837389733598993664809941164205702637090279242767544565229087538682506419718265533447265625"));
+	};
+
+	gd_testing_unit_test(StringFormatSinks)
+	{
+		// Fixed buffer truncates the text.
+		Char buffer[8];
+		StringFormatBuffer bufferSink(buffer);
+		StringFormat::FormatTo(bufferSink, GD_FORMAT("{} {}"), 123, "abc");
+		gd_testing_verify(!bufferSink.IsTruncated() && bufferSink.GetView() == "123 abc");
+		StringFormat::FormatTo(bufferSink, GD_FORMAT("{}"), 4567);
+		gd_testing_verify(bufferSink.IsTruncated() && bufferSink.GetLength() == 7 && CString::Strcmp(bufferSink.CStr(), "123 abc") == 0);
+
+		// String builder is appended.
+		StringBuilder builder;
+		builder.Append("x = ");
+		StringFormat::FormatTo(builder, GD_FORMAT("{:.1}; "), 0.25);
+		StringFormat::FormatTo(builder, GD_FORMAT("{}"), String(300, 'z'));
+		gd_testing_verify(builder.ToString() == "x = 0.2; " + String(300, 'z'));
+
+		// Stream is written through the buffer.
+		MemoryOutputStream stream;
+		{
+			StringFormatStream streamSink(stream);
+			for (SizeTp cnt = 0; cnt < 100; ++cnt)
+			{
+				StringFormat::FormatTo(streamSink, GD_FORMAT("{},"), cnt);
+			}
+			StringFormat::FormatTo(streamSink, GD_FORMAT("{}"), String(1000, 's'));
+		}
+		StringBuilder expected;
+		for (SizeTp cnt = 0; cnt < 100; ++cnt)
+		{
+			expected.AppendFormat("%d,", static_cast<int>(cnt));
+		}
+		expected.Append(String(1000, 's'));
+		gd_testing_verify(stream.GetData().GetLength() == expected.GetLength());
+		gd_testing_verify(CMemory::Memcmp(stream.GetData().GetData(), expected.CStr(), expected.GetLength()) == 0);
+
+		// Long strings are allocated once with the exact length.
+		auto const longString = StringFormat::Format(GD_FORMAT("{:>1000}"), "end");
+		gd_testing_verify(longString.GetLength() == 1000 && longString.EndsWith(" end"));
+	};
+
+GD_NAMESPACE_END
+
+#endif	// if GD_TESTING_ENABLED
@@ -0,0 +1,463 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/Containers/StringView.h
+ * Non-owning string view class.
+ */
+#pragma once
+
+#include <GoddamnEngine/Include.h>
+#include <GoddamnEngine/Core/CStdlib/CStringSearch.h>
+#include <GoddamnEngine/Core/Containers/String.h>
+
+GD_NAMESPACE_BEGIN
+
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+	// ******                             BaseStringView<T> class.                             ******
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+
+	// **------------------------------------------------------------------------------------------**
+	//! Non-owning immutable view of the characters, that are stored somewhere else.
+	//! Views are implicitly constructed from the C strings and strings, so functions, that only
+	//! read strings, should accept views by value instead of the string references.
+	//!
+	//! Views are not null-terminated. Viewed characters should outlive the view.
+	//!
+	//! @tparam TChar character type of this view.
+	// **------------------------------------------------------------------------------------------**
+	template<typename TChar>
+	class BaseStringView final
+	{
+	public:
+		using ElementType          = TChar const;
+		using ConstElementType     = TChar const;
+		using ReferenceType        = TChar const&;
+		using ConstReferenceType   = TChar const&;
+		using Iterator             = TChar const*;
+		using ConstIterator        = TChar const*;
+
+		GD_CONTAINER_DEFINE_ITERATION_SUPPORT(BaseStringView)
+		SizeTp static constexpr Npos = SizeTpMax;
+
+	private:
+		TChar const* m_Data;
+		SizeTp       m_Length;
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Constructors.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Initializes an empty view.
+		 */
+		GDINL BaseStringView()
+			: m_Data(GD_TEXT(TChar, "")), m_Length(0)
+		{
+		}
+
+		/*!
+		 * Initializes view of the specified characters.
+		 *
+		 * @param text Pointer to the characters.
+		 * @param textLength Amount of the characters.
+		 */
+		GDINL BaseStringView(TChar const* const text, SizeTp const textLength)
+			: m_Data(text), m_Length(textLength)
+		{
+			GD_ASSERT(text != nullptr || textLength == 0, "Null pointer view.");
+		}
+
+		/*!
+		 * Initializes view of the C string.
+		 * @param text Null-terminated string.
+		 */
+		GDINL implicit BaseStringView(TChar const* const text)  // NOLINT
+			: m_Data(text), m_Length(CString::Strlen(text))
+		{
+		}
+
+		/*!
+		 * Initializes view of the string.
+		 * @param text The string. View is invalidated, when the string is modified or destroyed.
+		 */
+		template<SizeTp TInlineLength>
+		GDINL implicit BaseStringView(BaseString<TChar, TInlineLength> const& text)  // NOLINT
+			: m_Data(text.CStr()), m_Length(text.GetLength())
+		{
+		}
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Iteration API.
+		// ------------------------------------------------------------------------------------------
+
+		GDINL ConstIterator Begin() const
+		{
+			return m_Data;
+		}
+
+		GDINL ConstIterator End() const
+		{
+			return m_Data + m_Length;
+		}
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Dynamic size management.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Returns length of the viewed characters.
+		 */
+		GDINL SizeTp GetLength() const
+		{
+			return m_Length;
+		}
+
+		/*!
+		 * Returns true if this view is empty.
+		 */
+		GDINL bool IsEmpty() const
+		{
+			return m_Length == 0;
+		}
+
+		// ------------------------------------------------------------------------------------------
+		// Element access.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Returns pointer to the viewed characters. Characters are not null-terminated.
+		 */
+		GDINL TChar const* GetData() const
+		{
+			return m_Data;
+		}
+
+		/*!
+		 * Returns first character of the view.
+		 */
+		GDINL TChar GetFirst() const
+		{
+			GD_ASSERT(m_Length != 0, "Empty view.");
+			return m_Data[0];
+		}
+
+		/*!
+		 * Returns last character of the view.
+		 */
+		GDINL TChar GetLast() const
+		{
+			GD_ASSERT(m_Length != 0, "Empty view.");
+			return m_Data[m_Length - 1];
+		}
+
+		/*!
+		 * Returns a copy of the viewed characters.
+		 */
+		GDINL BaseString<TChar> ToString() const
+		{
+			return BaseString<TChar>(m_Data, m_Length);
+		}
+
+		/*!
+		 * Returns hash code of the viewed characters. Matches hash code of the equal string.
+		 */
+		GDINL HashCode GetHashCode() const
+		{
+			return HashCode(Hash::ComputeBytes(m_Data, m_Length * sizeof(TChar)));
+		}
+
+		// ------------------------------------------------------------------------------------------
+		// Sub-viewing.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Returns a part of this view from specified index to the specified index (including both).
+		 *
+		 * @param from Index of the first character of the sub-view.
+		 * @param to Index of the last character of the sub-view.
+		 */
+		GDINL BaseStringView Substring(SizeTp const from, SizeTp const to) const
+		{
+			GD_ASSERT(to >= from, "Invalid substring indices.");
+			GD_ASSERT(to < m_Length, "Invalid substring indices.");
+			return BaseStringView(m_Data + from, to - from + 1);
+		}
+
+		/*!
+		 * Returns a part of this view from specified index to the end.
+		 * @param from Index of the first character of the sub-view. Could be equal to the length.
+		 */
+		GDINL BaseStringView Substring(SizeTp const from) const
+		{
+			GD_ASSERT(from <= m_Length, "Invalid substring indices.");
+			return BaseStringView(m_Data + from, m_Length - from);
+		}
+
+		/*!
+		 * Returns a part of this view from specified index with specified length.
+		 *
+		 * @param from Index of the first character of the sub-view.
+		 * @param length The length of the sub-view.
+		 */
+		GDINL BaseStringView SubstringLen(SizeTp const from, SizeTp const length) const
+		{
+			GD_ASSERT(from <= m_Length && length <= m_Length - from, "Invalid substring indices.");
+			return BaseStringView(m_Data + from, length);
+		}
+
+		/*!
+		 * Returns this view without specified amount of the first characters.
+		 * @param length Amount of characters to skip from front.
+		 */
+		GDINL BaseStringView ChopFront(SizeTp const length) const
+		{
+			return Substring(length);
+		}
+
+		/*!
+		 * Returns this view without specified amount of the last characters.
+		 * @param length Amount of characters to skip from end.
+		 */
+		GDINL BaseStringView ChopEnd(SizeTp const length) const
+		{
+			GD_ASSERT(length <= m_Length, "Invalid substring indices.");
+			return BaseStringView(m_Data, m_Length - length);
+		}
+
+		// ------------------------------------------------------------------------------------------
+		// 'Finds' and 'Starts/Ends With'.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Searches for first occurrence of the specified text in the view.
+		 *
+		 * @param text Text we are looking for.
+		 * @param from Index, from which search starts.
+		 *
+		 * @returns Index of the first occurrence of the text in the view or @c Npos if nothing was found.
+		 */
+		//! @{
+		GDINL SizeTp Find(TChar const text, SizeTp const from = 0) const
+		{
+			if (from >= m_Length)
+			{
+				return Npos;
+			}
+			auto const location = CStringSearch::Find(m_Data + from, m_Length - from, text);
+			return location != nullptr ? static_cast<SizeTp>(location - m_Data) : Npos;
+		}
+		GDINL SizeTp Find(BaseStringView const text, SizeTp const from = 0) const
+		{
+			if (from > m_Length)
+			{
+				return Npos;
+			}
+			auto const location = CStringSearch::Find(m_Data + from, m_Length - from, text.m_Data, text.m_Length);
+			return location != nullptr ? static_cast<SizeTp>(location - m_Data) : Npos;
+		}
+		//! @}
+
+		/*!
+		 * Searches for last occurrence of the specified text in the view.
+		 *
+		 * @param text Text we are looking for.
+		 * @returns Index of the last occurrence of the text in the view or @c Npos if nothing was found.
+		 */
+		//! @{
+		GDINL SizeTp ReverseFind(TChar const text) const
+		{
+			auto const location = CStringSearch::ReverseFind(m_Data, m_Length, text);
+			return location != nullptr ? static_cast<SizeTp>(location - m_Data) : Npos;
+		}
+		GDINL SizeTp ReverseFind(BaseStringView const text) const
+		{
+			auto const location = CStringSearch::ReverseFind(m_Data, m_Length, text.m_Data, text.m_Length);
+			return location != nullptr ? static_cast<SizeTp>(location - m_Data) : Npos;
+		}
+		//! @}
+
+		/*!
+		 * Searches for first character, that is contained in the specified set.
+		 *
+		 * @param characters Set of the characters we are looking for.
+		 * @param from Index, from which search starts.
+		 *
+		 * @returns Index of the first found character or @c Npos if nothing was found.
+		 */
+		GDINL SizeTp FindFirstOf(BaseStringView const characters, SizeTp const from = 0) const
+		{
+			for (auto index = from; index < m_Length; ++index)
+			{
+				if (characters.Find(m_Data[index]) != Npos)
+				{
+					return index;
+				}
+			}
+			return Npos;
+		}
+
+		/*!
+		 * Searches for last character, that is contained in the specified set.
+		 *
+		 * @param characters Set of the characters we are looking for.
+		 * @returns Index of the last found character or @c Npos if nothing was found.
+		 */
+		GDINL SizeTp FindLastOf(BaseStringView const characters) const
+		{
+			for (auto index = m_Length; index != 0; --index)
+			{
+				if (characters.Find(m_Data[index - 1]) != Npos)
+				{
+					return index - 1;
+				}
+			}
+			return Npos;
+		}
+
+		/*!
+		 * Returns true if this view contains specified text.
+		 * @param text Text we are looking for.
+		 */
+		//! @{
+		GDINL bool Contains(TChar const text) const
+		{
+			return Find(text) != Npos;
+		}
+		GDINL bool Contains(BaseStringView const text) const
+		{
+			return Find(text) != Npos;
+		}
+		//! @}
+
+		/*!
+		 * Returns true if this view starts with specified text.
+		 * @param text Text we are testing against.
+		 */
+		//! @{
+		GDINL bool StartsWith(BaseStringView const text) const
+		{
+			return text.m_Length <= m_Length && CMemory::Memcmp(m_Data, text.m_Data, text.m_Length * sizeof(TChar)) == 0;
+		}
+		GDINL bool StartsWith(TChar const text) const
+		{
+			return m_Length != 0 && m_Data[0] == text;
+		}
+		//! @}
+
+		/*!
+		 * Returns true if this view ends with specified text.
+		 * @param text Text we are testing against.
+		 */
+		//! @{
+		GDINL bool EndsWith(BaseStringView const text) const
+		{
+			return text.m_Length <= m_Length && CMemory::Memcmp(m_Data + m_Length - text.m_Length, text.m_Data, text.m_Length * sizeof(TChar)) == 0;
+		}
+		GDINL bool EndsWith(TChar const text) const
+		{
+			return m_Length != 0 && m_Data[m_Length - 1] == text;
+		}
+		//! @}
+
+		/*!
+		 * Lexicographically compares this view with other one.
+		 *
+		 * @param other The other view.
+		 * @returns Negative value if this view is less, zero if views are equal and positive value otherwise.
+		 */
+		GDINL Int32 Compare(BaseStringView const other) const
+		{
+			auto const commonLength = Min(m_Length, other.m_Length);
+			for (SizeTp index = 0; index < commonLength; ++index)
+			{
+				if (m_Data[index] != other.m_Data[index])
+				{
+					return m_Data[index] < other.m_Data[index] ? -1 : 1;
+				}
+			}
+			return m_Length < other.m_Length ? -1 : (m_Length > other.m_Length ? 1 : 0);
+		}
+
+		/*!
+		 * Lexicographically compares this view with other one ignoring case.
+		 * @see CStringSearch::CompareIgnoreCase
+		 *
+		 * @param other The other view.
+		 * @returns Negative value if this view is less, zero if views are equal and positive value otherwise.
+		 */
+		GDINL Int32 CompareIgnoreCase(BaseStringView const other) const
+		{
+			auto const result = CStringSearch::CompareIgnoreCase(m_Data, other.m_Data, Min(m_Length, other.m_Length));
+			if (result != 0)
+			{
+				return result;
+			}
+			return m_Length < other.m_Length ? -1 : (m_Length > other.m_Length ? 1 : 0);
+		}
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Overloaded operators.
+		// ------------------------------------------------------------------------------------------
+
+		// view[]
+		GDINL TChar const& operator[] (SizeTp const index) const
+		{
+			GD_ASSERT(index < m_Length, "Invalid view subindex.");
+			return m_Data[index];
+		}
+
+		// view == view
+		GDINL friend bool operator== (BaseStringView const lhs, BaseStringView const rhs)
+		{
+			return lhs.m_Length == rhs.m_Length && CMemory::Memcmp(lhs.m_Data, rhs.m_Data, lhs.m_Length * sizeof(TChar)) == 0;
+		}
+		GDINL friend bool operator!= (BaseStringView const lhs, BaseStringView const rhs)
+		{
+			return !(lhs == rhs);
+		}
+
+		// view < view
+		GDINL friend bool operator< (BaseStringView const lhs, BaseStringView const rhs)
+		{
+			return lhs.Compare(rhs) < 0;
+		}
+		GDINL friend bool operator<= (BaseStringView const lhs, BaseStringView const rhs)
+		{
+			return lhs.Compare(rhs) <= 0;
+		}
+		GDINL friend bool operator> (BaseStringView const lhs, BaseStringView const rhs)
+		{
+			return lhs.Compare(rhs) > 0;
+		}
+		GDINL friend bool operator>= (BaseStringView const lhs, BaseStringView const rhs)
+		{
+			return lhs.Compare(rhs) >= 0;
+		}
+
+	};	// class BaseStringView
+
+	/*!
+	 * A string view class used by the engine.
+	 */
+	using StringView = BaseStringView<Char>;
+
+	/*!
+	 * A wide-character string view class used by the engine.
+	 */
+	using WideStringView = BaseStringView<WideChar>;
+
+GD_NAMESPACE_END
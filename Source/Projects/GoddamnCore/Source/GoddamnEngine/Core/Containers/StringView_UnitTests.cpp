@@ -0,0 +1,122 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/Containers/StringView_UnitTests.cpp
+ * Non-owning string view tests.
+ */
+#include <GoddamnEngine/Core/Containers/StringView.h>
+#include <GoddamnEngine/Core/Containers/UnorderedMap.h>
+#if GD_TESTING_ENABLED
+
+GD_NAMESPACE_BEGIN
+
+	gd_testing_unit_test_foreach(StringViewCtors, T, Char, WideChar)
+	{
+		BaseStringView<T> const empty;
+		gd_testing_verify(empty.IsEmpty() && empty.GetLength() == 0 && empty.GetData() != nullptr);
+
+		BaseStringView<T> const literal(GD_TEXT(T, "abc"));
+		gd_testing_verify(literal.GetLength() == 3 && literal[0] == GD_TEXT(T, 'a') && literal.GetLast() == GD_TEXT(T, 'c'));
+
+		// Views of the strings do not copy the characters.
+		BaseString<T> const string(GD_TEXT(T, "abcdef"));
+		BaseStringView<T> const view(string);
+		gd_testing_verify(view.GetData() == string.CStr() && view.GetLength() == string.GetLength());
+		gd_testing_verify(view.ToString() == string);
+
+		BaseStringView<T> const partial(string.CStr() + 1, 2);
+		gd_testing_verify(partial == GD_TEXT(T, "bc") && partial.ToString() == GD_TEXT(T, "bc"));
+
+		SizeTp length = 0;
+		for (auto const character : view)
+		{
+			gd_testing_verify(character == string[length++]);
+		}
+		gd_testing_verify(length == 6);
+	};
+
+	gd_testing_unit_test_foreach(StringViewSubstring, T, Char, WideChar)
+	{
+		BaseStringView<T> const view(GD_TEXT(T, "directory/file.ext"));
+		gd_testing_verify(view.Substring(0, 8) == GD_TEXT(T, "directory"));
+		gd_testing_verify(view.Substring(10) == GD_TEXT(T, "file.ext"));
+		gd_testing_verify(view.Substring(view.GetLength()).IsEmpty());
+		gd_testing_verify(view.SubstringLen(10, 4) == GD_TEXT(T, "file"));
+		gd_testing_verify(view.ChopFront(14) == GD_TEXT(T, ".ext"));
+		gd_testing_verify(view.ChopEnd(4) == GD_TEXT(T, "directory/file"));
+	};
+
+	gd_testing_unit_test_foreach(StringViewFind, T, Char, WideChar)
+	{
+		BaseStringView<T> const view(GD_TEXT(T, "one two one two"));
+		gd_testing_verify(view.Find(GD_TEXT(T, 'o')) == 0);
+		gd_testing_verify(view.Find(GD_TEXT(T, 'o'), 1) == 6);
+		gd_testing_verify(view.Find(GD_TEXT(T, 'x')) == BaseStringView<T>::Npos);
+		gd_testing_verify(view.Find(GD_TEXT(T, "two")) == 4);
+		gd_testing_verify(view.Find(GD_TEXT(T, "two"), 5) == 12);
+		gd_testing_verify(view.Find(GD_TEXT(T, "three")) == BaseStringView<T>::Npos);
+		gd_testing_verify(view.Find(GD_TEXT(T, "")) == 0);
+
+		gd_testing_verify(view.ReverseFind(GD_TEXT(T, 'o')) == 14);
+		gd_testing_verify(view.ReverseFind(GD_TEXT(T, "one")) == 8);
+		gd_testing_verify(view.ReverseFind(GD_TEXT(T, "three")) == BaseStringView<T>::Npos);
+
+		gd_testing_verify(view.FindFirstOf(GD_TEXT(T, "wt")) == 4);
+		gd_testing_verify(view.FindFirstOf(GD_TEXT(T, "wt"), 6) == 12);
+		gd_testing_verify(view.FindLastOf(GD_TEXT(T, "ne")) == 10);
+		gd_testing_verify(view.FindLastOf(GD_TEXT(T, "xyz")) == BaseStringView<T>::Npos);
+
+		gd_testing_verify(view.Contains(GD_TEXT(T, 'w')) && !view.Contains(GD_TEXT(T, 'x')));
+		gd_testing_verify(view.Contains(GD_TEXT(T, "e t")) && !view.Contains(GD_TEXT(T, "two three")));
+
+		gd_testing_verify(view.StartsWith(GD_TEXT(T, "one")) && !view.StartsWith(GD_TEXT(T, "two")));
+		gd_testing_verify(view.EndsWith(GD_TEXT(T, "two")) && !view.EndsWith(GD_TEXT(T, "one")));
+		gd_testing_verify(view.StartsWith(GD_TEXT(T, 'o')) && view.EndsWith(GD_TEXT(T, 'o')));
+		gd_testing_verify(!BaseStringView<T>().StartsWith(GD_TEXT(T, 'o')) && !BaseStringView<T>().EndsWith(GD_TEXT(T, 'o')));
+	};
+
+	gd_testing_unit_test_foreach(StringViewCompare, T, Char, WideChar)
+	{
+		BaseString<T> const string(GD_TEXT(T, "abc"));
+		BaseStringView<T> const view(GD_TEXT(T, "abc"));
+		gd_testing_verify(view == string && string == view);
+		gd_testing_verify(view != GD_TEXT(T, "ab") && view != GD_TEXT(T, "abd"));
+
+		gd_testing_verify(BaseStringView<T>(GD_TEXT(T, "ab")) < view);
+		gd_testing_verify(view < GD_TEXT(T, "abd") && view <= GD_TEXT(T, "abc"));
+		gd_testing_verify(GD_TEXT(T, "b") > view && view >= GD_TEXT(T, "abc"));
+		gd_testing_verify(view.Compare(GD_TEXT(T, "abc")) == 0);
+		gd_testing_verify(view.Compare(GD_TEXT(T, "abd")) < 0 && view.Compare(GD_TEXT(T, "ab")) > 0);
+
+		gd_testing_verify(view.CompareIgnoreCase(GD_TEXT(T, "ABC")) == 0 && view.CompareIgnoreCase(GD_TEXT(T, "aBc")) == 0);
+		gd_testing_verify(view.CompareIgnoreCase(GD_TEXT(T, "ABD")) < 0 && view.CompareIgnoreCase(GD_TEXT(T, "AB")) > 0);
+		gd_testing_verify(view.CompareIgnoreCase(GD_TEXT(T, "ABCD")) < 0);
+	};
+
+	gd_testing_unit_test(StringViewHashTableLookup)
+	{
+		String const string("key");
+		StringView const view(string);
+		gd_testing_verify(view.GetHashCode() == string.GetHashCode());
+
+		// String-keyed tables could be searched without constructing a temporary string.
+		UnorderedMap<String, Int32> map;
+		map.Insert("key", 1);
+		map.Insert("other key", 2);
+
+		auto const storage = "the other key";
+		auto const valuePtr = map.Find(StringView(storage + 4));
+		gd_testing_verify(valuePtr != nullptr && *valuePtr == 2);
+		gd_testing_verify(map.Find(StringView(storage, 3)) == nullptr);
+		gd_testing_verify(map.Contains(StringView(storage + 10)));
+	};
+
+GD_NAMESPACE_END
+
+#endif	// if GD_TESTING_ENABLED
@@ -50,6 +50,12 @@ GD_NAMESPACE_BEGIN
 
 		gd_testing_verify(a < b);
 		gd_testing_verify(c > b);
+
+		// Prefix is less than the longer string.
+		gd_testing_verify(String("aa") < a);
+		gd_testing_verify(!(a < String("aa")));
+		gd_testing_verify(a > "aa");
+		gd_testing_verify("aaaa" > a);
 	};
 
 	gd_testing_unit_test(StringAssigmentOperators)
@@ -386,6 +392,49 @@ GD_NAMESPACE_BEGIN
 		String const formatString("%c-%d-%X-%.1f-%s");
 		String const fortmattedString = String::Format(formatString.CStr(), '%', -3, 10, 0.5f, "wasted");
 		gd_testing_verify(fortmattedString == "%--3-A-0.5-wasted");
+
+		// Strings longer than the stack buffer.
+		String const longString(1000, 'a');
+		gd_testing_verify(String::Format("[%s]", longString.CStr()) == "[" + longString + "]");
+		gd_testing_verify(WideString::Format(L"%ls", WideString(1000, L'b').CStr()) == WideString(1000, L'b'));
+	};
+
+	gd_testing_unit_test(StringNumberConversions)
+	{
+		gd_testing_verify(String::FromInt64(0) == "0");
+		gd_testing_verify(String::FromInt64(-1234) == "-1234");
+		gd_testing_verify(String::FromInt64(Int64Min) == "-9223372036854775808");
+		gd_testing_verify(String::FromUInt64(UInt64Max) == "18446744073709551615");
+		gd_testing_verify(String::FromUInt64(255, String::Base::Hexadecimal) == "ff");
+		gd_testing_verify(String::FromUInt64(255, String::Base::Hexadecimal, true) == "0xff");
+		gd_testing_verify(String::FromUInt64(8, String::Base::Octal, true) == "010");
+		gd_testing_verify(WideString::FromInt64(-42) == L"-42");
+
+		// Floating point numbers are written in the shortest form, that is parsed back to the same value.
+		gd_testing_verify(String::FromFloat64(1.0) == "1.0");
+		gd_testing_verify(String::FromFloat64(-1234.567) == "-1234.567");
+		gd_testing_verify(String::FromFloat64(0.1 + 0.2) == "0.30000000000000004");
+		gd_testing_verify(String::FromFloat64(1e-7) == "1e-07");
+		gd_testing_verify(String::FromFloat64(String::FromFloat64(0.1 + 0.2).ToFloat64()) == "0.30000000000000004");
+
+		// Parsing does not depend on the locale and fails on the out of range values.
+		bool result;
+		gd_testing_verify(String("0x7fffffffffffffff").ToInt64(&result) == Int64Max && result);
+		gd_testing_verify(String("9223372036854775808").ToInt64(&result) == Int64Max && !result);
+		gd_testing_verify(String("0xFF").ToUInt64(&result, String::Base::Hexadecimal) == 255 && result);
+		gd_testing_verify(String("777").ToUInt64(&result, String::Base::Octal) == 511 && result);
+		gd_testing_verify(String("-1").ToUInt64(&result) == 0 && !result);
+		gd_testing_verify(String("").ToInt64(&result) == 0 && !result);
+		gd_testing_verify(String("2.5e-3").ToFloat64(&result) == 2.5e-3 && result);
+		gd_testing_verify(String("1e400").ToFloat64(&result) > 1e308 && !result);
+		gd_testing_verify(WideString(L"-0.5").ToFloat64(&result) == -0.5 && result);
+
+		// C string conversions skip the leading spaces.
+		CStr endPtr;
+		gd_testing_verify(CString::Strtoi64("  -42 apples", &endPtr, 10) == -42 && CString::Strcmp(endPtr, " apples") == 0);
+		gd_testing_verify(CString::Strtoui64("-1") == UInt64Max);
+		gd_testing_verify(CString::Strtof64(" 12.5e1,", &endPtr) == 125.0 && *endPtr == ',');
+		gd_testing_verify(CString::Strtof64("apples", &endPtr) == 0.0 && CString::Strcmp(endPtr, "apples") == 0);
 	};
 
 
@@ -1,6 +1,223 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/Containers/UnorderedMap.h
+ * Dynamically sized hash-based associative container class.
+ */
 #pragma once
+
+#include <GoddamnEngine/Include.h>
 #include <GoddamnEngine/Core/Containers/Map.h>
+#include <GoddamnEngine/Core/Containers/HashTable/HashTable.h>
+
 GD_NAMESPACE_BEGIN
-template<typename K, typename V>
-using UnorderedMap = Map<K ,V>;
+
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+	// ******                            UnorderedMap<K, V> class.                             ******
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+
+	// **------------------------------------------------------------------------------------------**
+	//! Key selector for the tables of key-value pairs.
+	// **------------------------------------------------------------------------------------------**
+	template<typename TKey, typename TValue>
+	struct UnorderedMapKeySelector final : public TNonCreatable
+	{
+	public:
+		GDINL static TKey const& GetKey(MapPair<TKey, TValue> const& pair)
+		{
+			return pair.Key;
+		}
+	};	// struct UnorderedMapKeySelector
+
+	// **------------------------------------------------------------------------------------------**
+	//! Dynamically sized associative container that is implemented with open-addressing hash table.
+	//! Drop-in replacement for the map class, when order of the elements does not matter.
+	//!
+	//! Lookup functions accept any key type, that is supported by the hasher and is comparable
+	//! with the map keys, e.g. string maps could be searched with C strings.
+	//!
+	//! @tparam TKey Key type, used for searching.
+	//! @tparam TValue Type of elements stored in the map.
+	//! @tparam THasher Type, that computes hashes of the keys.
+	//! @tparam TAllocator Allocator used by this map.
+	// **------------------------------------------------------------------------------------------**
+	template<typename TKey, typename TValue, typename THasher = Hasher<TKey>, typename TAllocator = DefaultContainerAllocator>
+	class UnorderedMap : public HashTable<TKey, MapPair<TKey, TValue>, UnorderedMapKeySelector<TKey, TValue>, THasher, TAllocator>
+	{
+	public:
+		using PairType             = MapPair<TKey, TValue>;
+		using ElementType          = PairType;
+		using HashTableType        = HashTable<TKey, PairType, UnorderedMapKeySelector<TKey, TValue>, THasher, TAllocator>;
+		using Iterator             = typename HashTableType::Iterator;
+		using ConstIterator        = typename HashTableType::ConstIterator;
+		using ReverseIterator      = typename HashTableType::ReverseIterator;
+		using ReverseConstIterator = typename HashTableType::ReverseConstIterator;
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Constructor and destructor.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Initializes an empty map.
+		 */
+		GDINL UnorderedMap() = default;
+
+		/*!
+		 * Moves other map here.
+		 * @param otherMap Map would be moved into current object.
+		 */
+		GDINL UnorderedMap(UnorderedMap&& otherMap) = default;
+
+		/*!
+		 * Initializes map with default C++11's initializer list. You should not use this constructor manually.
+		 * @param initializerList Initializer list passed by the compiler.
+		 */
+		GDINL UnorderedMap(InitializerList<PairType> const& initializerList)
+		{
+			this->Reserve(initializerList.size());
+			for (auto const& element : initializerList)
+			{
+				this->Insert(element.Key, element.Value);
+			}
+		}
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Map manipulation.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Queries for the iterator of the element with specified key.
+		 *
+		 * @param key The key of the element we are looking for.
+		 * @returns Iterator on the element if it was found and End Iterator otherwise.
+		 */
+		//! @{
+		template<typename TLookupKey>
+		GDINL ConstIterator FindIterator(TLookupKey const& key) const
+		{
+			return ConstIterator(*this, this->FindSlot(key));
+		}
+		template<typename TLookupKey>
+		GDINL Iterator FindIterator(TLookupKey const& key)
+		{
+			return Iterator(*this, this->FindSlot(key));
+		}
+		//! @}
+
+		/*!
+		 * Queries for the value of the element with specified key.
+		 *
+		 * @param key The key of the element we are looking for.
+		 * @returns Pointer to the element if it was found and null pointer otherwise.
+		 */
+		//! @{
+		template<typename TLookupKey>
+		GDINL TValue const* Find(TLookupKey const& key) const
+		{
+			auto const index = this->FindSlot(key);
+			return index != this->GetCapacity() ? &this->GetSlot(index).Value : nullptr;
+		}
+		template<typename TLookupKey>
+		GDINL TValue* Find(TLookupKey const& key)
+		{
+			return const_cast<TValue*>(const_cast<UnorderedMap const*>(this)->Find(key));
+		}
+		//! @}
+
+		/*!
+		 * Determines whether the element with specified key exists in the map.
+		 *
+		 * @param key The key of the element we are looking for.
+		 * @returns True if element with specified key exists in the map, false otherwise.
+		 */
+		template<typename TLookupKey>
+		GDINL bool Contains(TLookupKey const& key) const
+		{
+			return this->FindSlot(key) != this->GetCapacity();
+		}
+
+		/*!
+		 * Inserts the specified key-value pair into the map.
+		 *
+		 * @param key The key of the element that is going to be inserted.
+		 * @param value The value of the element that is going to be inserted.
+		 */
+		//! @{
+		GDINL TValue& Insert(TKey&& key, TValue&& value = TValue())
+		{
+			GD_ASSERT(!this->Contains(key), "Element with specified key already exists.");
+
+			auto const hash = this->ComputeHash(key);
+			return this->GetSlot(this->InsertSlot(hash, Utils::Forward<TKey>(key), Utils::Forward<TValue>(value))).Value;
+		}
+		GDINL TValue& Insert(TKey const& key, TValue const& value = TValue())
+		{
+			GD_ASSERT(!this->Contains(key), "Element with specified key already exists.");
+
+			auto const hash = this->ComputeHash(key);
+			return this->GetSlot(this->InsertSlot(hash, key, value)).Value;
+		}
+		//! @}
+
+		/*!
+		 * Removes existing element with specified key from the map.
+		 * @param key The key of the element that is going to be removed.
+		 */
+		template<typename TLookupKey>
+		GDINL void Erase(TLookupKey const& key)
+		{
+			auto const index = this->FindSlot(key);
+			GD_ASSERT(index != this->GetCapacity(), "Element with specified key does not exist.");
+			this->EraseSlot(index);
+		}
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Overloaded operators.
+		// ------------------------------------------------------------------------------------------
+
+		GDINL UnorderedMap& operator= (UnorderedMap&& otherMap) = default;
+
+		/*!
+		 * Returns reference on value of the element with specified key.
+		 *
+		 * @param key The key of the element we are looking for.
+		 * @returns Reference on some element, or a newly created instance of the value type, that was automatically added to the map.
+		 */
+		GDINL TValue& operator[] (TKey const& key)
+		{
+			auto const index = this->FindSlot(key);
+			if (index == this->GetCapacity())
+			{
+				return this->GetSlot(this->InsertSlot(this->ComputeHash(key), key, TValue())).Value;
+			}
+			return this->GetSlot(index).Value;
+		}
+
+		/*!
+		 * Returns reference on value of the element with specified key.
+		 *
+		 * @param key The key of the element we are looking for.
+		 * @returns Reference on some element.
+		 */
+		GDINL TValue const& operator[] (TKey const& key) const
+		{
+			auto const index = this->FindSlot(key);
+			GD_ASSERT(index != this->GetCapacity(), "Element with specified key does not exist.");
+			return this->GetSlot(index).Value;
+		}
+
+	};	// class UnorderedMap
+
 GD_NAMESPACE_END
@@ -0,0 +1,116 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/Containers/UnorderedMap_UnitTests.cpp
+ * Dynamically sized hash-based associative container class.
+ */
+#include <GoddamnEngine/Core/Containers/Map.h>
+#include <GoddamnEngine/Core/Containers/Set.h>
+#include <GoddamnEngine/Core/Containers/String.h>
+#include <GoddamnEngine/Core/Containers/UnorderedMap.h>
+#include <GoddamnEngine/Core/Containers/UnorderedSet.h>
+
+GD_NAMESPACE_BEGIN
+
+#if GD_TESTING_ENABLED
+
+	gd_testing_unit_test(UnorderedMapManyElements)
+	{
+		UnorderedMap<Int32, Int32> map;
+		for (Int32 cnt = 0; cnt < 10000; ++cnt)
+		{
+			map.Insert(cnt * 7919 - 5000, cnt);
+		}
+		gd_testing_verify(map.GetLength() == 10000);
+
+		// Erasing every second element shifts the probe sequences.
+		for (Int32 cnt = 0; cnt < 10000; cnt += 2)
+		{
+			map.Erase(cnt * 7919 - 5000);
+		}
+		gd_testing_verify(map.GetLength() == 5000);
+		for (Int32 cnt = 0; cnt < 10000; ++cnt)
+		{
+			auto const value = map.Find(cnt * 7919 - 5000);
+			gd_testing_verify(cnt % 2 == 0 ? value == nullptr : value != nullptr && *value == cnt);
+		}
+
+		SizeTp iteratedLength = 0;
+		for (auto const& pair : map)
+		{
+			gd_testing_verify(pair.Value % 2 == 1);
+			++iteratedLength;
+		}
+		gd_testing_verify(iteratedLength == 5000);
+	};
+
+	gd_testing_unit_test(UnorderedMapRandomInsertErase)
+	{
+		// Hash table is compared with the red-black tree.
+		UnorderedSet<UInt32> hashSet;
+		Set<UInt32> treeSet;
+		UInt32 random = 1;
+		for (SizeTp cnt = 0; cnt < 20000; ++cnt)
+		{
+			random = random * 1664525 + 1013904223;
+			auto const element = (random >> 8) % 512;
+			if (treeSet.Contains(element))
+			{
+				hashSet.Erase(element);
+				treeSet.Erase(element);
+			}
+			else
+			{
+				hashSet.Insert(element);
+				treeSet.Insert(element);
+			}
+			gd_testing_verify(hashSet.GetLength() == treeSet.GetLength());
+		}
+		for (UInt32 element = 0; element < 512; ++element)
+		{
+			gd_testing_verify(hashSet.Contains(element) == treeSet.Contains(element));
+		}
+	};
+
+	gd_testing_unit_test(UnorderedMapHeterogeneousLookup)
+	{
+		UnorderedMap<String, Int32> map{ { "first", 1 }, { "second", 2 } };
+		map["third"] = 3;
+
+		// This should succeed: C strings are hashed and compared without temporary strings.
+		gd_testing_verify(*map.Find("first") == 1);
+		gd_testing_verify(*map.Find(String("second")) == 2);
+		gd_testing_verify(map.Contains("third"));
+		gd_testing_verify(!map.Contains("fourth"));
+
+		map.Erase("second");
+		gd_testing_verify(!map.Contains("second"));
+		gd_testing_verify(map.GetLength() == 2);
+	};
+
+	gd_testing_unit_test(UnorderedMapReserve)
+	{
+		UnorderedMap<Int32, Int32> map;
+		map.Reserve(1000);
+		auto const reservedCapacity = map.GetCapacity();
+		for (Int32 cnt = 0; cnt < 1000; ++cnt)
+		{
+			map.Insert(cnt, cnt);
+		}
+		gd_testing_verify(map.GetCapacity() == reservedCapacity);
+
+		map.Clear();
+		gd_testing_verify(map.IsEmpty());
+		gd_testing_verify(map.Begin() == map.End());
+		gd_testing_verify(map.GetCapacity() == reservedCapacity);
+	};
+
+#endif	// if GD_TESTING_ENABLED
+
+GD_NAMESPACE_END
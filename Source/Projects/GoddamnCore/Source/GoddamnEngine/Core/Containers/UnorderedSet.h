@@ -1,6 +1,170 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/Containers/UnorderedSet.h
+ * Dynamically sized hash-based set class.
+ */
 #pragma once
-#include <GoddamnEngine/Core/Containers/Set.h>
+
+#include <GoddamnEngine/Include.h>
+#include <GoddamnEngine/Core/Containers/InitializerList.h>
+#include <GoddamnEngine/Core/Containers/HashTable/HashTable.h>
+
 GD_NAMESPACE_BEGIN
-template<typename T>
-using UnorderedSet = Set<T>;
+
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+	// ******                              UnorderedSet<T> class.                              ******
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+
+	// **------------------------------------------------------------------------------------------**
+	//! Dynamically sized set that is implemented with open-addressing hash table.
+	//! Drop-in replacement for the set class, when order of the elements does not matter.
+	//!
+	//! @tparam TElement Container element type.
+	//! @tparam THasher Type, that computes hashes of the elements.
+	//! @tparam TAllocator Allocator used by this set.
+	// **------------------------------------------------------------------------------------------**
+	template<typename TElement, typename THasher = Hasher<TElement>, typename TAllocator = DefaultContainerAllocator>
+	class UnorderedSet : public HashTable<TElement, TElement, HashTableIdentityKeySelector<TElement>, THasher, TAllocator>
+	{
+	public:
+		using ElementType          = TElement;
+		using HashTableType        = HashTable<TElement, TElement, HashTableIdentityKeySelector<TElement>, THasher, TAllocator>;
+		using Iterator             = typename HashTableType::Iterator;
+		using ConstIterator        = typename HashTableType::ConstIterator;
+		using ReverseIterator      = typename HashTableType::ReverseIterator;
+		using ReverseConstIterator = typename HashTableType::ReverseConstIterator;
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Constructor and destructor.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Initializes an empty set.
+		 */
+		GDINL UnorderedSet() = default;
+
+		/*!
+		 * Moves other set here.
+		 * @param otherSet Set would be moved into current object.
+		 */
+		GDINL UnorderedSet(UnorderedSet&& otherSet) = default;
+
+		/*!
+		 * Initializes set with default C++11's initializer list. You should not use this constructor manually.
+		 * @param initializerList Initializer list passed by the compiler.
+		 */
+		GDINL UnorderedSet(InitializerList<TElement> const& initializerList)
+		{
+			this->Reserve(initializerList.size());
+			for (auto const& element : initializerList)
+			{
+				this->Insert(element);
+			}
+		}
+
+	public:
+
+		// ------------------------------------------------------------------------------------------
+		// Set manipulation.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Queries for the Iterator of the specified element.
+		 *
+		 * @param element The element we are looking for.
+		 * @returns Iterator on the element if it was found and End Iterator otherwise.
+		 */
+		//! @{
+		template<typename TLookupElement>
+		GDINL ConstIterator FindIterator(TLookupElement const& element) const
+		{
+			return ConstIterator(*this, this->FindSlot(element));
+		}
+		template<typename TLookupElement>
+		GDINL Iterator FindIterator(TLookupElement const& element)
+		{
+			return Iterator(*this, this->FindSlot(element));
+		}
+		//! @}
+
+		/*!
+		 * Queries for the specified element.
+		 *
+		 * @param element The element we are looking for.
+		 * @returns Pointer to the element if it was found and null pointer otherwise.
+		 */
+		//! @{
+		template<typename TLookupElement>
+		GDINL TElement const* Find(TLookupElement const& element) const
+		{
+			auto const index = this->FindSlot(element);
+			return index != this->GetCapacity() ? &this->GetSlot(index) : nullptr;
+		}
+		template<typename TLookupElement>
+		GDINL TElement* Find(TLookupElement const& element)
+		{
+			return const_cast<TElement*>(const_cast<UnorderedSet const*>(this)->Find(element));
+		}
+		//! @}
+
+		/*!
+		 * Determines whether the specified element exists in the set.
+		 * @param element The element we are looking for.
+		 */
+		template<typename TLookupElement>
+		GDINL bool Contains(TLookupElement const& element) const
+		{
+			return this->FindSlot(element) != this->GetCapacity();
+		}
+
+		/*!
+		 * Adds a new specified element to the set.
+		 * @param element The element that would be inserted.
+		 */
+		//! @{
+		GDINL TElement& Insert(TElement&& element)
+		{
+			GD_ASSERT(!this->Contains(element), "Specified element already exists.");
+
+			auto const hash = this->ComputeHash(element);
+			return this->GetSlot(this->InsertSlot(hash, Utils::Forward<TElement>(element)));
+		}
+		GDINL TElement& Insert(TElement const& element)
+		{
+			GD_ASSERT(!this->Contains(element), "Specified element already exists.");
+
+			auto const hash = this->ComputeHash(element);
+			return this->GetSlot(this->InsertSlot(hash, element));
+		}
+		//! @}
+
+		/*!
+		 * Removes existing element from the set.
+		 * @param element The element that is going to be removed.
+		 */
+		template<typename TLookupElement>
+		GDINL void Erase(TLookupElement const& element)
+		{
+			auto const index = this->FindSlot(element);
+			GD_ASSERT(index != this->GetCapacity(), "Specified element does not exist.");
+			this->EraseSlot(index);
+		}
+
+		// ------------------------------------------------------------------------------------------
+		// Overloaded operators.
+		// ------------------------------------------------------------------------------------------
+
+		GDINL UnorderedSet& operator= (UnorderedSet&&) = default;
+
+	};	// class UnorderedSet
+
 GD_NAMESPACE_END
@@ -59,7 +59,9 @@ GD_NAMESPACE_BEGIN
 		 * Moves other map here.
 		 * @param otherMap Map would be moved into current object.
 		 */
-		GDINL UnorderedVectorMap(UnorderedVectorMap&& otherMap) = default;
+		GDINL UnorderedVectorMap(UnorderedVectorMap&& otherMap) noexcept
+			: VectorType(Utils::Move(otherMap))
+		{}
 
 		/*!
 		 * Initializes map with default C++11's initializer list. You should not use this constructor manually.
@@ -236,7 +238,11 @@ GD_NAMESPACE_BEGIN
 		// Overloaded operators.
 		// ------------------------------------------------------------------------------------------
 
-		GDINL UnorderedVectorMap& operator= (UnorderedVectorMap&& otherMap) = default;
+		GDINL UnorderedVectorMap& operator= (UnorderedVectorMap&& otherMap) noexcept
+		{
+			this->VectorType::operator=(Utils::Move(otherMap));
+			return *this;
+		}
 
 		/*!
 		 * Returns reference on value of the element with specified key.
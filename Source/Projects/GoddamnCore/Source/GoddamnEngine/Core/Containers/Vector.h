@@ -272,8 +272,7 @@ GD_NAMESPACE_BEGIN
 				}
 				
 				auto const newMemory = GD_MALLOC_ARRAY_T(TElement, newCapacity);
-				Algo::MoveRange(m_Memory, m_Memory + m_Length, newMemory);
-				Algo::DeinitializeRange(m_Memory, m_Memory + m_Length);
+				Algo::RelocateRange(m_Memory, m_Memory + m_Length, newMemory);
 				GD_FREE(m_Memory);
 				
 				m_Memory = newMemory;
@@ -354,32 +353,15 @@ GD_NAMESPACE_BEGIN
 			GD_ASSERT(index <= m_Length, "Index is out of bounds");
 
 			ReserveToLength(m_Length + 1);
+			Algo::RelocateRange(m_Memory + index, m_Memory + m_Length, m_Memory + index + 1);
+			Algo::InitializeIterator(m_Memory + index, Utils::Forward<TElement>(element));
 			m_Length += 1;
-			for (auto iterator = End() - 1; iterator != Begin() + index; --iterator)
-			{
-				*iterator = Utils::Move(*(iterator - 1));
-			}
-			/*for (auto iterator = ReverseBegin(); iterator != ReverseEnd() - index + 1; ++iterator)
-			{
-				*iterator = Utils::Move(*(iterator + 1));
-			}*/
-			//Algo::MoveRange(ReverseBegin(), ReverseEnd() - index, ReverseBegin() + 1);
-			Algo::InitializeIterator(Begin() + index, Utils::Forward<TElement>(element));
 			return index;
 		}
 		GDINL SizeTp InsertAt(SizeTp const index, TElement const& element)
 		{
-			GD_ASSERT(index <= m_Length, "Index is out of bounds");
-
-			ReserveToLength(m_Length + 1);
-			m_Length += 1;
-			for (auto iterator = End() - 1; iterator != Begin() + index - 1; --iterator)
-			{
-				*iterator = Utils::Move(*(iterator - 1));
-			}
-			//Algo::MoveRange(ReverseBegin(), ReverseEnd() - index, ReverseBegin() + 1);
-			Algo::InitializeIterator(Begin() + index, element);
-			return index;
+			// Element may reference this vector's memory, so copying it before shifting.
+			return InsertAt(index, TElement(element));
 		}
 		//! @}
 
@@ -415,11 +397,8 @@ GD_NAMESPACE_BEGIN
 		GDINL void EraseAt(SizeTp const index, SizeTp const amount = 1)
 		{
 			GD_ASSERT(index + amount <= m_Length, "Index is out of bounds");
-			for (auto iterator = Begin() + index; iterator != (End() - amount); ++iterator)
-			{
-				*iterator = Utils::Move(*(iterator + amount));
-			}
-			Algo::DeinitializeRange(End() - amount, End());
+			Algo::DeinitializeRange(m_Memory + index, m_Memory + index + amount);
+			Algo::RelocateRange(m_Memory + index + amount, m_Memory + m_Length, m_Memory + index);
 			m_Length -= amount;
 		}
 
@@ -1264,11 +1243,12 @@ GD_NAMESPACE_BEGIN
 	template<typename TElement>
 	using Stack = Vector<TElement>;
 
-	/*!
-	 * Chunk vector implementation.
-	 * @todo Impelemnt me
-	 */
-	template<typename TElement>
-	using ChunkedVector = Vector<TElement>;
+	namespace TypeTraits
+	{
+		// Heap-based vector does not store pointers to itself.
+		template<typename TElement>
+		struct IsTriviallyRelocatable<Vector<TElement, HeapAllocator>> : public Internal::TypeTraitsBase<true>
+		{};
+	}	// namespace TypeTraits
 
 GD_NAMESPACE_END
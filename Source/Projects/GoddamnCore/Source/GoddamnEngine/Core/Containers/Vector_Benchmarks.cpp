@@ -0,0 +1,106 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+
+/*!
+ * @file GoddamnEngine/Core/Containers/Vector_Benchmarks.cpp
+ * Dynamically sized array class benchmarks.
+ */
+#include <GoddamnEngine/Core/Containers/Vector.h>
+
+GD_NAMESPACE_BEGIN
+
+#if GD_TESTING_ENABLED
+
+	// Handle-like type with non-trivial move constructor and destructor.
+	struct BenchmarkHandle
+	{
+		Handle Pointer;
+
+		GDINL BenchmarkHandle() : Pointer(nullptr) {}
+		GDINL BenchmarkHandle(Handle const pointer) : Pointer(pointer) {}
+		GDINL BenchmarkHandle(BenchmarkHandle&& other) : Pointer(other.Pointer) { other.Pointer = nullptr; }
+		GDINL BenchmarkHandle(BenchmarkHandle const& other) : Pointer(other.Pointer) {}
+		GDINL ~BenchmarkHandle() { Pointer = nullptr; }
+	};	// struct BenchmarkHandle
+
+	// Same handle, opted-in to be relocated with memory copies.
+	struct BenchmarkRelocatableHandle final : public BenchmarkHandle
+	{
+		using BenchmarkHandle::BenchmarkHandle;
+	};	// struct BenchmarkRelocatableHandle
+
+	namespace TypeTraits
+	{
+		template<>
+		struct IsTriviallyRelocatable<BenchmarkRelocatableHandle> : public Internal::TypeTraitsBase<true>
+		{};
+	}	// namespace TypeTraits
+
+	SizeTp static const VectorBenchmarkLength = 1000000;
+
+	gd_testing_benchmark(VectorInsertLast, state)
+	{
+		state.measure("Int32", VectorBenchmarkLength, []
+		{
+			Vector<Int32> vector;
+			for (SizeTp cnt = 0; cnt < VectorBenchmarkLength; ++cnt)
+			{
+				vector.InsertLast(static_cast<Int32>(cnt));
+			}
+		});
+		state.measure("Handle", VectorBenchmarkLength, []
+		{
+			Vector<BenchmarkHandle> vector;
+			for (SizeTp cnt = 0; cnt < VectorBenchmarkLength; ++cnt)
+			{
+				vector.InsertLast(BenchmarkHandle(reinterpret_cast<Handle>(cnt)));
+			}
+		});
+		state.measure("RelocatableHandle", VectorBenchmarkLength, []
+		{
+			Vector<BenchmarkRelocatableHandle> vector;
+			for (SizeTp cnt = 0; cnt < VectorBenchmarkLength; ++cnt)
+			{
+				vector.InsertLast(BenchmarkRelocatableHandle(reinterpret_cast<Handle>(cnt)));
+			}
+		});
+		state.measure("Vector<Int32>", VectorBenchmarkLength, []
+		{
+			Vector<Vector<Int32>> vector;
+			for (SizeTp cnt = 0; cnt < VectorBenchmarkLength; ++cnt)
+			{
+				vector.InsertLast(Vector<Int32>());
+			}
+		});
+	};
+
+	gd_testing_benchmark(VectorInsertFirst, state)
+	{
+		SizeTp static const insertionsCount = 10000;
+		state.measure("Handle", insertionsCount, []
+		{
+			Vector<BenchmarkHandle> vector;
+			for (SizeTp cnt = 0; cnt < insertionsCount; ++cnt)
+			{
+				vector.InsertAt(0, BenchmarkHandle(reinterpret_cast<Handle>(cnt)));
+			}
+		});
+		state.measure("RelocatableHandle", insertionsCount, []
+		{
+			Vector<BenchmarkRelocatableHandle> vector;
+			for (SizeTp cnt = 0; cnt < insertionsCount; ++cnt)
+			{
+				vector.InsertAt(0, BenchmarkRelocatableHandle(reinterpret_cast<Handle>(cnt)));
+			}
+		});
+	};
+
+#endif	// if GD_TESTING_ENABLED
+
+GD_NAMESPACE_END
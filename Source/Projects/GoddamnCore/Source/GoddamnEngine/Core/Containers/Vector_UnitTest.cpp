@@ -195,6 +195,30 @@ GD_NAMESPACE_BEGIN
 		}
 	};
 
+	gd_testing_unit_test(VectorRelocation)
+	{
+		static_assert(TypeTraits::IsTriviallyRelocatable<int>::Value, "Trivially copyable types should be trivially relocatable.");
+		static_assert(TypeTraits::IsTriviallyRelocatable<VectorInt>::Value, "Vector should be trivially relocatable.");
+		static_assert(!TypeTraits::IsTriviallyCopyable<VectorInt>::Value, "Vector should not be trivially copyable.");
+
+		// Relocatable non-trivial elements are shifted with memory moves.
+		Vector<VectorInt> vector;
+		for (int cnt = 0; cnt < 100; ++cnt)
+		{
+			vector.InsertLast(VectorInt{ cnt, cnt });
+		}
+		vector.InsertAt(0, VectorInt{ -1 });
+		vector.InsertAt(50, VectorInt{ -2 });
+		gd_testing_verify(vector.GetLength() == 102);
+		gd_testing_verify(vector[0] == VectorInt{ -1 } && vector[1] == VectorInt{ 0, 0 });
+		gd_testing_verify(vector[50] == VectorInt{ -2 } && vector[51] == VectorInt{ 49, 49 } && vector[101] == VectorInt{ 99, 99 });
+
+		vector.EraseAt(0);
+		vector.EraseAt(49, 2);
+		gd_testing_verify(vector.GetLength() == 99);
+		gd_testing_verify(vector[0] == VectorInt{ 0, 0 } && vector[49] == VectorInt{ 50, 50 } && vector.GetLast() == VectorInt{ 99, 99 });
+	};
+
 	// We need to provide similar tests set for Boolean vector since it is implemented in different manner.
 	using VectorBool = Vector<bool>;
 
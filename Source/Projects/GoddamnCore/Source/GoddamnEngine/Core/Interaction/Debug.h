@@ -16,6 +16,7 @@
 #include <GoddamnEngine/Include.h>
 #include <GoddamnEngine/Core/PlatformSpecificInclude.h>
 #include <GoddamnEngine/Core/Containers/String.h>
+#include <GoddamnEngine/Core/Containers/StringFormat.h>
 #include <GoddamnEngine/Core/CStdlib/CStdio.h>
 
 GD_NAMESPACE_BEGIN
@@ -189,6 +190,10 @@ GD_NAMESPACE_BEGIN
 	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
 	class DebugGeneric : public TNonCreatable
 	{
+	private:
+		// Messages, formatted with the 'GD_FORMAT' format strings, are truncated to this length.
+		SizeTp static const FormatBufferLength = 1024;
+
 	public:
 
 		// ------------------------------------------------------------------------------------------
@@ -197,29 +202,62 @@ GD_NAMESPACE_BEGIN
 
 		/*!
 		 * Writes a log string.
+		 *
 		 * @param message The message to print.
+		 * @param format The format string, wrapped with the 'GD_FORMAT' macro.
+		 * @param args Format arguments.
 		 */
 		//! @{
 		GDAPI static void LogFormat(CStr const message, ...);
 		GDAPI static void Log(CStr const message);
+		template<typename TFormat, typename... TArgs>
+		GDINL static typename EnableIf<TypeTraits::IsBase<StringFormatLiteral, TFormat>::Value>::Type Log(TFormat const format, TArgs const&... args)
+		{
+			Char buffer[FormatBufferLength];
+			StringFormatBuffer bufferSink(buffer);
+			StringFormat::FormatTo(bufferSink, format, args...);
+			Log(bufferSink.CStr());
+		}
 		//! @}
 
 		/*!
 		 * Writes a warning string.
+		 *
 		 * @param message The message to print.
+		 * @param format The format string, wrapped with the 'GD_FORMAT' macro.
+		 * @param args Format arguments.
 		 */
 		//! @{
 		GDAPI static void LogWarningFormat(CStr const message, ...);
 		GDAPI static void LogWarning(CStr const message);
+		template<typename TFormat, typename... TArgs>
+		GDINL static typename EnableIf<TypeTraits::IsBase<StringFormatLiteral, TFormat>::Value>::Type LogWarning(TFormat const format, TArgs const&... args)
+		{
+			Char buffer[FormatBufferLength];
+			StringFormatBuffer bufferSink(buffer);
+			StringFormat::FormatTo(bufferSink, format, args...);
+			LogWarning(bufferSink.CStr());
+		}
 		//! @}
 
 		/*!
 		 * Writes a error string.
+		 *
 		 * @param message The message to print.
+		 * @param format The format string, wrapped with the 'GD_FORMAT' macro.
+		 * @param args Format arguments.
 		 */
 		//! @{
 		GDAPI static void LogErrorFormat(CStr const message, ...);
 		GDAPI static void LogError(CStr const message);
+		template<typename TFormat, typename... TArgs>
+		GDINL static typename EnableIf<TypeTraits::IsBase<StringFormatLiteral, TFormat>::Value>::Type LogError(TFormat const format, TArgs const&... args)
+		{
+			Char buffer[FormatBufferLength];
+			StringFormatBuffer bufferSink(buffer);
+			StringFormat::FormatTo(bufferSink, format, args...);
+			LogError(bufferSink.CStr());
+		}
 		//! @}
 
 		// ------------------------------------------------------------------------------------------
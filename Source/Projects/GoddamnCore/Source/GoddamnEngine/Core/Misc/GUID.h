@@ -212,6 +212,14 @@ GD_NAMESPACE_BEGIN
 		 */
 		GDAPI String ToString(Style const format = Style::HexDigits64BitWithHyphen) const;
 
+		/*!
+		 * Returns hash code of this GUID.
+		 */
+		GDINL HashCode GetHashCode() const
+		{
+			return HashCode(Hash::Combine(Hash::ComputeInteger((*this)[0]), (*this)[1]));
+		}
+
 	public:
 
 		/*!
@@ -0,0 +1,95 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/Misc/Hash.cpp
+ * File contains fast non-cryptographic 64-bit hashing functions and hashers of the common types.
+ */
+#include <GoddamnEngine/Core/Misc/Hash.h>
+
+GD_NAMESPACE_BEGIN
+
+	GDINL static UInt64 HashRead64(Byte const* const data)
+	{
+		UInt64 value;
+		CMemory::Memcpy(&value, data, sizeof value);
+		return value;
+	}
+
+	GDINL static UInt64 HashRead32(Byte const* const data)
+	{
+		UInt32 value;
+		CMemory::Memcpy(&value, data, sizeof value);
+		return value;
+	}
+
+	/*!
+	 * Computes hash of the memory block.
+	 *
+	 * @param data Pointer to the memory block.
+	 * @param sizeBytes Size of the memory block in bytes.
+	 * @param seed Seed of the hash.
+	 *
+	 * @returns 64-bit hash value.
+	 */
+	GDAPI UInt64 Hash::ComputeBytes(CHandle const data, SizeTp const sizeBytes, UInt64 const seed /*= 0*/)
+	{
+		GD_ASSERT(data != nullptr || sizeBytes == 0, "Null pointer data was specified.");
+
+		auto bytes = static_cast<Byte const*>(data);
+		auto state = seed ^ Mix(seed ^ Secret0, Secret1);
+		UInt64 a, b;
+		if (sizeBytes <= 16)
+		{
+			// Short inputs are read with overlapping loads, no loops or branches on each byte.
+			if (sizeBytes >= 4)
+			{
+				auto const shift = (sizeBytes >> 3) << 2;
+				a = (HashRead32(bytes) << 32) | HashRead32(bytes + shift);
+				b = (HashRead32(bytes + sizeBytes - 4) << 32) | HashRead32(bytes + sizeBytes - 4 - shift);
+			}
+			else if (sizeBytes > 0)
+			{
+				a = (static_cast<UInt64>(bytes[0]) << 16) | (static_cast<UInt64>(bytes[sizeBytes >> 1]) << 8) | bytes[sizeBytes - 1];
+				b = 0;
+			}
+			else
+			{
+				a = b = 0;
+			}
+		}
+		else
+		{
+			auto remaining = sizeBytes;
+			if (remaining > 48)
+			{
+				// Three independent lanes let the multiplications overlap in the pipeline.
+				auto state1 = state, state2 = state;
+				do
+				{
+					state  = Mix(HashRead64(bytes +  0) ^ Secret1, HashRead64(bytes +  8) ^ state);
+					state1 = Mix(HashRead64(bytes + 16) ^ Secret2, HashRead64(bytes + 24) ^ state1);
+					state2 = Mix(HashRead64(bytes + 32) ^ Secret3, HashRead64(bytes + 40) ^ state2);
+					bytes += 48;
+					remaining -= 48;
+				} while (remaining > 48);
+				state ^= state1 ^ state2;
+			}
+			while (remaining > 16)
+			{
+				state = Mix(HashRead64(bytes) ^ Secret1, HashRead64(bytes + 8) ^ state);
+				bytes += 16;
+				remaining -= 16;
+			}
+			a = HashRead64(bytes + remaining - 16);
+			b = HashRead64(bytes + remaining - 8);
+		}
+		return Mix(Secret1 ^ sizeBytes, Mix(a ^ Secret1, b ^ state));
+	}
+
+GD_NAMESPACE_END
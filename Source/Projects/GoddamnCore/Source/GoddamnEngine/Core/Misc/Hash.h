@@ -0,0 +1,258 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/Misc/Hash.h
+ * File contains fast non-cryptographic 64-bit hashing functions and hashers of the common types.
+ */
+#pragma once
+
+#include <GoddamnEngine/Include.h>
+#include <GoddamnEngine/Core/CStdlib/CMemory.h>
+#include <GoddamnEngine/Core/CStdlib/CString.h>
+#include <GoddamnEngine/Core/Templates/TypeTraits.h>
+#include <GoddamnEngine/Core/Templates/Algorithm.h>
+
+#if GD_COMPILER_MSVC_COMPATIBLE && GD_ARCHITECTURE_X64
+#	include <intrin.h>
+#endif	// if GD_COMPILER_MSVC_COMPATIBLE && GD_ARCHITECTURE_X64
+
+GD_NAMESPACE_BEGIN
+
+	template<typename TChar, SizeTp TInlineLength>
+	class BaseString;
+	template<typename TChar>
+	class BaseStringView;
+
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+	// ******                                   Hash class.                                    ******
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+
+	// **------------------------------------------------------------------------------------------**
+	//! Fast non-cryptographic 64-bit hashing functions.
+	//! Byte hashing follows the wyhash design: input is consumed in 48-byte blocks by three
+	//! independent multiply-fold lanes, short inputs are handled with a few overlapping reads.
+	//! Hashes are not stable between engine versions and should not be stored on disk.
+	// **------------------------------------------------------------------------------------------**
+	class Hash final : public TNonCreatable
+	{
+	public:
+		UInt64 static const Secret0 = 0xA0761D6478BD642Full;
+		UInt64 static const Secret1 = 0xE7037ED1A0B428DBull;
+		UInt64 static const Secret2 = 0x8EBC6AF09C88C6E3ull;
+		UInt64 static const Secret3 = 0x589965CC75374CC3ull;
+
+	public:
+
+		/*!
+		 * Multiplies two 64-bit integers and folds the 128-bit product into 64 bits.
+		 */
+		GDINL static UInt64 Mix(UInt64 const lhs, UInt64 const rhs)
+		{
+#if GD_COMPILER_GCC_COMPATIBLE && (GD_ARCHITECTURE_X64 || GD_ARCHITECTURE_ARM64)
+			auto const product = static_cast<unsigned __int128>(lhs) * rhs;
+			return static_cast<UInt64>(product) ^ static_cast<UInt64>(product >> 64);
+#elif GD_COMPILER_MSVC_COMPATIBLE && GD_ARCHITECTURE_X64
+			UInt64 productHigh;
+			auto const productLow = _umul128(lhs, rhs, &productHigh);
+			return productLow ^ productHigh;
+#else	// *** 128-bit multiplication. ***
+			auto const lhsLow = lhs & 0xFFFFFFFF, lhsHigh = lhs >> 32;
+			auto const rhsLow = rhs & 0xFFFFFFFF, rhsHigh = rhs >> 32;
+			auto const lowLow = lhsLow * rhsLow, lowHigh = lhsLow * rhsHigh;
+			auto const highLow = lhsHigh * rhsLow, highHigh = lhsHigh * rhsHigh;
+			auto const middle = (lowLow >> 32) + (lowHigh & 0xFFFFFFFF) + (highLow & 0xFFFFFFFF);
+			auto const productLow = (middle << 32) | (lowLow & 0xFFFFFFFF);
+			auto const productHigh = highHigh + (lowHigh >> 32) + (highLow >> 32) + (middle >> 32);
+			return productLow ^ productHigh;
+#endif	// *** 128-bit multiplication. ***
+		}
+
+		/*!
+		 * Computes hash of the memory block.
+		 *
+		 * @param data Pointer to the memory block.
+		 * @param sizeBytes Size of the memory block in bytes.
+		 * @param seed Seed of the hash.
+		 *
+		 * @returns 64-bit hash value.
+		 */
+		GDAPI static UInt64 ComputeBytes(CHandle const data, SizeTp const sizeBytes, UInt64 const seed = 0);
+
+		/*!
+		 * Computes hash of the 64-bit integer.
+		 */
+		GDINL static UInt64 ComputeInteger(UInt64 const value)
+		{
+			return Mix(value ^ Secret0, Secret1 ^ 8);
+		}
+
+		/*!
+		 * Combines two hash values. Operation is not commutative.
+		 *
+		 * @param seed Hash of the previous values.
+		 * @param hash Hash of the next value.
+		 */
+		GDINL static UInt64 Combine(UInt64 const seed, UInt64 const hash)
+		{
+			return Mix(seed ^ Secret2, hash ^ Secret3);
+		}
+	};	// class Hash
+
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+	// ******                                  Hasher<T> class.                                ******
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+
+	// **------------------------------------------------------------------------------------------**
+	//! Computes well-distributed 64-bit hashes of the values.
+	//! By default, values should provide the 'GetHashCode' method. Integers, enums, floats,
+	//! pointers and strings are supported out of box.
+	//!
+	//! @tparam TValue Type of the hashed value.
+	// **------------------------------------------------------------------------------------------**
+	template<typename TValue, typename = void>
+	struct Hasher final
+	{
+	public:
+		GDINL UInt64 operator()(TValue const& value) const
+		{
+			// User hash codes could be poorly distributed.
+			return Hash::ComputeInteger(value.GetHashCode().GetValue());
+		}
+	};	// struct Hasher
+
+	template<typename TValue>
+	struct Hasher<TValue, typename EnableIf<TypeTraits::IsIntegral<TValue>::Value || TypeTraits::IsEnum<TValue>::Value || TypeTraits::IsCharacter<TValue>::Value || TypeTraits::IsSame<TValue, bool>::Value>::Type> final
+	{
+	public:
+		GDINL UInt64 operator()(TValue const value) const
+		{
+			return Hash::ComputeInteger(static_cast<UInt64>(value));
+		}
+	};	// struct Hasher<integer>
+
+	template<typename TValue>
+	struct Hasher<TValue, typename EnableIf<TypeTraits::IsFloatingPoint<TValue>::Value>::Type> final
+	{
+	public:
+		GDINL UInt64 operator()(TValue const value) const
+		{
+			// Positive and negative zeros are equal, but have different representations.
+			if (value == TValue(0))
+			{
+				return Hash::ComputeInteger(0);
+			}
+			UInt64 valueBits = 0;
+			CMemory::Memcpy(&valueBits, &value, sizeof value);
+			return Hash::ComputeInteger(valueBits);
+		}
+	};	// struct Hasher<floating point>
+
+	template<typename TValue>
+	struct Hasher<TValue*> final
+	{
+	public:
+		GDINL UInt64 operator()(TValue const* const value) const
+		{
+			return Hash::ComputeInteger(static_cast<UInt64>(reinterpret_cast<UIntPtr>(value)));
+		}
+	};	// struct Hasher<pointer>
+
+	// **------------------------------------------------------------------------------------------**
+	//! Hasher for strings. Supports hashing of C strings and string views without constructing
+	//! a temporary string, so string-keyed hash tables could be searched with literals and views.
+	// **------------------------------------------------------------------------------------------**
+	template<typename TChar, SizeTp TInlineLength>
+	struct Hasher<BaseString<TChar, TInlineLength>> final
+	{
+	public:
+		GDINL UInt64 operator()(TChar const* const string) const
+		{
+			return Hash::ComputeBytes(string, CString::Strlen(string) * sizeof(TChar));
+		}
+		GDINL UInt64 operator()(BaseString<TChar, TInlineLength> const& string) const
+		{
+			return Hash::ComputeBytes(string.CStr(), string.GetLength() * sizeof(TChar));
+		}
+		GDINL UInt64 operator()(BaseStringView<TChar> const& string) const
+		{
+			return Hash::ComputeBytes(string.GetData(), string.GetLength() * sizeof(TChar));
+		}
+	};	// struct Hasher<string>
+
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+	// ******                                 HashBuilder class.                               ******
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+
+	// **------------------------------------------------------------------------------------------**
+	//! Combines hashes of multiple values, e.g. fields of the structure.
+	//!
+	//! @code
+	//!		GDINL HashCode GetHashCode() const
+	//!		{
+	//!			return HashBuilder().Add(Position).Add(Name).GetHashCode();
+	//!		}
+	//! @endcode
+	// **------------------------------------------------------------------------------------------**
+	class HashBuilder final
+	{
+	private:
+		UInt64 m_Value;
+
+	public:
+
+		/*!
+		 * Initializes a new hash builder.
+		 * @param seed Seed of the hash.
+		 */
+		GDINL explicit HashBuilder(UInt64 const seed = 0)
+			: m_Value(seed)
+		{
+		}
+
+		/*!
+		 * Appends hash of the value.
+		 * @param value The value to hash.
+		 */
+		template<typename TValue>
+		GDINL HashBuilder& Add(TValue const& value)
+		{
+			m_Value = Hash::Combine(m_Value, Hasher<TValue>()(value));
+			return *this;
+		}
+
+		/*!
+		 * Appends hash of the memory block.
+		 *
+		 * @param data Pointer to the memory block.
+		 * @param sizeBytes Size of the memory block in bytes.
+		 */
+		GDINL HashBuilder& AddBytes(CHandle const data, SizeTp const sizeBytes)
+		{
+			m_Value = Hash::Combine(m_Value, Hash::ComputeBytes(data, sizeBytes));
+			return *this;
+		}
+
+		/*!
+		 * Returns combined hash value.
+		 */
+		GDINL UInt64 GetValue() const
+		{
+			return m_Value;
+		}
+
+		/*!
+		 * Returns combined hash code.
+		 */
+		GDINL HashCode GetHashCode() const
+		{
+			return HashCode(m_Value);
+		}
+	};	// class HashBuilder
+
+GD_NAMESPACE_END
@@ -0,0 +1,97 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*! 
+ * @file GoddamnEngine/Core/Misc/Hash_UnitTests.cpp
+ * File contains unit tests for the hashing functions.
+ */
+#include <GoddamnEngine/Core/Misc/Hash.h>
+#if GD_TESTING_ENABLED
+
+#include <GoddamnEngine/Core/Containers/String.h>
+#include <GoddamnEngine/Core/Containers/Set.h>
+
+GD_NAMESPACE_BEGIN
+
+	gd_testing_unit_test(HashBytesLengths)
+	{
+		Byte bytes[200];
+		for (SizeTp i = 0; i < sizeof bytes; ++i)
+		{
+			bytes[i] = static_cast<Byte>(i * 7 + 3);
+		}
+
+		// All prefixes should have different hashes, including short and overlapping reads.
+		Set<UInt64> hashes;
+		for (SizeTp length = 0; length <= sizeof bytes; ++length)
+		{
+			auto const hash = Hash::ComputeBytes(bytes, length);
+			gd_testing_verify(hash == Hash::ComputeBytes(bytes, length));
+			gd_testing_verify(hash != Hash::ComputeBytes(bytes, length, 1));
+			gd_testing_verify(!hashes.Contains(hash));
+			hashes.Insert(hash);
+		}
+	};
+
+	gd_testing_unit_test(HashBytesAvalanche)
+	{
+		Byte bytes[100] = {};
+		for (SizeTp length = 1; length <= sizeof bytes; ++length)
+		{
+			auto const hash = Hash::ComputeBytes(bytes, length);
+			for (SizeTp bit = 0; bit < length * 8; bit += 3)
+			{
+				bytes[bit / 8] ^= 1 << (bit % 8);
+				gd_testing_verify(hash != Hash::ComputeBytes(bytes, length));
+				bytes[bit / 8] ^= 1 << (bit % 8);
+			}
+		}
+	};
+
+	gd_testing_unit_test(HashIntegersDistribution)
+	{
+		// Sequential integers should be spread evenly over both low and high bits.
+		SizeTp lowBuckets[64] = {}, highBuckets[64] = {};
+		for (UInt64 value = 0; value < 64 * 1024; ++value)
+		{
+			auto const hash = Hasher<UInt64>()(value);
+			++lowBuckets[hash & 63];
+			++highBuckets[hash >> 58];
+		}
+		for (SizeTp i = 0; i < 64; ++i)
+		{
+			gd_testing_verify(lowBuckets[i] > 768 && lowBuckets[i] < 1280);
+			gd_testing_verify(highBuckets[i] > 768 && highBuckets[i] < 1280);
+		}
+	};
+
+	gd_testing_unit_test(HashHashers)
+	{
+		gd_testing_verify(Hasher<Float32>()(0.0f) == Hasher<Float32>()(-0.0f));
+		gd_testing_verify(Hasher<Float64>()(1.0) != Hasher<Float64>()(-1.0));
+		gd_testing_verify(Hasher<bool>()(true) != Hasher<bool>()(false));
+
+		String const string = "Hello, world!";
+		gd_testing_verify(Hasher<String>()(string) == Hasher<String>()("Hello, world!"));
+		gd_testing_verify(Hasher<String>()(string) != Hasher<String>()("Hello, world?"));
+		gd_testing_verify(string.GetHashCode().GetValue() == Hasher<String>()(string));
+		gd_testing_verify(Hasher<WideString>()(L"Hello") == Hasher<WideString>()(WideString(L"Hello")));
+	};
+
+	gd_testing_unit_test(HashBuilderOrder)
+	{
+		auto const hashAB = HashBuilder().Add(1).Add(String("2")).GetValue();
+		auto const hashBA = HashBuilder().Add(String("2")).Add(1).GetValue();
+		gd_testing_verify(hashAB != hashBA);
+		gd_testing_verify(hashAB == HashBuilder().Add(1).Add(String("2")).GetValue());
+		gd_testing_verify(HashBuilder().Add(0).GetValue() != HashBuilder().Add(0).Add(0).GetValue());
+	};
+
+GD_NAMESPACE_END
+
+#endif	// if GD_TESTING_ENABLED
@@ -0,0 +1,535 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+
+/*!
+ * @file GoddamnEngine/Core/Misc/HeapProfiler.cpp
+ * File contains heap profiler that tracks allocations per callsite.
+ */
+#include <GoddamnEngine/Core/Misc/HeapProfiler.h>
+#include <GoddamnEngine/Core/Concurrency/CriticalSection.h>
+#include <GoddamnEngine/Core/CStdlib/CMemory.h>
+#include <GoddamnEngine/Core/CStdlib/CString.h>
+#include <GoddamnEngine/Core/CStdlib/CStdio.h>
+
+#if GD_PLATFORM_API_MICROSOFT
+#	include <Windows.h>
+#elif GD_PLATFORM_API_POSIX
+#	include <execinfo.h>
+#endif	// if GD_PLATFORM_API_MICROSOFT
+
+GD_NAMESPACE_BEGIN
+
+	// ------------------------------------------------------------------------------------------
+	// Bookkeeping tables.
+	// ------------------------------------------------------------------------------------------
+
+	/*!
+	 * Open addressing hash table with linear probing.
+	 * Memory is requested directly from the platform allocator, so bookkeeping never recurses into the profiler.
+	 */
+	template<typename TEntry>
+	class HeapProfilerTable final : public TNonCopyable
+	{
+	public:
+		using KeyType = typename TEntry::KeyType;
+
+	private:
+		TEntry* m_Entries  = nullptr;
+		SizeTp  m_Capacity = 0;
+		SizeTp  m_Length   = 0;
+
+	public:
+		GDINL ~HeapProfilerTable()
+		{
+			IPlatformAllocator::Get().MemoryFree(m_Entries);
+		}
+
+		GDINL TEntry* GetEntries() const
+		{
+			return m_Entries;
+		}
+
+		GDINL SizeTp GetCapacity() const
+		{
+			return m_Capacity;
+		}
+
+		/*!
+		 * Returns entry with the specified key or nullptr if nothing was found.
+		 */
+		GDINL TEntry* Find(KeyType const& key) const
+		{
+			if (m_Length != 0)
+			{
+				for (auto index = TEntry::Hash(key) & (m_Capacity - 1);; index = (index + 1) & (m_Capacity - 1))
+				{
+					auto const entry = m_Entries + index;
+					if (entry->IsEmpty())
+					{
+						return nullptr;
+					}
+					if (entry->GetKey() == key)
+					{
+						return entry;
+					}
+				}
+			}
+			return nullptr;
+		}
+
+		/*!
+		 * Returns entry with the specified key, inserting a zeroed one if nothing was found.
+		 * Inserted entry should be assigned a key immediately.
+		 */
+		GDINL TEntry* FindOrInsert(KeyType const& key, bool& inserted)
+		{
+			if ((m_Length + 1) * 2 > m_Capacity)
+			{
+				Grow();
+			}
+			for (auto index = TEntry::Hash(key) & (m_Capacity - 1);; index = (index + 1) & (m_Capacity - 1))
+			{
+				auto const entry = m_Entries + index;
+				if (entry->IsEmpty())
+				{
+					++m_Length;
+					inserted = true;
+					return entry;
+				}
+				if (entry->GetKey() == key)
+				{
+					inserted = false;
+					return entry;
+				}
+			}
+		}
+
+		/*!
+		 * Erases the entry, shifting back the following entries of the probe sequence.
+		 */
+		GDINL void Erase(TEntry* const entry)
+		{
+			auto hole = static_cast<SizeTp>(entry - m_Entries);
+			for (auto index = (hole + 1) & (m_Capacity - 1); !m_Entries[index].IsEmpty(); index = (index + 1) & (m_Capacity - 1))
+			{
+				// Entry may fill the hole only if its home slot is not in the range (hole, index].
+				auto const home = TEntry::Hash(m_Entries[index].GetKey()) & (m_Capacity - 1);
+				if (((index - home) & (m_Capacity - 1)) >= ((index - hole) & (m_Capacity - 1)))
+				{
+					m_Entries[hole] = m_Entries[index];
+					hole = index;
+				}
+			}
+			CMemory::Memset(m_Entries + hole, 0, sizeof(TEntry));
+			--m_Length;
+		}
+
+	private:
+		GDINL void Grow()
+		{
+			auto const oldEntries = m_Entries;
+			auto const oldCapacity = m_Capacity;
+
+			m_Capacity = m_Capacity != 0 ? m_Capacity * 2 : 1024;
+			Handle newEntries = nullptr;
+			GD_VERIFY(IPlatformAllocator::Get().MemoryAllocate(newEntries, m_Capacity * sizeof(TEntry)), "Failed to grow the heap profiler table.");
+			m_Entries = static_cast<TEntry*>(CMemory::Memset(newEntries, 0, m_Capacity * sizeof(TEntry)));
+
+			for (SizeTp cnt = 0; cnt < oldCapacity; ++cnt)
+			{
+				if (!oldEntries[cnt].IsEmpty())
+				{
+					auto index = TEntry::Hash(oldEntries[cnt].GetKey()) & (m_Capacity - 1);
+					while (!m_Entries[index].IsEmpty())
+					{
+						index = (index + 1) & (m_Capacity - 1);
+					}
+					m_Entries[index] = oldEntries[cnt];
+				}
+			}
+			IPlatformAllocator::Get().MemoryFree(oldEntries);
+		}
+	};	// class HeapProfilerTable
+
+	/*!
+	 * Callsite is identified by the filename pointer and line number.
+	 */
+	struct HeapProfilerCallsiteKey final
+	{
+		CStr   Filename;
+		UInt32 LineNumber;
+
+		GDINL bool operator== (HeapProfilerCallsiteKey const& other) const
+		{
+			return Filename == other.Filename && LineNumber == other.LineNumber;
+		}
+	};	// struct HeapProfilerCallsiteKey
+
+	struct HeapProfilerCallsiteEntry final
+	{
+		using KeyType = HeapProfilerCallsiteKey;
+
+		bool                 IsUsed;
+		HeapProfilerCallsite Callsite;
+
+		GDINL static SizeTp Hash(KeyType const& key)
+		{
+			return (reinterpret_cast<SizeTp>(key.Filename) >> 3) * 31 + key.LineNumber * 2654435761u;
+		}
+		GDINL KeyType GetKey() const
+		{
+			return { Callsite.Filename, Callsite.LineNumber };
+		}
+		GDINL bool IsEmpty() const
+		{
+			return !IsUsed;
+		}
+	};	// struct HeapProfilerCallsiteEntry
+
+	struct HeapProfilerAllocationEntry final
+	{
+		using KeyType = Handle;
+
+		Handle                  Pointer;
+		SizeTp                  SizeBytes;
+		HeapProfilerCallsiteKey Callsite;
+
+		GDINL static SizeTp Hash(KeyType const& key)
+		{
+			auto const bits = reinterpret_cast<SizeTp>(key) >> 4;
+			return bits ^ (bits >> 16);
+		}
+		GDINL KeyType GetKey() const
+		{
+			return Pointer;
+		}
+		GDINL bool IsEmpty() const
+		{
+			return Pointer == nullptr;
+		}
+	};	// struct HeapProfilerAllocationEntry
+
+	// ------------------------------------------------------------------------------------------
+	// Global state.
+	// ------------------------------------------------------------------------------------------
+
+	struct HeapProfilerState final : public TNonCopyable
+	{
+		CriticalSection                                Lock;
+		HeapProfilerTable<HeapProfilerCallsiteEntry>   Callsites;
+		HeapProfilerTable<HeapProfilerAllocationEntry> Allocations;
+	};	// struct HeapProfilerState
+
+	GDINT static bool volatile g_HeapProfilerIsEnabled = false;
+	GDINT static UInt32 volatile g_HeapProfilerSamplingRate = 0;
+	GDINT static HeapProfilerState* volatile g_HeapProfilerState = nullptr;
+	GDINT static GD_THREAD_LOCAL bool g_HeapProfilerIsInside = false;
+	GDINT static GD_THREAD_LOCAL UInt32 g_HeapProfilerNoAllocationsDepth = 0;
+
+	/*!
+	 * Marks current thread as the one that is running the profiler code.
+	 * Allocations made by the profiler itself are not tracked.
+	 */
+	struct HeapProfilerReentrancyGuard final : public TNonCopyable
+	{
+		GDINL HeapProfilerReentrancyGuard()
+		{
+			g_HeapProfilerIsInside = true;
+		}
+		GDINL ~HeapProfilerReentrancyGuard()
+		{
+			g_HeapProfilerIsInside = false;
+		}
+	};	// struct HeapProfilerReentrancyGuard
+
+	/*!
+	 * Returns the profiler state, creating it on the first use.
+	 * State is intentionally never destroyed: memory may still be freed during static destruction.
+	 */
+	GDINT static HeapProfilerState& GetHeapProfilerState()
+	{
+		alignas(HeapProfilerState) static Byte stateMemory[sizeof(HeapProfilerState)];
+		static HeapProfilerState* const state = new (stateMemory) HeapProfilerState();
+		g_HeapProfilerState = state;
+		return *state;
+	}
+
+	// ------------------------------------------------------------------------------------------
+	// HeapProfilerSnapshot class.
+	// ------------------------------------------------------------------------------------------
+
+	/*!
+	 * Searches for the statistics of the specified callsite.
+	 *
+	 * @param filename File in which allocation is requested.
+	 * @param lineNumber Line number in which allocation is requested.
+	 *
+	 * @returns Pointer to the callsite statistics or nullptr if nothing was found.
+	 */
+	GDAPI HeapProfilerCallsite const* HeapProfilerSnapshot::FindCallsite(CStr const filename, UInt32 const lineNumber) const
+	{
+		for (auto const& callsite : m_Callsites)
+		{
+			if (callsite.LineNumber == lineNumber && (callsite.Filename == filename
+				|| (callsite.Filename != nullptr && filename != nullptr && CString::Strcmp(callsite.Filename, filename) == 0)))
+			{
+				return &callsite;
+			}
+		}
+		return nullptr;
+	}
+
+	/*!
+	 * Returns total amount of bytes that are allocated and not yet freed.
+	 */
+	GDAPI Int64 HeapProfilerSnapshot::GetLiveBytes() const
+	{
+		Int64 liveBytes = 0;
+		for (auto const& callsite : m_Callsites)
+		{
+			liveBytes += callsite.LiveBytes;
+		}
+		return liveBytes;
+	}
+
+	/*!
+	 * Returns total amount of allocations that are not yet freed.
+	 */
+	GDAPI Int64 HeapProfilerSnapshot::GetLiveAllocations() const
+	{
+		Int64 liveAllocations = 0;
+		for (auto const& callsite : m_Callsites)
+		{
+			liveAllocations += callsite.LiveAllocations;
+		}
+		return liveAllocations;
+	}
+
+	/*!
+	 * Computes difference between this and the older snapshot.
+	 * Live and total counters of the result contain deltas, callsites without any changes are skipped.
+	 *
+	 * @param olderSnapshot Snapshot that was taken before this one.
+	 * @returns Snapshot with differences.
+	 */
+	GDAPI HeapProfilerSnapshot HeapProfilerSnapshot::Diff(HeapProfilerSnapshot const& olderSnapshot) const
+	{
+		HeapProfilerSnapshot diff;
+		for (auto const& callsite : m_Callsites)
+		{
+			auto delta = callsite;
+			for (auto const& olderCallsite : olderSnapshot.m_Callsites)
+			{
+				// Both snapshots come from the same table, so filename pointers are comparable.
+				if (olderCallsite.Filename == callsite.Filename && olderCallsite.LineNumber == callsite.LineNumber)
+				{
+					delta.LiveBytes -= olderCallsite.LiveBytes;
+					delta.LiveAllocations -= olderCallsite.LiveAllocations;
+					delta.TotalBytes -= olderCallsite.TotalBytes;
+					delta.TotalAllocations -= olderCallsite.TotalAllocations;
+					break;
+				}
+			}
+			if (delta.TotalAllocations != 0 || delta.LiveAllocations != 0)
+			{
+				diff.m_Callsites.InsertLast(delta);
+			}
+		}
+		return diff;
+	}
+
+	/*!
+	 * Writes this snapshot into the text file, one line per callsite.
+	 *
+	 * @param filename Path to the output file.
+	 * @returns True if operation succeeded.
+	 */
+	GDAPI bool HeapProfilerSnapshot::ExportToFile(CStr const filename) const
+	{
+		auto const file = CStdio::Fopen(filename, "wb");
+		if (file == nullptr)
+		{
+			return false;
+		}
+
+		Char line[512];
+		auto const header = "# callsite\tlive_bytes\tlive_allocations\tpeak_live_bytes\ttotal_bytes\ttotal_allocations\tstack_trace\n";
+		auto result = CStdio::Fwrite(header, CString::Strlen(header), 1, file) == 1;
+		for (auto const& callsite : m_Callsites)
+		{
+			auto lineLength = static_cast<SizeTp>(CString::Snprintf(line, GetLength(line), "%s:%u\t%lld\t%lld\t%lld\t%llu\t%llu\t"
+				, callsite.Filename != nullptr ? callsite.Filename : "<unknown>", callsite.LineNumber
+				, static_cast<long long>(callsite.LiveBytes), static_cast<long long>(callsite.LiveAllocations), static_cast<long long>(callsite.PeakLiveBytes)
+				, static_cast<unsigned long long>(callsite.TotalBytes), static_cast<unsigned long long>(callsite.TotalAllocations)));
+			for (SizeTp cnt = 0; cnt < callsite.StackTraceDepth && lineLength < GetLength(line) - 32; ++cnt)
+			{
+				lineLength += CString::Snprintf(line + lineLength, GetLength(line) - lineLength, cnt == 0 ? "%p" : ",%p", callsite.StackTrace[cnt]);
+			}
+			lineLength = Min(lineLength, GetLength(line) - 1);
+			line[lineLength++] = '\n';
+			result &= CStdio::Fwrite(line, lineLength, 1, file) == 1;
+		}
+
+		result &= CStdio::Fclose(file) == 0;
+		return result;
+	}
+
+	// ------------------------------------------------------------------------------------------
+	// HeapProfiler class.
+	// ------------------------------------------------------------------------------------------
+
+	/*!
+	 * Enables or disables tracking of the allocations.
+	 * Memory blocks that were allocated while profiler was disabled are ignored.
+	 */
+	GDAPI void HeapProfiler::SetEnabled(bool const enabled)
+	{
+		g_HeapProfilerIsEnabled = enabled;
+	}
+
+	/*!
+	 * Returns true if tracking of the allocations is enabled.
+	 */
+	GDAPI bool HeapProfiler::IsEnabled()
+	{
+		return g_HeapProfilerIsEnabled;
+	}
+
+	/*!
+	 * Specifies how often stack traces are sampled.
+	 * Stack trace would be captured for each Nth allocation of the callsite, zero disables sampling.
+	 */
+	GDAPI void HeapProfiler::SetStackTraceSamplingRate(UInt32 const samplingRate)
+	{
+		g_HeapProfilerSamplingRate = samplingRate;
+	}
+
+	/*!
+	 * Captures statistics of all callsites.
+	 */
+	GDAPI HeapProfilerSnapshot HeapProfiler::TakeSnapshot()
+	{
+		HeapProfilerSnapshot snapshot;
+		HeapProfilerReentrancyGuard const guard;
+		auto& state = GetHeapProfilerState();
+		ScopedCriticalSection const lock(state.Lock);
+		for (SizeTp cnt = 0; cnt < state.Callsites.GetCapacity(); ++cnt)
+		{
+			auto const& entry = state.Callsites.GetEntries()[cnt];
+			if (!entry.IsEmpty())
+			{
+				snapshot.m_Callsites.InsertLast(entry.Callsite);
+			}
+		}
+		return snapshot;
+	}
+
+	/*!
+	 * Callback for the allocation of the memory block.
+	 * @note Should be only called by the memory allocation functions.
+	 */
+	GDAPI void HeapProfiler::OnAllocate(Handle const allocationPointer, SizeTp const allocationSizeBytes, CStr const allocationFilename, UInt32 const allocationLineNumber)
+	{
+		if (g_HeapProfilerIsInside)
+		{
+			return;
+		}
+		if (g_HeapProfilerNoAllocationsDepth != 0)
+		{
+			HeapProfilerReentrancyGuard const guard;
+			GD_ASSERT_FALSE("Memory was allocated inside the no-allocations scope.");
+		}
+		if (!g_HeapProfilerIsEnabled || allocationPointer == nullptr)
+		{
+			return;
+		}
+
+		HeapProfilerReentrancyGuard const guard;
+		auto& state = GetHeapProfilerState();
+		ScopedCriticalSection const lock(state.Lock);
+
+		HeapProfilerCallsiteKey const callsiteKey = { allocationFilename, allocationLineNumber };
+		bool inserted = false;
+		auto const callsiteEntry = state.Callsites.FindOrInsert(callsiteKey, inserted);
+		auto& callsite = callsiteEntry->Callsite;
+		if (inserted)
+		{
+			callsiteEntry->IsUsed = true;
+			callsite.Filename = allocationFilename;
+			callsite.LineNumber = allocationLineNumber;
+		}
+		callsite.LiveBytes += allocationSizeBytes;
+		callsite.LiveAllocations += 1;
+		callsite.TotalBytes += allocationSizeBytes;
+		callsite.TotalAllocations += 1;
+		if (callsite.PeakLiveBytes < callsite.LiveBytes)
+		{
+			callsite.PeakLiveBytes = callsite.LiveBytes;
+		}
+
+		auto const samplingRate = g_HeapProfilerSamplingRate;
+		if (samplingRate != 0 && callsite.TotalAllocations % samplingRate == 1 % samplingRate)
+		{
+#if GD_PLATFORM_API_MICROSOFT
+			callsite.StackTraceDepth = static_cast<SizeTp>(RtlCaptureStackBackTrace(0, HeapProfilerMaxStackTraceDepth, callsite.StackTrace, nullptr));
+#elif GD_PLATFORM_API_POSIX
+			callsite.StackTraceDepth = static_cast<SizeTp>(backtrace(callsite.StackTrace, HeapProfilerMaxStackTraceDepth));
+#endif	// if GD_PLATFORM_API_MICROSOFT
+		}
+
+		// Callsite entry pointer is not used below, so the allocations table may grow freely.
+		auto const allocationEntry = state.Allocations.FindOrInsert(allocationPointer, inserted);
+		GD_ASSERT(inserted, "Memory block was allocated twice without being freed.");
+		allocationEntry->Pointer = allocationPointer;
+		allocationEntry->SizeBytes = allocationSizeBytes;
+		allocationEntry->Callsite = callsiteKey;
+	}
+
+	/*!
+	 * Callback for the deallocation of the memory block.
+	 * @note Should be only called by the memory deallocation functions.
+	 */
+	GDAPI void HeapProfiler::OnFree(Handle const allocationPointer)
+	{
+		// Blocks that were tracked must be forgotten even if profiler was disabled in between.
+		if (g_HeapProfilerIsInside || g_HeapProfilerState == nullptr || allocationPointer == nullptr)
+		{
+			return;
+		}
+
+		HeapProfilerReentrancyGuard const guard;
+		auto& state = *g_HeapProfilerState;
+		ScopedCriticalSection const lock(state.Lock);
+
+		auto const allocationEntry = state.Allocations.Find(allocationPointer);
+		if (allocationEntry != nullptr)
+		{
+			auto const callsiteEntry = state.Callsites.Find(allocationEntry->Callsite);
+			GD_ASSERT(callsiteEntry != nullptr);
+			callsiteEntry->Callsite.LiveBytes -= allocationEntry->SizeBytes;
+			callsiteEntry->Callsite.LiveAllocations -= 1;
+			state.Allocations.Erase(allocationEntry);
+		}
+	}
+
+	// ------------------------------------------------------------------------------------------
+	// HeapProfilerNoAllocationsScope class.
+	// ------------------------------------------------------------------------------------------
+
+	GDAPI HeapProfilerNoAllocationsScope::HeapProfilerNoAllocationsScope()
+	{
+		++g_HeapProfilerNoAllocationsDepth;
+	}
+
+	GDAPI HeapProfilerNoAllocationsScope::~HeapProfilerNoAllocationsScope()
+	{
+		--g_HeapProfilerNoAllocationsDepth;
+	}
+
+GD_NAMESPACE_END
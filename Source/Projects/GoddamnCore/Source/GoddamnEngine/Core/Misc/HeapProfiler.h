@@ -0,0 +1,162 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+
+/*!
+ * @file GoddamnEngine/Core/Misc/HeapProfiler.h
+ * File contains heap profiler that tracks allocations per callsite.
+ */
+#pragma once
+
+#include <GoddamnEngine/Include.h>
+#include <GoddamnEngine/Core/Containers/Vector.h>
+
+/*!
+ * Enables tracking of the allocations, made with @c GD_MALLOC and @c gd_new.
+ * Callsites are only known in debug builds, all other allocations are reported as unknown.
+ */
+#ifndef GD_HEAP_PROFILER_ENABLED
+#define GD_HEAP_PROFILER_ENABLED GD_DEBUG
+#endif	// ifndef GD_HEAP_PROFILER_ENABLED
+
+GD_NAMESPACE_BEGIN
+
+	enum : SizeTp
+	{
+		HeapProfilerMaxStackTraceDepth = 16,
+	};
+
+	// **------------------------------------------------------------------------------------------**
+	//! Allocation statistics of a single callsite.
+	// **------------------------------------------------------------------------------------------**
+	struct HeapProfilerCallsite final
+	{
+	public:
+		CStr   Filename;
+		UInt32 LineNumber;
+		Int64  LiveBytes;
+		Int64  LiveAllocations;
+		Int64  PeakLiveBytes;
+		UInt64 TotalBytes;
+		UInt64 TotalAllocations;
+		SizeTp StackTraceDepth;
+		Handle StackTrace[HeapProfilerMaxStackTraceDepth];
+	};	// struct HeapProfilerCallsite
+
+	// **------------------------------------------------------------------------------------------**
+	//! Statistics of all callsites at some point of time.
+	// **------------------------------------------------------------------------------------------**
+	class HeapProfilerSnapshot final
+	{
+		friend class HeapProfiler;
+
+	private:
+		Vector<HeapProfilerCallsite> m_Callsites;
+
+	public:
+
+		/*!
+		 * Returns statistics of all callsites in this snapshot.
+		 */
+		GDINL Vector<HeapProfilerCallsite> const& GetCallsites() const
+		{
+			return m_Callsites;
+		}
+
+		/*!
+		 * Searches for the statistics of the specified callsite.
+		 *
+		 * @param filename File in which allocation is requested.
+		 * @param lineNumber Line number in which allocation is requested.
+		 *
+		 * @returns Pointer to the callsite statistics or nullptr if nothing was found.
+		 */
+		GDAPI HeapProfilerCallsite const* FindCallsite(CStr const filename, UInt32 const lineNumber) const;
+
+		/*!
+		 * Returns total amount of bytes that are allocated and not yet freed.
+		 */
+		GDAPI Int64 GetLiveBytes() const;
+
+		/*!
+		 * Returns total amount of allocations that are not yet freed.
+		 */
+		GDAPI Int64 GetLiveAllocations() const;
+
+		/*!
+		 * Computes difference between this and the older snapshot.
+		 * Live and total counters of the result contain deltas, callsites without any changes are skipped.
+		 *
+		 * @param olderSnapshot Snapshot that was taken before this one.
+		 * @returns Snapshot with differences.
+		 */
+		GDAPI HeapProfilerSnapshot Diff(HeapProfilerSnapshot const& olderSnapshot) const;
+
+		/*!
+		 * Writes this snapshot into the text file, one line per callsite.
+		 *
+		 * @param filename Path to the output file.
+		 * @returns True if operation succeeded.
+		 */
+		GDAPI bool ExportToFile(CStr const filename) const;
+	};	// class HeapProfilerSnapshot
+
+	// **------------------------------------------------------------------------------------------**
+	//! Tracks live bytes, allocation counts and peaks per allocation callsite.
+	// **------------------------------------------------------------------------------------------**
+	class HeapProfiler final : public TNonCreatable
+	{
+	public:
+
+		/*!
+		 * Enables or disables tracking of the allocations.
+		 * Memory blocks that were allocated while profiler was disabled are ignored.
+		 */
+		GDAPI static void SetEnabled(bool const enabled);
+
+		/*!
+		 * Returns true if tracking of the allocations is enabled.
+		 */
+		GDAPI static bool IsEnabled();
+
+		/*!
+		 * Specifies how often stack traces are sampled.
+		 * Stack trace would be captured for each Nth allocation of the callsite, zero disables sampling.
+		 */
+		GDAPI static void SetStackTraceSamplingRate(UInt32 const samplingRate);
+
+		/*!
+		 * Captures statistics of all callsites.
+		 */
+		GDAPI static HeapProfilerSnapshot TakeSnapshot();
+
+		/*!
+		 * Callback for the allocation of the memory block.
+		 * @note Should be only called by the memory allocation functions.
+		 */
+		GDAPI static void OnAllocate(Handle const allocationPointer, SizeTp const allocationSizeBytes, CStr const allocationFilename, UInt32 const allocationLineNumber);
+
+		/*!
+		 * Callback for the deallocation of the memory block.
+		 * @note Should be only called by the memory deallocation functions.
+		 */
+		GDAPI static void OnFree(Handle const allocationPointer);
+	};	// class HeapProfiler
+
+	// **------------------------------------------------------------------------------------------**
+	//! Asserts that no memory is allocated by the current thread while the scope is alive.
+	//! Useful for hot loops that are expected to run without touching the heap.
+	// **------------------------------------------------------------------------------------------**
+	struct HeapProfilerNoAllocationsScope final : public TNonCopyable
+	{
+	public:
+		GDAPI HeapProfilerNoAllocationsScope();
+		GDAPI ~HeapProfilerNoAllocationsScope();
+	};	// struct HeapProfilerNoAllocationsScope
+
+GD_NAMESPACE_END
@@ -0,0 +1,89 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+
+/*! 
+ * @file GoddamnEngine/Core/Misc/HeapProfiler_UnitTests.cpp
+ * File contains unit tests for the heap profiler.
+ */
+#include <GoddamnEngine/Core/Misc/HeapProfiler.h>
+
+GD_NAMESPACE_BEGIN
+
+#if GD_TESTING_ENABLED && GD_HEAP_PROFILER_ENABLED
+
+	gd_testing_unit_test(HeapProfilerCallsites)
+	{
+		HeapProfiler::SetEnabled(true);
+		auto const olderSnapshot = HeapProfiler::TakeSnapshot();
+
+		Handle blocks[3];
+		UInt32 const blocksLineNumber = __LINE__ + 3;
+		for (auto& block : blocks)
+		{
+			block = GD_MALLOC(100);
+		}
+		auto const newerSnapshot = HeapProfiler::TakeSnapshot();
+
+		for (auto const block : blocks)
+		{
+			GD_FREE(block);
+		}
+		auto const newestSnapshot = HeapProfiler::TakeSnapshot();
+		HeapProfiler::SetEnabled(false);
+
+		{
+			// This should succeed.
+			auto const diff = newerSnapshot.Diff(olderSnapshot);
+			auto const blocksCallsite = diff.FindCallsite(__FILE__, blocksLineNumber);
+			gd_testing_verify(blocksCallsite != nullptr);
+			gd_testing_verify(blocksCallsite->LiveAllocations == 3);
+			gd_testing_verify(blocksCallsite->LiveBytes == 300);
+			gd_testing_verify(blocksCallsite->PeakLiveBytes >= 300);
+		}
+
+		{
+			// This should succeed: all blocks were freed.
+			auto const diff = newestSnapshot.Diff(olderSnapshot);
+			auto const blocksCallsite = diff.FindCallsite(__FILE__, blocksLineNumber);
+			gd_testing_verify(blocksCallsite != nullptr);
+			gd_testing_verify(blocksCallsite->LiveAllocations == 0);
+			gd_testing_verify(blocksCallsite->TotalAllocations == 3);
+		}
+	};
+
+	gd_testing_unit_test(HeapProfilerNoAllocationsScope)
+	{
+		{
+			// This should succeed.
+			HeapProfilerNoAllocationsScope const noAllocationsScope;
+			Int32 sum = 0;
+			for (Int32 cnt = 0; cnt < 100; ++cnt)
+			{
+				sum += cnt;
+			}
+			gd_testing_verify(sum == 4950);
+		}
+
+		try
+		{
+			// This should fail: memory is allocated inside the scope.
+			HeapProfilerNoAllocationsScope const noAllocationsScope;
+			auto const block = GD_MALLOC(100);
+			GD_FREE(block);
+			gd_testing_verify(false);
+		}
+		catch (goddamn_testing::assertion_exception const&)
+		{
+			gd_testing_verify(true);
+		}
+	};
+
+#endif	// if GD_TESTING_ENABLED && GD_HEAP_PROFILER_ENABLED
+
+GD_NAMESPACE_END
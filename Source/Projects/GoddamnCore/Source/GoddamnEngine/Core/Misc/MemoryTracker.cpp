@@ -0,0 +1,279 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+
+/*!
+ * @file GoddamnEngine/Core/Misc/MemoryTracker.cpp
+ * File contains per-subsystem memory accounting and budgets.
+ */
+#include <GoddamnEngine/Core/Misc/MemoryTracker.h>
+#include <GoddamnEngine/Core/Platform/PlatformAtomics.h>
+#include <GoddamnEngine/Core/CStdlib/CString.h>
+#include <GoddamnEngine/Core/CStdlib/CStdio.h>
+#include <GoddamnEngine/Core/Templates/Algorithm.h>
+
+GD_NAMESPACE_BEGIN
+
+	/*!
+	 * Header that prefixes every tracked memory block.
+	 */
+	struct MemoryTrackerHeader final
+	{
+		SizeTp    SizeBytes;
+		MemoryTag Tag;
+	};	// struct MemoryTrackerHeader
+	static_assert(sizeof(MemoryTrackerHeader) <= MemoryTracker::HeaderSize, "Memory tracker header does not fit.");
+
+	/*!
+	 * Counters of a single tag, padded to avoid false sharing between tags.
+	 */
+	struct alignas(64) MemoryTrackerTagState final
+	{
+		Int64 volatile CurrentBytes;
+		Int64 volatile PeakBytes;
+		Int64 volatile TotalAllocations;
+		Int64 volatile TotalBytes;
+		Int64 volatile SoftBudgetBytes;
+		Int64 volatile HardBudgetBytes;
+		Int64          LastTotalAllocations;
+		Int64          LastTotalBytes;
+		Float64        AllocationsPerSecond;
+		Float64        BytesPerSecond;
+	};	// struct MemoryTrackerTagState
+
+	GDINT static MemoryTrackerTagState g_MemoryTrackerTags[static_cast<SizeTp>(MemoryTag::Count)] = {};
+	GDINT static MemoryBudgetCallback volatile g_MemoryTrackerBudgetCallback = nullptr;
+	GDINT static GD_THREAD_LOCAL MemoryTag g_MemoryTrackerCurrentTag = MemoryTag::Unknown;
+	GDINT static GD_THREAD_LOCAL bool g_MemoryTrackerIsInsideCallback = false;
+
+	GDINT static CStr const g_MemoryTrackerTagNames[] = {
+		"Unknown", "Containers", "Strings", "Objects", "Meshes", "Textures", "Shaders", "Audio", "Physics", "Scripts", "Resources",
+	};
+	static_assert(GetLength(g_MemoryTrackerTagNames) == static_cast<SizeTp>(MemoryTag::Count), "Some tag names are missing.");
+
+	/*!
+	 * Returns human-readable name of the tag.
+	 */
+	GDAPI CStr MemoryTracker::GetTagName(MemoryTag const tag)
+	{
+		GD_ASSERT(tag < MemoryTag::Count, "Invalid memory tag.");
+		return g_MemoryTrackerTagNames[static_cast<SizeTp>(tag)];
+	}
+
+	/*!
+	 * Returns tag, to which memory allocated by the current thread is accounted.
+	 */
+	GDAPI MemoryTag MemoryTracker::GetCurrentTag()
+	{
+		return g_MemoryTrackerCurrentTag;
+	}
+
+	/*!
+	 * Changes tag, to which memory allocated by the current thread is accounted.
+	 * @note Use @ref MemoryTagScope instead.
+	 *
+	 * @param tag New tag.
+	 * @returns Previous tag.
+	 */
+	GDAPI MemoryTag MemoryTracker::SetCurrentTag(MemoryTag const tag)
+	{
+		GD_ASSERT(tag < MemoryTag::Count, "Invalid memory tag.");
+		auto const previousTag = g_MemoryTrackerCurrentTag;
+		g_MemoryTrackerCurrentTag = tag;
+		return previousTag;
+	}
+
+	/*!
+	 * Returns counters of the specified tag.
+	 */
+	GDAPI MemoryTagCounters MemoryTracker::GetCounters(MemoryTag const tag)
+	{
+		GD_ASSERT(tag < MemoryTag::Count, "Invalid memory tag.");
+		auto const& tagState = g_MemoryTrackerTags[static_cast<SizeTp>(tag)];
+
+		MemoryTagCounters counters;
+		counters.CurrentBytes = static_cast<SizeTp>(tagState.CurrentBytes);
+		counters.PeakBytes = static_cast<SizeTp>(tagState.PeakBytes);
+		counters.TotalAllocations = static_cast<UInt64>(tagState.TotalAllocations);
+		counters.TotalBytes = static_cast<UInt64>(tagState.TotalBytes);
+		counters.AllocationsPerSecond = tagState.AllocationsPerSecond;
+		counters.BytesPerSecond = tagState.BytesPerSecond;
+		counters.SoftBudgetBytes = static_cast<SizeTp>(tagState.SoftBudgetBytes);
+		counters.HardBudgetBytes = static_cast<SizeTp>(tagState.HardBudgetBytes);
+		return counters;
+	}
+
+	/*!
+	 * Specifies budgets of the tag. Zero budget is never exceeded.
+	 *
+	 * @param tag Tag to modify.
+	 * @param softBudgetBytes Soft budget in bytes.
+	 * @param hardBudgetBytes Hard budget in bytes.
+	 */
+	GDAPI void MemoryTracker::SetBudgets(MemoryTag const tag, SizeTp const softBudgetBytes, SizeTp const hardBudgetBytes)
+	{
+		GD_ASSERT(tag < MemoryTag::Count, "Invalid memory tag.");
+		auto& tagState = g_MemoryTrackerTags[static_cast<SizeTp>(tag)];
+		tagState.SoftBudgetBytes = static_cast<Int64>(softBudgetBytes);
+		tagState.HardBudgetBytes = static_cast<Int64>(hardBudgetBytes);
+	}
+
+	/*!
+	 * Specifies callback that is invoked when memory of some tag grows beyond the budget.
+	 */
+	GDAPI void MemoryTracker::SetBudgetCallback(MemoryBudgetCallback const callback)
+	{
+		g_MemoryTrackerBudgetCallback = callback;
+	}
+
+	/*!
+	 * Recomputes allocation rates of all tags since the previous call.
+	 * Should be called periodically (e.g. once per frame) from a single thread.
+	 *
+	 * @param elapsedSeconds Time since the previous call in seconds.
+	 */
+	GDAPI void MemoryTracker::UpdateRates(Float64 const elapsedSeconds)
+	{
+		GD_ASSERT(elapsedSeconds > 0.0, "Elapsed time should be positive.");
+		for (auto& tagState : g_MemoryTrackerTags)
+		{
+			Int64 const totalAllocations = tagState.TotalAllocations;
+			Int64 const totalBytes = tagState.TotalBytes;
+			tagState.AllocationsPerSecond = static_cast<Float64>(totalAllocations - tagState.LastTotalAllocations) / elapsedSeconds;
+			tagState.BytesPerSecond = static_cast<Float64>(totalBytes - tagState.LastTotalBytes) / elapsedSeconds;
+			tagState.LastTotalAllocations = totalAllocations;
+			tagState.LastTotalBytes = totalBytes;
+		}
+	}
+
+	/*!
+	 * Writes counters of all tags into the JSON file.
+	 *
+	 * @param filename Path to the output file.
+	 * @returns True if operation succeeded.
+	 */
+	GDAPI bool MemoryTracker::ExportToFile(CStr const filename)
+	{
+		auto const file = CStdio::Fopen(filename, "wb");
+		if (file == nullptr)
+		{
+			return false;
+		}
+
+		Char line[512];
+		auto result = CStdio::Fwrite("{\n\t\"tags\": [\n", 13, 1, file) == 1;
+		for (SizeTp cnt = 0; cnt < static_cast<SizeTp>(MemoryTag::Count); ++cnt)
+		{
+			auto const tag = static_cast<MemoryTag>(cnt);
+			auto const counters = GetCounters(tag);
+			auto const lineLength = CString::Snprintf(line, GetLength(line)
+				, "\t\t{ \"name\": \"%s\", \"current_bytes\": %llu, \"peak_bytes\": %llu, \"total_allocations\": %llu, \"total_bytes\": %llu"
+				  ", \"allocations_per_second\": %.2f, \"bytes_per_second\": %.2f, \"soft_budget_bytes\": %llu, \"hard_budget_bytes\": %llu }%s\n"
+				, GetTagName(tag), static_cast<unsigned long long>(counters.CurrentBytes), static_cast<unsigned long long>(counters.PeakBytes)
+				, static_cast<unsigned long long>(counters.TotalAllocations), static_cast<unsigned long long>(counters.TotalBytes)
+				, counters.AllocationsPerSecond, counters.BytesPerSecond
+				, static_cast<unsigned long long>(counters.SoftBudgetBytes), static_cast<unsigned long long>(counters.HardBudgetBytes)
+				, cnt + 1 != static_cast<SizeTp>(MemoryTag::Count) ? "," : "");
+			result &= lineLength > 0 && CStdio::Fwrite(line, Min(static_cast<SizeTp>(lineLength), GetLength(line) - 1), 1, file) == 1;
+		}
+		result &= CStdio::Fwrite("\t]\n}\n", 5, 1, file) == 1;
+
+		result &= CStdio::Fclose(file) == 0;
+		return result;
+	}
+
+	/*!
+	 * Accounts the allocated memory block.
+	 * @note Should be only called by the memory allocation functions.
+	 *
+	 * @param platformPointer Memory block, returned by the platform allocator.
+	 * @param allocationSizeBytes Requested size of the memory block.
+	 *
+	 * @returns Pointer that should be returned to the user.
+	 */
+	GDAPI Handle MemoryTracker::OnAllocate(Handle const platformPointer, SizeTp const allocationSizeBytes)
+	{
+#if GD_MEMORY_TRACKER_ENABLED
+		if (platformPointer == nullptr)
+		{
+			return nullptr;
+		}
+
+		auto const tag = g_MemoryTrackerCurrentTag;
+		auto const header = static_cast<MemoryTrackerHeader*>(platformPointer);
+		header->SizeBytes = allocationSizeBytes;
+		header->Tag = tag;
+
+		auto& atomics = IPlatformAtomics::Get();
+		auto& tagState = g_MemoryTrackerTags[static_cast<SizeTp>(tag)];
+		auto const sizeBytes = static_cast<Int64>(allocationSizeBytes);
+		auto const previousBytes = atomics.AtomicAdd(&tagState.CurrentBytes, sizeBytes);
+		auto const currentBytes = previousBytes + sizeBytes;
+		atomics.AtomicAdd(&tagState.TotalAllocations, 1);
+		atomics.AtomicAdd(&tagState.TotalBytes, sizeBytes);
+		for (Int64 peakBytes = tagState.PeakBytes; peakBytes < currentBytes; peakBytes = tagState.PeakBytes)
+		{
+			if (atomics.AtomicCompareExchange(&tagState.PeakBytes, currentBytes, peakBytes) == peakBytes)
+			{
+				break;
+			}
+		}
+
+		// Callbacks fire only when the budget is crossed, not on every allocation beyond it.
+		auto const softBudgetBytes = tagState.SoftBudgetBytes;
+		auto const hardBudgetBytes = tagState.HardBudgetBytes;
+		auto const callback = g_MemoryTrackerBudgetCallback;
+		if (callback != nullptr && !g_MemoryTrackerIsInsideCallback)
+		{
+			g_MemoryTrackerIsInsideCallback = true;
+			if (softBudgetBytes != 0 && previousBytes < softBudgetBytes && currentBytes >= softBudgetBytes)
+			{
+				callback(tag, MemoryBudget::Soft, static_cast<SizeTp>(currentBytes), static_cast<SizeTp>(softBudgetBytes));
+			}
+			if (hardBudgetBytes != 0 && previousBytes < hardBudgetBytes && currentBytes >= hardBudgetBytes)
+			{
+				callback(tag, MemoryBudget::Hard, static_cast<SizeTp>(currentBytes), static_cast<SizeTp>(hardBudgetBytes));
+			}
+			g_MemoryTrackerIsInsideCallback = false;
+		}
+
+		return static_cast<Byte*>(platformPointer) + HeaderSize;
+#else	// if GD_MEMORY_TRACKER_ENABLED
+		GD_NOT_USED(allocationSizeBytes);
+		return platformPointer;
+#endif	// if GD_MEMORY_TRACKER_ENABLED
+	}
+
+	/*!
+	 * Accounts the freed memory block.
+	 * @note Should be only called by the memory deallocation functions.
+	 *
+	 * @param allocationPointer Pointer that was returned to the user.
+	 * @returns Pointer that should be passed to the platform allocator.
+	 */
+	GDAPI Handle MemoryTracker::OnFree(Handle const allocationPointer)
+	{
+#if GD_MEMORY_TRACKER_ENABLED
+		if (allocationPointer == nullptr)
+		{
+			return nullptr;
+		}
+
+		auto const platformPointer = static_cast<Byte*>(allocationPointer) - HeaderSize;
+		auto const header = reinterpret_cast<MemoryTrackerHeader const*>(platformPointer);
+		GD_ASSERT(header->Tag < MemoryTag::Count, "Memory block header is corrupted.");
+
+		auto& tagState = g_MemoryTrackerTags[static_cast<SizeTp>(header->Tag)];
+		IPlatformAtomics::Get().AtomicAdd(&tagState.CurrentBytes, -static_cast<Int64>(header->SizeBytes));
+		return platformPointer;
+#else	// if GD_MEMORY_TRACKER_ENABLED
+		return allocationPointer;
+#endif	// if GD_MEMORY_TRACKER_ENABLED
+	}
+
+GD_NAMESPACE_END
@@ -0,0 +1,200 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+
+/*!
+ * @file GoddamnEngine/Core/Misc/MemoryTracker.h
+ * File contains per-subsystem memory accounting and budgets.
+ */
+#pragma once
+
+#include <GoddamnEngine/Include.h>
+
+/*!
+ * Enables accounting of the allocations, made with @c GD_MALLOC and @c gd_new.
+ * Every memory block is prefixed with a small header that stores its size and tag.
+ */
+#ifndef GD_MEMORY_TRACKER_ENABLED
+#define GD_MEMORY_TRACKER_ENABLED 1
+#endif	// ifndef GD_MEMORY_TRACKER_ENABLED
+
+GD_NAMESPACE_BEGIN
+
+	/*!
+	 * Subsystem, to which allocated memory is accounted.
+	 */
+	enum class MemoryTag : UInt8
+	{
+		Unknown,
+		Containers,
+		Strings,
+		Objects,
+		Meshes,
+		Textures,
+		Shaders,
+		Audio,
+		Physics,
+		Scripts,
+		Resources,
+		Count,
+	};	// enum class MemoryTag
+
+	/*!
+	 * Kind of the budget that was exceeded.
+	 */
+	enum class MemoryBudget
+	{
+		Soft,	//!< Caches should be evicted.
+		Hard,	//!< Memory is about to run out.
+	};	// enum class MemoryBudget
+
+	/*!
+	 * Callback that is invoked when memory of some tag grows beyond the budget.
+	 * Callback is invoked on the allocating thread, allocations made by it do not trigger callbacks again.
+	 */
+	using MemoryBudgetCallback = void(*)(MemoryTag const tag, MemoryBudget const budget, SizeTp const currentBytes, SizeTp const budgetBytes);
+
+	// **------------------------------------------------------------------------------------------**
+	//! Memory counters of a single tag.
+	// **------------------------------------------------------------------------------------------**
+	struct MemoryTagCounters final
+	{
+	public:
+		SizeTp  CurrentBytes;
+		SizeTp  PeakBytes;
+		UInt64  TotalAllocations;
+		UInt64  TotalBytes;
+		Float64 AllocationsPerSecond;
+		Float64 BytesPerSecond;
+		SizeTp  SoftBudgetBytes;
+		SizeTp  HardBudgetBytes;
+	};	// struct MemoryTagCounters
+
+	// **------------------------------------------------------------------------------------------**
+	//! Accounts allocated memory per subsystem tag.
+	// **------------------------------------------------------------------------------------------**
+	class MemoryTracker final : public TNonCreatable
+	{
+	public:
+
+		/*!
+		 * Returns human-readable name of the tag.
+		 */
+		GDAPI static CStr GetTagName(MemoryTag const tag);
+
+		/*!
+		 * Returns tag, to which memory allocated by the current thread is accounted.
+		 */
+		GDAPI static MemoryTag GetCurrentTag();
+
+		/*!
+		 * Changes tag, to which memory allocated by the current thread is accounted.
+		 * @note Use @ref MemoryTagScope instead.
+		 *
+		 * @param tag New tag.
+		 * @returns Previous tag.
+		 */
+		GDAPI static MemoryTag SetCurrentTag(MemoryTag const tag);
+
+		/*!
+		 * Returns counters of the specified tag.
+		 */
+		GDAPI static MemoryTagCounters GetCounters(MemoryTag const tag);
+
+		/*!
+		 * Specifies budgets of the tag. Zero budget is never exceeded.
+		 *
+		 * @param tag Tag to modify.
+		 * @param softBudgetBytes Soft budget in bytes.
+		 * @param hardBudgetBytes Hard budget in bytes.
+		 */
+		GDAPI static void SetBudgets(MemoryTag const tag, SizeTp const softBudgetBytes, SizeTp const hardBudgetBytes);
+
+		/*!
+		 * Specifies callback that is invoked when memory of some tag grows beyond the budget.
+		 */
+		GDAPI static void SetBudgetCallback(MemoryBudgetCallback const callback);
+
+		/*!
+		 * Recomputes allocation rates of all tags since the previous call.
+		 * Should be called periodically (e.g. once per frame) from a single thread.
+		 *
+		 * @param elapsedSeconds Time since the previous call in seconds.
+		 */
+		GDAPI static void UpdateRates(Float64 const elapsedSeconds);
+
+		/*!
+		 * Writes counters of all tags into the JSON file.
+		 *
+		 * @param filename Path to the output file.
+		 * @returns True if operation succeeded.
+		 */
+		GDAPI static bool ExportToFile(CStr const filename);
+
+	public:
+
+		/*!
+		 * Size of the header that prefixes every tracked memory block.
+		 */
+		SizeTp static const HeaderSize = 2 * sizeof(Handle);
+
+		/*!
+		 * Returns size of the memory block that should be requested from the platform allocator.
+		 * @note Should be only called by the memory allocation functions.
+		 */
+		GDINL static SizeTp GetPlatformAllocationSize(SizeTp const allocationSizeBytes)
+		{
+#if GD_MEMORY_TRACKER_ENABLED
+			return allocationSizeBytes != 0 ? allocationSizeBytes + HeaderSize : 0;
+#else	// if GD_MEMORY_TRACKER_ENABLED
+			return allocationSizeBytes;
+#endif	// if GD_MEMORY_TRACKER_ENABLED
+		}
+
+		/*!
+		 * Accounts the allocated memory block.
+		 * @note Should be only called by the memory allocation functions.
+		 *
+		 * @param platformPointer Memory block, returned by the platform allocator.
+		 * @param allocationSizeBytes Requested size of the memory block.
+		 *
+		 * @returns Pointer that should be returned to the user.
+		 */
+		GDAPI static Handle OnAllocate(Handle const platformPointer, SizeTp const allocationSizeBytes);
+
+		/*!
+		 * Accounts the freed memory block.
+		 * @note Should be only called by the memory deallocation functions.
+		 *
+		 * @param allocationPointer Pointer that was returned to the user.
+		 * @returns Pointer that should be passed to the platform allocator.
+		 */
+		GDAPI static Handle OnFree(Handle const allocationPointer);
+	};	// class MemoryTracker
+
+	// **------------------------------------------------------------------------------------------**
+	//! Accounts all memory, allocated by the current thread while the scope is alive, to the specified tag.
+	// **------------------------------------------------------------------------------------------**
+	struct MemoryTagScope final : public TNonCopyable
+	{
+	private:
+		MemoryTag m_PreviousTag;
+
+	public:
+		GDINL explicit MemoryTagScope(MemoryTag const tag)
+			: m_PreviousTag(MemoryTracker::SetCurrentTag(tag))
+		{
+		}
+
+		GDINL ~MemoryTagScope()
+		{
+			MemoryTracker::SetCurrentTag(m_PreviousTag);
+		}
+	};	// struct MemoryTagScope
+
+GD_NAMESPACE_END
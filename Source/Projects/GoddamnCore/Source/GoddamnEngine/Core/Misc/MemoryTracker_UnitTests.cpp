@@ -0,0 +1,113 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+
+/*! 
+ * @file GoddamnEngine/Core/Misc/MemoryTracker_UnitTests.cpp
+ * File contains unit tests for the memory tracker.
+ */
+#include <GoddamnEngine/Core/Misc/MemoryTracker.h>
+
+#if GD_TESTING_ENABLED
+#	include <string>
+#endif	// if GD_TESTING_ENABLED
+
+GD_NAMESPACE_BEGIN
+
+#if GD_TESTING_ENABLED && GD_MEMORY_TRACKER_ENABLED
+
+	gd_testing_unit_test(MemoryTrackerTags)
+	{
+		auto const olderCounters = MemoryTracker::GetCounters(MemoryTag::Meshes);
+
+		Handle block;
+		{
+			MemoryTagScope const memoryTagScope(MemoryTag::Meshes);
+			gd_testing_verify(MemoryTracker::GetCurrentTag() == MemoryTag::Meshes);
+			block = GD_MALLOC(1000);
+		}
+		gd_testing_verify(MemoryTracker::GetCurrentTag() == MemoryTag::Unknown);
+
+		{
+			// These should succeed.
+			auto const counters = MemoryTracker::GetCounters(MemoryTag::Meshes);
+			gd_testing_verify(counters.CurrentBytes == olderCounters.CurrentBytes + 1000);
+			gd_testing_verify(counters.PeakBytes >= counters.CurrentBytes);
+			gd_testing_verify(counters.TotalAllocations == olderCounters.TotalAllocations + 1);
+		}
+
+		{
+			// This should succeed: memory is accounted to the allocation tag, not to the current one.
+			MemoryTagScope const memoryTagScope(MemoryTag::Textures);
+			GD_FREE(block);
+			gd_testing_verify(MemoryTracker::GetCounters(MemoryTag::Meshes).CurrentBytes == olderCounters.CurrentBytes);
+		}
+
+		{
+			// This should succeed.
+			MemoryTracker::UpdateRates(1.0);
+			MemoryTracker::UpdateRates(1.0);
+			gd_testing_verify(MemoryTracker::GetCounters(MemoryTag::Meshes).AllocationsPerSecond == 0.0);
+		}
+	};
+
+	GDINT static SizeTp g_SoftBudgetCallbacksCount = 0;
+	GDINT static SizeTp g_HardBudgetCallbacksCount = 0;
+
+	gd_testing_unit_test(MemoryTrackerBudgets)
+	{
+		auto const currentBytes = MemoryTracker::GetCounters(MemoryTag::Audio).CurrentBytes;
+		MemoryTracker::SetBudgets(MemoryTag::Audio, currentBytes + 1000, currentBytes + 2000);
+		MemoryTracker::SetBudgetCallback([](MemoryTag const tag, MemoryBudget const budget, SizeTp const, SizeTp const)
+		{
+			if (tag == MemoryTag::Audio)
+			{
+				++(budget == MemoryBudget::Soft ? g_SoftBudgetCallbacksCount : g_HardBudgetCallbacksCount);
+			}
+		});
+
+		MemoryTagScope const memoryTagScope(MemoryTag::Audio);
+		auto const block1 = GD_MALLOC(600);
+		gd_testing_verify(g_SoftBudgetCallbacksCount == 0 && g_HardBudgetCallbacksCount == 0);
+		auto const block2 = GD_MALLOC(600);
+		gd_testing_verify(g_SoftBudgetCallbacksCount == 1 && g_HardBudgetCallbacksCount == 0);
+		auto const block3 = GD_MALLOC(600);
+		gd_testing_verify(g_SoftBudgetCallbacksCount == 1 && g_HardBudgetCallbacksCount == 0);
+		auto const block4 = GD_MALLOC(600);
+		gd_testing_verify(g_SoftBudgetCallbacksCount == 1 && g_HardBudgetCallbacksCount == 1);
+
+		GD_FREE(block1);
+		GD_FREE(block2);
+		GD_FREE(block3);
+		GD_FREE(block4);
+		MemoryTracker::SetBudgetCallback(nullptr);
+		MemoryTracker::SetBudgets(MemoryTag::Audio, 0, 0);
+	};
+
+	gd_testing_unit_test(MemoryTrackerGlobalNew)
+	{
+		auto const olderCounters = MemoryTracker::GetCounters(MemoryTag::Physics);
+		{
+			// This should succeed: memory of the standard library, allocated out of line, is accounted too.
+			MemoryTagScope const memoryTagScope(MemoryTag::Physics);
+			std::string const text(1000, 'a');
+			gd_testing_verify(MemoryTracker::GetCounters(MemoryTag::Physics).CurrentBytes > olderCounters.CurrentBytes + 1000);
+			gd_testing_verify(text.size() == 1000);
+		}
+		{
+			// These should succeed.
+			auto const array = new Int32[1000];
+			gd_testing_verify(array != nullptr);
+			delete[] array;
+			gd_testing_verify(MemoryTracker::GetCounters(MemoryTag::Physics).CurrentBytes == olderCounters.CurrentBytes);
+		}
+	};
+
+#endif	// if GD_TESTING_ENABLED && GD_MEMORY_TRACKER_ENABLED
+
+GD_NAMESPACE_END
@@ -0,0 +1,182 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+
+/*!
+ * @file GoddamnEngine/Core/Misc/VirtualMemoryArena.cpp
+ * File contains arena and pool allocators on top of the reserved virtual memory.
+ */
+#include <GoddamnEngine/Core/Misc/VirtualMemoryArena.h>
+#include <GoddamnEngine/Core/Templates/Algorithm.h>
+
+GD_NAMESPACE_BEGIN
+
+	enum : SizeTp
+	{
+		// Committing memory with default pages in bigger chunks reduces the amount of system calls.
+		VirtualMemoryArenaMinCommitGranularity = 64 * 1024,
+	};
+
+	// ------------------------------------------------------------------------------------------
+	// VirtualMemoryArena class.
+	// ------------------------------------------------------------------------------------------
+
+	/*!
+	 * Initializes an arena and reserves the address space for it.
+	 *
+	 * @param reservationSizeBytes Maximum size of the arena in bytes.
+	 * @param pageSize Size of pages that should back the memory.
+	 */
+	GDAPI VirtualMemoryArena::VirtualMemoryArena(SizeTp const reservationSizeBytes, VirtualMemoryPageSize const pageSize)
+		: m_PageSize(pageSize)
+	{
+		auto& allocator = IPlatformAllocator::Get();
+		m_CommitGranularity = allocator.VirtualMemoryGetPageSize(pageSize);
+		if (m_CommitGranularity < VirtualMemoryArenaMinCommitGranularity)
+		{
+			m_CommitGranularity = VirtualMemoryArenaMinCommitGranularity;
+		}
+		m_ReservedSize = (reservationSizeBytes + m_CommitGranularity - 1) & ~(m_CommitGranularity - 1);
+
+		Handle reservationPointer = nullptr;
+		GD_VERIFY(allocator.VirtualMemoryReserve(reservationPointer, m_ReservedSize, pageSize), "Unhandled allocation error: failed to reserve address space.");
+		m_Memory = static_cast<Byte*>(reservationPointer);
+	}
+
+	/*!
+	 * Releases all memory of the arena.
+	 */
+	GDAPI VirtualMemoryArena::~VirtualMemoryArena()
+	{
+		GD_VERIFY(IPlatformAllocator::Get().VirtualMemoryRelease(m_Memory, m_ReservedSize), "Unhandled allocation error: failed to release address space.");
+	}
+
+	/*!
+	 * Allocates a memory block in the arena, committing more memory if required.
+	 *
+	 * @param allocationSizeBytes Size of memory block to allocate in bytes.
+	 * @param allocationAlignment Memory alignment, should be a power of two.
+	 *
+	 * @returns Allocated memory block or nullptr if the reservation is exhausted.
+	 */
+	GDAPI Handle VirtualMemoryArena::Allocate(SizeTp const allocationSizeBytes, SizeTp const allocationAlignment)
+	{
+		GD_ASSERT((allocationAlignment & (allocationAlignment - 1)) == 0, "Alignment should be a power of two.");
+
+		auto const allocationOffset = (m_UsedSize + allocationAlignment - 1) & ~(allocationAlignment - 1);
+		auto const usedSize = allocationOffset + allocationSizeBytes;
+		if (usedSize > m_ReservedSize || usedSize < allocationOffset)
+		{
+			return nullptr;
+		}
+		if (usedSize > m_CommittedSize)
+		{
+			auto const committedSize = Min((usedSize + m_CommitGranularity - 1) & ~(m_CommitGranularity - 1), m_ReservedSize);
+			if (!IPlatformAllocator::Get().VirtualMemoryCommit(m_Memory + m_CommittedSize, committedSize - m_CommittedSize))
+			{
+				return nullptr;
+			}
+			m_CommittedSize = committedSize;
+		}
+		m_UsedSize = usedSize;
+		return m_Memory + allocationOffset;
+	}
+
+	/*!
+	 * Frees all allocations that were made after the marker was taken.
+	 * Committed memory is kept for the future allocations.
+	 *
+	 * @param usedSize Marker, previously returned by the @ref GetUsedSize function.
+	 */
+	GDAPI void VirtualMemoryArena::Rewind(SizeTp const usedSize)
+	{
+		GD_ASSERT(usedSize <= m_UsedSize, "Invalid arena marker.");
+		m_UsedSize = usedSize;
+	}
+
+	/*!
+	 * Returns committed memory that is not used by any allocation back to the system.
+	 */
+	GDAPI void VirtualMemoryArena::Trim()
+	{
+		auto const committedSize = (m_UsedSize + m_CommitGranularity - 1) & ~(m_CommitGranularity - 1);
+		if (committedSize < m_CommittedSize)
+		{
+			GD_VERIFY(IPlatformAllocator::Get().VirtualMemoryDecommit(m_Memory + committedSize, m_CommittedSize - committedSize), "Unhandled allocation error: failed to decommit memory.");
+			m_CommittedSize = committedSize;
+		}
+	}
+
+	// ------------------------------------------------------------------------------------------
+	// VirtualMemoryPool class.
+	// ------------------------------------------------------------------------------------------
+
+	/*!
+	 * Initializes a pool and reserves the address space for it.
+	 *
+	 * @param blockSizeBytes Size of every block in bytes.
+	 * @param reservationSizeBytes Maximum size of all blocks in bytes.
+	 * @param pageSize Size of pages that should back the memory.
+	 */
+	GDAPI VirtualMemoryPool::VirtualMemoryPool(SizeTp const blockSizeBytes, SizeTp const reservationSizeBytes, VirtualMemoryPageSize const pageSize)
+		: m_Arena(reservationSizeBytes, pageSize)
+		, m_BlockSize((Max(blockSizeBytes, sizeof(Handle)) + sizeof(Handle) - 1) & ~(sizeof(Handle) - 1))
+	{
+	}
+
+	/*!
+	 * Allocates a memory block.
+	 * @returns Allocated memory block or nullptr if the reservation is exhausted.
+	 */
+	GDAPI Handle VirtualMemoryPool::Allocate()
+	{
+		Handle block;
+		if (m_FreeBlocks != nullptr)
+		{
+			block = m_FreeBlocks;
+			m_FreeBlocks = *static_cast<Handle*>(m_FreeBlocks);
+		}
+		else
+		{
+			block = m_Arena.Allocate(m_BlockSize, sizeof(Handle));
+			if (block == nullptr)
+			{
+				return nullptr;
+			}
+		}
+		++m_AllocatedBlocksCount;
+		return block;
+	}
+
+	/*!
+	 * Returns the memory block into the pool.
+	 * @param block Memory block, previously allocated by this pool.
+	 */
+	GDAPI void VirtualMemoryPool::Free(Handle const block)
+	{
+		if (block != nullptr)
+		{
+			GD_ASSERT(m_Arena.Contains(block), "Block was not allocated by this pool.");
+			*static_cast<Handle*>(block) = m_FreeBlocks;
+			m_FreeBlocks = block;
+			--m_AllocatedBlocksCount;
+		}
+	}
+
+	/*!
+	 * Frees all blocks at once and returns all memory back to the system.
+	 */
+	GDAPI void VirtualMemoryPool::Reset()
+	{
+		m_FreeBlocks = nullptr;
+		m_AllocatedBlocksCount = 0;
+		m_Arena.Reset();
+		m_Arena.Trim();
+	}
+
+GD_NAMESPACE_END
@@ -0,0 +1,193 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+
+/*!
+ * @file GoddamnEngine/Core/Misc/VirtualMemoryArena.h
+ * File contains arena and pool allocators on top of the reserved virtual memory.
+ */
+#pragma once
+
+#include <GoddamnEngine/Include.h>
+
+GD_NAMESPACE_BEGIN
+
+	// **------------------------------------------------------------------------------------------**
+	//! Linear allocator that reserves a large address space range up front and commits it on demand.
+	//! Suits big long-lived heaps: with huge pages TLB pressure is low and memory is returned to the system in bulk.
+	//! @note This class is not thread-safe.
+	// **------------------------------------------------------------------------------------------**
+	class VirtualMemoryArena final : public TNonCopyable
+	{
+	private:
+		Byte*                 m_Memory = nullptr;
+		SizeTp                m_ReservedSize = 0;
+		SizeTp                m_CommittedSize = 0;
+		SizeTp                m_UsedSize = 0;
+		SizeTp                m_CommitGranularity = 0;
+		VirtualMemoryPageSize m_PageSize;
+
+	public:
+
+		/*!
+		 * Initializes an arena and reserves the address space for it.
+		 *
+		 * @param reservationSizeBytes Maximum size of the arena in bytes.
+		 * @param pageSize Size of pages that should back the memory.
+		 */
+		GDAPI explicit VirtualMemoryArena(SizeTp const reservationSizeBytes, VirtualMemoryPageSize const pageSize = VirtualMemoryPageSize::Default);
+
+		/*!
+		 * Releases all memory of the arena.
+		 */
+		GDAPI ~VirtualMemoryArena();
+
+	public:
+
+		/*!
+		 * Returns size of the reserved address space in bytes.
+		 */
+		GDINL SizeTp GetReservedSize() const
+		{
+			return m_ReservedSize;
+		}
+
+		/*!
+		 * Returns size of the memory that is backed by the physical pages in bytes.
+		 */
+		GDINL SizeTp GetCommittedSize() const
+		{
+			return m_CommittedSize;
+		}
+
+		/*!
+		 * Returns size of the allocated memory in bytes.
+		 * This value may be used as a marker for the @ref Rewind function.
+		 */
+		GDINL SizeTp GetUsedSize() const
+		{
+			return m_UsedSize;
+		}
+
+		/*!
+		 * Returns size of pages that back the memory.
+		 */
+		GDINL VirtualMemoryPageSize GetPageSize() const
+		{
+			return m_PageSize;
+		}
+
+		/*!
+		 * Returns true if the pointer belongs to the arena.
+		 */
+		GDINL bool Contains(CHandle const pointer) const
+		{
+			return pointer >= m_Memory && pointer < m_Memory + m_ReservedSize;
+		}
+
+		/*!
+		 * Allocates a memory block in the arena, committing more memory if required.
+		 *
+		 * @param allocationSizeBytes Size of memory block to allocate in bytes.
+		 * @param allocationAlignment Memory alignment, should be a power of two.
+		 *
+		 * @returns Allocated memory block or nullptr if the reservation is exhausted.
+		 */
+		GDAPI Handle Allocate(SizeTp const allocationSizeBytes, SizeTp const allocationAlignment = 2 * sizeof(Handle));
+
+		/*!
+		 * Frees all allocations that were made after the marker was taken.
+		 * Committed memory is kept for the future allocations.
+		 *
+		 * @param usedSize Marker, previously returned by the @ref GetUsedSize function.
+		 */
+		GDAPI void Rewind(SizeTp const usedSize);
+
+		/*!
+		 * Frees all allocations in the arena.
+		 * Committed memory is kept for the future allocations.
+		 */
+		GDINL void Reset()
+		{
+			Rewind(0);
+		}
+
+		/*!
+		 * Returns committed memory that is not used by any allocation back to the system.
+		 */
+		GDAPI void Trim();
+	};	// class VirtualMemoryArena
+
+	// **------------------------------------------------------------------------------------------**
+	//! Pool of fixed-size memory blocks on top of the virtual memory arena.
+	//! @note This class is not thread-safe.
+	// **------------------------------------------------------------------------------------------**
+	class VirtualMemoryPool final : public TNonCopyable
+	{
+	private:
+		VirtualMemoryArena m_Arena;
+		SizeTp             m_BlockSize;
+		SizeTp             m_AllocatedBlocksCount = 0;
+		Handle             m_FreeBlocks = nullptr;
+
+	public:
+
+		/*!
+		 * Initializes a pool and reserves the address space for it.
+		 *
+		 * @param blockSizeBytes Size of every block in bytes.
+		 * @param reservationSizeBytes Maximum size of all blocks in bytes.
+		 * @param pageSize Size of pages that should back the memory.
+		 */
+		GDAPI VirtualMemoryPool(SizeTp const blockSizeBytes, SizeTp const reservationSizeBytes, VirtualMemoryPageSize const pageSize = VirtualMemoryPageSize::Default);
+
+	public:
+
+		/*!
+		 * Returns size of every block in bytes.
+		 */
+		GDINL SizeTp GetBlockSize() const
+		{
+			return m_BlockSize;
+		}
+
+		/*!
+		 * Returns amount of blocks that were allocated and not yet freed.
+		 */
+		GDINL SizeTp GetAllocatedBlocksCount() const
+		{
+			return m_AllocatedBlocksCount;
+		}
+
+		/*!
+		 * Returns the underlying arena.
+		 */
+		GDINL VirtualMemoryArena const& GetArena() const
+		{
+			return m_Arena;
+		}
+
+		/*!
+		 * Allocates a memory block.
+		 * @returns Allocated memory block or nullptr if the reservation is exhausted.
+		 */
+		GDAPI Handle Allocate();
+
+		/*!
+		 * Returns the memory block into the pool.
+		 * @param block Memory block, previously allocated by this pool.
+		 */
+		GDAPI void Free(Handle const block);
+
+		/*!
+		 * Frees all blocks at once and returns all memory back to the system.
+		 */
+		GDAPI void Reset();
+	};	// class VirtualMemoryPool
+
+GD_NAMESPACE_END
@@ -0,0 +1,121 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+
+/*! 
+ * @file GoddamnEngine/Core/Misc/VirtualMemoryArena_UnitTests.cpp
+ * File contains unit tests for the virtual memory arena and pool.
+ */
+#include <GoddamnEngine/Core/Misc/VirtualMemoryArena.h>
+#include <GoddamnEngine/Core/CStdlib/CMemory.h>
+
+GD_NAMESPACE_BEGIN
+
+#if GD_TESTING_ENABLED
+
+	gd_testing_unit_test(VirtualMemoryArenaAllocate)
+	{
+		VirtualMemoryArena arena(64 * 1024 * 1024);
+		gd_testing_verify(arena.GetReservedSize() >= 64 * 1024 * 1024);
+		gd_testing_verify(arena.GetCommittedSize() == 0);
+
+		{
+			// These should succeed.
+			auto const block1 = static_cast<Byte*>(arena.Allocate(100));
+			auto const block2 = static_cast<Byte*>(arena.Allocate(3 * 1024 * 1024, 4096));
+			gd_testing_verify(block1 != nullptr && block2 != nullptr);
+			gd_testing_verify(reinterpret_cast<SizeTp>(block2) % 4096 == 0);
+			gd_testing_verify(arena.Contains(block1) && arena.Contains(block2 + 3 * 1024 * 1024 - 1));
+			gd_testing_verify(arena.GetCommittedSize() >= arena.GetUsedSize());
+			CMemory::Memset(block1, 0xAB, 100);
+			CMemory::Memset(block2, 0xCD, 3 * 1024 * 1024);
+			gd_testing_verify(block1[99] == 0xAB && block2[3 * 1024 * 1024 - 1] == 0xCD);
+		}
+
+		{
+			// These should succeed: rewinding keeps committed memory, trimming returns it.
+			auto const marker = arena.GetUsedSize();
+			auto const block = arena.Allocate(1024);
+			arena.Rewind(marker);
+			gd_testing_verify(arena.Allocate(1024) == block);
+
+			auto const committedSize = arena.GetCommittedSize();
+			arena.Reset();
+			gd_testing_verify(arena.GetUsedSize() == 0 && arena.GetCommittedSize() == committedSize);
+			arena.Trim();
+			gd_testing_verify(arena.GetCommittedSize() == 0);
+		}
+
+		{
+			// This should succeed: memory is committed again after trimming.
+			auto const block = static_cast<Byte*>(arena.Allocate(100));
+			CMemory::Memset(block, 0xEF, 100);
+			gd_testing_verify(block[0] == 0xEF);
+		}
+
+		{
+			// This should fail: reservation is exhausted.
+			gd_testing_verify(arena.Allocate(arena.GetReservedSize()) == nullptr);
+		}
+	};
+
+	gd_testing_unit_test(VirtualMemoryArenaHugePages)
+	{
+		VirtualMemoryArena arena(16 * 1024 * 1024, VirtualMemoryPageSize::Huge);
+		auto const hugePageSize = IPlatformAllocator::Get().VirtualMemoryGetPageSize(VirtualMemoryPageSize::Huge);
+
+		auto const block = static_cast<Byte*>(arena.Allocate(5 * 1024 * 1024));
+		gd_testing_verify(block != nullptr);
+		gd_testing_verify(reinterpret_cast<SizeTp>(block) % hugePageSize == 0);
+		gd_testing_verify(arena.GetCommittedSize() % hugePageSize == 0);
+		CMemory::Memset(block, 0x11, 5 * 1024 * 1024);
+		gd_testing_verify(block[5 * 1024 * 1024 - 1] == 0x11);
+	};
+
+	gd_testing_unit_test(VirtualMemoryArenaExplicitHugePages)
+	{
+		// Falls back to the transparent huge pages, if the system pool is empty, so committed memory is always writable.
+		VirtualMemoryArena arena(16 * 1024 * 1024, VirtualMemoryPageSize::ExplicitHuge);
+		auto const hugePageSize = IPlatformAllocator::Get().VirtualMemoryGetPageSize(VirtualMemoryPageSize::ExplicitHuge);
+
+		auto const block = static_cast<Byte*>(arena.Allocate(5 * 1024 * 1024));
+		gd_testing_verify(block != nullptr);
+		gd_testing_verify(reinterpret_cast<SizeTp>(block) % hugePageSize == 0);
+		CMemory::Memset(block, 0x22, 5 * 1024 * 1024);
+		gd_testing_verify(block[0] == 0x22 && block[5 * 1024 * 1024 - 1] == 0x22);
+	};
+
+	gd_testing_unit_test(VirtualMemoryPool)
+	{
+		VirtualMemoryPool pool(24, 1024 * 1024);
+		gd_testing_verify(pool.GetBlockSize() >= 24);
+
+		{
+			// These should succeed.
+			auto const block1 = pool.Allocate();
+			auto const block2 = pool.Allocate();
+			gd_testing_verify(block1 != nullptr && block2 != nullptr && block1 != block2);
+			gd_testing_verify(pool.GetAllocatedBlocksCount() == 2);
+
+			pool.Free(block1);
+			gd_testing_verify(pool.GetAllocatedBlocksCount() == 1);
+			gd_testing_verify(pool.Allocate() == block1);
+		}
+
+		{
+			// These should succeed: all blocks are freed and memory is returned at once.
+			pool.Reset();
+			gd_testing_verify(pool.GetAllocatedBlocksCount() == 0);
+			gd_testing_verify(pool.GetArena().GetCommittedSize() == 0);
+			gd_testing_verify(pool.Allocate() != nullptr);
+		}
+	};
+
+#endif	// if GD_TESTING_ENABLED
+
+GD_NAMESPACE_END
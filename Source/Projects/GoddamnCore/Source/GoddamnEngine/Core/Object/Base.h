@@ -34,8 +34,9 @@ GD_NAMESPACE_BEGIN
 
 	/*!
 	 * Represents constructor procedure pointer for objects.
+	 * Constructs object inside the specified memory, allocated by the class instance pool.
 	 */
-	GD_OBJECT_KERNEL using ObjectCtorProc = Object*(*)();
+	GD_OBJECT_KERNEL using ObjectCtorProc = Object*(*)(Handle const memory);
 
 	template<typename TObjectDest, typename TObjectSource>
 	GDINL GD_OBJECT_KERNEL static TObjectDest object_cast(TObjectSource const sourceObject);
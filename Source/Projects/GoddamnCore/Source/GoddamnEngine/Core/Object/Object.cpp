@@ -11,23 +11,133 @@
  * Base class for all engine entities.
  */
 #include <GoddamnEngine/Core/Object/Object.h>
+#include <GoddamnEngine/Core/Misc/MemoryTracker.h>
 
 GD_NAMESPACE_BEGIN
 	
-	static Map<String, ObjectClassPtr>& g_ObjectClasses()
+	static UnorderedMap<Name, ObjectClassPtr>& g_ObjectClasses()
 	{
-		static Map<String, ObjectClassPtr> o;
+		static UnorderedMap<Name, ObjectClassPtr> o;
 		return o;
 	}
 
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+	// ******                           'ObjectRegistry' class.                                ******
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+
+	/*!
+	 * Registers a batch of objects under a single lock.
+	 * GUIDs of the objects that are already present in this registry are regenerated.
+	 *
+	 * @param objects Objects to register.
+	 * @param objectsCount Number of objects.
+	 */
+	GDAPI void ObjectRegistry::InsertBatch(Object* const* const objects, SizeTp const objectsCount)
+	{
+		ScopedCriticalSection registryLock(m_RegistryLock);
+		for (SizeTp cnt = 0; cnt < objectsCount; ++cnt)
+		{
+			auto const object = objects[cnt];
+			while (m_Registry.Find(object->m_GUID) != nullptr)
+			{
+				object->m_GUID = GUID::New();
+			}
+			m_Registry.Insert(object->m_GUID, object);
+		}
+	}
+
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+	// ******                             'ObjectPool' class.                                  ******
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+
+	/*!
+	 * Initializes a pool for instances of the specified size.
+	 * Slots are large enough to keep the free list link and are aligned by 16 bytes.
+	 *
+	 * @param instanceSize Size of a single instance.
+	 */
+	GDAPI ObjectPool::ObjectPool(SizeTp const instanceSize)
+		: m_SlotSize((Max(instanceSize, sizeof(Handle)) + 15) & ~static_cast<SizeTp>(15)), m_FreeSlots(nullptr)
+	{
+	}
+
+	GDAPI ObjectPool::~ObjectPool()
+	{
+		for (auto const slab : m_Slabs)
+		{
+			GD_FREE(slab);
+		}
+	}
+
+	/*!
+	 * Allocates memory for a single instance.
+	 */
+	GDAPI Handle ObjectPool::Allocate()
+	{
+		ScopedCriticalSection poolLock(m_PoolLock);
+		if (m_FreeSlots == nullptr)
+		{
+			// No free slots left, allocating a new slab and threading it into the free list.
+			MemoryTagScope const memoryTagScope(MemoryTag::Objects);
+			auto const slab = static_cast<Byte*>(GD_MALLOC(SlabLength * m_SlotSize));
+			for (SizeTp cnt = SlabLength; cnt != 0; --cnt)
+			{
+				auto const slot = slab + (cnt - 1) * m_SlotSize;
+				*reinterpret_cast<Handle*>(slot) = m_FreeSlots;
+				m_FreeSlots = slot;
+			}
+			m_Slabs.InsertLast(slab);
+		}
+
+		auto const slot = m_FreeSlots;
+		m_FreeSlots = *static_cast<Handle*>(slot);
+		return slot;
+	}
+
+	/*!
+	 * Allocates contiguous memory for the specified number of instances.
+	 * Slots of the batch can be freed separately.
+	 *
+	 * @param instancesCount Number of instances.
+	 * @returns Pointer to the first slot. Slots are @ref GetSlotSize bytes apart.
+	 */
+	GDAPI Handle ObjectPool::AllocateBatch(SizeTp const instancesCount)
+	{
+		GD_ASSERT(instancesCount != 0, "Empty batch was specified.");
+
+		Handle slab;
+		{
+			MemoryTagScope const memoryTagScope(MemoryTag::Objects);
+			slab = GD_MALLOC(instancesCount * m_SlotSize);
+		}
+		ScopedCriticalSection poolLock(m_PoolLock);
+		m_Slabs.InsertLast(slab);
+		return slab;
+	}
+
+	/*!
+	 * Returns memory of the instance to the pool.
+	 * @param memory Memory, allocated by this pool.
+	 */
+	GDAPI void ObjectPool::Free(Handle const memory)
+	{
+		ScopedCriticalSection poolLock(m_PoolLock);
+		*static_cast<Handle*>(memory) = m_FreeSlots;
+		m_FreeSlots = memory;
+	}
+
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+	// ******                            'ObjectClass' class.                                  ******
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+
 	/*!
 	 * Initializes a new class. 
 	 * @warning Never call this constructor manually.
 	 */
-	GDAPI GD_OBJECT_KERNEL ObjectClass::ObjectClass(CStr const className, ObjectClassPtr const classSuper, ObjectCtorProc const classConstructor)
-		: ClassName(className), ClassSuper(classSuper), m_InstanceCtor(classConstructor)
+	GDAPI GD_OBJECT_KERNEL ObjectClass::ObjectClass(CStr const className, ObjectClassPtr const classSuper, ObjectCtorProc const classConstructor, SizeTp const classInstanceSize)
+		: ClassName(className), ClassSuper(classSuper), m_InstanceCtor(classConstructor), m_InstancePool(classInstanceSize)
 	{
-		g_ObjectClasses().Insert(className, this);
+		g_ObjectClasses().Insert(ClassName, this);
 		if (classSuper != nullptr)
 		{
 			const_cast<ObjectClass*>(classSuper)->m_ClassDerived.InsertLast(this);
@@ -40,11 +150,19 @@ GD_NAMESPACE_BEGIN
 	 * @param className Name of the class we are looking for.
  	 * @returns Pointer to found class or nullptr if no suck class was found.
 	 */
-	GDAPI GD_OBJECT_KERNEL ObjectClassPtr ObjectClass::FindClass(String const& className)
+	//! @{
+	GDAPI GD_OBJECT_KERNEL ObjectClassPtr ObjectClass::FindClass(Name const& className)
 	{
 		auto const classPtrPtr = g_ObjectClasses().Find(className);
 		return classPtrPtr != nullptr ? *classPtrPtr : nullptr;
 	}
+	GDAPI GD_OBJECT_KERNEL ObjectClassPtr ObjectClass::FindClass(StringView const className)
+	{
+		// Names of all classes are interned, unknown strings should not pollute the name table.
+		auto const name = Name::Find(className);
+		return !name.IsNone() ? FindClass(name) : nullptr;
+	}
+	//! @}
 
 	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
 	// ******                               'Object' class.                                    ******
@@ -99,8 +217,10 @@ GD_NAMESPACE_BEGIN
 		if (--m_ReferenceCount == 0)
 		{
 			// Zero reference counter reached, it is time to recycle object.
-			GetClass()->m_Instances.Erase(m_GUID);
-			gd_delete this;
+			auto const klass = GetClass();
+			klass->m_Instances.Erase(m_GUID);
+			this->~Object();
+			klass->m_InstancePool.Free(this);
 		}
 	}
 	
@@ -184,9 +304,14 @@ GD_NAMESPACE_BEGIN
 		GD_ASSERT(klass != nullptr, "Null pointer class was specified.");
 		
 		// Safely copying all instances of the specified class into array.
-		auto foundObjects(FindObjectsByClass(klass));
+		ChunkedVector<RefPtr<Object>> foundObjects;
+		for (auto& foundObject : FindObjectsByClass(klass))
+		{
+			foundObjects.InsertLast(Utils::Move(foundObject));
+		}
 
 		// Next, safely copying all instances of the derived classes into array.
+		// Results of the derived classes are spliced chunk-wise, when possible.
 		for (auto const derivedKlass : klass->m_ClassDerived)
 		{
 			foundObjects += FindClassRelatedObjects(derivedKlass);
@@ -223,7 +348,7 @@ GD_NAMESPACE_BEGIN
 
 		// No object was found, and we are sure it does not exist. We need to create it.
 		GD_VERIFY(klass->m_InstanceCtor != nullptr, "Specified class is abstract.");
-		auto const object = klass->m_InstanceCtor();
+		auto const object = klass->m_InstanceCtor(klass->m_InstancePool.Allocate());
 		if (guid == EmptyGUID)
 		{
 			// We need to be sure that the generated GUID is really unique.
@@ -243,6 +368,41 @@ GD_NAMESPACE_BEGIN
 		return object;
 	}
 
+	/*!
+	 * @brief Creates a batch of new instances of the specified class.
+	 * Instances are allocated contiguously in the class pool and are registered under a single lock.
+	 * Generated GUIDs are checked for uniqueness only inside the class registry: unlike single object
+	 * creation, global lookup for each of random 128-bit GUIDs is not worth it.
+	 *
+	 * @param klass Class of the required objects.
+	 * @param objectsCount Number of objects to create.
+	 *
+	 * @returns Vector with all created objects.
+	 */
+	GDAPI Vector<RefPtr<Object>> GD_OBJECT_KERNEL Object::CreateObjects(ObjectClassPtr const klass, SizeTp const objectsCount)
+	{
+		GD_ASSERT(klass != nullptr, "Null pointer class was specified.");
+		GD_VERIFY(klass->m_InstanceCtor != nullptr, "Specified class is abstract.");
+
+		Vector<RefPtr<Object>> objects(0, objectsCount);
+		if (objectsCount != 0)
+		{
+			auto const slotSize = klass->m_InstancePool.GetSlotSize();
+			auto const memory = static_cast<Byte*>(klass->m_InstancePool.AllocateBatch(objectsCount));
+			for (SizeTp cnt = 0; cnt < objectsCount; ++cnt)
+			{
+				auto const object = klass->m_InstanceCtor(memory + cnt * slotSize);
+				object->m_GUID = GUID::New();
+				objects.InsertLast(object);
+			}
+
+			// Registering all objects in the class table at once.
+			static_assert(sizeof(RefPtr<Object>) == sizeof(Object*), "Reference pointers should be binary compatible with raw ones.");
+			klass->m_Instances.InsertBatch(reinterpret_cast<Object* const*>(objects.GetData()), objectsCount);
+		}
+		return objects;
+	}
+
 	// ------------------------------------------------------------------------------------------
 	// Reflection & Runtime type information.
 	// ------------------------------------------------------------------------------------------
@@ -255,7 +415,7 @@ GD_NAMESPACE_BEGIN
 	 */
 	GDAPI ObjectClassPtr GD_OBJECT_GENERATED Object::GetStaticClass()
 	{
-		static ObjectClass objectClass("Object", nullptr, ObjectCtorGetter<Object>::Get());
+		static ObjectClass objectClass("Object", nullptr, ObjectCtorGetter<Object>::Get(), sizeof(Object));
 		return &objectClass;
 	}
 
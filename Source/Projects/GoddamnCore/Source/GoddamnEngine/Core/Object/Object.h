@@ -16,8 +16,10 @@
 #include <GoddamnEngine/Core/Misc/GUID.h>
 #include <GoddamnEngine/Core/Object/RefPtr.h>
 #include <GoddamnEngine/Core/Object/Struct.h>
-#include <GoddamnEngine/Core/Containers/Map.h>
+#include <GoddamnEngine/Core/Containers/UnorderedMap.h>
+#include <GoddamnEngine/Core/Containers/Name.h>
 #include <GoddamnEngine/Core/Containers/Vector.h>
+#include <GoddamnEngine/Core/Containers/ChunkedVector.h>
 #include <GoddamnEngine/Core/Concurrency/CriticalSection.h>
 
 GD_NAMESPACE_BEGIN
@@ -35,7 +37,7 @@ GD_NAMESPACE_BEGIN
 	GD_OBJECT_HELPER struct ObjectRegistry final : public TNonCopyable
 	{
 	private:
-		Map<GUID, Object*> m_Registry;
+		UnorderedMap<GUID, Object*> m_Registry;
 		CriticalSection m_RegistryLock;
 
 	public:
@@ -63,8 +65,71 @@ GD_NAMESPACE_BEGIN
 			m_Registry.Erase(guid);
 		}
 
+		/*!
+		 * Registers a batch of objects under a single lock.
+		 * GUIDs of the objects that are already present in this registry are regenerated.
+		 *
+		 * @param objects Objects to register.
+		 * @param objectsCount Number of objects.
+		 */
+		GDAPI void InsertBatch(Object* const* const objects, SizeTp const objectsCount);
+
 	};	// class ObjectRegistry
 
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+	// ******                             'ObjectPool' class.                                  ******
+	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+
+	// **------------------------------------------------------------------------------------------**
+	//! Multithreaded slab pool of the class instances memory.
+	//! Memory is allocated in slabs of the fixed-size slots, freed slots are reused through the 
+	//! intrusive free list. Slabs are released only with the pool itself.
+	// **------------------------------------------------------------------------------------------**
+	GD_OBJECT_HELPER struct ObjectPool final : public TNonCopyable
+	{
+	private:
+		SizeTp const m_SlotSize;
+		Vector<Handle> m_Slabs;
+		Handle m_FreeSlots;
+		CriticalSection m_PoolLock;
+
+	public:
+		SizeTp static const SlabLength = 64;
+
+	public:
+		GDAPI explicit ObjectPool(SizeTp const instanceSize);
+		GDAPI ~ObjectPool();
+
+		/*!
+		 * Returns size of the single slot in bytes.
+		 */
+		GDINL SizeTp GetSlotSize() const
+		{
+			return m_SlotSize;
+		}
+
+		/*!
+		 * Allocates memory for a single instance.
+		 */
+		GDAPI Handle Allocate();
+
+		/*!
+		 * Allocates contiguous memory for the specified number of instances.
+		 * Slots of the batch can be freed separately.
+		 *
+		 * @param instancesCount Number of instances.
+		 * @returns Pointer to the first slot. Slots are @ref GetSlotSize bytes apart.
+		 */
+		GDAPI Handle AllocateBatch(SizeTp const instancesCount);
+
+		/*!
+		 * Returns memory of the instance to the pool.
+		 * @param memory Memory, allocated by this pool.
+		 */
+		GDAPI void Free(Handle const memory);
+
+	};	// class ObjectPool
+
 	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
 	// ******                            'ObjectClass' class.                                  ******
 	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
@@ -77,7 +142,7 @@ GD_NAMESPACE_BEGIN
 		friend class Object;
 
 	public:
-		String		   ClassName;		/*!< Name of the class. */
+		Name		   ClassName;		/*!< Name of the class. */
 		ObjectClassPtr ClassSuper;		/*!< Pointer to the super class information. */
 
 	private:
@@ -85,10 +150,11 @@ GD_NAMESPACE_BEGIN
 		
 		ObjectCtorProc m_InstanceCtor;
 		ObjectRegistry m_Instances;
+		ObjectPool     m_InstancePool;
 
 	public:
 
-		GDAPI GD_OBJECT_GENERATED explicit ObjectClass(CStr const className, ObjectClassPtr const classSuper, ObjectCtorProc const classConstructor);
+		GDAPI GD_OBJECT_GENERATED explicit ObjectClass(CStr const className, ObjectClassPtr const classSuper, ObjectCtorProc const classConstructor, SizeTp const classInstanceSize);
 
 	public:
 
@@ -98,7 +164,10 @@ GD_NAMESPACE_BEGIN
 		 * @param className Name of the class we are looking for.
  		 * @returns Pointer to found class or nullptr if no suck class was found.
 		 */
-		GDAPI GD_OBJECT_KERNEL static ObjectClassPtr FindClass(String const& className);
+		//! @{
+		GDAPI GD_OBJECT_KERNEL static ObjectClassPtr FindClass(Name const& className);
+		GDAPI GD_OBJECT_KERNEL static ObjectClassPtr FindClass(StringView const className);
+		//! @}
 
 	};	// struct ObjectClass
 
@@ -112,6 +181,8 @@ GD_NAMESPACE_BEGIN
 	// **------------------------------------------------------------------------------------------**
 	GD_OBJECT_KERNEL class Object : public Struct
 	{
+		friend struct ObjectRegistry;
+
 	private:
 		GUID m_GUID;
 		UInt32 m_ReferenceCount;
@@ -192,6 +263,30 @@ GD_NAMESPACE_BEGIN
 		}
 		//! @}
 
+		/*!
+		 * @brief Creates a batch of new instances of the specified class.
+		 * Instances are allocated contiguously in the class pool and are registered under a single lock.
+		 *
+		 * @param klass Class of the required objects.
+		 * @param objectsCount Number of objects to create.
+		 *
+		 * @returns Vector with all created objects.
+		 */
+		//! @{
+		GDAPI static Vector<RefPtr<Object>> GD_OBJECT_KERNEL CreateObjects(ObjectClassPtr const klass, SizeTp const objectsCount);
+		template<typename TObject>
+		GDINL static Vector<RefPtr<TObject>> GD_OBJECT_HELPER CreateObjects(SizeTp const objectsCount)
+		{
+			auto const objects = Object::CreateObjects(TObject::GetStaticClass(), objectsCount);
+			Vector<RefPtr<TObject>> typedObjects(0, objects.GetLength());
+			for (auto const& object : objects)
+			{
+				typedObjects.InsertLast(union_cast<RefPtr<TObject>>(object));
+			}
+			return typedObjects;
+		}
+		//! @}
+
 		// ------------------------------------------------------------------------------------------
 		// Reflection & Runtime type information.
 		// ------------------------------------------------------------------------------------------
@@ -338,7 +433,7 @@ GD_NAMESPACE_BEGIN
 	{
 		GDINL static constexpr ObjectCtorProc Get()
 		{
-			return []() -> Object* { return gd_new TObject(); };
+			return [](Handle const memory) -> Object* { return new (memory) TObject(); };
 		}
 	};	// struct ObjectCtorGetterBase<T, false>
 	template<typename TObject>
@@ -353,7 +448,7 @@ GD_NAMESPACE_BEGIN
 	 * @param TThisClass Name of the class.
 	 */
 	#define GD_IMPLEMENT_OBJECT_BASE(TEAPI, TThisClass) GD_OBJECT_KERNEL \
-			static ObjectClass g_##TThisClass##Class(#TThisClass, TThisClass::Super::GetStaticClass(), ObjectCtorGetter<TThisClass>::Get());\
+			static ObjectClass g_##TThisClass##Class(#TThisClass, TThisClass::Super::GetStaticClass(), ObjectCtorGetter<TThisClass>::Get(), sizeof(TThisClass));\
 			TEAPI  ObjectClassPtr TThisClass::GetStaticClass() \
 			{ \
 				return &g_##TThisClass##Class; \
@@ -17,8 +17,8 @@
 
 GD_NAMESPACE_BEGIN
 
-    static String const g_ObjectClassPropertyName("GODDAMN_OBJECT_CLASS");
-    static String const g_ObjectGuidPropertyName("GODDAMN_OBJECT_GUID");
+    static Name const g_ObjectClassPropertyName("GODDAMN_OBJECT_CLASS");
+    static Name const g_ObjectGuidPropertyName("GODDAMN_OBJECT_GUID");
 
 	// **------------------------------------------------------------------------------------------**
     //! Deserialization implementation based on reflection system.
@@ -383,7 +383,7 @@ GD_NAMESPACE_BEGIN
 	{
 		BeginWriteStructPropertyValue();
 		WritePropertyName(g_ObjectClassPropertyName);
-		WritePropertyValue(value->GetClass()->ClassName);
+		WritePropertyValue(value->GetClass()->ClassName.ToString());
 		WritePropertyName(g_ObjectGuidPropertyName);
 		WritePropertyValue(value->GetGUID());
 	}
@@ -71,10 +71,10 @@ GD_NAMESPACE_BEGIN
 		/*!
 		 * Reads name of the property or selects next array element.
 		 *
-		 * @param name String property name.
+		 * @param name Property name.
 		 * @returns True if property with such name was found.
 		 */
-		GDINT virtual bool TryReadPropertyName(String const& name)
+		GDINT virtual bool TryReadPropertyName(Name const& name)
 		{
 			GD_NOT_USED(name);
 			return false;
@@ -86,7 +86,7 @@ GD_NAMESPACE_BEGIN
 		 * @param namePtr Pointer to the property name.
 		 * @returns True if property with such name was found.
 		 */
-		GDINL bool TryReadPropertyNameOrSelectNextArrayElement(String const* const namePtr = nullptr)
+		GDINL bool TryReadPropertyNameOrSelectNextArrayElement(Name const* const namePtr = nullptr)
 		{
 			if (!TrySelectNextArrayElement())
 			{
@@ -351,9 +351,9 @@ GD_NAMESPACE_BEGIN
 
 		/*!
 		 * Writes name of the property.
-		 * @param name String property name.
+		 * @param name Property name.
 		 */
-		GDINT virtual void WritePropertyName(String const& name)
+		GDINT virtual void WritePropertyName(Name const& name)
 		{
 			GD_NOT_USED(name);
 		}
@@ -362,7 +362,7 @@ GD_NAMESPACE_BEGIN
 		 * Writes name of the property or selects next array element.
 		 * @param namePtr Pointer to the property name.
 		 */
-		GDINT void WritePropertyNameOrSelectNextArrayElement(String const* const namePtr = nullptr)
+		GDINT void WritePropertyNameOrSelectNextArrayElement(Name const* const namePtr = nullptr)
 		{
 			if (!TrySelectNextArrayElement())
 			{
@@ -97,7 +97,7 @@ GD_NAMESPACE_BEGIN
 		// ------------------------------------------------------------------------------------------
 
 	public:
-		GDINT virtual bool TryReadPropertyName(String const& name) override
+		GDINT virtual bool TryReadPropertyName(Name const& name) override
 		{
 			if (!ObjectReaderDocBase::TryReadPropertyName(name))
 			{
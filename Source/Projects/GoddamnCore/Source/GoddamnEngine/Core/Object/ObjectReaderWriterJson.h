@@ -15,6 +15,7 @@
 #include <GoddamnEngine/Include.h>
 #include <GoddamnEngine/Core/Object/ObjectReaderWriterDoc.h>
 #include <GoddamnEngine/Core/Object/Serialization/Doc/DocJson.h>
+#include <GoddamnEngine/Core/Containers/StringFormat.h>
 
 GD_NAMESPACE_BEGIN
 
@@ -106,11 +107,11 @@ GD_NAMESPACE_BEGIN
 			return false;
 		}
 
-		GDINT virtual void WritePropertyName(String const& name) override final
+		GDINT virtual void WritePropertyName(Name const& name) override final
 		{
 			WritePropertyNewLineAndTabs();
 			m_WritingStream.Write("\"");
-			m_WritingStream.Write(name);
+			m_WritingStream.Write(name.CStr(), sizeof(Char), name.GetLength());
 			m_WritingStream.Write("\" : ");
 		}
 
@@ -131,7 +132,9 @@ GD_NAMESPACE_BEGIN
 		template<typename TNumericValue>
 		GDINL void WritePropertyValueImpl(TNumericValue const value)
 		{
-			m_WritingStream.Write(String::FromFloat64(static_cast<Float64>(value)));
+			// Integers are written exactly, floating point numbers in the shortest form, that is read back to the same value.
+			StringFormatStream writingStream(m_WritingStream);
+			StringFormat::FormatTo(writingStream, GD_FORMAT("{}"), value);
 		}
         
 		GDINL void WritePropertyValueImpl(String const& value)
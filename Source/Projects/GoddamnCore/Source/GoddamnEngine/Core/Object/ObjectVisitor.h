@@ -16,7 +16,9 @@
 #include <GoddamnEngine/Core/Object/Base.h>
 
 #include <GoddamnEngine/Core/Containers/String.h>
+#include <GoddamnEngine/Core/Containers/Name.h>
 #include <GoddamnEngine/Core/Containers/Vector.h>
+#include <GoddamnEngine/Core/Containers/InlineVector.h>
 
 GD_NAMESPACE_BEGIN
 
@@ -39,11 +41,11 @@ GD_NAMESPACE_BEGIN
 	// **------------------------------------------------------------------------------------------**
 	GD_OBJECT_KERNEL struct PropertyMetaInfo final : public TNonCopyable
 	{
-		String const PropertyName;
+		Name const PropertyName;
 		PropertyFlags const PropertyFlags;
 
 	public:
-		GDINL explicit PropertyMetaInfo(CStr const propertyName, GD::PropertyFlags const propertyFlags = PFDefault, ...)
+		GDINL explicit PropertyMetaInfo(Name const& propertyName, GD::PropertyFlags const propertyFlags = PFDefault, ...)
 			: PropertyName(propertyName), PropertyFlags(propertyFlags)
 		{
 		}
@@ -348,6 +350,27 @@ GD_NAMESPACE_BEGIN
 			}
 		}
 
+		/*!
+		 * Handles array property with inline storage.
+		 *
+		 * @param propertyMetaInfo Meta information, declared with property.
+		 * @param array Array property value.
+		 */
+		template<typename TElement, SizeTp TInlineCapacity>
+		GDINL void VisitProperty(PropertyMetaInfo const* const propertyMetaInfo, InlineVector<TElement, TInlineCapacity>& array)
+		{
+			auto arraySize = array.GetLength();
+			if (this->BeginVisitArrayProperty(propertyMetaInfo, arraySize))
+			{
+				array.Resize(arraySize);
+				for (auto& arrayElement : array)
+				{
+					this->VisitProperty(propertyMetaInfo, arrayElement);
+				}
+				this->EndVisitArrayProperty(propertyMetaInfo);
+			}
+		}
+
         /*!
          * Handles struct property.
          *
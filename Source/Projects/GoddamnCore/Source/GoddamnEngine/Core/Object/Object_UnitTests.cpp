@@ -126,6 +126,38 @@ GD_NAMESPACE_BEGIN
 		}
 	};
 
+	gd_testing_unit_test(ObjectCreateObjects)
+	{
+		{
+			// These should succeed.
+			auto const instances = Object::CreateObjects<TestDerived1Class>(100);
+			gd_testing_verify(instances.GetLength() == 100);
+			for (SizeTp cnt = 0; cnt < instances.GetLength(); ++cnt)
+			{
+				gd_testing_verify(instances[cnt]->GetClass() == TestDerived1Class::GetStaticClass());
+				gd_testing_verify(instances[cnt]->FirstPoperty == 1);
+				if (cnt != 0)
+				{
+					gd_testing_verify(instances[cnt]->GetGUID() != instances[cnt - 1]->GetGUID());
+				}
+
+				auto const foundInstance = Object::CreateOrFindClassRelatedObjectByGUID<TestDerived1Class>(instances[cnt]->GetGUID());
+				gd_testing_verify(foundInstance == instances[cnt]);
+			}
+		}
+
+		{
+			// This should succeed: released slots are recycled by the class pool.
+			Object const* instance1Memory = nullptr;
+			{
+				auto const instance1 = TestDerived2Class::CreateObject();
+				instance1Memory = instance1.Get();
+			}
+			auto const instance2 = TestDerived2Class::CreateObject();
+			gd_testing_verify(instance2.Get() == instance1Memory);
+		}
+	};
+
 	gd_testing_unit_test(ObjectFindObjects)
 	{
 		//auto const instance1 = TestBase2Class::CreateObject();
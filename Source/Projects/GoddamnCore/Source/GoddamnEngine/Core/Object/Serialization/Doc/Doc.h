@@ -16,6 +16,7 @@
 #include <GoddamnEngine/Core/IO/Stream.h>
 #include <GoddamnEngine/Core/Containers/Vector.h>
 #include <GoddamnEngine/Core/Containers/String.h>
+#include <GoddamnEngine/Core/Containers/Name.h>
 #include <GoddamnEngine/Core/Templates/SharedPtr.h>
 
 GD_NAMESPACE_BEGIN
@@ -121,7 +122,7 @@ GD_NAMESPACE_BEGIN
 		 * @param name The name of the property.
 		 * @returns Pointer to the found value or null pointer.
 		 */
-		GDINT virtual DocValuePtr _GetProperty(String const& name) GD_PURE_VIRTUAL;
+		GDINT virtual DocValuePtr _GetProperty(Name const& name) GD_PURE_VIRTUAL;
 		
 	};	// class IDocObject
 
@@ -12,6 +12,7 @@
  */
 #include <GoddamnEngine/Core/Object/Serialization/Doc/DocJson.h>
 
+#include <GoddamnEngine/Core/CStdlib/CParse.h>
 #include <GoddamnEngine/Core/Templates/UniquePtr.h>
 #include <GoddamnEngine/Core/IO/Stream.h>
 
@@ -99,21 +100,35 @@ GD_NAMESPACE_BEGIN
 		if(CChar::IsDigit(nextCharacter) || CString::Strchr("+-.", nextCharacter) != nullptr)
 		{
 			// Numeric constant. Is should be written like a "cast-able" to double constant in C++.
+			// Characters are collected on the stack, only the very long constants are copied into the token data.
 			nextToken.TokenType = JsonTokenType::Number;
+			Char numberBuffer[64];
+			SizeTp numberLength = 0;
 			while ((CChar::IsDigit(nextCharacter) || CChar::IsAlphabetic(nextCharacter)
 				 || CString::Strchr("+-.", nextCharacter) != nullptr) && nextCharacter != -1)
 			{
-				nextToken.TokenData += nextCharacter;
+				if (numberLength == GD::GetLength(numberBuffer))
+				{
+					nextToken.TokenData += String(numberBuffer, numberLength);
+					numberLength = 0;
+				}
+				numberBuffer[numberLength++] = nextCharacter;
 				JsonGetNextChar(stream, nextCharacter, nextCharacterInt);
 			}
 			stream.Seek(-1);
 
+			CStr numberString = numberBuffer;
+			if (!nextToken.TokenData.IsEmpty())
+			{
+				nextToken.TokenData += String(numberBuffer, numberLength);
+				numberString = nextToken.TokenData.CStr();
+				numberLength = nextToken.TokenData.GetLength();
+			}
+
 			// Testing whether all the token content is a valid number.
-			CStr numberString = nextToken.TokenData.CStr();
-			nextToken.TokenNumber = CString::Strtof64(numberString, &numberString);
-			if (*numberString != '\0')
+			if (CParse::ParseFloat64(numberString, numberLength, nextToken.TokenNumber).Length != numberLength)
 			{
-				return{ JsonTokenType::Error, String::Format("Invalid numeric constant \"%s\" in the input stream.", nextToken.TokenData.CStr()) };
+				return{ JsonTokenType::Error, String::Format("Invalid numeric constant \"%s\" in the input stream.", String(numberString, numberLength).CStr()) };
 			}
 		}
 		else if (CChar::IsAlphabetic(nextCharacter))
@@ -15,9 +15,10 @@
 #include <GoddamnEngine/Include.h>
 #include <GoddamnEngine/Core/Object/Serialization/Doc/Doc.h>
 
-#include <GoddamnEngine/Core/Containers/Map.h>
+#include <GoddamnEngine/Core/Containers/UnorderedMap.h>
 #include <GoddamnEngine/Core/Containers/Vector.h>
 #include <GoddamnEngine/Core/Containers/String.h>
+#include <GoddamnEngine/Core/Containers/Name.h>
 #include <GoddamnEngine/Core/Templates/SharedPtr.h>
 
 GD_NAMESPACE_BEGIN
@@ -466,7 +467,9 @@ GD_NAMESPACE_BEGIN
 	class JsonObject final : public IDocObject
 	{
 	private:
-		Map<String, JsonValuePtr> m_Properties;
+		// Keys of the documents are not interned, so that parsing large or untrusted documents
+		// does not grow the global name table.
+		UnorderedMap<String, JsonValuePtr> m_Properties;
 
 	public:
 
@@ -476,12 +479,18 @@ GD_NAMESPACE_BEGIN
 		 * @param name The name of the property.
 		 * @returns Pointer to the found value or null pointer.
 		 */
-		GDINL JsonValuePtr GetProperty(String const& name)
+		//! @{
+		GDINL JsonValuePtr GetProperty(StringView const name)
 		{
 			auto const propertyPtr = m_Properties.Find(name);
 			return propertyPtr != nullptr ? *propertyPtr : nullptr;
 		}
-		GDINT virtual DocValuePtr _GetProperty(String const& name) override final
+		GDINL JsonValuePtr GetProperty(Name const& name)
+		{
+			return GetProperty(StringView(name.CStr(), name.GetLength()));
+		}
+		//! @}
+		GDINT virtual DocValuePtr _GetProperty(Name const& name) override final
         {
             return static_cast<DocValuePtr>(GetProperty(name));
         }
@@ -90,7 +90,7 @@ GD_NAMESPACE_BEGIN
 				GD_PROPERTY_NO_DECL_BASE(TPropertyName); \
 				private: template<> void ReflectPrivate<__COUNTER__>(ObjectVisitor& objectVisitor) /*NOLINT*/ \
 				{ \
-					static PropertyMetaInfo const propertyMetaInfo(#TPropertyName, ##__VA_ARGS__); \
+					static PropertyMetaInfo const propertyMetaInfo(GD_NAME(#TPropertyName), ##__VA_ARGS__); \
 					objectVisitor.VisitProperty(&propertyMetaInfo, TPropertyName); \
 					ReflectPrivate<__COUNTER__ + 1>(objectVisitor); \
 				} \
@@ -149,7 +149,7 @@ GD_NAMESPACE_BEGIN
 				{ \
 					static void Invoke(TObjectVisitor& objectVisitor, This* const self) \
 					{ \
-						static PropertyMetaInfo const propertyMetaInfo(#TPropertyName, ##__VA_ARGS__); \
+						static PropertyMetaInfo const propertyMetaInfo(GD_NAME(#TPropertyName), ##__VA_ARGS__); \
 						objectVisitor.VisitProperty(&propertyMetaInfo, self->TPropertyName); \
 						ReflectPrivate<TObjectVisitor, __COUNTER__ + 1>::Invoke(objectVisitor, self); \
 					} \
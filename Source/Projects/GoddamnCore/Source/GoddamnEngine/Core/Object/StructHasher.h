@@ -0,0 +1,131 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/Object/StructHasher.h
+ * File contains reflection-based hashing of the structures.
+ */
+#pragma once
+
+#include <GoddamnEngine/Include.h>
+#include <GoddamnEngine/Core/Misc/Hash.h>
+#include <GoddamnEngine/Core/Object/Object.h>
+
+GD_NAMESPACE_BEGIN
+
+	// **------------------------------------------------------------------------------------------**
+	//! Hashing implementation based on reflection system.
+	//! Combines hashes of all reflected properties in their declaration order.
+	// **------------------------------------------------------------------------------------------**
+	struct GD_OBJECT_HELPER StructHashVisitor final : public TObjectVisitor<StructHashVisitor>
+	{
+	private:
+		HashBuilder m_HashBuilder;
+
+	public:
+
+		/*!
+		 * Returns combined hash value of the visited properties.
+		 */
+		GDINL UInt64 GetValue() const
+		{
+			return m_HashBuilder.GetValue();
+		}
+
+		// ------------------------------------------------------------------------------------------
+		// Unknown properties visitors.
+		// ------------------------------------------------------------------------------------------
+
+		GDINL virtual void VisitUnknownProperty(PropertyMetaInfo const* const propertyMetaInfo, Handle const valueHandle) override final
+		{
+			// Unknown properties do not participate in the hash.
+			GD_NOT_USED_L(this, propertyMetaInfo, valueHandle);
+		}
+
+		// ------------------------------------------------------------------------------------------
+		// Primitives properties visitors.
+		// ------------------------------------------------------------------------------------------
+
+		template<typename TValue>
+		GDINL void VisitPrimitivePropertyImpl(PropertyMetaInfo const* const propertyMetaInfo, TValue& value)
+		{
+			GD_NOT_USED(propertyMetaInfo);
+			m_HashBuilder.Add(const_cast<TValue const&>(value));
+		}
+
+		GDINL void VisitPrimitivePropertyImpl(PropertyMetaInfo const* const propertyMetaInfo, RefPtr<Object>& value)
+		{
+			// Objects are hashed by identity.
+			GD_NOT_USED(propertyMetaInfo);
+			if (value != nullptr)
+			{
+				m_HashBuilder.Add(value->GetGUID());
+			}
+			else
+			{
+				m_HashBuilder.Add(UInt64(0));
+			}
+		}
+
+		// ------------------------------------------------------------------------------------------
+		// Array properties visitors.
+		// ------------------------------------------------------------------------------------------
+
+		GDINT bool BeginVisitArrayProperty(PropertyMetaInfo const* const propertyMetaInfo, SizeTp& arraySize) override final
+		{
+			// Length is hashed, so that nested arrays with same elements but different splitting differ.
+			GD_NOT_USED(propertyMetaInfo);
+			m_HashBuilder.Add(static_cast<UInt64>(arraySize));
+			return true;
+		}
+
+		GDINT void EndVisitArrayProperty(PropertyMetaInfo const* const propertyMetaInfo) override final
+		{
+			GD_NOT_USED_L(this, propertyMetaInfo);
+		}
+
+		// ------------------------------------------------------------------------------------------
+		// Structure properties visitors.
+		// ------------------------------------------------------------------------------------------
+
+		GDINT bool BeginVisitStructProperty(PropertyMetaInfo const* const propertyMetaInfo) override final
+		{
+			GD_NOT_USED_L(this, propertyMetaInfo);
+			return true;
+		}
+
+		GDINT void EndVisitStructProperty(PropertyMetaInfo const* const propertyMetaInfo) override final
+		{
+			GD_NOT_USED_L(this, propertyMetaInfo);
+		}
+	};	// struct StructHashVisitor
+
+	// **------------------------------------------------------------------------------------------**
+	//! Computes hashes of the reflectable structures, so they could be used as keys of the hash
+	//! tables without implementing the 'GetHashCode' method manually:
+	//!
+	//! @code
+	//!		UnorderedMap<TestPhoneNumber, String, StructHasher<TestPhoneNumber>> phoneBook;
+	//! @endcode
+	//!
+	//! @tparam TStruct Type of the hashed structure.
+	// **------------------------------------------------------------------------------------------**
+	template<typename TStruct>
+	struct GD_OBJECT_HELPER StructHasher final
+	{
+	public:
+		GDINL UInt64 operator()(TStruct const& theStruct) const
+		{
+			// Reflection API is not const-correct, but hashing never modifies the properties.
+			StructHashVisitor structHashVisitor;
+			const_cast<TStruct&>(theStruct).Reflect(structHashVisitor);
+			return structHashVisitor.GetValue();
+		}
+	};	// struct StructHasher
+
+GD_NAMESPACE_END
@@ -0,0 +1,69 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*! 
+ * @file GoddamnEngine/Core/Object/StructHasher_UnitTests.cpp
+ * File contains unit tests for the reflection-based hashing.
+ */
+#include <GoddamnEngine/Core/Object/StructHasher.h>
+#if GD_TESTING_ENABLED
+
+#include <GoddamnEngine/Core/Containers/UnorderedMap.h>
+
+GD_NAMESPACE_BEGIN
+
+	struct TestHashedPoint final : public Struct
+	{
+		GD_DECLARE_STRUCT(TestHashedPoint, Struct)
+		GD_PROPERTY(public, Int32, X);
+		GD_PROPERTY(public, Int32, Y);
+		GD_PROPERTY(public, String, Name);
+		GD_PROPERTY(public, Vector<Int32>, Tags);
+
+	public:
+		GDINL TestHashedPoint(Int32 const x = 0, Int32 const y = 0, String const& name = "")
+			: X(x), Y(y), Name(name)
+		{
+		}
+
+		GDINL friend bool operator== (TestHashedPoint const& lhs, TestHashedPoint const& rhs)
+		{
+			return lhs.X == rhs.X && lhs.Y == rhs.Y && lhs.Name == rhs.Name && lhs.Tags == rhs.Tags;
+		}
+	};	// struct TestHashedPoint
+
+	gd_testing_unit_test(StructHasherProperties)
+	{
+		StructHasher<TestHashedPoint> const hasher;
+		gd_testing_verify(hasher(TestHashedPoint(1, 2, "a")) == hasher(TestHashedPoint(1, 2, "a")));
+		gd_testing_verify(hasher(TestHashedPoint(1, 2, "a")) != hasher(TestHashedPoint(2, 1, "a")));
+		gd_testing_verify(hasher(TestHashedPoint(1, 2, "a")) != hasher(TestHashedPoint(1, 2, "b")));
+
+		TestHashedPoint withTags(1, 2, "a");
+		withTags.Tags.InsertLast(0);
+		gd_testing_verify(hasher(withTags) != hasher(TestHashedPoint(1, 2, "a")));
+	};
+
+	gd_testing_unit_test(StructHasherUnorderedMap)
+	{
+		UnorderedMap<TestHashedPoint, Int32, StructHasher<TestHashedPoint>> map;
+		for (Int32 i = 0; i < 100; ++i)
+		{
+			map.Insert(TestHashedPoint(i, -i, "point"), i);
+		}
+		for (Int32 i = 0; i < 100; ++i)
+		{
+			auto const value = map.Find(TestHashedPoint(i, -i, "point"));
+			gd_testing_verify(value != nullptr && *value == i);
+		}
+		gd_testing_verify(!map.Contains(TestHashedPoint(1, 1, "point")));
+	};
+
+GD_NAMESPACE_END
+
+#endif	// if GD_TESTING_ENABLED
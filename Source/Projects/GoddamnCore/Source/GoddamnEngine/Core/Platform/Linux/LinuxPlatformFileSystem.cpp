@@ -178,11 +178,11 @@ GD_NAMESPACE_BEGIN
 				{
 				}
 			public:
-				GDINT virtual bool OnVisitDirectoryEntry(WideString const& path, bool const isDirectory) override final
+				GDINT virtual bool OnVisitDirectoryEntry(Path const& path, bool const isDirectory) override final
 				{
 					if (isDirectory)
 					{
-						return m_Watch.AddDirectory(path);
+						return m_Watch.AddDirectory(path.ToWideString());
 					}
 					return true;
 				}
@@ -14,6 +14,7 @@
 #if GD_PLATFORM_API_MICROSOFT
 
 #include <crtdbg.h>
+#include <Windows.h>
 
 GD_NAMESPACE_BEGIN
 
@@ -182,6 +183,81 @@ GD_NAMESPACE_BEGIN
 			return true;
 		}
 #endif	// if GD_DEBUG
+
+		// ------------------------------------------------------------------------------------------
+		// Virtual memory.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Returns size of the virtual memory page.
+		 * Large pages on Microsoft platforms require a special privilege and cannot be decommitted,
+		 * so huge page requests are served by the allocation granularity instead.
+		 *
+		 * @param pageSize Size of pages that back the memory.
+		 */
+		GDINT virtual SizeTp VirtualMemoryGetPageSize(VirtualMemoryPageSize const pageSize) const override final
+		{
+			SYSTEM_INFO systemInfo = {};
+			GetSystemInfo(&systemInfo);
+			return pageSize == VirtualMemoryPageSize::Default ? systemInfo.dwPageSize : systemInfo.dwAllocationGranularity;
+		}
+
+		/*!
+		 * Reserves a range of the address space without committing any physical memory.
+		 * 
+		 * @param reservationPointer Reserved memory pointer, aligned by the page size.
+		 * @param reservationSizeBytes Size of the address space range to reserve in bytes.
+		 * @param pageSize Size of pages that should back the memory.
+		 *
+		 * @returns True if operation succeeded.
+		 */
+		GDINT virtual bool VirtualMemoryReserve(Handle& reservationPointer, SizeTp const reservationSizeBytes, VirtualMemoryPageSize const pageSize) override final
+		{
+			GD_NOT_USED(pageSize);
+			reservationPointer = VirtualAlloc(nullptr, reservationSizeBytes, MEM_RESERVE, PAGE_NOACCESS);
+			return reservationPointer != nullptr;
+		}
+
+		/*!
+		 * Commits physical memory to the part of the reserved range and makes it readable and writable.
+		 * 
+		 * @param commitPointer Pointer to the first page to commit.
+		 * @param commitSizeBytes Size of memory to commit in bytes.
+		 *
+		 * @returns True if operation succeeded.
+		 */
+		GDINT virtual bool VirtualMemoryCommit(Handle const commitPointer, SizeTp const commitSizeBytes) override final
+		{
+			return VirtualAlloc(commitPointer, commitSizeBytes, MEM_COMMIT, PAGE_READWRITE) != nullptr;
+		}
+
+		/*!
+		 * Returns physical memory of the part of the reserved range back to the system.
+		 * Address space stays reserved.
+		 * 
+		 * @param decommitPointer Pointer to the first page to decommit.
+		 * @param decommitSizeBytes Size of memory to decommit in bytes.
+		 *
+		 * @returns True if operation succeeded.
+		 */
+		GDINT virtual bool VirtualMemoryDecommit(Handle const decommitPointer, SizeTp const decommitSizeBytes) override final
+		{
+			return VirtualFree(decommitPointer, decommitSizeBytes, MEM_DECOMMIT) != FALSE;
+		}
+
+		/*!
+		 * Releases the whole reserved range, including all committed memory.
+		 * 
+		 * @param reservationPointer Reserved memory pointer.
+		 * @param reservationSizeBytes Size of the reserved range in bytes.
+		 *
+		 * @returns True if operation succeeded.
+		 */
+		GDINT virtual bool VirtualMemoryRelease(Handle const reservationPointer, SizeTp const reservationSizeBytes) override final
+		{
+			GD_NOT_USED(reservationSizeBytes);
+			return VirtualFree(reservationPointer, 0, MEM_RELEASE) != FALSE;
+		}
 	};	// class MicrosoftPlatformAllocator
 
 	GD_IMPLEMENT_SINGLETON(IPlatformAllocator, MicrosoftPlatformAllocator);
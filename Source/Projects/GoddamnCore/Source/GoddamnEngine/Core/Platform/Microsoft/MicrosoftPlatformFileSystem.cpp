@@ -30,19 +30,19 @@ GD_NAMESPACE_BEGIN
 		// File utilities.
 		// ------------------------------------------------------------------------------------------
 
-		GDINT virtual bool FileExists(WideString const& filename) const override final;
-		GDINT virtual bool FileSize(WideString const& filename, UInt64& fileSize) const override final;
-		GDINT virtual bool FileCreateEmpty(WideString const& filename) override final;
-		GDINT virtual bool FileRemove(WideString const& filename) override final;
-		GDINT virtual bool FileMove(WideString const& srcFilename, WideString const& dstFilename, bool const doOverwrite) override final;
-		GDINT virtual bool FileCopy(WideString const& srcFilename, WideString const& dstFilename, bool const doOverwrite) override final;
+		GDINT virtual bool FileExists(Path const& filename) const override final;
+		GDINT virtual bool FileSize(Path const& filename, UInt64& fileSize) const override final;
+		GDINT virtual bool FileCreateEmpty(Path const& filename) override final;
+		GDINT virtual bool FileRemove(Path const& filename) override final;
+		GDINT virtual bool FileMove(Path const& srcFilename, Path const& dstFilename, bool const doOverwrite) override final;
+		GDINT virtual bool FileCopy(Path const& srcFilename, Path const& dstFilename, bool const doOverwrite) override final;
 
 		// ------------------------------------------------------------------------------------------
 		// File IO utilities.
 		// ------------------------------------------------------------------------------------------
 
-		GDINT virtual bool FileOpenRead(WideString const& filename, Handle& fileHandle) const override final;
-		GDINT virtual bool FileOpenWrite(WideString const& filename, Handle& fileHandle, bool const doAppend) override final;
+		GDINT virtual bool FileOpenRead(Path const& filename, Handle& fileHandle) const override final;
+		GDINT virtual bool FileOpenWrite(Path const& filename, Handle& fileHandle, bool const doAppend) override final;
 		GDINT virtual bool FileClose(Handle const fileHandle) const override final;
 		GDINT virtual bool FileSeek(Handle const fileHandle, Int64 const offset, SeekOrigin const origin, UInt64* const newPosition) const override final;
 		GDINT virtual bool FileRead(Handle const fileHandle, Handle const readBuffer, UInt32 const readBufferSizeBytes, UInt32* const numBytesRead) const override final;
@@ -52,10 +52,10 @@ GD_NAMESPACE_BEGIN
 		// Directory utilities.
 		// ------------------------------------------------------------------------------------------
 
-		GDINT virtual bool DirectoryExists(WideString const& directoryName) const override final;
-		GDINT virtual bool DirectoryCreateEmpty(WideString const& directoryName) const override final;
-		GDINT virtual bool DirectoryRemove(WideString const& directoryName) override final;
-		GDINT virtual bool DirectoryIterate(WideString const& directoryName, IFileSystemDirectoryIterateDelegate& directoryIterateDelegate) const override final;
+		GDINT virtual bool DirectoryExists(Path const& directoryName) const override final;
+		GDINT virtual bool DirectoryCreateEmpty(Path const& directoryName) const override final;
+		GDINT virtual bool DirectoryRemove(Path const& directoryName) override final;
+		GDINT virtual bool DirectoryIterate(Path const& directoryName, IFileSystemDirectoryIterateDelegate& directoryIterateDelegate) const override final;
 	};	// class MicrosoftPlatformDiskFileSystem
 
 	GD_IMPLEMENT_SINGLETON(IPlatformDiskFileSystem, MicrosoftPlatformDiskFileSystem)
@@ -68,9 +68,9 @@ GD_NAMESPACE_BEGIN
 	 * Returns true if the specified file exists and is not directory.
 	 * @param filename Path to the file.
 	 */
-	GDINT bool MicrosoftPlatformDiskFileSystem::FileExists(WideString const& filename) const
+	GDINT bool MicrosoftPlatformDiskFileSystem::FileExists(Path const& filename) const
 	{
-		auto const filenameSystem = Paths::Platformize(filename);
+		auto const filenameSystem = Paths::Platformize(filename.GetView());
 		auto const fileAttributes = GetFileAttributesW(filenameSystem.CStr());
 		return fileAttributes != INVALID_FILE_ATTRIBUTES && (fileAttributes & FILE_ATTRIBUTE_DIRECTORY) == 0;
 	}
@@ -83,10 +83,10 @@ GD_NAMESPACE_BEGIN
 	 * 
 	 * @returns True if file size was successfully obtained.
 	 */
-	GDINT bool MicrosoftPlatformDiskFileSystem::FileSize(WideString const& filename, UInt64& fileSize) const
+	GDINT bool MicrosoftPlatformDiskFileSystem::FileSize(Path const& filename, UInt64& fileSize) const
 	{
 		WIN32_FILE_ATTRIBUTE_DATA fileAttributeData = {};
-		auto const filenameSystem = Paths::Platformize(filename);
+		auto const filenameSystem = Paths::Platformize(filename.GetView());
 		if (GetFileAttributesExW(filenameSystem.CStr(), GetFileExInfoStandard, &fileAttributeData) == TRUE)
 		{
 			if ((fileAttributeData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) == 0)
@@ -108,11 +108,11 @@ GD_NAMESPACE_BEGIN
 	 * @param filename Path to the file.
 	 * @returns True if file exists or was successfully created.
 	 */
-	GDINT bool MicrosoftPlatformDiskFileSystem::FileCreateEmpty(WideString const& filename)
+	GDINT bool MicrosoftPlatformDiskFileSystem::FileCreateEmpty(Path const& filename)
 	{
 		if (!FileExists(filename))
 		{
-			auto const filenameSystem = Paths::Platformize(filename);
+			auto const filenameSystem = Paths::Platformize(filename.GetView());
 			auto const emptyFile = CreateFile2(filenameSystem.CStr(), GENERIC_WRITE, FILE_SHARE_READ, CREATE_NEW, nullptr);
 			if (emptyFile != INVALID_HANDLE_VALUE)
 			{
@@ -130,9 +130,9 @@ GD_NAMESPACE_BEGIN
 	 * @param filename Path to the file.
 	 * @returns True if file was successfully deleted.
 	 */
-	GDINT bool MicrosoftPlatformDiskFileSystem::FileRemove(WideString const& filename)
+	GDINT bool MicrosoftPlatformDiskFileSystem::FileRemove(Path const& filename)
 	{
-		auto const filenameSystem = Paths::Platformize(filename);
+		auto const filenameSystem = Paths::Platformize(filename.GetView());
 		if (DeleteFileW(filenameSystem.CStr()) == FALSE)
 		{
 			Sleep(0);
@@ -150,15 +150,15 @@ GD_NAMESPACE_BEGIN
 	 * 
 	 * @returns True if file was successfully moved.
 	 */
-	GDINT bool MicrosoftPlatformDiskFileSystem::FileMove(WideString const& srcFilename, WideString const& dstFilename, bool const doOverwrite)
+	GDINT bool MicrosoftPlatformDiskFileSystem::FileMove(Path const& srcFilename, Path const& dstFilename, bool const doOverwrite)
 	{
 		if (DirectoryExists(srcFilename))
 		{
 			// Specified path is a path to file, this is an error.
 			return false;
 		}
-		auto const srcFilenameSystem = Paths::Platformize(srcFilename);
-		auto const dstFilenameSystem = Paths::Platformize(dstFilename);
+		auto const srcFilenameSystem = Paths::Platformize(srcFilename.GetView());
+		auto const dstFilenameSystem = Paths::Platformize(dstFilename.GetView());
 		if (MoveFileExW(srcFilenameSystem.CStr(), dstFilenameSystem.CStr(), doOverwrite ? MOVEFILE_REPLACE_EXISTING : 0) == FALSE)
 		{
 			Sleep(0);
@@ -176,15 +176,15 @@ GD_NAMESPACE_BEGIN
 	 * 
 	 * @returns True if file was successfully moved.
 	 */
-	GDINT bool MicrosoftPlatformDiskFileSystem::FileCopy(WideString const& srcFilename, WideString const& dstFilename, bool const doOverwrite)
+	GDINT bool MicrosoftPlatformDiskFileSystem::FileCopy(Path const& srcFilename, Path const& dstFilename, bool const doOverwrite)
 	{
 		if (DirectoryExists(srcFilename))
 		{
 			// Specified path is a path to file, this is an error.
 			return false;
 		}
-		auto const srcFilenameSystem = Paths::Platformize(srcFilename);
-		auto const dstFilenameSystem = Paths::Platformize(dstFilename);
+		auto const srcFilenameSystem = Paths::Platformize(srcFilename.GetView());
+		auto const dstFilenameSystem = Paths::Platformize(dstFilename.GetView());
 		if (CopyFileW(srcFilenameSystem.CStr(), dstFilenameSystem.CStr(), !doOverwrite) == FALSE)
 		{
 			Sleep(0);
@@ -205,9 +205,9 @@ GD_NAMESPACE_BEGIN
 	 * 
 	 * @returns True if file was successfully opened.
 	 */
-	GDINT bool MicrosoftPlatformDiskFileSystem::FileOpenRead(WideString const& filename, Handle& fileHandle) const
+	GDINT bool MicrosoftPlatformDiskFileSystem::FileOpenRead(Path const& filename, Handle& fileHandle) const
 	{
-		auto const filenameSystem = Paths::Platformize(filename);
+		auto const filenameSystem = Paths::Platformize(filename.GetView());
 		auto const fileHandleSystem = CreateFile2(filenameSystem.CStr(), GENERIC_READ, FILE_SHARE_READ, OPEN_EXISTING, nullptr);
 		if (fileHandleSystem != INVALID_HANDLE_VALUE)
 		{
@@ -226,9 +226,9 @@ GD_NAMESPACE_BEGIN
 	 * 
 	 * @returns True if file was successfully opened.
 	 */
-	GDINT bool MicrosoftPlatformDiskFileSystem::FileOpenWrite(WideString const& filename, Handle& fileHandle, bool const doAppend)
+	GDINT bool MicrosoftPlatformDiskFileSystem::FileOpenWrite(Path const& filename, Handle& fileHandle, bool const doAppend)
 	{
-		auto const filenameSystem = Paths::Platformize(filename);
+		auto const filenameSystem = Paths::Platformize(filename.GetView());
 		auto const fileHandleSystem = CreateFile2(filenameSystem.CStr(), doAppend ? FILE_APPEND_DATA : GENERIC_WRITE, FILE_SHARE_READ, doAppend ? OPEN_ALWAYS : CREATE_ALWAYS, nullptr);
 		if (fileHandleSystem != INVALID_HANDLE_VALUE)
 		{
@@ -371,9 +371,9 @@ GD_NAMESPACE_BEGIN
 	 * Returns true if the specified file exists and is a directory.
 	 * @param directoryName Name to the directory.
 	 */
-	GDINT bool MicrosoftPlatformDiskFileSystem::DirectoryExists(WideString const& directoryName) const
+	GDINT bool MicrosoftPlatformDiskFileSystem::DirectoryExists(Path const& directoryName) const
 	{
-		auto const directoryNameSystem = Paths::Platformize(directoryName);
+		auto const directoryNameSystem = Paths::Platformize(directoryName.GetView());
 		auto const directoryAttributes = GetFileAttributesW(directoryNameSystem.CStr());
 		return directoryAttributes != INVALID_FILE_ATTRIBUTES && (directoryAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0;
 	}
@@ -385,9 +385,9 @@ GD_NAMESPACE_BEGIN
 	 * @param directoryName Path to the directory.
 	 * @returns True if directory exists or was successfully created.
 	 */
-	GDINT bool MicrosoftPlatformDiskFileSystem::DirectoryCreateEmpty(WideString const& directoryName) const
+	GDINT bool MicrosoftPlatformDiskFileSystem::DirectoryCreateEmpty(Path const& directoryName) const
 	{
-		auto const directoryNameSystem = Paths::Platformize(directoryName);
+		auto const directoryNameSystem = Paths::Platformize(directoryName.GetView());
 		if (CreateDirectoryW(directoryNameSystem.CStr(), nullptr) == FALSE)
 		{
 			if (GetLastError() != ERROR_ALREADY_EXISTS)
@@ -410,9 +410,9 @@ GD_NAMESPACE_BEGIN
 	 * @param directoryName Path to the directory.
 	 * @returns True if directory was successfully deleted.
 	 */
-	GDINT bool MicrosoftPlatformDiskFileSystem::DirectoryRemove(WideString const& directoryName)
+	GDINT bool MicrosoftPlatformDiskFileSystem::DirectoryRemove(Path const& directoryName)
 	{
-		auto const directoryNameSystem = Paths::Platformize(directoryName);
+		auto const directoryNameSystem = Paths::Platformize(directoryName.GetView());
 		if (RemoveDirectoryW(directoryNameSystem.CStr()) == FALSE)
 		{
 			Sleep(0);
@@ -429,10 +429,10 @@ GD_NAMESPACE_BEGIN
 	 *
 	 * @returns True if directory exists or was successfully iterated.
 	 */
-	GDINT bool MicrosoftPlatformDiskFileSystem::DirectoryIterate(WideString const& directoryName, IFileSystemDirectoryIterateDelegate& directoryIterateDelegate) const
+	GDINT bool MicrosoftPlatformDiskFileSystem::DirectoryIterate(Path const& directoryName, IFileSystemDirectoryIterateDelegate& directoryIterateDelegate) const
 	{
 		WIN32_FIND_DATAW directoryEntry = {};
-		auto const directoryNameSystem = Paths::Platformize(Paths::Combine(directoryName, L"*"));
+		auto const directoryNameSystem = Paths::Platformize(Paths::Combine(directoryName.GetView(), L"*"));
 		auto const directoryHandle = FindFirstFileW(directoryNameSystem.CStr(), &directoryEntry);
 		if (directoryHandle != INVALID_HANDLE_VALUE)
 		{
@@ -440,9 +440,9 @@ GD_NAMESPACE_BEGIN
 			{
 				if (CString::Strcmp(directoryEntry.cFileName, L".") != 0 && CString::Strcmp(directoryEntry.cFileName, L"..") != 0)
 				{
-					auto const directoryEntryName = Paths::Combine(directoryName, directoryEntry.cFileName);
+					auto const directoryEntryName = directoryName / directoryEntry.cFileName;
 					auto const directoryEntryIsDirectory = (directoryEntry.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0;
-					if (!directoryIterateDelegate.OnVisitDirectoryEntry(directoryEntryName.CStr(), directoryEntryIsDirectory))
+					if (!directoryIterateDelegate.OnVisitDirectoryEntry(directoryEntryName, directoryEntryIsDirectory))
 					{
 						return false;
 					}
@@ -593,7 +593,7 @@ GD_NAMESPACE_BEGIN
 					case FILE_ACTION_ADDED:
 						{
 							auto const watchEventIsDir = (watchEventIterator->FileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0;
-							auto const watchEventPath = Paths::Combine(directoryName, WideString(watchEventIterator->FileName, watchEventIterator->FileNameLength / sizeof(watchEventIterator->FileName[0])));
+							auto const watchEventPath = Paths::Combine(directoryName, WideStringView(watchEventIterator->FileName, watchEventIterator->FileNameLength / sizeof(watchEventIterator->FileName[0])));
 							if (!directoryWatcherDelegate.OnFileOrDirectoryCreated(watchEventPath, watchEventIsDir))
 							{
 								return false;
@@ -604,7 +604,7 @@ GD_NAMESPACE_BEGIN
 					case FILE_ACTION_REMOVED:
 						{
 							auto const watchEventIsDir = (watchEventIterator->FileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0;
-							auto const watchEventPath = Paths::Combine(directoryName, WideString(watchEventIterator->FileName, watchEventIterator->FileNameLength / sizeof(watchEventIterator->FileName[0])));
+							auto const watchEventPath = Paths::Combine(directoryName, WideStringView(watchEventIterator->FileName, watchEventIterator->FileNameLength / sizeof(watchEventIterator->FileName[0])));
 							if (!directoryWatcherDelegate.OnFileOrDirectoryRemoved(watchEventPath, watchEventIsDir))
 							{
 								return false;
@@ -615,7 +615,7 @@ GD_NAMESPACE_BEGIN
 					case FILE_ACTION_MODIFIED:
 						{
 							auto const watchEventIsDir = (watchEventIterator->FileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0;
-							auto const watchEventPath = Paths::Combine(directoryName, WideString(watchEventIterator->FileName, watchEventIterator->FileNameLength / sizeof(watchEventIterator->FileName[0])));
+							auto const watchEventPath = Paths::Combine(directoryName, WideStringView(watchEventIterator->FileName, watchEventIterator->FileNameLength / sizeof(watchEventIterator->FileName[0])));
 							if (!directoryWatcherDelegate.OnFileOrDirectoryModified(watchEventPath, watchEventIsDir))
 							{
 								return false;
@@ -629,8 +629,8 @@ GD_NAMESPACE_BEGIN
 							if (newNameEventIterator.IsEnd() && newNameEventIterator->Action == FILE_ACTION_RENAMED_NEW_NAME)
 							{
 								auto const watchEventIsDir = (watchEventIterator->FileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0;
-								auto const watchRenamedOldNameEventPath = Paths::Combine(directoryName, WideString(watchEventIterator->FileName, watchEventIterator->FileNameLength / sizeof(watchEventIterator->FileName[0])));
-								auto const watchRenamedNewNameEventPath = Paths::Combine(directoryName, WideString(newNameEventIterator->FileName, newNameEventIterator->FileNameLength / sizeof(watchEventIterator->FileName[0])));
+								auto const watchRenamedOldNameEventPath = Paths::Combine(directoryName, WideStringView(watchEventIterator->FileName, watchEventIterator->FileNameLength / sizeof(watchEventIterator->FileName[0])));
+								auto const watchRenamedNewNameEventPath = Paths::Combine(directoryName, WideStringView(newNameEventIterator->FileName, newNameEventIterator->FileNameLength / sizeof(watchEventIterator->FileName[0])));
 								if (!directoryWatcherDelegate.OnFileOrDirectoryMoved(watchRenamedOldNameEventPath, watchRenamedNewNameEventPath, watchEventIsDir))
 								{
 									return false;
@@ -36,9 +36,9 @@ GD_NAMESPACE_BEGIN
 			return GD_TEXT(WideChar, '\\');
 		}
 
-		GDINT virtual bool PathPlatformize(WideString const& path, WideString& pathSystem) const override final;
-		GDINT virtual bool PathGetFull(WideString const& path, WideString& pathFull) const override final;
-		GDINT virtual bool PathGetRelative(WideString const& pathFrom, WideString const& pathTo, WideString& pathRelative) const override final;
+		GDINT virtual bool PathPlatformize(WideStringView const path, WideString& pathSystem) const override final;
+		GDINT virtual bool PathGetFull(WideStringView const path, WideString& pathFull) const override final;
+		GDINT virtual bool PathGetRelative(WideStringView const pathFrom, WideStringView const pathTo, WideString& pathRelative) const override final;
 	};  // class MicrosoftPlatformPaths
 
 	GD_IMPLEMENT_SINGLETON(IPlatformPaths, MicrosoftPlatformPaths)
@@ -51,9 +51,9 @@ GD_NAMESPACE_BEGIN
 	 *
 	 * @returns True if operation succeeded.
 	 */
-	GDINT bool MicrosoftPlatformPaths::PathPlatformize(WideString const& path, WideString& pathSystem) const
+	GDINT bool MicrosoftPlatformPaths::PathPlatformize(WideStringView const path, WideString& pathSystem) const
 	{
-		auto pathCopy(path);
+		auto pathCopy(path.ToString());
 		for (auto& character : pathCopy)
 		{
 			if (character == '/')
@@ -70,10 +70,10 @@ GD_NAMESPACE_BEGIN
 	 *
 	 * @returns True if operation succeeded.
 	 */
-	GDINT bool MicrosoftPlatformPaths::PathGetFull(WideString const& path, WideString& pathFull) const
+	GDINT bool MicrosoftPlatformPaths::PathGetFull(WideStringView const path, WideString& pathFull) const
 	{
 		WCHAR pathFullSystem[MAX_PATH] = {};
-		if (GetFullPathNameW(path.CStr(), GetLength<DWORD>(pathFullSystem), pathFullSystem, nullptr) != 0)
+		if (GetFullPathNameW(path.ToString().CStr(), GetLength<DWORD>(pathFullSystem), pathFullSystem, nullptr) != 0)
 		{
 			pathFull = pathFullSystem;
 			return true;
@@ -90,10 +90,10 @@ GD_NAMESPACE_BEGIN
 	 *
 	 * @returns True if operation succeeded.
 	 */
-	GDINT bool MicrosoftPlatformPaths::PathGetRelative(WideString const& pathFrom, WideString const& pathTo, WideString& pathRelative) const
+	GDINT bool MicrosoftPlatformPaths::PathGetRelative(WideStringView const pathFrom, WideStringView const pathTo, WideString& pathRelative) const
 	{
 		WCHAR pathRelativeSystem[MAX_PATH] = {};
-		if (PathRelativePathToW(pathRelativeSystem, pathFrom.CStr(), FILE_ATTRIBUTE_DIRECTORY, pathTo.CStr(), FILE_ATTRIBUTE_DIRECTORY) != 0)
+		if (PathRelativePathToW(pathRelativeSystem, pathFrom.ToString().CStr(), FILE_ATTRIBUTE_DIRECTORY, pathTo.ToString().CStr(), FILE_ATTRIBUTE_DIRECTORY) != 0)
 		{
 			pathRelative = pathRelativeSystem;
 			return true;
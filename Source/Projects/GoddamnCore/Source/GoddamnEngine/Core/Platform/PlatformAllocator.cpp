@@ -11,6 +11,8 @@
  * Allocator implementation.
  */
 #include <GoddamnEngine/Core/Platform/PlatformAllocator.h>
+#include <GoddamnEngine/Core/Misc/HeapProfiler.h>
+#include <GoddamnEngine/Core/Misc/MemoryTracker.h>
 
 #define tlsf_assert GD_VERIFY
 #include <tlsf.c>
@@ -159,7 +161,14 @@ GD_NAMESPACE_BEGIN
 	GDAPI Handle GD_PLATFORM_WRAPPER AllocateMemory(SizeTp const allocationSizeBytes, CStr const allocationFilename, UInt32 const allocationLineNumber, bool* const resultPtr)
 	{
 		Handle allocationPointer = nullptr;
-		auto const result = IPlatformAllocator::Get().MemoryAllocateAlignedDebug(allocationPointer, allocationSizeBytes, 2 * sizeof(allocationPointer), allocationFilename, allocationLineNumber);
+		auto const result = IPlatformAllocator::Get().MemoryAllocateAlignedDebug(allocationPointer, MemoryTracker::GetPlatformAllocationSize(allocationSizeBytes), 2 * sizeof(allocationPointer), allocationFilename, allocationLineNumber);
+		allocationPointer = MemoryTracker::OnAllocate(allocationPointer, allocationSizeBytes);
+#if GD_HEAP_PROFILER_ENABLED
+		if (result)
+		{
+			HeapProfiler::OnAllocate(allocationPointer, allocationSizeBytes, allocationFilename, allocationLineNumber);
+		}
+#endif	// if GD_HEAP_PROFILER_ENABLED
 		if (resultPtr != nullptr)
 		{
 			*resultPtr = result;
@@ -174,7 +183,14 @@ GD_NAMESPACE_BEGIN
 	GDAPI Handle GD_PLATFORM_WRAPPER AllocateMemory(SizeTp const allocationSizeBytes, bool* const resultPtr)
 	{
 		Handle allocationPointer = nullptr;
-		auto const result = IPlatformAllocator::Get().MemoryAllocateAligned(allocationPointer, allocationSizeBytes, 2 * sizeof(allocationPointer));
+		auto const result = IPlatformAllocator::Get().MemoryAllocateAligned(allocationPointer, MemoryTracker::GetPlatformAllocationSize(allocationSizeBytes), 2 * sizeof(allocationPointer));
+		allocationPointer = MemoryTracker::OnAllocate(allocationPointer, allocationSizeBytes);
+#if GD_HEAP_PROFILER_ENABLED
+		if (result)
+		{
+			HeapProfiler::OnAllocate(allocationPointer, allocationSizeBytes, nullptr, 0);
+		}
+#endif	// if GD_HEAP_PROFILER_ENABLED
 		if (resultPtr != nullptr)
 		{
 			*resultPtr = result;
@@ -196,7 +212,10 @@ GD_NAMESPACE_BEGIN
 #if GD_DEBUG
 	GDAPI void GD_PLATFORM_WRAPPER FreeMemory(Handle const allocationPointer, bool* const resultPtr)
 	{
-		auto const result = IPlatformAllocator::Get().MemoryFreeAlignedDebug(allocationPointer);
+#if GD_HEAP_PROFILER_ENABLED
+		HeapProfiler::OnFree(allocationPointer);
+#endif	// if GD_HEAP_PROFILER_ENABLED
+		auto const result = IPlatformAllocator::Get().MemoryFreeAlignedDebug(MemoryTracker::OnFree(allocationPointer));
 		if (resultPtr != nullptr)
 		{
 			*resultPtr = result;
@@ -209,7 +228,10 @@ GD_NAMESPACE_BEGIN
 #else	// if GD_DEBUG
 	GDAPI void GD_PLATFORM_WRAPPER FreeMemory(Handle const allocationPointer, bool* const resultPtr)
 	{
-		auto const result = IPlatformAllocator::Get().MemoryFreeAligned(allocationPointer);
+#if GD_HEAP_PROFILER_ENABLED
+		HeapProfiler::OnFree(allocationPointer);
+#endif	// if GD_HEAP_PROFILER_ENABLED
+		auto const result = IPlatformAllocator::Get().MemoryFreeAligned(MemoryTracker::OnFree(allocationPointer));
 		if (resultPtr != nullptr)
 		{
 			*resultPtr = result;
@@ -223,3 +245,69 @@ GD_NAMESPACE_BEGIN
 	//! @}
 
 GD_NAMESPACE_END
+
+// ------------------------------------------------------------------------------------------
+// Replaceable global new and delete operators.
+// ------------------------------------------------------------------------------------------
+
+// Plain new T && new T[N]
+void* operator new(size_t const size)
+{
+	bool result;
+	auto const allocationPointer = GD::AllocateMemory(size != 0 ? size : 1
+#if GD_DEBUG
+		, nullptr, 0
+#endif	// if GD_DEBUG
+		, &result);
+	if (!result)
+	{
+		throw std::bad_alloc();
+	}
+	return allocationPointer;
+}
+void* operator new[](size_t const size)
+{
+	return operator new(size);
+}
+void* operator new(size_t const size, std::nothrow_t const&) noexcept
+{
+	bool result;
+	auto const allocationPointer = GD::AllocateMemory(size != 0 ? size : 1
+#if GD_DEBUG
+		, nullptr, 0
+#endif	// if GD_DEBUG
+		, &result);
+	return result ? allocationPointer : nullptr;
+}
+void* operator new[](size_t const size, std::nothrow_t const& nothrow) noexcept
+{
+	return operator new(size, nothrow);
+}
+
+// delete T && delete[] T
+void operator delete(void* const ptr) noexcept
+{
+	GD::FreeMemory(ptr);
+}
+void operator delete[](void* const ptr) noexcept
+{
+	GD::FreeMemory(ptr);
+}
+void operator delete(void* const ptr, size_t const size) noexcept
+{
+	GD_NOT_USED(size);
+	GD::FreeMemory(ptr);
+}
+void operator delete[](void* const ptr, size_t const size) noexcept
+{
+	GD_NOT_USED(size);
+	GD::FreeMemory(ptr);
+}
+void operator delete(void* const ptr, std::nothrow_t const&) noexcept
+{
+	GD::FreeMemory(ptr);
+}
+void operator delete[](void* const ptr, std::nothrow_t const&) noexcept
+{
+	GD::FreeMemory(ptr);
+}
@@ -17,6 +17,16 @@
 
 GD_NAMESPACE_BEGIN
 
+	/*!
+	 * Size of pages that back the reserved virtual memory.
+	 */
+	enum class VirtualMemoryPageSize
+	{
+		Default,		//!< Default system pages (usually 4 KB).
+		Huge,			//!< Transparent huge pages (usually 2 MB), if supported by the system.
+		ExplicitHuge,	//!< Huge pages from the preallocated system pool. Falls back to transparent huge pages.
+	};	// enum class VirtualMemoryPageSize
+
 	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
 	//! Memory allocator.
 	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
@@ -135,6 +145,60 @@ GD_NAMESPACE_BEGIN
 			return MemoryFreeAligned(allocationPointer);
 		}
 #endif	// if GD_DEBUG
+
+		// ------------------------------------------------------------------------------------------
+		// Virtual memory.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Returns size of the virtual memory page.
+		 * All sizes and offsets passed to virtual memory functions should be aligned by this value.
+		 *
+		 * @param pageSize Size of pages that back the memory.
+		 */
+		GDINT virtual SizeTp VirtualMemoryGetPageSize(VirtualMemoryPageSize const pageSize) const GD_PURE_VIRTUAL;
+
+		/*!
+		 * Reserves a range of the address space without committing any physical memory.
+		 * 
+		 * @param reservationPointer Reserved memory pointer, aligned by the page size.
+		 * @param reservationSizeBytes Size of the address space range to reserve in bytes.
+		 * @param pageSize Size of pages that should back the memory.
+		 *
+		 * @returns True if operation succeeded.
+		 */
+		GDINT virtual bool VirtualMemoryReserve(Handle& reservationPointer, SizeTp const reservationSizeBytes, VirtualMemoryPageSize const pageSize) GD_PURE_VIRTUAL;
+
+		/*!
+		 * Commits physical memory to the part of the reserved range and makes it readable and writable.
+		 * 
+		 * @param commitPointer Pointer to the first page to commit.
+		 * @param commitSizeBytes Size of memory to commit in bytes.
+		 *
+		 * @returns True if operation succeeded.
+		 */
+		GDINT virtual bool VirtualMemoryCommit(Handle const commitPointer, SizeTp const commitSizeBytes) GD_PURE_VIRTUAL;
+
+		/*!
+		 * Returns physical memory of the part of the reserved range back to the system.
+		 * Address space stays reserved.
+		 * 
+		 * @param decommitPointer Pointer to the first page to decommit.
+		 * @param decommitSizeBytes Size of memory to decommit in bytes.
+		 *
+		 * @returns True if operation succeeded.
+		 */
+		GDINT virtual bool VirtualMemoryDecommit(Handle const decommitPointer, SizeTp const decommitSizeBytes) GD_PURE_VIRTUAL;
+
+		/*!
+		 * Releases the whole reserved range, including all committed memory.
+		 * 
+		 * @param reservationPointer Reserved memory pointer.
+		 * @param reservationSizeBytes Size of the reserved range in bytes.
+		 *
+		 * @returns True if operation succeeded.
+		 */
+		GDINT virtual bool VirtualMemoryRelease(Handle const reservationPointer, SizeTp const reservationSizeBytes) GD_PURE_VIRTUAL;
 	};	// class IPlatformAllocator
 
 	template<>
@@ -260,12 +324,6 @@ inline void* operator new[](size_t const size, gd_operator_new_delete_t
 	);
 }
 
-// delete T && delete[] T
-inline void operator delete(void* ptr) noexcept
-{
-	GD::FreeMemory(ptr);
-}
-inline void operator delete[](void* ptr) noexcept
-{
-	GD::FreeMemory(ptr);
-}
+// Plain new T && new T[N] and delete T && delete[] T
+// Global new and delete operators are replaced in PlatformAllocator.cpp, so that memory of the
+// standard library is routed into the same allocator. Replacements may not be inline.
@@ -14,6 +14,8 @@
 
 #include <GoddamnEngine/Include.h>
 #include <GoddamnEngine/Core/Containers/String.h>
+#include <GoddamnEngine/Core/Containers/StringView.h>
+#include <GoddamnEngine/Core/CStdlib/CUnicode.h>
 #include <GoddamnEngine/Core/Templates/Singleton.h>
 
 GD_NAMESPACE_BEGIN
@@ -85,9 +87,14 @@ GD_NAMESPACE_BEGIN
 
 	// **------------------------------------------------------------------------------------------**
 	//! UTF-8 wide-character text encoder.
+	//! Text is transcoded in a single pass into the buffer of the maximum possible length,
+	//! short texts use the buffer on the stack.
 	// **------------------------------------------------------------------------------------------**
 	class StringConv final
 	{
+	private:
+		SizeTp static const InlineBufferLength = 256;
+
 	public:
 
 		// ------------------------------------------------------------------------------------------
@@ -104,24 +111,24 @@ GD_NAMESPACE_BEGIN
 		GDINL static String EncodeUTF8(WideCStr const text, SizeTp const textLength, bool* const resultPtr = nullptr)
 		{
 			GD_ASSERT(text != nullptr);
-			SizeTp textEncodedLength = 0;
-			if (IPlatformTextEncoding::Get().CalculateEncodedLength(text, textLength, textEncodedLength))
+			Char textEncodedInline[InlineBufferLength];
+			auto const textEncodedMaxLength = CUnicode::GetMaxEncodedLength(textLength);
+			auto const textEncodedBuffer = textEncodedMaxLength <= InlineBufferLength ? textEncodedInline : GD_MALLOC_ARRAY_T(Char, textEncodedMaxLength);
+			auto const result = CUnicode::EncodeUTF8(textEncodedBuffer, textEncodedMaxLength, text, textLength);
+			auto textEncoded = result.Succeeded() ? String(textEncodedBuffer, result.Length) : String();
+			if (textEncodedBuffer != textEncodedInline)
+			{
+				GD_FREE(textEncodedBuffer);
+			}
+			if (resultPtr != nullptr)
 			{
-				String textEncoded(textEncodedLength);
-				if (IPlatformTextEncoding::Get().EncodeUTF8(textEncoded.CStr(), textEncodedLength, text, textLength))
-				{
-					if (resultPtr != nullptr)
-					{
-						*resultPtr = true;
-					}
-					return textEncoded;
-				}
+				*resultPtr = result.Succeeded();
 			}
-			if (resultPtr == nullptr)
+			else if (!result.Succeeded())
 			{
 				GD_VERIFY_FALSE("Unhandled encoding error: encoding to UTF-8 failed.");
 			}
-			return "";
+			return textEncoded;
 		}
 
 		/*!
@@ -131,9 +138,9 @@ GD_NAMESPACE_BEGIN
 		 * @param resultPtr Pointer to the function call result. If no parameter presented and function fails it will throw.
 		 */
 		//! @{
-		GDINL static String EncodeUTF8(WideString const& text, bool* const resultPtr = nullptr)
+		GDINL static String EncodeUTF8(WideStringView const text, bool* const resultPtr = nullptr)
 		{
-			return EncodeUTF8(text.CStr(), text.GetLength(), resultPtr);
+			return EncodeUTF8(text.GetData(), text.GetLength(), resultPtr);
 		}
 		GDINL static String EncodeUTF8(WideCStr const text, bool* const resultPtr = nullptr)
 		{
@@ -155,24 +162,24 @@ GD_NAMESPACE_BEGIN
 		GDINL static WideString DecodeUTF8(CStr const text, SizeTp const textLength, bool* const resultPtr = nullptr)
 		{
 			GD_ASSERT(text != nullptr);
-			SizeTp textDecodedLength = 0;
-			if (IPlatformTextEncoding::Get().CalculateDecodedLength(text, textLength, textDecodedLength))
+			WideChar textDecodedInline[InlineBufferLength];
+			auto const textDecodedMaxLength = CUnicode::GetMaxDecodedLength(textLength);
+			auto const textDecodedBuffer = textDecodedMaxLength <= InlineBufferLength ? textDecodedInline : GD_MALLOC_ARRAY_T(WideChar, textDecodedMaxLength);
+			auto const result = CUnicode::DecodeUTF8(textDecodedBuffer, textDecodedMaxLength, text, textLength);
+			auto textDecoded = result.Succeeded() ? WideString(textDecodedBuffer, result.Length) : WideString();
+			if (textDecodedBuffer != textDecodedInline)
+			{
+				GD_FREE(textDecodedBuffer);
+			}
+			if (resultPtr != nullptr)
 			{
-				WideString textDecoded(textDecodedLength);
-				if (IPlatformTextEncoding::Get().DecodeUTF8(textDecoded.CStr(), textDecodedLength, text, textLength))
-				{
-					if (resultPtr != nullptr)
-					{
-						*resultPtr = true;
-					}
-					return textDecoded;
-				}
+				*resultPtr = result.Succeeded();
 			}
-			if (resultPtr == nullptr)
+			else if (!result.Succeeded())
 			{
 				GD_VERIFY_FALSE("Unhandled encoding error: decoding from UTF-8 failed.");
 			}
-			return L"";
+			return textDecoded;
 		}
 
 		/*!
@@ -182,9 +189,9 @@ GD_NAMESPACE_BEGIN
 		 * @param resultPtr Pointer to the function call result. If no parameter presented and function fails it will throw.
 		 */
 		//! @{
-		GDINL static WideString DecodeUTF8(String const& text, bool* const resultPtr = nullptr)
+		GDINL static WideString DecodeUTF8(StringView const text, bool* const resultPtr = nullptr)
 		{
-			return DecodeUTF8(text.CStr(), text.GetLength(), resultPtr);
+			return DecodeUTF8(text.GetData(), text.GetLength(), resultPtr);
 		}
 		GDINL static WideString DecodeUTF8(CStr const text, bool* const resultPtr = nullptr)
 		{
@@ -28,6 +28,23 @@ GD_NAMESPACE_BEGIN
 		gd_testing_assert(textDecoded == textInRussianWide);
 	};
 
+	gd_testing_unit_test(PlatformEncodingLongText)
+	{
+		// Texts, that do not fit into the inline buffers.
+		WideString textWide;
+		for (SizeTp cnt = 0; cnt < 100; ++cnt)
+		{
+			textWide += L"path/to/\x0444\x0430\x0439\x043B/";
+		}
+		auto const textEncoded = StringConv::EncodeUTF8(textWide);
+		gd_testing_verify(textEncoded.GetLength() == 100 * 17);
+		gd_testing_verify(StringConv::DecodeUTF8(textEncoded) == textWide);
+
+		bool succeeded = true;
+		auto const textDecoded = StringConv::DecodeUTF8("valid\xC0\x80", &succeeded);
+		gd_testing_verify(!succeeded && textDecoded.IsEmpty());
+	};
+
 GD_NAMESPACE_END
 
 #endif	// if GD_TESTING_ENABLED
@@ -160,7 +160,7 @@ GD_NAMESPACE_BEGIN
 	 * 
 	 * @returns True if file was successfully moved.
 	 */
-	GDINT bool IFileSystem::FileMove(WideString const& srcFilename, WideString const& dstFilename, bool const doOverwrite)
+	GDINT bool IFileSystem::FileMove(Path const& srcFilename, Path const& dstFilename, bool const doOverwrite)
 	{
 		if (FileCopy(srcFilename, dstFilename, doOverwrite))
 		{
@@ -184,7 +184,7 @@ GD_NAMESPACE_BEGIN
      *
      * @returns True if file was successfully moved.
      */
-    GDINT bool IFileSystem::FileCopy(WideString const& srcFilename, WideString const& dstFilename, bool const doOverwrite)
+    GDINT bool IFileSystem::FileCopy(Path const& srcFilename, Path const& dstFilename, bool const doOverwrite)
     {
         if (FileExists(srcFilename) && (doOverwrite || !FileExists(dstFilename)))
         {
@@ -237,7 +237,7 @@ GD_NAMESPACE_BEGIN
 	 * @param filename Path to the file.
 	 * @returns Opened valid input stream or null pointer if operation has failed.
 	 */
-	GDINT SharedPtr<IInputStream> IPlatformDiskFileSystem::FileStreamOpenRead(WideString const& filename) const
+	GDINT SharedPtr<IInputStream> IPlatformDiskFileSystem::FileStreamOpenRead(Path const& filename) const
 	{
 		Handle fileHandle = nullptr;
 		if (FileOpenRead(filename, fileHandle))
@@ -255,7 +255,7 @@ GD_NAMESPACE_BEGIN
 	 * 
 	 * @returns Opened valid output stream or null pointer if operation has failed.
 	 */
-	GDINT SharedPtr<IOutputStream> IPlatformDiskFileSystem::FileStreamOpenWrite(WideString const& filename, bool const doAppend)
+	GDINT SharedPtr<IOutputStream> IPlatformDiskFileSystem::FileStreamOpenWrite(Path const& filename, bool const doAppend)
 	{
 		Handle fileHandle = nullptr;
 		if (FileOpenWrite(filename, fileHandle, doAppend))
@@ -277,7 +277,7 @@ GD_NAMESPACE_BEGIN
      *
      * @returns True if directory exists or was successfully iterated.
      */
-    GDINT bool IFileSystem::DirectoryIterateRecursive(WideString const& directoryName, IFileSystemDirectoryIterateDelegate& directoryIterateDelegate) const
+    GDINT bool IFileSystem::DirectoryIterateRecursive(Path const& directoryName, IFileSystemDirectoryIterateDelegate& directoryIterateDelegate) const
 	{
 		class DirectoryIterateRecursiveDelegate final : public IFileSystemDirectoryIterateDelegate
 		{
@@ -290,7 +290,7 @@ GD_NAMESPACE_BEGIN
 			{
 			}
 		public:
-			GDINT virtual bool OnVisitDirectoryEntry(WideString const& path, bool const isDirectory) override final
+			GDINT virtual bool OnVisitDirectoryEntry(Path const& path, bool const isDirectory) override final
 			{
 				if (isDirectory)
 				{
@@ -313,7 +313,7 @@ GD_NAMESPACE_BEGIN
 	 * @param directoryName Path to the directory.
 	 * @returns True if directory was successfully deleted.
 	 */
-	GDINT bool IFileSystem::DirectoryRemoveRecursive(WideString const& directoryName)
+	GDINT bool IFileSystem::DirectoryRemoveRecursive(Path const& directoryName)
 	{
 		class DirectoryRemoveRecursiveDelegate final : public IFileSystemDirectoryIterateDelegate
 		{
@@ -325,7 +325,7 @@ GD_NAMESPACE_BEGIN
 			{
 			}
 		private:
-			GDINT virtual bool OnVisitDirectoryEntry(WideString const& path, bool const isDirectory) override final
+			GDINT virtual bool OnVisitDirectoryEntry(Path const& path, bool const isDirectory) override final
 			{
 				if (isDirectory)
 				{
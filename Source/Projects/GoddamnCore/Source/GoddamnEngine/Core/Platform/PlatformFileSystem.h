@@ -13,6 +13,8 @@
 #pragma once
 
 #include <GoddamnEngine/Include.h>
+#include <GoddamnEngine/Core/Containers/StringView.h>
+#include <GoddamnEngine/Core/Containers/Path.h>
 #include <GoddamnEngine/Core/Platform/PlatformIO.h>
 #include <GoddamnEngine/Core/Templates/Singleton.h>
 
@@ -33,7 +35,7 @@ GD_NAMESPACE_BEGIN
 		 * 
 		 * @returns If false was returned, iterations would stop.
 		 */
-		GDINT virtual bool OnVisitDirectoryEntry(WideString const& path, bool const isDirectory)
+		GDINT virtual bool OnVisitDirectoryEntry(Path const& path, bool const isDirectory)
 		{
 			GD_NOT_USED_L(path, isDirectory);
 			return true;
@@ -114,7 +116,7 @@ GD_NAMESPACE_BEGIN
 		 * Returns true if the specified file exists and is not directory.
 		 * @param filename Path to the file.
 		 */
-		GDINT virtual bool FileExists(WideString const& filename) const GD_PURE_VIRTUAL;
+		GDINT virtual bool FileExists(Path const& filename) const GD_PURE_VIRTUAL;
 
 		/*!
 		 * Gets size of the file in bytes, or -1 if it does not exist.
@@ -124,7 +126,7 @@ GD_NAMESPACE_BEGIN
 		 * 
 		 * @returns True if file size was successfully obtained.
 		 */
-		GDINT virtual bool FileSize(WideString const& filename, UInt64& fileSize) const GD_PURE_VIRTUAL;
+		GDINT virtual bool FileSize(Path const& filename, UInt64& fileSize) const GD_PURE_VIRTUAL;
 
 		/*!
 		 * Creates an empty file with the specified file name.
@@ -133,7 +135,7 @@ GD_NAMESPACE_BEGIN
 		 * @param filename Path to the file.
 		 * @returns True if file exists or was successfully created.
 		 */
-		GDINT virtual bool FileCreateEmpty(WideString const& filename) GD_PURE_VIRTUAL;
+		GDINT virtual bool FileCreateEmpty(Path const& filename) GD_PURE_VIRTUAL;
 
 		/*!
 		 * Removes the existing file.
@@ -141,7 +143,7 @@ GD_NAMESPACE_BEGIN
 		 * @param filename Path to the file.
 		 * @returns True if file was successfully deleted.
 		 */
-		GDINT virtual bool FileRemove(WideString const& filename) GD_PURE_VIRTUAL;
+		GDINT virtual bool FileRemove(Path const& filename) GD_PURE_VIRTUAL;
 
 		/*!
 		 * Moves file from source path to destination.
@@ -152,7 +154,7 @@ GD_NAMESPACE_BEGIN
 		 * 
 		 * @returns True if file was successfully moved.
 		 */
-		GDINT virtual bool FileMove(WideString const& srcFilename, WideString const& dstFilename, bool const doOverwrite = false);
+		GDINT virtual bool FileMove(Path const& srcFilename, Path const& dstFilename, bool const doOverwrite = false);
 
 		/*!
 		 * Copies file from source path to destination.
@@ -163,7 +165,7 @@ GD_NAMESPACE_BEGIN
 		 * 
 		 * @returns True if file was successfully moved.
 		 */
-		GDINT virtual bool FileCopy(WideString const& srcFilename, WideString const& dstFilename, bool const doOverwrite = false);
+		GDINT virtual bool FileCopy(Path const& srcFilename, Path const& dstFilename, bool const doOverwrite = false);
 
 		/*!
 		 * Opens a input stream for the specified file.
@@ -171,7 +173,7 @@ GD_NAMESPACE_BEGIN
 		 * @param filename Path to the file.
 		 * @returns Opened valid input stream or null pointer if operation has failed.
 		 */
-		GDINT virtual SharedPtr<IInputStream> FileStreamOpenRead(WideString const& filename) const GD_PURE_VIRTUAL;
+		GDINT virtual SharedPtr<IInputStream> FileStreamOpenRead(Path const& filename) const GD_PURE_VIRTUAL;
 
 		/*!
 		 * Opens a output stream for the specified file.
@@ -181,7 +183,7 @@ GD_NAMESPACE_BEGIN
 		 * 
 		 * @returns Opened valid output stream or null pointer if operation has failed.
 		 */
-		GDINT virtual SharedPtr<IOutputStream> FileStreamOpenWrite(WideString const& filename, bool const doAppend = false) GD_PURE_VIRTUAL;
+		GDINT virtual SharedPtr<IOutputStream> FileStreamOpenWrite(Path const& filename, bool const doAppend = false) GD_PURE_VIRTUAL;
 
 		// ------------------------------------------------------------------------------------------
 		// Directory utilities.
@@ -191,7 +193,7 @@ GD_NAMESPACE_BEGIN
 		 * Returns true if the specified file exists and is a directory.
 		 * @param directoryName Name to the directory.
 		 */
-		GDINT virtual bool DirectoryExists(WideString const& directoryName) const GD_PURE_VIRTUAL;
+		GDINT virtual bool DirectoryExists(Path const& directoryName) const GD_PURE_VIRTUAL;
 
 		/*!
 		 * Creates an empty directory with the specified directory name.
@@ -200,7 +202,7 @@ GD_NAMESPACE_BEGIN
 		 * @param directoryName Path to the directory.
 		 * @returns True if directory exists or was successfully created.
 		 */
-		GDINT virtual bool DirectoryCreateEmpty(WideString const& directoryName) const GD_PURE_VIRTUAL;
+		GDINT virtual bool DirectoryCreateEmpty(Path const& directoryName) const GD_PURE_VIRTUAL;
 
 		/*!
 		 * Removes the existing empty directory.
@@ -208,7 +210,7 @@ GD_NAMESPACE_BEGIN
 		 * @param directoryName Path to the directory.
 		 * @returns True if directory was successfully deleted.
 		 */
-		GDINT virtual bool DirectoryRemove(WideString const& directoryName) GD_PURE_VIRTUAL;
+		GDINT virtual bool DirectoryRemove(Path const& directoryName) GD_PURE_VIRTUAL;
 
 		/*!
 		 * Removes the existing directory and everything inside it.
@@ -216,7 +218,7 @@ GD_NAMESPACE_BEGIN
 		 * @param directoryName Path to the directory.
 		 * @returns True if directory was successfully deleted.
 		 */
-		GDINT virtual bool DirectoryRemoveRecursive(WideString const& directoryName);
+		GDINT virtual bool DirectoryRemoveRecursive(Path const& directoryName);
 
         /*!
          * Iterates through all entities of a directory.
@@ -226,7 +228,7 @@ GD_NAMESPACE_BEGIN
          *
          * @returns True if directory exists or was successfully iterated.
          */
-        GDINT virtual bool DirectoryIterate(WideString const& directoryName, IFileSystemDirectoryIterateDelegate& directoryIterateDelegate) const GD_PURE_VIRTUAL;
+        GDINT virtual bool DirectoryIterate(Path const& directoryName, IFileSystemDirectoryIterateDelegate& directoryIterateDelegate) const GD_PURE_VIRTUAL;
 
 		/*!
          * Recursively iterates through all entities of a directory.
@@ -236,7 +238,7 @@ GD_NAMESPACE_BEGIN
          *
          * @returns True if directory exists or was successfully iterated.
          */
-        GDINT virtual bool DirectoryIterateRecursive(WideString const& directoryName, IFileSystemDirectoryIterateDelegate& directoryIterateDelegate) const;
+        GDINT virtual bool DirectoryIterateRecursive(Path const& directoryName, IFileSystemDirectoryIterateDelegate& directoryIterateDelegate) const;
 	};	// class IFileSystem
 
 	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
@@ -245,8 +247,8 @@ GD_NAMESPACE_BEGIN
 	class GD_PLATFORM_KERNEL IPlatformDiskFileSystem : public IFileSystem, public Singleton<IPlatformDiskFileSystem>
 	{
 	public:
-		GDINT virtual SharedPtr<IInputStream> FileStreamOpenRead(WideString const& filename) const override final;
-		GDINT virtual SharedPtr<IOutputStream> FileStreamOpenWrite(WideString const& filename, bool const doAppend) override final;
+		GDINT virtual SharedPtr<IInputStream> FileStreamOpenRead(Path const& filename) const override final;
+		GDINT virtual SharedPtr<IOutputStream> FileStreamOpenWrite(Path const& filename, bool const doAppend) override final;
 
 	public:
 
@@ -262,7 +264,7 @@ GD_NAMESPACE_BEGIN
 		 * 
 		 * @returns True if file was successfully opened.
 		 */
-		GDINT virtual bool FileOpenRead(WideString const& filename, Handle& fileHandle) const GD_PURE_VIRTUAL;
+		GDINT virtual bool FileOpenRead(Path const& filename, Handle& fileHandle) const GD_PURE_VIRTUAL;
 
 		/*!
 		 * Opens an output handle for the specified file.
@@ -273,7 +275,7 @@ GD_NAMESPACE_BEGIN
 		 * 
 		 * @returns True if file was successfully opened.
 		 */
-		GDINT virtual bool FileOpenWrite(WideString const& filename, Handle& fileHandle, bool const doAppend = false) GD_PURE_VIRTUAL;
+		GDINT virtual bool FileOpenWrite(Path const& filename, Handle& fileHandle, bool const doAppend = false) GD_PURE_VIRTUAL;
 
 		/*!
 		 * Closes a file handle.
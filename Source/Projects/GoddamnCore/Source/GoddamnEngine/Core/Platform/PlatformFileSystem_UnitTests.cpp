@@ -11,7 +11,6 @@
  * File system implementation.
  */
 #include <GoddamnEngine/Core/Platform/PlatformFileSystem.h>
-#include <GoddamnEngine/Core/Platform/PlatformPaths.h>
 #if GD_TESTING_ENABLED
 
 #include <GoddamnEngine/Core/Containers/StringBuilder.h>
@@ -23,17 +22,18 @@ GD_NAMESPACE_BEGIN
 	public:
 		WideStringBuilder Contents;
 	private:
-		GDINT virtual bool OnVisitDirectoryEntry(WideString const& path, bool const isDirectory) override final
+		GDINT virtual bool OnVisitDirectoryEntry(Path const& path, bool const isDirectory) override final
 		{
 			// Directories and files may come in different order on different platforms, so we need to sort entries.
+			auto const fileName = Path(path.GetFileName()).ToWideString();
 			if (isDirectory)
 			{
-				Contents.AppendFormat(L"%ls 1;", Paths::GetFileName(path).CStr());
+				Contents.AppendFormat(L"%ls 1;", fileName.CStr());
 			}
 			else
 			{
 				WideStringBuilder newContents;
-				newContents.AppendFormat(L"%ls 0;", Paths::GetFileName(path).CStr());
+				newContents.AppendFormat(L"%ls 0;", fileName.CStr());
 				newContents.Append(Contents);
 				Contents = Utils::Move(newContents);
 			}
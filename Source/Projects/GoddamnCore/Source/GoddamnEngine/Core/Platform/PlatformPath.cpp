@@ -15,15 +15,9 @@
 
 GD_NAMESPACE_BEGIN
 
-	GDINL static UInt32 FindLastChar(WideString const& filename, WideChar const query)
+	GDINL static SizeTp FindLastSlashOrBackslash(WideStringView const path)
 	{
-		auto const ptr = CString::Strrchr(filename.CStr(), query);
-		return ptr != nullptr ? static_cast<UInt32>(*ptr) : UInt32Max;
-	}
-	GDINL static UInt32 FindLastChar(WideString const& filename, WideChar const query1, WideChar const query2)
-	{
-		auto const iter = Algo::FindLastIf(filename, [=](WideChar const character) { return character == query1 || character == query2; });
-		return iter != filename.End() ? static_cast<UInt32>(&*iter - filename.CStr()) : UInt32Max;
+		return path.FindLastOf(L"/\\");
 	}
 
 	// ------------------------------------------------------------------------------------------
@@ -39,18 +33,19 @@ GD_NAMESPACE_BEGIN
 	 * @returns Combination of two paths.
 	 */
 	//! @{
-	GDAPI WideString Paths::Combine(WideString const& firstPath, WideString const& secondPath)
+	GDAPI WideString Paths::Combine(WideStringView const firstPath, WideStringView const secondPath)
 	{
 		WideStringBuilder combinedPath;
-		combinedPath.Append(firstPath);
-		if (firstPath.GetLast() != GD_TEXT(WideChar, '/') && firstPath.GetLast() != GD_TEXT(WideChar, '\\'))
+		combinedPath.Append(firstPath.GetData(), firstPath.GetLength());
+		if (!firstPath.EndsWith(GD_TEXT(WideChar, '/')) && !firstPath.EndsWith(GD_TEXT(WideChar, '\\')))
 		{
 			combinedPath.Append(IPlatformPaths::Get().PathGetSeparator());
 		}
-		combinedPath.Append(secondPath[0] == GD_TEXT(WideChar, '/') || secondPath[0] == GD_TEXT(WideChar, '\\') ? secondPath.CStr() + 1 : secondPath.CStr());
+		auto const secondPathRelative = secondPath.StartsWith(GD_TEXT(WideChar, '/')) || secondPath.StartsWith(GD_TEXT(WideChar, '\\')) ? secondPath.ChopFront(1) : secondPath;
+		combinedPath.Append(secondPathRelative.GetData(), secondPathRelative.GetLength());
 		return combinedPath.ToString();
 	}
-	GDAPI WideString Paths::Combine(WideString const& firstPath, WideString const& secondPath, WideString const& thirdPath)
+	GDAPI WideString Paths::Combine(WideStringView const firstPath, WideStringView const secondPath, WideStringView const thirdPath)
 	{
 		return Paths::Combine(Paths::Combine(firstPath, secondPath), thirdPath);
 	}
@@ -62,7 +57,7 @@ GD_NAMESPACE_BEGIN
 	 * @param path Path to the file.
 	 * @param resultPtr Pointer to the function call result. If no parameter presented and function fails it will throw.
 	 */
-	GDAPI WideString Paths::Platformize(WideString const& path, bool* const resultPtr)
+	GDAPI WideString Paths::Platformize(WideStringView const path, bool* const resultPtr)
 	{
 		WideString pathSystem;
 		auto const result = IPlatformPaths::Get().PathPlatformize(path, pathSystem);
@@ -83,7 +78,7 @@ GD_NAMESPACE_BEGIN
 	 * @param path Path to the file.
 	 * @param resultPtr Pointer to the function call result. If no parameter presented and function fails it will throw.
 	 */
-	GDAPI WideString Paths::GetFullPath(WideString const& path, bool* const resultPtr)
+	GDAPI WideString Paths::GetFullPath(WideStringView const path, bool* const resultPtr)
 	{
 		WideString pathSystem;
 		auto const result = IPlatformPaths::Get().PathGetFull(path, pathSystem);
@@ -105,7 +100,7 @@ GD_NAMESPACE_BEGIN
 	 * @param pathFrom Path to file, which relative path we need to compute.
 	 * @param resultPtr Pointer to the function call result. If no parameter presented and function fails it will throw.
 	 */
-	GDAPI WideString Paths::GetRelativePath(WideString const& pathFrom, WideString const& pathTo, bool* const resultPtr)
+	GDAPI WideString Paths::GetRelativePath(WideStringView const pathFrom, WideStringView const pathTo, bool* const resultPtr)
 	{
 		WideString pathRelative;
 		auto const result = IPlatformPaths::Get().PathGetRelative(pathFrom, pathTo, pathRelative);
@@ -126,10 +121,10 @@ GD_NAMESPACE_BEGIN
 	 *
 	 * @param path Path to the file.
 	 */
-	GDAPI WideString Paths::GetExtension(WideString const& path)
+	GDAPI WideString Paths::GetExtension(WideStringView const path)
 	{
-		auto const lastDot = FindLastChar(path, '.');
-		return lastDot == UInt32Max ? path : path.Substring(lastDot);
+		auto const lastDot = path.ReverseFind(GD_TEXT(WideChar, '.'));
+		return (lastDot == WideStringView::Npos ? path : path.Substring(lastDot)).ToString();
 	}
 
 	/*!
@@ -138,10 +133,10 @@ GD_NAMESPACE_BEGIN
 	 *
 	 * @param path Path to the file.
 	 */
-	GDAPI WideString Paths::GetFileName(WideString const& path)
+	GDAPI WideString Paths::GetFileName(WideStringView const path)
 	{
-		auto const lastSlashOrBackslash = FindLastChar(path, '/', '\\');
-		return lastSlashOrBackslash == UInt32Max ? path : path.Substring(lastSlashOrBackslash + 1);
+		auto const lastSlashOrBackslash = FindLastSlashOrBackslash(path);
+		return (lastSlashOrBackslash == WideStringView::Npos ? path : path.Substring(lastSlashOrBackslash + 1)).ToString();
 	}
 
 	/*!
@@ -150,7 +145,7 @@ GD_NAMESPACE_BEGIN
 	 *
 	 * @param path Path to the file.
 	 */
-	GDAPI WideString Paths::GetFileNameWithoutExtension(WideString const& path)
+	GDAPI WideString Paths::GetFileNameWithoutExtension(WideStringView const path)
 	{
 		return Paths::GetFileName(Paths::GetDirectoryAndFileNameWithoutExtension(path));
 	}
@@ -161,10 +156,10 @@ GD_NAMESPACE_BEGIN
 	 *
 	 * @param path Path to the file.
 	 */
-	GDAPI WideString Paths::GetDirectoryName(WideString const& path)
+	GDAPI WideString Paths::GetDirectoryName(WideStringView const path)
 	{
-		auto const lastSlashOrBackslash = FindLastChar(path, '/', '\\');
-		return lastSlashOrBackslash == UInt32Max ? path : path.Substring(0, lastSlashOrBackslash);
+		auto const lastSlashOrBackslash = FindLastSlashOrBackslash(path);
+		return (lastSlashOrBackslash == WideStringView::Npos ? path : path.SubstringLen(0, lastSlashOrBackslash + 1)).ToString();
 	}
 
 	/*!
@@ -173,10 +168,10 @@ GD_NAMESPACE_BEGIN
 	 *
 	 * @param path Path to the file.
 	 */
-	GDAPI WideString Paths::GetDirectoryAndFileNameWithoutExtension(WideString const& path)
+	GDAPI WideString Paths::GetDirectoryAndFileNameWithoutExtension(WideStringView const path)
 	{
-		auto const lastDot = FindLastChar(path, '.');
-		return lastDot == UInt32Max ? path : path.Substring(0, lastDot);
+		auto const lastDot = path.ReverseFind(GD_TEXT(WideChar, '.'));
+		return (lastDot == WideStringView::Npos ? path : path.SubstringLen(0, lastDot)).ToString();
 	}
 
 GD_NAMESPACE_END
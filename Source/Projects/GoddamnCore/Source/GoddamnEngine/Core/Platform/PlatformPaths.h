@@ -14,6 +14,7 @@
 
 #include <GoddamnEngine/Include.h>
 #include <GoddamnEngine/Core/Containers/String.h>
+#include <GoddamnEngine/Core/Containers/StringView.h>
 #include <GoddamnEngine/Core/Templates/Singleton.h>
 
 GD_NAMESPACE_BEGIN
@@ -45,7 +46,7 @@ GD_NAMESPACE_BEGIN
 		 *
 		 * @returns True if operation succeeded.
 		 */
-		GDINT virtual bool PathPlatformize(WideString const& path, WideString& pathSystem) const GD_PURE_VIRTUAL;
+		GDINT virtual bool PathPlatformize(WideStringView const path, WideString& pathSystem) const GD_PURE_VIRTUAL;
 
 		/*!
 		 * Calculates full path to the specified path string.
@@ -55,7 +56,7 @@ GD_NAMESPACE_BEGIN
 		 *
 		 * @returns True if operation succeeded.
 		 */
-		GDINT virtual bool PathGetFull(WideString const& path, WideString& pathFull) const GD_PURE_VIRTUAL;
+		GDINT virtual bool PathGetFull(WideStringView const path, WideString& pathFull) const GD_PURE_VIRTUAL;
 
 		/*!
 		 * Calculates relative path from one path to another.
@@ -66,7 +67,7 @@ GD_NAMESPACE_BEGIN
 		 *
 		 * @returns True if operation succeeded.
 		 */
-		GDINT virtual bool PathGetRelative(WideString const& pathFrom, WideString const& pathTo, WideString& pathRelative) const GD_PURE_VIRTUAL;
+		GDINT virtual bool PathGetRelative(WideStringView const pathFrom, WideStringView const pathTo, WideString& pathRelative) const GD_PURE_VIRTUAL;
 	};  // class IPlatformPaths
 
 	template<>
@@ -92,8 +93,8 @@ GD_NAMESPACE_BEGIN
 		 * @returns Combination of two paths.
 		 */
 		//! @{
-		GDAPI static WideString Combine(WideString const& firstPath, WideString const& secondPath);
-		GDAPI static WideString Combine(WideString const& firstPath, WideString const& secondPath, WideString const& thirdPath);
+		GDAPI static WideString Combine(WideStringView const firstPath, WideStringView const secondPath);
+		GDAPI static WideString Combine(WideStringView const firstPath, WideStringView const secondPath, WideStringView const thirdPath);
 		//! @}
 
 		/*!
@@ -102,7 +103,7 @@ GD_NAMESPACE_BEGIN
 		 * @param path Path to the file.
 		 * @param resultPtr Pointer to the function call result. If no parameter presented and function fails it will throw.
 		 */
-		GDAPI static WideString Platformize(WideString const& path, bool* const resultPtr = nullptr);
+		GDAPI static WideString Platformize(WideStringView const path, bool* const resultPtr = nullptr);
 
 		/*!
 		 * Returns a full path to the specified path string.
@@ -110,7 +111,7 @@ GD_NAMESPACE_BEGIN
 		 * @param path Path to the file.
 		 * @param resultPtr Pointer to the function call result. If no parameter presented and function fails it will throw.
 		 */
-		GDAPI static WideString GetFullPath(WideString const& path, bool* const resultPtr = nullptr);
+		GDAPI static WideString GetFullPath(WideStringView const path, bool* const resultPtr = nullptr);
 
 		/*!
 		 * Returns relative path from one path to another.
@@ -119,21 +120,21 @@ GD_NAMESPACE_BEGIN
 		 * @param pathFrom Path to file, which relative path we need to compute.
 		 * @param resultPtr Pointer to the function call result. If no parameter presented and function fails it will throw.
 		 */
-		GDAPI static WideString GetRelativePath(WideString const& pathFrom, WideString const& pathTo, bool* const resultPtr = nullptr);
+		GDAPI static WideString GetRelativePath(WideStringView const pathFrom, WideStringView const pathTo, bool* const resultPtr = nullptr);
 
 		/*!
 		 * Returns extension information for specified path string.
 		 * E.g. "directory/file.ext" -> ".ext"
 		 * @param path Path to the file.
 		 */
-		GDAPI static WideString GetExtension(WideString const& path);
+		GDAPI static WideString GetExtension(WideStringView const path);
 
 		/*!
 		 * Returns file and extension information for specified path string.
 		 * E.g. "directory/file.ext" -> "file.ext"
 		 * @param path Path to the file.
 		 */
-		GDAPI static WideString GetFileName(WideString const& path);
+		GDAPI static WideString GetFileName(WideStringView const path);
 
 		/*!
 		 * Returns file information for specified path string (without extension).
@@ -141,7 +142,7 @@ GD_NAMESPACE_BEGIN
 		 *
 		 * @param path Path to the file.
 		 */
-		GDAPI static WideString GetFileNameWithoutExtension(WideString const& path);
+		GDAPI static WideString GetFileNameWithoutExtension(WideStringView const path);
 
 		/*!
 		 * Returns directory information for specified path string.
@@ -149,7 +150,7 @@ GD_NAMESPACE_BEGIN
 		 *
 		 * @param path Path to the file.
 		 */
-		GDAPI static WideString GetDirectoryName(WideString const& path);
+		GDAPI static WideString GetDirectoryName(WideStringView const path);
 
 		/*!
 		 * Returns directory file information for specified path string (without extension).
@@ -157,7 +158,7 @@ GD_NAMESPACE_BEGIN
 		 *
 		 * @param path Path to the file.
 		 */
-		GDAPI static WideString GetDirectoryAndFileNameWithoutExtension(WideString const& path);
+		GDAPI static WideString GetDirectoryAndFileNameWithoutExtension(WideStringView const path);
 	};	// class PathsGeneric
 
 GD_NAMESPACE_END
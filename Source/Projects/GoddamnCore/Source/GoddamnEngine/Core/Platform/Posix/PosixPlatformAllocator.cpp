@@ -14,6 +14,8 @@
 #if GD_PLATFORM_API_POSIX
 
 #include <stdlib.h>
+#include <unistd.h>
+#include <sys/mman.h>
 
 GD_NAMESPACE_BEGIN
 
@@ -95,6 +97,125 @@ GD_NAMESPACE_BEGIN
 			free(allocationPointer);
 			return true;
 		}
+
+		// ------------------------------------------------------------------------------------------
+		// Virtual memory.
+		// ------------------------------------------------------------------------------------------
+
+		/*!
+		 * Returns size of the virtual memory page.
+		 * All sizes and offsets passed to virtual memory functions should be aligned by this value.
+		 *
+		 * @param pageSize Size of pages that back the memory.
+		 */
+		GDINT virtual SizeTp VirtualMemoryGetPageSize(VirtualMemoryPageSize const pageSize) const override final
+		{
+			SizeTp static const systemPageSize = static_cast<SizeTp>(sysconf(_SC_PAGESIZE));
+			return pageSize == VirtualMemoryPageSize::Default ? systemPageSize : 2 * 1024 * 1024;
+		}
+
+		/*!
+		 * Reserves a range of the address space without committing any physical memory.
+		 *
+		 * @param reservationPointer Reserved memory pointer, aligned by the page size.
+		 * @param reservationSizeBytes Size of the address space range to reserve in bytes.
+		 * @param pageSize Size of pages that should back the memory.
+		 *
+		 * @returns True if operation succeeded.
+		 */
+		GDINT virtual bool VirtualMemoryReserve(Handle& reservationPointer, SizeTp const reservationSizeBytes, VirtualMemoryPageSize const pageSize) override final
+		{
+			reservationPointer = nullptr;
+#if defined(MAP_HUGETLB)
+			if (pageSize == VirtualMemoryPageSize::ExplicitHuge)
+			{
+				// Huge pages are reserved from the system pool at this point, so that an empty pool fails here and
+				// not with SIGBUS on the first write to the committed memory.
+				auto const hugeTlbPointer = mmap(nullptr, reservationSizeBytes, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+				if (hugeTlbPointer != MAP_FAILED)
+				{
+					reservationPointer = hugeTlbPointer;
+					return true;
+				}
+				// No huge pages were preallocated in the system pool, falling back to the transparent ones.
+			}
+#endif	// if defined(MAP_HUGETLB)
+			if (pageSize == VirtualMemoryPageSize::Default)
+			{
+				auto const mmapPointer = mmap(nullptr, reservationSizeBytes, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+				if (mmapPointer == MAP_FAILED)
+				{
+					return false;
+				}
+				reservationPointer = mmapPointer;
+				return true;
+			}
+
+			// Over-reserving the range to align it by the huge page size and trimming the excess.
+			auto const hugePageSize = VirtualMemoryGetPageSize(VirtualMemoryPageSize::Huge);
+			auto const mmapSizeBytes = reservationSizeBytes + hugePageSize;
+			auto const mmapPointer = mmap(nullptr, mmapSizeBytes, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+			if (mmapPointer == MAP_FAILED)
+			{
+				return false;
+			}
+			auto const mmapAddress = reinterpret_cast<SizeTp>(mmapPointer);
+			auto const alignedAddress = (mmapAddress + hugePageSize - 1) & ~(hugePageSize - 1);
+			if (alignedAddress != mmapAddress)
+			{
+				munmap(mmapPointer, alignedAddress - mmapAddress);
+			}
+			if (alignedAddress + reservationSizeBytes != mmapAddress + mmapSizeBytes)
+			{
+				munmap(reinterpret_cast<Handle>(alignedAddress + reservationSizeBytes), mmapAddress + mmapSizeBytes - alignedAddress - reservationSizeBytes);
+			}
+			reservationPointer = reinterpret_cast<Handle>(alignedAddress);
+#if defined(MADV_HUGEPAGE)
+			madvise(reservationPointer, reservationSizeBytes, MADV_HUGEPAGE);
+#endif	// if defined(MADV_HUGEPAGE)
+			return true;
+		}
+
+		/*!
+		 * Commits physical memory to the part of the reserved range and makes it readable and writable.
+		 *
+		 * @param commitPointer Pointer to the first page to commit.
+		 * @param commitSizeBytes Size of memory to commit in bytes.
+		 *
+		 * @returns True if operation succeeded.
+		 */
+		GDINT virtual bool VirtualMemoryCommit(Handle const commitPointer, SizeTp const commitSizeBytes) override final
+		{
+			return mprotect(commitPointer, commitSizeBytes, PROT_READ | PROT_WRITE) == 0;
+		}
+
+		/*!
+		 * Returns physical memory of the part of the reserved range back to the system.
+		 * Address space stays reserved.
+		 *
+		 * @param decommitPointer Pointer to the first page to decommit.
+		 * @param decommitSizeBytes Size of memory to decommit in bytes.
+		 *
+		 * @returns True if operation succeeded.
+		 */
+		GDINT virtual bool VirtualMemoryDecommit(Handle const decommitPointer, SizeTp const decommitSizeBytes) override final
+		{
+			return madvise(decommitPointer, decommitSizeBytes, MADV_DONTNEED) == 0
+				&& mprotect(decommitPointer, decommitSizeBytes, PROT_NONE) == 0;
+		}
+
+		/*!
+		 * Releases the whole reserved range, including all committed memory.
+		 *
+		 * @param reservationPointer Reserved memory pointer.
+		 * @param reservationSizeBytes Size of the reserved range in bytes.
+		 *
+		 * @returns True if operation succeeded.
+		 */
+		GDINT virtual bool VirtualMemoryRelease(Handle const reservationPointer, SizeTp const reservationSizeBytes) override final
+		{
+			return munmap(reservationPointer, reservationSizeBytes) == 0;
+		}
 	};	// class PosixPlatformAllocator
 
 	GD_IMPLEMENT_SINGLETON(IPlatformAllocator, PosixPlatformAllocator);
@@ -13,23 +13,14 @@
 #include <GoddamnEngine/Core/Platform/PlatformEncoding.h>
 #if GD_PLATFORM_API_POSIX && !GD_PLATFORM_API_COCOA
 
-#include <iconv.h>
-
 GD_NAMESPACE_BEGIN
 
 	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
 	//! Text encoding conversions on Posix platforms.
+	//! Wide characters are UTF-32 here, so the built-in transcoder is used instead of iconv.
 	// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
 	class GD_PLATFORM_KERNEL PosixPlatformTextEncoding final : public IPlatformTextEncoding
 	{
-	private:
-		iconv_t m_WideCharToUTF8;
-		iconv_t m_UTF8ToWideChar;
-
-	public:
-		GDINT PosixPlatformTextEncoding();
-		GDINT virtual ~PosixPlatformTextEncoding();
-
 	private:
 
 		// ------------------------------------------------------------------------------------------
@@ -49,19 +40,6 @@ GD_NAMESPACE_BEGIN
 
 	GD_IMPLEMENT_SINGLETON(IPlatformTextEncoding, PosixPlatformTextEncoding)
 
-	GDINT PosixPlatformTextEncoding::PosixPlatformTextEncoding()
-		: m_WideCharToUTF8(), m_UTF8ToWideChar()
-	{
-		m_WideCharToUTF8 = iconv_open("UTF-8", "UTF-32LE");
-		m_UTF8ToWideChar = iconv_open("UTF-32LE", "UTF-8");
-	}
-
-	GDINT PosixPlatformTextEncoding::~PosixPlatformTextEncoding()
-	{
-		iconv_close(m_WideCharToUTF8);
-		iconv_close(m_UTF8ToWideChar);
-	}
-
 	// ------------------------------------------------------------------------------------------
 	// Encoding.
 	// ------------------------------------------------------------------------------------------
@@ -78,21 +56,9 @@ GD_NAMESPACE_BEGIN
 	GDINT bool PosixPlatformTextEncoding::CalculateEncodedLength(WideCStr const text, SizeTp const textLength, SizeTp& encodedLength) const
 	{
 		GD_ASSERT(text != nullptr && textLength > 0);
-		if (m_WideCharToUTF8 != nullptr)
-		{
-			auto inBuffer = reinterpret_cast<Char*>(const_cast<WideChar*>(text));
-			auto inBufferBytesLeft = ::size_t(sizeof(*text) * textLength);
-			String textEncoded(textLength * 4);
-			auto outBuffer = textEncoded.CStr();
-			auto outBufferBytesLeft = ::size_t(sizeof(textEncoded[0]) * textEncoded.GetLength());
-			if (iconv(m_WideCharToUTF8, &inBuffer, &inBufferBytesLeft, &outBuffer, &outBufferBytesLeft) != -1)
-			{
-				auto const encodedLengthInBytes = sizeof(textEncoded[0]) * textEncoded.GetLength() - outBufferBytesLeft;
-				encodedLength = encodedLengthInBytes / sizeof(textEncoded[0]);
-				return true;
-			}
-		}
-		return false;
+		auto const result = CUnicode::CalculateEncodedLength(text, textLength);
+		encodedLength = result.Length;
+		return result.Succeeded();
 	}
 
 	/*!
@@ -109,15 +75,7 @@ GD_NAMESPACE_BEGIN
 	{
 		GD_ASSERT(dst != nullptr && dstLength > 0);
 		GD_ASSERT(src != nullptr && srcLength > 0);
-		if (m_WideCharToUTF8 != nullptr)
-		{
-			auto inBuffer = reinterpret_cast<Char*>(const_cast<WideChar*>(src));
-			auto inBufferBytesLeft = ::size_t(sizeof(*src) * srcLength);
-			auto outBuffer = dst;
-			auto outBufferBytesLeft = ::size_t(sizeof(*dst) * dstLength);
-			return iconv(m_WideCharToUTF8, &inBuffer, &inBufferBytesLeft, &outBuffer, &outBufferBytesLeft) != -1;
-		}
-		return false;
+		return CUnicode::EncodeUTF8(dst, dstLength, src, srcLength).Succeeded();
 	}
 
 	// ------------------------------------------------------------------------------------------
@@ -136,21 +94,9 @@ GD_NAMESPACE_BEGIN
 	GDINT bool PosixPlatformTextEncoding::CalculateDecodedLength(CStr const text, SizeTp const textLength, SizeTp& decodedLength) const
 	{
 		GD_ASSERT(text != nullptr && textLength > 0);
-		if (m_WideCharToUTF8 != nullptr)
-		{
-			auto inBuffer = const_cast<Char*>(text);
-			auto inBufferBytesLeft = ::size_t(sizeof(*text) * textLength);
-			WideString textDecoded(textLength);
-			auto outBuffer = reinterpret_cast<Char*>(textDecoded.CStr());
-			auto outBufferBytesLeft = ::size_t(sizeof(textDecoded[0]) * textDecoded.GetLength());
-			if (iconv(m_UTF8ToWideChar, &inBuffer, &inBufferBytesLeft, &outBuffer, &outBufferBytesLeft) != -1)
-			{
-				auto const decodedLengthInBytes = sizeof(textDecoded[0]) * textDecoded.GetLength() - outBufferBytesLeft;
-				decodedLength = decodedLengthInBytes / sizeof(textDecoded[0]);
-				return true;
-			}
-		}
-		return false;
+		auto const result = CUnicode::CalculateDecodedLength(text, textLength);
+		decodedLength = result.Length;
+		return result.Succeeded();
 	}
 
 	/*!
@@ -167,15 +113,7 @@ GD_NAMESPACE_BEGIN
 	{
 		GD_ASSERT(dst != nullptr && dstLength > 0);
 		GD_ASSERT(src != nullptr && srcLength > 0);
-		if (m_UTF8ToWideChar != nullptr)
-		{
-			auto inBuffer = const_cast<Char*>(src);
-			auto inBufferBytesLeft = ::size_t(sizeof(*src) * srcLength);
-			auto outBuffer = reinterpret_cast<Char*>(dst);
-			auto outBufferBytesLeft = ::size_t(sizeof(*dst) * dstLength);
-			return iconv(m_UTF8ToWideChar, &inBuffer, &inBufferBytesLeft, &outBuffer, &outBufferBytesLeft) != -1;
-		}
-		return false;
+		return CUnicode::DecodeUTF8(dst, dstLength, src, srcLength).Succeeded();
 	}
 
 GD_NAMESPACE_END
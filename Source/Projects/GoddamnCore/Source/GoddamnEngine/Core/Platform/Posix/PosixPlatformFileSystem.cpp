@@ -13,8 +13,6 @@
 #include <GoddamnEngine/Core/Platform/PlatformFileSystem.h>
 #if GD_PLATFORM_API_POSIX
 
-#include <GoddamnEngine/Core/Platform/PlatformPaths.h>
-
 #include <sys/stat.h>
 #include <unistd.h>
 #include <dirent.h>
@@ -33,18 +31,18 @@ GD_NAMESPACE_BEGIN
 		// File utilities.
 		// ------------------------------------------------------------------------------------------
 
-		GDINT virtual bool FileExists(WideString const& filename) const override final;
-		GDINT virtual bool FileSize(WideString const& filename, UInt64& fileSize) const override final;
-		GDINT virtual bool FileCreateEmpty(WideString const& filename) override final;
-		GDINT virtual bool FileRemove(WideString const& filename) override final;
-		GDINT virtual bool FileMove(WideString const& srcFilename, WideString const& dstFilename, bool const doOverwrite) override final;
+		GDINT virtual bool FileExists(Path const& filename) const override final;
+		GDINT virtual bool FileSize(Path const& filename, UInt64& fileSize) const override final;
+		GDINT virtual bool FileCreateEmpty(Path const& filename) override final;
+		GDINT virtual bool FileRemove(Path const& filename) override final;
+		GDINT virtual bool FileMove(Path const& srcFilename, Path const& dstFilename, bool const doOverwrite) override final;
 
         // ------------------------------------------------------------------------------------------
         // File IO utilities.
         // ------------------------------------------------------------------------------------------
 
-        GDINT virtual bool FileOpenRead(WideString const& filename, Handle& fileHandle) const override final;
-        GDINT virtual bool FileOpenWrite(WideString const& filename, Handle& fileHandle, bool const doAppend) override final;
+        GDINT virtual bool FileOpenRead(Path const& filename, Handle& fileHandle) const override final;
+        GDINT virtual bool FileOpenWrite(Path const& filename, Handle& fileHandle, bool const doAppend) override final;
         GDINT virtual bool FileClose(Handle const fileHandle) const override final;
         GDINT virtual bool FileSeek(Handle const fileHandle, Int64 const offset, SeekOrigin const origin, UInt64* const newPosition) const override final;
         GDINT virtual bool FileRead(Handle const fileHandle, Handle const readBuffer, UInt32 const readBufferSizeBytes, UInt32* const numBytesRead) const override final;
@@ -54,10 +52,10 @@ GD_NAMESPACE_BEGIN
 		// Directory utilities.
 		// ------------------------------------------------------------------------------------------
 
-		GDINT virtual bool DirectoryExists(WideString const& directoryName) const override final;
-		GDINT virtual bool DirectoryCreateEmpty(WideString const& directoryName) const override final;
-		GDINT virtual bool DirectoryRemove(WideString const& directoryName) override final;
-		GDINT virtual bool DirectoryIterate(WideString const& directoryName, IFileSystemDirectoryIterateDelegate& directoryIterateDelegate) const override final;
+		GDINT virtual bool DirectoryExists(Path const& directoryName) const override final;
+		GDINT virtual bool DirectoryCreateEmpty(Path const& directoryName) const override final;
+		GDINT virtual bool DirectoryRemove(Path const& directoryName) override final;
+		GDINT virtual bool DirectoryIterate(Path const& directoryName, IFileSystemDirectoryIterateDelegate& directoryIterateDelegate) const override final;
 	};	// class PosixPlatformDiskFileSystem
 
 	GD_IMPLEMENT_SINGLETON(IPlatformDiskFileSystem, PosixPlatformDiskFileSystem)
@@ -70,11 +68,10 @@ GD_NAMESPACE_BEGIN
      * Returns true if the specified file exists and is not directory.
      * @param filename Path to the file.
      */
-    GDINT bool PosixPlatformDiskFileSystem::FileExists(WideString const& filename) const
+    GDINT bool PosixPlatformDiskFileSystem::FileExists(Path const& filename) const
     {
         struct stat fileAttributeData = {};
-        auto const filenameSystem = StringConv::EncodeUTF8(Paths::Platformize(filename));
-        if (stat(filenameSystem.CStr(), &fileAttributeData) == 0)
+        if (stat(filename.CStr(), &fileAttributeData) == 0)
         {
             return S_ISREG(fileAttributeData.st_mode);
         }
@@ -89,11 +86,10 @@ GD_NAMESPACE_BEGIN
      *
      * @returns True if file size was successfully obtained.
      */
-    GDINT bool PosixPlatformDiskFileSystem::FileSize(WideString const& filename, UInt64& fileSize) const
+    GDINT bool PosixPlatformDiskFileSystem::FileSize(Path const& filename, UInt64& fileSize) const
     {
         struct stat fileAttributeData = {};
-        auto const filenameSystem = StringConv::EncodeUTF8(Paths::Platformize(filename));
-        if (stat(filenameSystem.CStr(), &fileAttributeData) == 0)
+        if (stat(filename.CStr(), &fileAttributeData) == 0)
         {
             if (!S_ISDIR(fileAttributeData.st_mode))
             {
@@ -111,10 +107,9 @@ GD_NAMESPACE_BEGIN
      * @param filename Path to the file.
      * @returns True if file exists or was successfully created.
      */
-    GDINT bool PosixPlatformDiskFileSystem::FileCreateEmpty(WideString const& filename)
+    GDINT bool PosixPlatformDiskFileSystem::FileCreateEmpty(Path const& filename)
     {
-        auto const filenameSystem = StringConv::EncodeUTF8(Paths::Platformize(filename));
-        auto const emptyOrExistingFile = open(filenameSystem.CStr(), O_CREAT);
+        auto const emptyOrExistingFile = open(filename.CStr(), O_CREAT);
         if (emptyOrExistingFile != -1)
         {
             close(emptyOrExistingFile);
@@ -129,13 +124,12 @@ GD_NAMESPACE_BEGIN
      * @param filename Path to the file.
      * @returns True if file was successfully deleted.
      */
-    GDINT bool PosixPlatformDiskFileSystem::FileRemove(WideString const& filename)
+    GDINT bool PosixPlatformDiskFileSystem::FileRemove(Path const& filename)
     {
-        auto const filenameSystem = StringConv::EncodeUTF8(Paths::Platformize(filename));
-        if (unlink(filenameSystem.CStr()) != 0)
+        if (unlink(filename.CStr()) != 0)
         {
             sleep(0);
-            return unlink(filenameSystem.CStr()) == 0;
+            return unlink(filename.CStr()) == 0;
         }
         return true;
     }
@@ -149,7 +143,7 @@ GD_NAMESPACE_BEGIN
      *
      * @returns True if file was successfully moved.
      */
-    GDINT bool PosixPlatformDiskFileSystem::FileMove(WideString const& srcFilename, WideString const& dstFilename, bool const doOverwrite)
+    GDINT bool PosixPlatformDiskFileSystem::FileMove(Path const& srcFilename, Path const& dstFilename, bool const doOverwrite)
     {
 	    if (DirectoryExists(srcFilename))
 	    {
@@ -158,12 +152,10 @@ GD_NAMESPACE_BEGIN
 	    }
         if (doOverwrite || !FileExists(dstFilename))
         {
-            auto const srcFilenameSystem = StringConv::EncodeUTF8(Paths::Platformize(srcFilename));
-            auto const dstFilenameSystem = StringConv::EncodeUTF8(Paths::Platformize(dstFilename));
-            if (rename(srcFilenameSystem.CStr(), dstFilenameSystem.CStr()) != 0)
+            if (rename(srcFilename.CStr(), dstFilename.CStr()) != 0)
             {
                 sleep(0);
-                return rename(srcFilenameSystem.CStr(), dstFilenameSystem.CStr()) == 0;
+                return rename(srcFilename.CStr(), dstFilename.CStr()) == 0;
             }
             return true;
         }
@@ -182,15 +174,14 @@ GD_NAMESPACE_BEGIN
      *
      * @returns True if file was successfully opened.
      */
-    GDINT bool PosixPlatformDiskFileSystem::FileOpenRead(WideString const& filename, Handle& fileHandle) const
+    GDINT bool PosixPlatformDiskFileSystem::FileOpenRead(Path const& filename, Handle& fileHandle) const
     {
 	    if (DirectoryExists(filename))
 	    {
 		    // Specified path is a path to file, this is an error.
 		    return false;
 	    }
-        auto const filenameSystem = StringConv::EncodeUTF8(Paths::Platformize(filename));
-        auto const fileHandleSystem = open(filenameSystem.CStr(), O_RDONLY);
+        auto const fileHandleSystem = open(filename.CStr(), O_RDONLY);
         if (fileHandleSystem != -1)
         {
             fileHandle = reinterpret_cast<Handle>(fileHandleSystem);
@@ -208,15 +199,14 @@ GD_NAMESPACE_BEGIN
      *
      * @returns True if file was successfully opened.
      */
-    GDINT bool PosixPlatformDiskFileSystem::FileOpenWrite(WideString const& filename, Handle& fileHandle, bool const doAppend)
+    GDINT bool PosixPlatformDiskFileSystem::FileOpenWrite(Path const& filename, Handle& fileHandle, bool const doAppend)
     {
 	    if (DirectoryExists(filename))
 	    {
 		    // Specified path is a path to file, this is an error.
 		    return false;
 	    }
-        auto const filenameSystem = StringConv::EncodeUTF8(Paths::Platformize(filename));
-        auto const fileHandleSystem = open(filenameSystem.CStr(), O_CREAT | O_WRONLY | (doAppend ? O_APPEND : O_TRUNC));
+        auto const fileHandleSystem = open(filename.CStr(), O_CREAT | O_WRONLY | (doAppend ? O_APPEND : O_TRUNC));
         if (fileHandleSystem != -1)
         {
             fileHandle = reinterpret_cast<Handle>(fileHandleSystem);
@@ -360,11 +350,10 @@ GD_NAMESPACE_BEGIN
      * Returns true if the specified file exists and is a directory.
      * @param directoryName Name to the directory.
      */
-    GDINT bool PosixPlatformDiskFileSystem::DirectoryExists(WideString const& directoryName) const
+    GDINT bool PosixPlatformDiskFileSystem::DirectoryExists(Path const& directoryName) const
     {
         struct stat directoryAttributes = {};
-        auto const directoryNameSystem = StringConv::EncodeUTF8(Paths::Platformize(directoryName));
-        if (stat(directoryNameSystem.CStr(), &directoryAttributes) == 0)
+        if (stat(directoryName.CStr(), &directoryAttributes) == 0)
         {
             return S_ISDIR(directoryAttributes.st_mode);
         }
@@ -378,7 +367,7 @@ GD_NAMESPACE_BEGIN
      * @param directoryName Path to the directory.
      * @returns True if directory exists or was successfully created.
      */
-    GDINT bool PosixPlatformDiskFileSystem::DirectoryCreateEmpty(WideString const& directoryName) const
+    GDINT bool PosixPlatformDiskFileSystem::DirectoryCreateEmpty(Path const& directoryName) const
     {
 	    if (!DirectoryExists(directoryName))
 	    {
@@ -387,11 +376,10 @@ GD_NAMESPACE_BEGIN
 			    // Specified path is a path to file, this is an error.
 			    return false;
 		    }
-	        auto const directoryNameSystem = StringConv::EncodeUTF8(Paths::Platformize(directoryName));
-	        if (mkdir(directoryNameSystem.CStr(), 0755) != 0)
+	        if (mkdir(directoryName.CStr(), 0755) != 0)
 	        {
 				sleep(0);
-				return mkdir(directoryNameSystem.CStr(), 0755) == 0;
+				return mkdir(directoryName.CStr(), 0755) == 0;
 			}
 	    }
 		return true;
@@ -403,13 +391,12 @@ GD_NAMESPACE_BEGIN
      * @param directoryName Path to the directory.
      * @returns True if directory was successfully deleted.
      */
-    GDINT bool PosixPlatformDiskFileSystem::DirectoryRemove(WideString const& directoryName)
+    GDINT bool PosixPlatformDiskFileSystem::DirectoryRemove(Path const& directoryName)
     {
-        auto const directoryNameSystem = StringConv::EncodeUTF8(Paths::Platformize(directoryName));
-        if (rmdir(directoryNameSystem.CStr()) != 0)
+        if (rmdir(directoryName.CStr()) != 0)
         {
             sleep(0);
-            return rmdir(directoryNameSystem.CStr()) == 0;
+            return rmdir(directoryName.CStr()) == 0;
         }
 		return true;
     }
@@ -422,10 +409,9 @@ GD_NAMESPACE_BEGIN
      *
      * @returns True if directory exists or was successfully iterated.
      */
-    GDINT bool PosixPlatformDiskFileSystem::DirectoryIterate(WideString const& directoryName, IFileSystemDirectoryIterateDelegate& directoryIterateDelegate) const
+    GDINT bool PosixPlatformDiskFileSystem::DirectoryIterate(Path const& directoryName, IFileSystemDirectoryIterateDelegate& directoryIterateDelegate) const
     {
-        auto const directoryNameSystem = StringConv::EncodeUTF8(Paths::Platformize(directoryName));
-        auto const directoryHandle = opendir(directoryNameSystem.CStr());
+        auto const directoryHandle = opendir(directoryName.CStr());
         if (directoryHandle != nullptr)
         {
             while (true)
@@ -442,7 +428,7 @@ GD_NAMESPACE_BEGIN
 #endif  // if GD_PLATFORM_API_COCOA
                     )
                 {
-                    auto const directoryEntryName = Paths::Combine(directoryName, StringConv::DecodeUTF8(directoryEntryHandle->d_name));
+                    auto const directoryEntryName = directoryName / directoryEntryHandle->d_name;
                     directoryIterateDelegate.OnVisitDirectoryEntry(directoryEntryName, directoryEntryHandle->d_type == DT_DIR);
                 }
             }
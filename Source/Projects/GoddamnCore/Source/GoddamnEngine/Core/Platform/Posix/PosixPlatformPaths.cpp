@@ -31,9 +31,9 @@ GD_NAMESPACE_BEGIN
 		// Paths utilities.
 		// ------------------------------------------------------------------------------------------
 
-		GDINT virtual bool PathPlatformize(WideString const& path, WideString& pathSystem) const override final;
-		GDINT virtual bool PathGetFull(WideString const& path, WideString& pathFull) const override final;
-		GDINT virtual bool PathGetRelative(WideString const& pathFrom, WideString const& pathTo, WideString& pathRelative) const override final;
+		GDINT virtual bool PathPlatformize(WideStringView const path, WideString& pathSystem) const override final;
+		GDINT virtual bool PathGetFull(WideStringView const path, WideString& pathFull) const override final;
+		GDINT virtual bool PathGetRelative(WideStringView const pathFrom, WideStringView const pathTo, WideString& pathRelative) const override final;
 	};  // class PosixPlatformPaths
 
 	GD_IMPLEMENT_SINGLETON(IPlatformPaths, PosixPlatformPaths)
@@ -46,9 +46,9 @@ GD_NAMESPACE_BEGIN
 	 *
 	 * @returns True if operation succeeded.
 	 */
-	GDINT bool PosixPlatformPaths::PathPlatformize(WideString const& path, WideString& pathSystem) const
+	GDINT bool PosixPlatformPaths::PathPlatformize(WideStringView const path, WideString& pathSystem) const
 	{
-		pathSystem = path;
+		pathSystem = path.ToString();
 		return true;
 	}
 
@@ -60,7 +60,7 @@ GD_NAMESPACE_BEGIN
 	 *
 	 * @returns True if operation succeeded.
 	 */
-	GDINT bool PosixPlatformPaths::PathGetFull(WideString const& path, WideString& pathFull) const
+	GDINT bool PosixPlatformPaths::PathGetFull(WideStringView const path, WideString& pathFull) const
 	{
 		auto const pathSystem = StringConv::EncodeUTF8(path);
 		Char pathFullSystem[4 * PATH_MAX] = {};
@@ -81,7 +81,7 @@ GD_NAMESPACE_BEGIN
 	 *
 	 * @returns True if operation succeeded.
 	 */
-	GDINT bool PosixPlatformPaths::PathGetRelative(WideString const& pathFrom, WideString const& pathTo, WideString& pathRelative) const
+	GDINT bool PosixPlatformPaths::PathGetRelative(WideStringView const pathFrom, WideStringView const pathTo, WideString& pathRelative) const
 	{
 		GD_NOT_IMPLEMENTED();
 	}
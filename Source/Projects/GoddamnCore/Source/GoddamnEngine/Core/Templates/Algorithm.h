@@ -13,6 +13,8 @@
 #include <GoddamnEngine/Include.h>
 #include <GoddamnEngine/Core/Templates/Utility.h>
 #include <GoddamnEngine/Core/Templates/Iterators.h>
+#include <GoddamnEngine/Core/CStdlib/CMemory.h>
+#include <GoddamnEngine/Core/Platform/PlatformAllocator.h>
 
 GD_NAMESPACE_BEGIN
 	
@@ -240,6 +242,54 @@ GD_NAMESPACE_BEGIN
 				Algo::InitializeIterator(destination + (iterator - startSource), Utils::Move(*iterator));
 			}
 		}
+		template<typename TElement, typename = typename EnableIf<TypeTraits::IsTriviallyCopyable<TElement>::Value>::Type>
+		GDINL static void MoveRange(TElement* const& startSource, TElement* const& endSource, TElement* const destination)
+		{
+			// Moving trivially copyable objects is the same as copying their memory.
+			if (startSource != endSource)
+			{
+				CMemory::Memcpy(destination, startSource, (endSource - startSource) * sizeof(TElement));
+			}
+		}
+
+		/*!
+		 * Relocates objects from source range to destination: objects are moved into uninitialized
+		 * destination memory and source objects are destroyed. Ranges may overlap.
+		 * Trivially relocatable objects are relocated with a single memory move.
+		 *
+		 * @param startSource Start of the source range.
+		 * @param endSource End of the source range.
+		 * @param destination Start of the destination range.
+		 */
+		template<typename TElement>
+		GDINL static void RelocateRange(TElement* const startSource, TElement* const endSource, TElement* const destination)
+		{
+			if (startSource == destination || startSource == endSource)
+			{
+				return;
+			}
+			if (TypeTraits::IsTriviallyRelocatable<TElement>::Value)
+			{
+				CMemory::Memmove(destination, startSource, (endSource - startSource) * sizeof(TElement));
+			}
+			else if (destination < startSource || destination >= endSource)
+			{
+				for (auto source = startSource; source != endSource; ++source)
+				{
+					Algo::InitializeIterator(destination + (source - startSource), Utils::Move(*source));
+					Algo::DeinitializeIterator(source);
+				}
+			}
+			else
+			{
+				// Destination overlaps the tail of the source, relocating backwards.
+				for (auto source = endSource; source != startSource; --source)
+				{
+					Algo::InitializeIterator(destination + (source - startSource - 1), Utils::Move(*(source - 1)));
+					Algo::DeinitializeIterator(source - 1);
+				}
+			}
+		}
 
 		// ------------------------------------------------------------------------------------------
 		// Searching algorithms.
@@ -371,12 +421,97 @@ GD_NAMESPACE_BEGIN
 		}
 		//! @}
 
+		/*!
+		 * Searches for the first element in the sorted range, that is not less than the specified value.
+		 * Search is branchless: each step conditionally moves the range base, so it does not suffer
+		 * from branch mispredictions, and both possible next pivots are prefetched in advance.
+		 *
+		 * @param startIterator Start of the iterators range.
+		 * @param endIterator End of the iterators range.
+		 * @param value Value we are searching for.
+		 * @param lessPredicate Binary predicate that determines, whether left expression is less than right.
+		 *
+		 * @returns Iterator of the first element not less than the value or the end Iterator.
+		 */
+		//! @{
+		template<typename TRandomAccessIterator, typename TValue, typename TLessPredicate
+			, typename = typename EnableIf<IteratorTraits<TRandomAccessIterator>::IsRandomAccess>::Type
+			>
+		GDINL static TRandomAccessIterator LowerBound(TRandomAccessIterator const startIterator, TRandomAccessIterator const endIterator, TValue const& value, TLessPredicate const& lessPredicate)
+		{
+			SizeTp length = endIterator - startIterator;
+			if (length == 0)
+			{
+				return endIterator;
+			}
+			auto baseIterator = startIterator;
+			while (length > 1)
+			{
+				auto const half = length / 2;
+				CMemory::Prefetch(&*(baseIterator + half / 2));
+				CMemory::Prefetch(&*(baseIterator + half + half / 2));
+				baseIterator = lessPredicate(*(baseIterator + half), value) ? baseIterator + half : baseIterator;
+				length -= half;
+			}
+			return baseIterator + static_cast<SizeTp>(lessPredicate(*baseIterator, value));
+		}
+		template<typename TRandomAccessIterator, typename TValue
+			, typename = typename EnableIf<IteratorTraits<TRandomAccessIterator>::IsRandomAccess>::Type
+			>
+		GDINL static TRandomAccessIterator LowerBound(TRandomAccessIterator const startIterator, TRandomAccessIterator const endIterator, TValue const& value)
+		{
+			return LowerBound(startIterator, endIterator, value, [](auto const& lhs, auto const& rhs) { return lhs < rhs; });
+		}
+		//! @}
+
+		/*!
+		 * Searches for the first element in the sorted range, that is greater than the specified value.
+		 * Search is branchless, see @ref LowerBound.
+		 *
+		 * @param startIterator Start of the iterators range.
+		 * @param endIterator End of the iterators range.
+		 * @param value Value we are searching for.
+		 * @param lessPredicate Binary predicate that determines, whether left expression is less than right.
+		 *
+		 * @returns Iterator of the first element greater than the value or the end Iterator.
+		 */
+		//! @{
+		template<typename TRandomAccessIterator, typename TValue, typename TLessPredicate
+			, typename = typename EnableIf<IteratorTraits<TRandomAccessIterator>::IsRandomAccess>::Type
+			>
+		GDINL static TRandomAccessIterator UpperBound(TRandomAccessIterator const startIterator, TRandomAccessIterator const endIterator, TValue const& value, TLessPredicate const& lessPredicate)
+		{
+			SizeTp length = endIterator - startIterator;
+			if (length == 0)
+			{
+				return endIterator;
+			}
+			auto baseIterator = startIterator;
+			while (length > 1)
+			{
+				auto const half = length / 2;
+				CMemory::Prefetch(&*(baseIterator + half / 2));
+				CMemory::Prefetch(&*(baseIterator + half + half / 2));
+				baseIterator = !lessPredicate(value, *(baseIterator + half)) ? baseIterator + half : baseIterator;
+				length -= half;
+			}
+			return baseIterator + static_cast<SizeTp>(!lessPredicate(value, *baseIterator));
+		}
+		template<typename TRandomAccessIterator, typename TValue
+			, typename = typename EnableIf<IteratorTraits<TRandomAccessIterator>::IsRandomAccess>::Type
+			>
+		GDINL static TRandomAccessIterator UpperBound(TRandomAccessIterator const startIterator, TRandomAccessIterator const endIterator, TValue const& value)
+		{
+			return UpperBound(startIterator, endIterator, value, [](auto const& lhs, auto const& rhs) { return lhs < rhs; });
+		}
+		//! @}
+
 		/*!
 		 * Searches through all iterators for one that matches the specified predicate via binary searching algorithm.
 		 * The range must me sorted in ascending order. See @ref UnstableSort method.
 		 *
-		 * @param startSource Start of the iterators range.
-		 * @param endSource End of the iterators range.
+		 * @param startIterator Start of the iterators range.
+		 * @param endIterator End of the iterators range.
 		 * @param predicate Element we are searching for.
 		 *
 		 * @returns Iterator found that matched specified predicate or the end Iterator.
@@ -386,17 +521,10 @@ GD_NAMESPACE_BEGIN
 			>
 		GDINL static TRandomAccessIterator BinaryFind(TRandomAccessIterator const startIterator, TRandomAccessIterator const endIterator, TElement const& predicate)
 		{
-			for (auto leftIterator = startIterator, rightIterator = (endIterator - 1); leftIterator != rightIterator; )
+			auto const foundIterator = LowerBound(startIterator, endIterator, predicate);
+			if (foundIterator != endIterator && !(predicate < *foundIterator))
 			{
-				auto const iteratorsDistance = (rightIterator - leftIterator);
-				auto const pivotIterator = leftIterator + iteratorsDistance / 2;
-				auto const& pivotElement = *pivotIterator;
-				if (pivotElement == predicate)
-				{
-					return pivotIterator;
-				}
-
-				((pivotElement < predicate) ? leftIterator : rightIterator) = pivotIterator;
+				return foundIterator;
 			}
 			return endIterator;
 		}
@@ -435,6 +563,7 @@ GD_NAMESPACE_BEGIN
 
 		// ------------------------------------------------------------------------------------------
 		// https://en.wikipedia.org/wiki/Insertion_sort
+		// Stable, used for the short ranges by all other sorting algorithms.
 		template<typename TRandomAccessIterator, typename TLessPredicate
 	#if !GD_DOCUMENTATION
 			, typename = typename EnableIf<IteratorTraits<TRandomAccessIterator>::IsRandomAccess>::Type
@@ -444,63 +573,186 @@ GD_NAMESPACE_BEGIN
 		{
 			if (endIterator != startIterator)
 			{
-				TRandomAccessIterator const reverseEndIterator = startIterator - 1;
 				for (TRandomAccessIterator iterator = startIterator + 1; iterator != endIterator; ++iterator)
 				{
-					for (TRandomAccessIterator sortedIterator = iterator; (sortedIterator != reverseEndIterator)
-						&& lessPredicate(*sortedIterator, *(sortedIterator - 1)); --sortedIterator)
-						IteratorSwap(sortedIterator, sortedIterator - 1);
+					if (lessPredicate(*iterator, *(iterator - 1)))
+					{
+						// Shifting greater elements right instead of swapping them.
+						auto element = Utils::Move(*iterator);
+						auto holeIterator = iterator;
+						do
+						{
+							*holeIterator = Utils::Move(*(holeIterator - 1));
+							--holeIterator;
+						} while (holeIterator != startIterator && lessPredicate(element, *(holeIterator - 1)));
+						*holeIterator = Utils::Move(element);
+					}
 				}
 			}
 		}
 
 		// ------------------------------------------------------------------------------------------
-		// https://en.wikipedia.org/wiki/Quicksort
+		// Restores the heap property of the subtree with the specified root.
+		template<typename TRandomAccessIterator, typename TLessPredicate>
+		GDINL static void _HeapSiftDown(TRandomAccessIterator const startIterator, SizeTp rootIndex, SizeTp const length, TLessPredicate const& lessPredicate)
+		{
+			auto element = Utils::Move(*(startIterator + rootIndex));
+			for (auto childIndex = 2 * rootIndex + 1; childIndex < length; childIndex = 2 * rootIndex + 1)
+			{
+				if (childIndex + 1 < length && lessPredicate(*(startIterator + childIndex), *(startIterator + childIndex + 1)))
+				{
+					++childIndex;
+				}
+				if (!lessPredicate(element, *(startIterator + childIndex)))
+				{
+					break;
+				}
+				*(startIterator + rootIndex) = Utils::Move(*(startIterator + childIndex));
+				rootIndex = childIndex;
+			}
+			*(startIterator + rootIndex) = Utils::Move(element);
+		}
+
+		// ------------------------------------------------------------------------------------------
+		// https://en.wikipedia.org/wiki/Heapsort
 		template<typename TRandomAccessIterator, typename TLessPredicate
 	#if !GD_DOCUMENTATION
 			, typename = typename EnableIf<IteratorTraits<TRandomAccessIterator>::IsRandomAccess>::Type
 	#endif	// if !GD_DOCUMENTATION
 		>
-		GDINL static void _QuickSort(TRandomAccessIterator const startIterator, TRandomAccessIterator const endIterator, TLessPredicate const& lessPredicate)
+		GDINL static void _HeapSort(TRandomAccessIterator const startIterator, TRandomAccessIterator const endIterator, TLessPredicate const& lessPredicate)
 		{
-			if (startIterator != endIterator)
+			SizeTp const length = endIterator - startIterator;
+			for (auto rootIndex = length / 2; rootIndex-- > 0;)
 			{
-				TRandomAccessIterator leftIterator = startIterator;
-				TRandomAccessIterator rightIterator = endIterator - 1;
-				if (leftIterator != rightIterator)
-				{
-					TRandomAccessIterator const pivotIterator = leftIterator++;
-					while (leftIterator != rightIterator)
-					{
-						if (lessPredicate(*leftIterator, *pivotIterator))
-						{
-							++leftIterator;
-						}
-						else
-						{
-							while ((leftIterator != rightIterator) && lessPredicate(*pivotIterator, *rightIterator))
-								--rightIterator;
-							IteratorSwap(leftIterator, rightIterator);
-						}
-					}
-					IteratorSwap(pivotIterator, leftIterator - 1);
-					_QuickSort(startIterator, leftIterator, lessPredicate);
-					_QuickSort(rightIterator, endIterator, lessPredicate);
-				}
+				_HeapSiftDown(startIterator, rootIndex, length, lessPredicate);
 			}
+			for (auto heapLength = length; heapLength > 1;)
+			{
+				--heapLength;
+				IteratorSwap(startIterator, startIterator + heapLength);
+				_HeapSiftDown(startIterator, 0, heapLength, lessPredicate);
+			}
+		}
+
+		// ------------------------------------------------------------------------------------------
+		// Moves median of the three elements to the result iterator.
+		template<typename TRandomAccessIterator, typename TLessPredicate>
+		GDINL static void _MoveMedianToFirst(TRandomAccessIterator const resultIterator, TRandomAccessIterator const aIterator
+			, TRandomAccessIterator const bIterator, TRandomAccessIterator const cIterator, TLessPredicate const& lessPredicate)
+		{
+			if (lessPredicate(*aIterator, *bIterator))
+			{
+				if (lessPredicate(*bIterator, *cIterator))
+					IteratorSwap(resultIterator, bIterator);
+				else if (lessPredicate(*aIterator, *cIterator))
+					IteratorSwap(resultIterator, cIterator);
+				else
+					IteratorSwap(resultIterator, aIterator);
+			}
+			else if (lessPredicate(*aIterator, *cIterator))
+				IteratorSwap(resultIterator, aIterator);
+			else if (lessPredicate(*bIterator, *cIterator))
+				IteratorSwap(resultIterator, cIterator);
+			else
+				IteratorSwap(resultIterator, bIterator);
 		}
 
 		// ------------------------------------------------------------------------------------------
-		// https://en.wikipedia.org/wiki/Smoothsort
+		// https://en.wikipedia.org/wiki/Introsort
+		// Quick sort with median of three pivot, that switches to the heap sort when recursion 
+		// becomes too deep, so worst case is O(n log n).
 		template<typename TRandomAccessIterator, typename TLessPredicate
 	#if !GD_DOCUMENTATION
 			, typename = typename EnableIf<IteratorTraits<TRandomAccessIterator>::IsRandomAccess>::Type
 	#endif	// if !GD_DOCUMENTATION
 		>
-		GDINL static void _SmoothSort(TRandomAccessIterator const startIterator, TRandomAccessIterator const endIterator, TLessPredicate const& lessPredicate)
+		GDINL static void _IntroSort(TRandomAccessIterator const startIterator, TRandomAccessIterator endIterator, SizeTp depthLimit, TLessPredicate const& lessPredicate)
 		{
-			//! @todo Implement smooth sorting.
-			_QuickSort(startIterator, endIterator, lessPredicate);
+			SizeTp static const maxInsertionSortDistance = 16;
+			while (static_cast<SizeTp>(endIterator - startIterator) > maxInsertionSortDistance)
+			{
+				if (depthLimit == 0)
+				{
+					_HeapSort(startIterator, endIterator, lessPredicate);
+					return;
+				}
+				--depthLimit;
+
+				// Pivot is placed at the start of the range, so that both scans below are stopped 
+				// by elements of the range without any bound checks.
+				auto const middleIterator = startIterator + (endIterator - startIterator) / 2;
+				_MoveMedianToFirst(startIterator, startIterator + 1, middleIterator, endIterator - 1, lessPredicate);
+				auto leftIterator = startIterator + 1;
+				auto rightIterator = endIterator;
+				while (true)
+				{
+					while (lessPredicate(*leftIterator, *startIterator))
+						++leftIterator;
+					--rightIterator;
+					while (lessPredicate(*startIterator, *rightIterator))
+						--rightIterator;
+					if (rightIterator - leftIterator <= 0)
+						break;
+					IteratorSwap(leftIterator, rightIterator);
+					++leftIterator;
+				}
+
+				_IntroSort(leftIterator, endIterator, depthLimit, lessPredicate);
+				endIterator = leftIterator;
+			}
+			_InsertionSort(startIterator, endIterator, lessPredicate);
+		}
+
+		// ------------------------------------------------------------------------------------------
+		// Sorts range with the merge sort, using the buffer for the half of the range.
+		template<typename TRandomAccessIterator, typename TElement, typename TLessPredicate>
+		GDINL static void _MergeSortWithBuffer(TRandomAccessIterator const startIterator, TRandomAccessIterator const endIterator
+			, TElement* const buffer, TLessPredicate const& lessPredicate)
+		{
+			SizeTp static const maxInsertionSortDistance = 16;
+			SizeTp const length = endIterator - startIterator;
+			if (length <= maxInsertionSortDistance)
+			{
+				_InsertionSort(startIterator, endIterator, lessPredicate);
+				return;
+			}
+
+			auto const middleIterator = startIterator + length / 2;
+			_MergeSortWithBuffer(startIterator, middleIterator, buffer, lessPredicate);
+			_MergeSortWithBuffer(middleIterator, endIterator, buffer, lessPredicate);
+			if (!lessPredicate(*middleIterator, *(middleIterator - 1)))
+			{
+				// Halves are already ordered.
+				return;
+			}
+
+			// Left half is moved to the buffer and then merged with the right one. Elements of the 
+			// left half win ties, so sorting is stable.
+			auto const bufferEnd = buffer + length / 2;
+			MoveRange(startIterator, middleIterator, buffer);
+			auto bufferIterator = buffer;
+			auto rightIterator = middleIterator;
+			auto destinationIterator = startIterator;
+			while (bufferIterator != bufferEnd && rightIterator != endIterator)
+			{
+				if (lessPredicate(*rightIterator, *bufferIterator))
+				{
+					*destinationIterator = Utils::Move(*rightIterator);
+					++rightIterator;
+				}
+				else
+				{
+					*destinationIterator = Utils::Move(*bufferIterator);
+					++bufferIterator;
+				}
+				++destinationIterator;
+			}
+			for (; bufferIterator != bufferEnd; ++bufferIterator, ++destinationIterator)
+			{
+				*destinationIterator = Utils::Move(*bufferIterator);
+			}
+			DeinitializeRange(buffer, bufferEnd);
 		}
 
 		// ------------------------------------------------------------------------------------------
@@ -512,12 +764,16 @@ GD_NAMESPACE_BEGIN
 		>
 		GDINL static void _MergeSort(TRandomAccessIterator const startIterator, TRandomAccessIterator const endIterator, TLessPredicate const& lessPredicate)
 		{
-			//! @todo Implement merge sorting.
-			_InsertionSort(startIterator, endIterator, lessPredicate);
+			using ElementType = TypeTraits::RemoveReference<decltype(*startIterator)>;
+			SizeTp const length = endIterator - startIterator;
+			auto const buffer = GD_MALLOC_ARRAY_T(ElementType, length / 2);
+			_MergeSortWithBuffer(startIterator, endIterator, buffer, lessPredicate);
+			GD_FREE(buffer);
 		}
 
 		// ------------------------------------------------------------------------------------------
 		//! Performs fast unstable (in case of >= 2 elements) sorting of Iterator range. 
+		//! Introspective sort is used, so sorting takes O(n log n) time for any input.
 		//! @param startIterator Start of the iterators range.
 		//! @param endIterator End of the iterators range.
 		//! @param lessPredicate Binary predicate that determines, whether m_Left expression is less than m_Right.
@@ -534,16 +790,13 @@ GD_NAMESPACE_BEGIN
 			{
 				if (iteratorsDistance != 2)
 				{
-					SizeTp static const maxInsertionSortDistance = 8;
-					if (iteratorsDistance > maxInsertionSortDistance)
+					// Recursion depth is limited with the doubled logarithm of the length.
+					SizeTp depthLimit = 0;
+					for (auto distance = iteratorsDistance; distance > 1; distance /= 2)
 					{
-						SizeTp static const maxQuickSortDistance = 150;
-						iteratorsDistance <= maxQuickSortDistance ? _QuickSort(startIterator, endIterator, lessPredicate) : _SmoothSort(startIterator, endIterator, lessPredicate);
-					}
-					else
-					{
-						_InsertionSort(startIterator, endIterator, lessPredicate);
+						depthLimit += 2;
 					}
+					_IntroSort(startIterator, endIterator, depthLimit, lessPredicate);
 				}
 				else
 				{
@@ -554,7 +807,7 @@ GD_NAMESPACE_BEGIN
 		template<typename TRandomAccessIterator>
 		GDINL static void UnstableSort(TRandomAccessIterator const startIterator, TRandomAccessIterator const endIterator)
 		{
-			typedef typename TypeTraits::RemoveReference<decltype(*startIterator)>::Type ElementType;
+			using ElementType = TypeTraits::RemoveReference<decltype(*startIterator)>;
 			UnstableSort(startIterator, endIterator, TLess<ElementType>());
 		}
 		//! @}
@@ -570,6 +823,7 @@ GD_NAMESPACE_BEGIN
 
 		// ------------------------------------------------------------------------------------------
 		//! Performs fast stable sorting of Iterator range. Stable sorting is slower than unstable one.
+		//! Merge sort is used, it allocates temporary buffer for the half of the range.
 		//! @param startIterator Start of the iterators range.
 		//! @param endIterator End of the iterators range.
 		//! @param lessPredicate Binary predicate that determines, whether m_Left expression is less than m_Right.
@@ -587,7 +841,7 @@ GD_NAMESPACE_BEGIN
 			{
 				if (iteratorsDistance != 2)
 				{
-					SizeTp static const maxInsertionSortDistance = 5;
+					SizeTp static const maxInsertionSortDistance = 16;
 					maxInsertionSortDistance >= iteratorsDistance ? _InsertionSort(startIterator, endIterator, lessPredicate) : _MergeSort(startIterator, endIterator, lessPredicate);
 				}
 				else
@@ -599,7 +853,7 @@ GD_NAMESPACE_BEGIN
 		template<typename TRandomAccessIterator>
 		GDINL static void StableSort(TRandomAccessIterator const startIterator, TRandomAccessIterator const endIterator)
 		{
-			typedef typename TypeTraits::RemoveReference<decltype(*startIterator)>::Type ElementType;
+			using ElementType = TypeTraits::RemoveReference<decltype(*startIterator)>;
 			StableSort(startIterator, endIterator, TLess<ElementType>());
 		}
 		//! @}
@@ -613,6 +867,157 @@ GD_NAMESPACE_BEGIN
 			StableSort(Begin(container), End(container));
 		}
 
+		// ------------------------------------------------------------------------------------------
+		// Converts keys to the unsigned integers with the same order.
+		template<typename TKey>
+		GDINL static typename EnableIf<TypeTraits::IsUnsigned<TKey>::Value, UInt64>::Type _ToRadixKey(TKey const key)
+		{
+			return static_cast<UInt64>(key);
+		}
+		template<typename TKey>
+		GDINL static typename EnableIf<TypeTraits::IsSigned<TKey>::Value, UInt64>::Type _ToRadixKey(TKey const key)
+		{
+			// Flipping the sign bit moves negative values before positive ones.
+			return static_cast<UInt64>(key) ^ (UInt64(1) << (8 * sizeof(TKey) - 1));
+		}
+		GDINL static UInt64 _ToRadixKey(Float32 const key)
+		{
+			// Negative values have all bits flipped to reverse their order, positive ones have sign bit set.
+			UInt32 keyBits;
+			CMemory::Memcpy(&keyBits, &key, sizeof keyBits);
+			return keyBits ^ ((keyBits >> 31) != 0 ? 0xFFFFFFFFu : 0x80000000u);
+		}
+		GDINL static UInt64 _ToRadixKey(Float64 const key)
+		{
+			UInt64 keyBits;
+			CMemory::Memcpy(&keyBits, &key, sizeof keyBits);
+			return keyBits ^ ((keyBits >> 63) != 0 ? 0xFFFFFFFFFFFFFFFFull : 0x8000000000000000ull);
+		}
+
+		// ------------------------------------------------------------------------------------------
+		// Scatters elements into the destination by the specified byte of the keys.
+		template<bool TConstruct, typename TSourceIterator, typename TDestinationIterator, typename TKeySelector>
+		GDINL static void _RadixScatter(TSourceIterator const sourceIterator, TDestinationIterator const destinationIterator
+			, SizeTp const length, SizeTp const byteIndex, SizeTp (&offsets)[256], TKeySelector const& keySelector)
+		{
+			for (SizeTp index = 0; index < length; ++index)
+			{
+				auto& sourceElement = *(sourceIterator + index);
+				auto const keyByte = static_cast<SizeTp>(_ToRadixKey(keySelector(sourceElement)) >> (8 * byteIndex)) & 0xFF;
+				auto const destination = destinationIterator + offsets[keyByte]++;
+				if (TConstruct)
+				{
+					InitializeIterator(destination, Utils::Move(sourceElement));
+				}
+				else
+				{
+					*destination = Utils::Move(sourceElement);
+				}
+			}
+		}
+
+		// ------------------------------------------------------------------------------------------
+		//! Performs stable least significant digit radix sorting of Iterator range by the extracted keys.
+		//! Sorting takes O(n) time and allocates temporary buffer for the whole range. Keys should
+		//! be integers or floating point numbers, key bytes, that are same for all elements, are skipped.
+		//! @param startIterator Start of the iterators range.
+		//! @param endIterator End of the iterators range.
+		//! @param keySelector Function that returns sorting key of the element.
+		//! @{
+		template<typename TRandomAccessIterator, typename TKeySelector
+	#if !GD_DOCUMENTATION
+			, typename = typename EnableIf<IteratorTraits<TRandomAccessIterator>::IsRandomAccess>::Type
+	#endif	// if !GD_DOCUMENTATION
+		>
+		GDINL static void RadixSort(TRandomAccessIterator const startIterator, TRandomAccessIterator const endIterator, TKeySelector const& keySelector)
+		{
+			using ElementType = TypeTraits::RemoveReference<decltype(*startIterator)>;
+			using KeyType = TypeTraits::Decay<decltype(keySelector(*startIterator))>;
+			static_assert(TypeTraits::IsIntegral<KeyType>::Value || TypeTraits::IsFloatingPoint<KeyType>::Value, "Radix sorting keys should be integers or floating point numbers.");
+
+			SizeTp const length = endIterator - startIterator;
+			if (length < 2)
+			{
+				return;
+			}
+
+			// Histograms of all key bytes are computed in a single pass.
+			SizeTp histograms[sizeof(KeyType)][256] = {};
+			for (auto iterator = startIterator; iterator != endIterator; ++iterator)
+			{
+				auto const key = _ToRadixKey(keySelector(*iterator));
+				for (SizeTp byteIndex = 0; byteIndex < sizeof(KeyType); ++byteIndex)
+				{
+					++histograms[byteIndex][(key >> (8 * byteIndex)) & 0xFF];
+				}
+			}
+
+			ElementType* buffer = nullptr;
+			bool isSortedInBuffer = false;
+			auto const firstKey = _ToRadixKey(keySelector(*startIterator));
+			for (SizeTp byteIndex = 0; byteIndex < sizeof(KeyType); ++byteIndex)
+			{
+				auto const& histogram = histograms[byteIndex];
+				if (histogram[(firstKey >> (8 * byteIndex)) & 0xFF] == length)
+				{
+					continue;
+				}
+
+				SizeTp offsets[256];
+				for (SizeTp bucket = 0, offset = 0; bucket < 256; ++bucket)
+				{
+					offsets[bucket] = offset;
+					offset += histogram[bucket];
+				}
+
+				// Elements are moved into the uninitialized buffer on the first pass and then 
+				// they are moved back and forth between the range and the buffer.
+				if (buffer == nullptr)
+				{
+					buffer = GD_MALLOC_ARRAY_T(ElementType, length);
+					_RadixScatter<true>(startIterator, buffer, length, byteIndex, offsets, keySelector);
+				}
+				else if (isSortedInBuffer)
+				{
+					_RadixScatter<false>(buffer, startIterator, length, byteIndex, offsets, keySelector);
+				}
+				else
+				{
+					_RadixScatter<false>(startIterator, buffer, length, byteIndex, offsets, keySelector);
+				}
+				isSortedInBuffer = !isSortedInBuffer;
+			}
+
+			if (buffer != nullptr)
+			{
+				if (isSortedInBuffer)
+				{
+					for (SizeTp index = 0; index < length; ++index)
+					{
+						*(startIterator + index) = Utils::Move(buffer[index]);
+					}
+				}
+				DeinitializeRange(buffer, buffer + length);
+				GD_FREE(buffer);
+			}
+		}
+		template<typename TRandomAccessIterator>
+		GDINL static void RadixSort(TRandomAccessIterator const startIterator, TRandomAccessIterator const endIterator)
+		{
+			using ElementType = TypeTraits::RemoveReference<decltype(*startIterator)>;
+			RadixSort(startIterator, endIterator, [](ElementType const& element) { return element; });
+		}
+		//! @}
+
+		// ------------------------------------------------------------------------------------------
+		//! Performs stable radix sorting of the container of integers or floating point numbers.
+		//! @param container The container to be sorted.
+		template<typename TContainer>
+		GDINL static void RadixSort(TContainer& container)
+		{
+			RadixSort(Begin(container), End(container));
+		}
+
 		// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 		// other algorithms.
 		// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
@@ -653,7 +1058,7 @@ GD_NAMESPACE_BEGIN
 
 	}	// namespace Algo
 
-	typedef Int32 HashValue;
+	typedef UInt64 HashValue;
 
 	//! Represents hash code that can not be IMPLcilty casted to integer type. 
 	struct HashCode final
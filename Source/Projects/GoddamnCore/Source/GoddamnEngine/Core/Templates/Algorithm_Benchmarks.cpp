@@ -0,0 +1,184 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/Templates/Algorithm_Benchmarks.cpp
+ * Template algorithms benchmarks: searching and sorting.
+ */
+#include <GoddamnEngine/Core/Templates/Algorithm.h>
+#include <GoddamnEngine/Core/Containers/Vector.h>
+#include <GoddamnEngine/Core/Containers/EytzingerVector.h>
+
+GD_NAMESPACE_BEGIN
+
+#if GD_TESTING_ENABLED
+
+	SizeTp static const SearchBenchmarkLengths[] = { 1000, 100000, 10000000 };
+	SizeTp static const SearchBenchmarkQueries = 1000000;
+	char const* const SearchBenchmarkCases[][3] = {
+		{ "BranchySearch 1k", "BranchySearch 100k", "BranchySearch 10M" },
+		{ "LowerBound 1k", "LowerBound 100k", "LowerBound 10M" },
+		{ "EytzingerVector 1k", "EytzingerVector 100k", "EytzingerVector 10M" },
+	};
+
+	// Keeps results of the benchmarks, so that computations are not optimized away.
+	static UInt64 volatile g_AlgorithmBenchmarkSink;
+
+	// Classic binary search, that branches on each comparison.
+	GDINL static UInt32 const* BranchyLowerBound(UInt32 const* first, SizeTp length, UInt32 const value)
+	{
+		while (length > 0)
+		{
+			auto const half = length / 2;
+			if (first[half] < value)
+			{
+				first += half + 1;
+				length -= half + 1;
+			}
+			else
+			{
+				length = half;
+			}
+		}
+		return first;
+	}
+
+	gd_testing_benchmark(AlgoSearch, state)
+	{
+		for (SizeTp lengthIndex = 0; lengthIndex < 3; ++lengthIndex)
+		{
+			auto const length = SearchBenchmarkLengths[lengthIndex];
+			Vector<UInt32> sorted;
+			sorted.Reserve(length);
+			for (SizeTp cnt = 0; cnt < length; ++cnt)
+			{
+				sorted.InsertLast(static_cast<UInt32>(cnt * 2));
+			}
+			EytzingerVector<UInt32> eytzinger(sorted.Begin(), sorted.End());
+
+			// Queries are pseudo-random values in the range of the array.
+			Vector<UInt32> queries;
+			queries.Reserve(SearchBenchmarkQueries);
+			for (SizeTp cnt = 0; cnt < SearchBenchmarkQueries; ++cnt)
+			{
+				queries.InsertLast(static_cast<UInt32>(cnt * 2654435761u % (2 * length)));
+			}
+
+			auto const data = sorted.GetData();
+			state.measure(SearchBenchmarkCases[0][lengthIndex], SearchBenchmarkQueries, [&]
+			{
+				UInt64 sum = 0;
+				for (auto const query : queries)
+				{
+					sum += BranchyLowerBound(data, length, query) - data;
+				}
+				g_AlgorithmBenchmarkSink = sum;
+			});
+			state.measure(SearchBenchmarkCases[1][lengthIndex], SearchBenchmarkQueries, [&]
+			{
+				UInt64 sum = 0;
+				for (auto const query : queries)
+				{
+					sum += Algo::LowerBound(data, data + length, query) - data;
+				}
+				g_AlgorithmBenchmarkSink = sum;
+			});
+			state.measure(SearchBenchmarkCases[2][lengthIndex], SearchBenchmarkQueries, [&]
+			{
+				UInt64 sum = 0;
+				for (auto const query : queries)
+				{
+					sum += eytzinger.LowerBound(query);
+				}
+				g_AlgorithmBenchmarkSink = sum;
+			});
+		}
+	};
+
+	SizeTp static const SortBenchmarkLengths[] = { 1000, 100000, 1000000 };
+	char const* const SortBenchmarkCases[][3] = {
+		{ "UnstableSort 1k", "UnstableSort 100k", "UnstableSort 1M" },
+		{ "StableSort 1k", "StableSort 100k", "StableSort 1M" },
+		{ "RadixSort 1k", "RadixSort 100k", "RadixSort 1M" },
+	};
+
+	// Typical draw list entry: sorting key and the payload.
+	struct SortBenchmarkDrawCall final
+	{
+		UInt64 SortKey;
+		UInt32 MeshIndex;
+		UInt32 MaterialIndex;
+	};	// struct SortBenchmarkDrawCall
+
+	gd_testing_benchmark(AlgoSortIntegers, state)
+	{
+		for (SizeTp lengthIndex = 0; lengthIndex < 3; ++lengthIndex)
+		{
+			auto const length = SortBenchmarkLengths[lengthIndex];
+			Vector<UInt32> unsorted;
+			unsorted.Reserve(length);
+			for (SizeTp cnt = 0; cnt < length; ++cnt)
+			{
+				unsorted.InsertLast(static_cast<UInt32>(cnt * 2654435761u));
+			}
+
+			// Copying of the input is included into the measurements.
+			Vector<UInt32> elements;
+			state.measure(SortBenchmarkCases[0][lengthIndex], length, [&]
+			{
+				elements = unsorted;
+				Algo::UnstableSort(elements);
+			});
+			state.measure(SortBenchmarkCases[1][lengthIndex], length, [&]
+			{
+				elements = unsorted;
+				Algo::StableSort(elements);
+			});
+			state.measure(SortBenchmarkCases[2][lengthIndex], length, [&]
+			{
+				elements = unsorted;
+				Algo::RadixSort(elements);
+			});
+		}
+	};
+
+	gd_testing_benchmark(AlgoSortDrawCalls, state)
+	{
+		for (SizeTp lengthIndex = 0; lengthIndex < 3; ++lengthIndex)
+		{
+			auto const length = SortBenchmarkLengths[lengthIndex];
+			Vector<SortBenchmarkDrawCall> unsorted;
+			unsorted.Reserve(length);
+			for (SizeTp cnt = 0; cnt < length; ++cnt)
+			{
+				unsorted.InsertLast({ cnt * 0x9E3779B97F4A7C15ull, static_cast<UInt32>(cnt), static_cast<UInt32>(cnt % 64) });
+			}
+
+			auto const lessPredicate = [](SortBenchmarkDrawCall const& lhs, SortBenchmarkDrawCall const& rhs) { return lhs.SortKey < rhs.SortKey; };
+			Vector<SortBenchmarkDrawCall> elements;
+			state.measure(SortBenchmarkCases[0][lengthIndex], length, [&]
+			{
+				elements = unsorted;
+				Algo::UnstableSort(elements.Begin(), elements.End(), lessPredicate);
+			});
+			state.measure(SortBenchmarkCases[1][lengthIndex], length, [&]
+			{
+				elements = unsorted;
+				Algo::StableSort(elements.Begin(), elements.End(), lessPredicate);
+			});
+			state.measure(SortBenchmarkCases[2][lengthIndex], length, [&]
+			{
+				elements = unsorted;
+				Algo::RadixSort(elements.Begin(), elements.End(), [](SortBenchmarkDrawCall const& drawCall) { return drawCall.SortKey; });
+			});
+		}
+	};
+
+#endif	// if GD_TESTING_ENABLED
+
+GD_NAMESPACE_END
@@ -0,0 +1,227 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/Templates/Algorithm_UnitTests.cpp
+ * Template algorithms definitions.
+ */
+#include <GoddamnEngine/Core/Templates/Algorithm.h>
+#include <GoddamnEngine/Core/Containers/Vector.h>
+#include <GoddamnEngine/Core/Containers/String.h>
+#include <GoddamnEngine/Core/Containers/Map.h>
+
+GD_NAMESPACE_BEGIN
+
+#if GD_TESTING_ENABLED
+
+	gd_testing_unit_test(AlgoLowerUpperBound)
+	{
+		for (Int32 length = 0; length < 70; ++length)
+		{
+			// Each value is repeated twice: 0, 0, 2, 2, 4, 4...
+			Vector<Int32> sorted;
+			for (Int32 cnt = 0; cnt < length; ++cnt)
+			{
+				sorted.InsertLast(cnt / 2 * 2);
+			}
+			for (Int32 value = -1; value <= length + 1; ++value)
+			{
+				SizeTp expectedLower = 0, expectedUpper = 0;
+				for (auto const element : sorted)
+				{
+					expectedLower += element < value ? 1 : 0;
+					expectedUpper += element <= value ? 1 : 0;
+				}
+				gd_testing_verify(Algo::LowerBound(sorted.Begin(), sorted.End(), value) - sorted.Begin() == static_cast<PtrDiffTp>(expectedLower));
+				gd_testing_verify(Algo::UpperBound(sorted.Begin(), sorted.End(), value) - sorted.Begin() == static_cast<PtrDiffTp>(expectedUpper));
+				
+				auto const data = sorted.GetData();
+				gd_testing_verify(Algo::LowerBound(data, data + length, value) == data + expectedLower);
+				gd_testing_verify(Algo::UpperBound(data, data + length, value) == data + expectedUpper);
+
+				auto const foundIterator = Algo::BinaryFind(sorted.Begin(), sorted.End(), value);
+				if (expectedLower != expectedUpper)
+				{
+					gd_testing_verify(foundIterator - sorted.Begin() == static_cast<PtrDiffTp>(expectedLower));
+				}
+				else
+				{
+					gd_testing_verify(foundIterator == sorted.End());
+				}
+			}
+		}
+	};
+
+	gd_testing_unit_test(AlgoLowerBoundPredicate)
+	{
+		// Descending order with the reversed predicate.
+		Int32 const sorted[] = { 9, 7, 7, 5, 3, 1 };
+		auto const greater = [](Int32 const lhs, Int32 const rhs) { return lhs > rhs; };
+		gd_testing_verify(Algo::LowerBound(sorted, sorted + 6, 7, greater) == sorted + 1);
+		gd_testing_verify(Algo::UpperBound(sorted, sorted + 6, 7, greater) == sorted + 3);
+		gd_testing_verify(Algo::LowerBound(sorted, sorted + 6, 0, greater) == sorted + 6);
+		gd_testing_verify(Algo::UpperBound(sorted, sorted + 6, 10, greater) == sorted);
+	};
+
+	// Generates adversarial inputs for the sorting algorithms.
+	GDINL static void GenerateSortInput(Vector<Int32>& elements, SizeTp const kind, SizeTp const length)
+	{
+		elements.Emptify();
+		UInt32 random = 1;
+		for (SizeTp cnt = 0; cnt < length; ++cnt)
+		{
+			random = random * 1664525 + 1013904223;
+			auto const index = static_cast<Int32>(cnt);
+			switch (kind)
+			{
+				case 0: elements.InsertLast(static_cast<Int32>(random >> 8)); break;			// Random.
+				case 1: elements.InsertLast(index); break;										// Sorted.
+				case 2: elements.InsertLast(-index); break;										// Reversed.
+				case 3: elements.InsertLast(42); break;											// Equal.
+				case 4: elements.InsertLast(static_cast<Int32>(random >> 8) % 4); break;		// Few unique.
+				case 5: elements.InsertLast(Min(index, static_cast<Int32>(length) - index)); break;	// Organ pipe.
+				case 6: elements.InsertLast(index % 2 == 0 ? index : static_cast<Int32>(length) + index); break;	// Sawtooth.
+				default: elements.InsertLast(cnt % 100 == 0 ? -index : index); break;			// Sorted with the noise.
+			}
+		}
+	}
+
+	gd_testing_unit_test(AlgoUnstableSortAdversarial)
+	{
+		Vector<Int32> elements;
+		for (SizeTp kind = 0; kind < 8; ++kind)
+		{
+			for (SizeTp length : { 0, 1, 2, 3, 17, 100, 1000, 20000 })
+			{
+				GenerateSortInput(elements, kind, length);
+				Int64 expectedSum = 0;
+				for (auto const element : elements)
+				{
+					expectedSum += element;
+				}
+
+				// Number of comparisons should be O(n log n) for any input.
+				SizeTp comparisons = 0;
+				Algo::UnstableSort(elements.Begin(), elements.End(), [&comparisons](Int32 const lhs, Int32 const rhs)
+				{
+					++comparisons;
+					return lhs < rhs;
+				});
+				SizeTp lengthLog = 1;
+				for (auto distance = length; distance > 1; distance /= 2)
+				{
+					++lengthLog;
+				}
+				gd_testing_verify(comparisons <= 8 * length * lengthLog);
+
+				Int64 sum = 0;
+				for (SizeTp cnt = 0; cnt < length; ++cnt)
+				{
+					gd_testing_verify(cnt == 0 || !(elements[cnt] < elements[cnt - 1]));
+					sum += elements[cnt];
+				}
+				gd_testing_verify(sum == expectedSum);
+			}
+		}
+	};
+
+	gd_testing_unit_test(AlgoStableSort)
+	{
+		Vector<Int32> elements;
+		for (SizeTp kind = 0; kind < 8; ++kind)
+		{
+			for (SizeTp length : { 0, 1, 2, 3, 17, 100, 1000, 20000 })
+			{
+				// Elements are sorted by the low bits only, high bits keep the original index.
+				GenerateSortInput(elements, kind, length);
+				for (SizeTp cnt = 0; cnt < length; ++cnt)
+				{
+					elements[cnt] = static_cast<Int32>((cnt << 8) | (elements[cnt] & 0xFF));
+				}
+				Algo::StableSort(elements.Begin(), elements.End(), [](Int32 const lhs, Int32 const rhs)
+				{
+					return (lhs & 0xFF) < (rhs & 0xFF);
+				});
+				for (SizeTp cnt = 1; cnt < length; ++cnt)
+				{
+					auto const lhs = elements[cnt - 1], rhs = elements[cnt];
+					gd_testing_verify((lhs & 0xFF) < (rhs & 0xFF) || ((lhs & 0xFF) == (rhs & 0xFF) && lhs < rhs));
+				}
+			}
+		}
+	};
+
+	gd_testing_unit_test(AlgoStableSortStrings)
+	{
+		// Non-trivially movable elements.
+		Vector<String> elements;
+		for (Int32 cnt = 0; cnt < 1000; ++cnt)
+		{
+			elements.InsertLast(String::FromInt64((cnt * 7919) % 1000));
+		}
+		Algo::StableSort(elements);
+		for (SizeTp cnt = 1; cnt < elements.GetLength(); ++cnt)
+		{
+			gd_testing_verify(elements[cnt - 1] < elements[cnt]);
+		}
+		Algo::UnstableSort(elements.Begin(), elements.End(), [](String const& lhs, String const& rhs) { return rhs < lhs; });
+		for (SizeTp cnt = 1; cnt < elements.GetLength(); ++cnt)
+		{
+			gd_testing_verify(elements[cnt] < elements[cnt - 1]);
+		}
+	};
+
+	gd_testing_unit_test(AlgoRadixSort)
+	{
+		Vector<Int32> integers;
+		for (SizeTp kind = 0; kind < 8; ++kind)
+		{
+			GenerateSortInput(integers, kind, 5000);
+			for (SizeTp cnt = 0; cnt < integers.GetLength(); cnt += 3)
+			{
+				integers[cnt] = -integers[cnt];
+			}
+			auto expected = integers;
+			Algo::UnstableSort(expected);
+			Algo::RadixSort(integers);
+			gd_testing_verify(integers == expected);
+		}
+
+		Vector<Float32> floats = { 3.5f, -1.0f, 0.0f, -1000.25f, 1e30f, -1e-30f, 2.0f, -0.5f, 1e-30f };
+		auto expectedFloats = floats;
+		Algo::UnstableSort(expectedFloats);
+		Algo::RadixSort(floats);
+		gd_testing_verify(floats == expectedFloats);
+
+		Vector<UInt64> largeIntegers = { 0xFFFFFFFFFFFFFFFFull, 0, 1ull << 40, 1ull << 63, 12345 };
+		auto expectedLargeIntegers = largeIntegers;
+		Algo::UnstableSort(expectedLargeIntegers);
+		Algo::RadixSort(largeIntegers);
+		gd_testing_verify(largeIntegers == expectedLargeIntegers);
+	};
+
+	gd_testing_unit_test(AlgoRadixSortKeySelector)
+	{
+		// Sorting is stable: elements with same keys keep their order.
+		Vector<MapPair<UInt16, String>> pairs;
+		for (Int32 cnt = 0; cnt < 1000; ++cnt)
+		{
+			pairs.InsertLast(MapPair<UInt16, String>(static_cast<UInt16>((cnt * 7919) % 300), String::FromInt64(cnt)));
+		}
+		Algo::RadixSort(pairs.Begin(), pairs.End(), [](MapPair<UInt16, String> const& pair) { return pair.Key; });
+		for (SizeTp cnt = 1; cnt < pairs.GetLength(); ++cnt)
+		{
+			auto const& lhs = pairs[cnt - 1];
+			auto const& rhs = pairs[cnt];
+			gd_testing_verify(lhs.Key < rhs.Key || (lhs.Key == rhs.Key && CString::Strtoi64(lhs.Value.CStr(), nullptr, 10) < CString::Strtoi64(rhs.Value.CStr(), nullptr, 10)));
+		}
+	};
+
+#endif	// if GD_TESTING_ENABLED
+
+GD_NAMESPACE_END
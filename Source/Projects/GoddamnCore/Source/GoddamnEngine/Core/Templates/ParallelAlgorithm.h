@@ -0,0 +1,501 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/Templates/ParallelAlgorithm.h
+ * Template algorithms, that split work across the job manager workers.
+ */
+#pragma once
+
+#include <GoddamnEngine/Include.h>
+#include <GoddamnEngine/Core/Templates/Algorithm.h>
+#include <GoddamnEngine/Core/Concurrency/JobManager.h>
+
+GD_NAMESPACE_BEGIN
+
+	namespace Algo
+	{
+		// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+		// Parallel sorting algorithms.
+		// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+		//! Maximal amount of jobs, parallel algorithms split the work into.
+		SizeTp static const ParallelMaxJobs = 64;
+
+		//! Minimal amount of elements, processed by a single job. Shorter ranges are processed sequentially.
+		SizeTp static const ParallelMinElementsPerJob = 8192;
+
+		// ------------------------------------------------------------------------------------------
+		// Computes amount of jobs, the range of the specified length is split into.
+		GDINL static SizeTp _ParallelNumJobs(SizeTp const length, SizeTp const maxNumJobs)
+		{
+			// Calling thread executes jobs too.
+			auto const numJobs = maxNumJobs != 0 ? maxNumJobs : JobManager::GetNumWorkerThreads() + 1;
+			return Min(Min(numJobs, ParallelMaxJobs), length / ParallelMinElementsPerJob);
+		}
+
+		// ------------------------------------------------------------------------------------------
+		// Job delegate, that executes the job function with the job index.
+		template<typename TJobFunction>
+		GDINT static void _ParallelForDelegate(JobManager::JobDelegateArgs* const delegateArgs)
+		{
+			using JobDelegateArgsWrap = JobManager::JobDelegateArgsWrap2<TJobFunction const*, SizeTp>;
+			auto const args = reinterpret_cast<JobDelegateArgsWrap*>(delegateArgs);
+			(*args->Arg1)(args->Arg2);
+			args->~JobDelegateArgsWrap();
+		}
+
+		// ------------------------------------------------------------------------------------------
+		// Executes the job function for each job index and waits for completion. 
+		// First job is executed on the calling thread.
+		template<typename TJobFunction>
+		GDINL static void _ParallelFor(SizeTp const numJobs, TJobFunction const& jobFunction)
+		{
+			// Job functions are lambdas, that could not be passed through the 'GD_SUBMIT_PARALLEL_JOB*' macros,
+			// so jobs are constructed manually.
+			JobManager::ParallelJobList jobList;
+			for (SizeTp jobIndex = 1; jobIndex < numJobs; ++jobIndex)
+			{
+				JobManager::Job job = {};
+				job.Delegate = &_ParallelForDelegate<TJobFunction>;
+				new (&job.DelegateArgs) JobManager::JobDelegateArgsWrap2<TJobFunction const*, SizeTp>(&jobFunction, jobIndex);
+				jobList.SubmitJob(job);
+			}
+			jobFunction(0);
+			jobList.Wait();
+		}
+
+		// ------------------------------------------------------------------------------------------
+		// Moves element into either uninitialized or initialized destination.
+		template<bool TConstruct, typename TIterator, typename TElement>
+		GDINL static void _MoveToIterator(TIterator const destinationIterator, TElement& element)
+		{
+			if (TConstruct)
+			{
+				InitializeIterator(destinationIterator, Utils::Move(element));
+			}
+			else
+			{
+				*destinationIterator = Utils::Move(element);
+			}
+		}
+
+		// ------------------------------------------------------------------------------------------
+		// Returns amount of the elements of the first run among the first merged elements.
+		// Elements of the first run win ties.
+		template<typename TIterator, typename TLessPredicate>
+		GDINL static SizeTp _MergeCoRank(SizeTp const mergedLength, TIterator const firstIterator, SizeTp const firstLength
+			, TIterator const secondIterator, SizeTp const secondLength, TLessPredicate const& lessPredicate)
+		{
+			SizeTp lowIndex = mergedLength > secondLength ? mergedLength - secondLength : 0;
+			SizeTp highIndex = Min(mergedLength, firstLength);
+			while (lowIndex < highIndex)
+			{
+				auto const middleIndex = (lowIndex + highIndex) / 2;
+				if (!lessPredicate(*(secondIterator + (mergedLength - middleIndex - 1)), *(firstIterator + middleIndex)))
+				{
+					lowIndex = middleIndex + 1;
+				}
+				else
+				{
+					highIndex = middleIndex;
+				}
+			}
+			return lowIndex;
+		}
+
+		// ------------------------------------------------------------------------------------------
+		// Merges pairs of the adjacent sorted runs from the source into the destination. Each job
+		// merges an equal part of the output, so all jobs are busy even when few runs are left.
+		template<bool TConstruct, typename TSourceIterator, typename TDestinationIterator, typename TLessPredicate>
+		GDINL static void _ParallelMergeRuns(TSourceIterator const sourceIterator, TDestinationIterator const destinationIterator
+			, SizeTp const length, SizeTp const* const runBounds, SizeTp const numRuns, SizeTp const numJobs, TLessPredicate const& lessPredicate)
+		{
+			// Parts of the output are projected onto the runs before merging, 
+			// because merging moves the elements out of the runs.
+			SizeTp firstRunSplits[ParallelMaxJobs + 1] = {};
+			for (SizeTp jobIndex = 0; jobIndex < numJobs; ++jobIndex)
+			{
+				auto const outputStart = jobIndex * length / numJobs;
+				for (SizeTp runIndex = 0; runIndex < numRuns; runIndex += 2)
+				{
+					auto const pairStart = runBounds[runIndex];
+					auto const pairMiddle = runBounds[Min(runIndex + 1, numRuns)];
+					auto const pairEnd = runBounds[Min(runIndex + 2, numRuns)];
+					if (outputStart < pairEnd)
+					{
+						firstRunSplits[jobIndex] = _MergeCoRank(outputStart - pairStart, sourceIterator + pairStart, pairMiddle - pairStart
+							, sourceIterator + pairMiddle, pairEnd - pairMiddle, lessPredicate);
+						break;
+					}
+				}
+			}
+
+			_ParallelFor(numJobs, [&](SizeTp const jobIndex)
+			{
+				auto const outputStart = jobIndex * length / numJobs;
+				auto const outputEnd = (jobIndex + 1) * length / numJobs;
+				for (SizeTp runIndex = 0; runIndex < numRuns; runIndex += 2)
+				{
+					auto const pairStart = runBounds[runIndex];
+					auto const pairMiddle = runBounds[Min(runIndex + 1, numRuns)];
+					auto const pairEnd = runBounds[Min(runIndex + 2, numRuns)];
+					if (pairEnd <= outputStart)
+					{
+						continue;
+					}
+					if (pairStart >= outputEnd)
+					{
+						break;
+					}
+
+					auto const mergedStart = Max(outputStart, pairStart) - pairStart;
+					auto const mergedEnd = Min(outputEnd, pairEnd) - pairStart;
+					auto const firstStart = outputStart > pairStart ? firstRunSplits[jobIndex] : 0;
+					auto const firstEnd = outputEnd < pairEnd ? firstRunSplits[jobIndex + 1] : pairMiddle - pairStart;
+
+					auto firstIterator = sourceIterator + (pairStart + firstStart);
+					auto secondIterator = sourceIterator + (pairMiddle + mergedStart - firstStart);
+					auto const firstEndIterator = sourceIterator + (pairStart + firstEnd);
+					auto const secondEndIterator = sourceIterator + (pairMiddle + mergedEnd - firstEnd);
+					auto mergeDestination = destinationIterator + (pairStart + mergedStart);
+					while (firstIterator != firstEndIterator && secondIterator != secondEndIterator)
+					{
+						if (lessPredicate(*secondIterator, *firstIterator))
+						{
+							_MoveToIterator<TConstruct>(mergeDestination, *secondIterator);
+							++secondIterator;
+						}
+						else
+						{
+							_MoveToIterator<TConstruct>(mergeDestination, *firstIterator);
+							++firstIterator;
+						}
+						++mergeDestination;
+					}
+					for (; firstIterator != firstEndIterator; ++firstIterator, ++mergeDestination)
+					{
+						_MoveToIterator<TConstruct>(mergeDestination, *firstIterator);
+					}
+					for (; secondIterator != secondEndIterator; ++secondIterator, ++mergeDestination)
+					{
+						_MoveToIterator<TConstruct>(mergeDestination, *secondIterator);
+					}
+				}
+			});
+		}
+
+		// ------------------------------------------------------------------------------------------
+		// Moves the buffer back into the range in parallel and frees it.
+		template<typename TRandomAccessIterator, typename TElement>
+		GDINL static void _ParallelMoveFromBuffer(TRandomAccessIterator const startIterator, TElement* const buffer
+			, SizeTp const length, SizeTp const numJobs, bool const isSortedInBuffer)
+		{
+			_ParallelFor(numJobs, [&](SizeTp const jobIndex)
+			{
+				auto const chunkStart = jobIndex * length / numJobs;
+				auto const chunkEnd = (jobIndex + 1) * length / numJobs;
+				if (isSortedInBuffer)
+				{
+					for (auto index = chunkStart; index < chunkEnd; ++index)
+					{
+						*(startIterator + index) = Utils::Move(buffer[index]);
+					}
+				}
+				DeinitializeRange(buffer + chunkStart, buffer + chunkEnd);
+			});
+			GD_FREE(buffer);
+		}
+
+		// ------------------------------------------------------------------------------------------
+		// Sorts the chunks of the range in parallel and then merges them in parallel rounds.
+		// Merging is stable, so stability depends only on the sorting of the chunks.
+		template<bool TStable, typename TRandomAccessIterator, typename TLessPredicate>
+		GDINL static void _ParallelMergeSort(TRandomAccessIterator const startIterator, SizeTp const length
+			, SizeTp const numJobs, TLessPredicate const& lessPredicate)
+		{
+			using ElementType = TypeTraits::RemoveReference<decltype(*startIterator)>;
+
+			SizeTp runBounds[ParallelMaxJobs + 1];
+			for (SizeTp jobIndex = 0; jobIndex <= numJobs; ++jobIndex)
+			{
+				runBounds[jobIndex] = jobIndex * length / numJobs;
+			}
+			_ParallelFor(numJobs, [&](SizeTp const jobIndex)
+			{
+				auto const runStartIterator = startIterator + runBounds[jobIndex];
+				auto const runEndIterator = startIterator + runBounds[jobIndex + 1];
+				if (TStable)
+				{
+					StableSort(runStartIterator, runEndIterator, lessPredicate);
+				}
+				else
+				{
+					UnstableSort(runStartIterator, runEndIterator, lessPredicate);
+				}
+			});
+
+			// Runs are moved into the uninitialized buffer on the first round and then 
+			// they are moved back and forth between the range and the buffer.
+			auto const buffer = GD_MALLOC_ARRAY_T(ElementType, length);
+			auto isSortedInBuffer = false;
+			for (auto numRuns = numJobs; numRuns > 1; numRuns = (numRuns + 1) / 2)
+			{
+				if (isSortedInBuffer)
+				{
+					_ParallelMergeRuns<false>(buffer, startIterator, length, runBounds, numRuns, numJobs, lessPredicate);
+				}
+				else if (numRuns == numJobs)
+				{
+					_ParallelMergeRuns<true>(startIterator, buffer, length, runBounds, numRuns, numJobs, lessPredicate);
+				}
+				else
+				{
+					_ParallelMergeRuns<false>(startIterator, buffer, length, runBounds, numRuns, numJobs, lessPredicate);
+				}
+				isSortedInBuffer = !isSortedInBuffer;
+
+				for (SizeTp runIndex = 0; runIndex < numRuns; runIndex += 2)
+				{
+					runBounds[runIndex / 2] = runBounds[runIndex];
+				}
+				runBounds[(numRuns + 1) / 2] = length;
+			}
+			_ParallelMoveFromBuffer(startIterator, buffer, length, numJobs, isSortedInBuffer);
+		}
+
+		// ------------------------------------------------------------------------------------------
+		//! Performs unstable sorting of Iterator range, splitting the work across the job manager workers.
+		//! The range is split into chunks, which are sorted independently and then merged in parallel.
+		//! Short ranges are sorted sequentially. Sorting temporary allocates buffer for the whole range.
+		//! Should not be called from the jobs.
+		//! @param startIterator Start of the iterators range.
+		//! @param endIterator End of the iterators range.
+		//! @param lessPredicate Binary predicate that determines, whether m_Left expression is less than m_Right.
+		//! @param maxNumJobs Maximal amount of jobs, including the calling thread. Zero means all workers.
+		//! @{
+		template<typename TRandomAccessIterator, typename TLessPredicate
+	#if !GD_DOCUMENTATION
+			, typename = typename EnableIf<IteratorTraits<TRandomAccessIterator>::IsRandomAccess>::Type
+	#endif	// if !GD_DOCUMENTATION
+		>
+		GDINL static void ParallelSort(TRandomAccessIterator const startIterator, TRandomAccessIterator const endIterator
+			, TLessPredicate const& lessPredicate, SizeTp const maxNumJobs = 0)
+		{
+			SizeTp const length = endIterator - startIterator;
+			auto const numJobs = _ParallelNumJobs(length, maxNumJobs);
+			if (numJobs < 2)
+			{
+				UnstableSort(startIterator, endIterator, lessPredicate);
+				return;
+			}
+			_ParallelMergeSort<false>(startIterator, length, numJobs, lessPredicate);
+		}
+		template<typename TRandomAccessIterator>
+		GDINL static void ParallelSort(TRandomAccessIterator const startIterator, TRandomAccessIterator const endIterator)
+		{
+			using ElementType = TypeTraits::RemoveReference<decltype(*startIterator)>;
+			ParallelSort(startIterator, endIterator, TLess<ElementType>());
+		}
+		//! @}
+
+		// ------------------------------------------------------------------------------------------
+		//! Performs unstable sorting of the container, splitting the work across the job manager workers.
+		//! @param container The container to be sorted.
+		template<typename TContainer>
+		GDINL static void ParallelSort(TContainer& container)
+		{
+			ParallelSort(Begin(container), End(container));
+		}
+
+		// ------------------------------------------------------------------------------------------
+		//! Performs stable sorting of Iterator range, splitting the work across the job manager workers.
+		//! The range is split into chunks, which are sorted independently and then merged in parallel.
+		//! Short ranges are sorted sequentially. Sorting temporary allocates buffer for the whole range.
+		//! Should not be called from the jobs.
+		//! @param startIterator Start of the iterators range.
+		//! @param endIterator End of the iterators range.
+		//! @param lessPredicate Binary predicate that determines, whether m_Left expression is less than m_Right.
+		//! @param maxNumJobs Maximal amount of jobs, including the calling thread. Zero means all workers.
+		//! @{
+		template<typename TRandomAccessIterator, typename TLessPredicate
+	#if !GD_DOCUMENTATION
+			, typename = typename EnableIf<IteratorTraits<TRandomAccessIterator>::IsRandomAccess>::Type
+	#endif	// if !GD_DOCUMENTATION
+		>
+		GDINL static void ParallelStableSort(TRandomAccessIterator const startIterator, TRandomAccessIterator const endIterator
+			, TLessPredicate const& lessPredicate, SizeTp const maxNumJobs = 0)
+		{
+			SizeTp const length = endIterator - startIterator;
+			auto const numJobs = _ParallelNumJobs(length, maxNumJobs);
+			if (numJobs < 2)
+			{
+				StableSort(startIterator, endIterator, lessPredicate);
+				return;
+			}
+			_ParallelMergeSort<true>(startIterator, length, numJobs, lessPredicate);
+		}
+		template<typename TRandomAccessIterator>
+		GDINL static void ParallelStableSort(TRandomAccessIterator const startIterator, TRandomAccessIterator const endIterator)
+		{
+			using ElementType = TypeTraits::RemoveReference<decltype(*startIterator)>;
+			ParallelStableSort(startIterator, endIterator, TLess<ElementType>());
+		}
+		//! @}
+
+		// ------------------------------------------------------------------------------------------
+		//! Performs stable sorting of the container, splitting the work across the job manager workers.
+		//! @param container The container to be sorted.
+		template<typename TContainer>
+		GDINL static void ParallelStableSort(TContainer& container)
+		{
+			ParallelStableSort(Begin(container), End(container));
+		}
+
+		// ------------------------------------------------------------------------------------------
+		//! Performs stable least significant digit radix sorting of Iterator range by the extracted keys,
+		//! splitting the work across the job manager workers. Each job computes histograms of its chunk,
+		//! so that all jobs could scatter their elements simultaneously. Short ranges are sorted sequentially.
+		//! Should not be called from the jobs.
+		//! @param startIterator Start of the iterators range.
+		//! @param endIterator End of the iterators range.
+		//! @param keySelector Function that returns sorting key of the element.
+		//! @param maxNumJobs Maximal amount of jobs, including the calling thread. Zero means all workers.
+		//! @{
+		template<typename TRandomAccessIterator, typename TKeySelector
+	#if !GD_DOCUMENTATION
+			, typename = typename EnableIf<IteratorTraits<TRandomAccessIterator>::IsRandomAccess>::Type
+	#endif	// if !GD_DOCUMENTATION
+		>
+		GDINL static void ParallelRadixSort(TRandomAccessIterator const startIterator, TRandomAccessIterator const endIterator
+			, TKeySelector const& keySelector, SizeTp const maxNumJobs = 0)
+		{
+			using ElementType = TypeTraits::RemoveReference<decltype(*startIterator)>;
+			using KeyType = TypeTraits::Decay<decltype(keySelector(*startIterator))>;
+			using HistogramsType = SizeTp[sizeof(KeyType)][256];
+			static_assert(TypeTraits::IsIntegral<KeyType>::Value || TypeTraits::IsFloatingPoint<KeyType>::Value, "Radix sorting keys should be integers or floating point numbers.");
+
+			SizeTp const length = endIterator - startIterator;
+			auto const numJobs = _ParallelNumJobs(length, maxNumJobs);
+			if (numJobs < 2)
+			{
+				RadixSort(startIterator, endIterator, keySelector);
+				return;
+			}
+
+			// Histograms of all key bytes of all chunks are computed in a single pass.
+			auto const jobHistograms = reinterpret_cast<HistogramsType*>(GD_MALLOC_ARRAY_T(SizeTp, numJobs * sizeof(KeyType) * 256));
+			auto const jobOffsets = reinterpret_cast<SizeTp(*)[256]>(GD_MALLOC_ARRAY_T(SizeTp, numJobs * 256));
+			_ParallelFor(numJobs, [&](SizeTp const jobIndex)
+			{
+				auto& histograms = jobHistograms[jobIndex];
+				CMemory::Memset(histograms, 0, sizeof histograms);
+				auto const chunkEndIterator = startIterator + (jobIndex + 1) * length / numJobs;
+				for (auto iterator = startIterator + jobIndex * length / numJobs; iterator != chunkEndIterator; ++iterator)
+				{
+					auto const key = _ToRadixKey(keySelector(*iterator));
+					for (SizeTp byteIndex = 0; byteIndex < sizeof(KeyType); ++byteIndex)
+					{
+						++histograms[byteIndex][(key >> (8 * byteIndex)) & 0xFF];
+					}
+				}
+			});
+
+			ElementType* buffer = nullptr;
+			auto isSortedInBuffer = false;
+			auto const firstKey = _ToRadixKey(keySelector(*startIterator));
+			for (SizeTp byteIndex = 0; byteIndex < sizeof(KeyType); ++byteIndex)
+			{
+				SizeTp firstKeyBucketLength = 0;
+				for (SizeTp jobIndex = 0; jobIndex < numJobs; ++jobIndex)
+				{
+					firstKeyBucketLength += jobHistograms[jobIndex][byteIndex][(firstKey >> (8 * byteIndex)) & 0xFF];
+				}
+				if (firstKeyBucketLength == length)
+				{
+					continue;
+				}
+
+				// Elements were moved since the histograms were computed, so the chunks are recounted.
+				if (buffer != nullptr)
+				{
+					_ParallelFor(numJobs, [&](SizeTp const jobIndex)
+					{
+						auto& histogram = jobHistograms[jobIndex][byteIndex];
+						CMemory::Memset(histogram, 0, sizeof histogram);
+						for (auto index = jobIndex * length / numJobs; index < (jobIndex + 1) * length / numJobs; ++index)
+						{
+							auto const& element = isSortedInBuffer ? buffer[index] : *(startIterator + index);
+							++histogram[(_ToRadixKey(keySelector(element)) >> (8 * byteIndex)) & 0xFF];
+						}
+					});
+				}
+
+				// Elements of each bucket are placed in the order of the chunks.
+				for (SizeTp bucket = 0, offset = 0; bucket < 256; ++bucket)
+				{
+					for (SizeTp jobIndex = 0; jobIndex < numJobs; ++jobIndex)
+					{
+						jobOffsets[jobIndex][bucket] = offset;
+						offset += jobHistograms[jobIndex][byteIndex][bucket];
+					}
+				}
+
+				auto const isBufferInitialized = buffer != nullptr;
+				if (!isBufferInitialized)
+				{
+					buffer = GD_MALLOC_ARRAY_T(ElementType, length);
+				}
+				_ParallelFor(numJobs, [&](SizeTp const jobIndex)
+				{
+					auto const chunkStart = jobIndex * length / numJobs;
+					auto const chunkLength = (jobIndex + 1) * length / numJobs - chunkStart;
+					if (!isBufferInitialized)
+					{
+						_RadixScatter<true>(startIterator + chunkStart, buffer, chunkLength, byteIndex, jobOffsets[jobIndex], keySelector);
+					}
+					else if (isSortedInBuffer)
+					{
+						_RadixScatter<false>(buffer + chunkStart, startIterator, chunkLength, byteIndex, jobOffsets[jobIndex], keySelector);
+					}
+					else
+					{
+						_RadixScatter<false>(startIterator + chunkStart, buffer, chunkLength, byteIndex, jobOffsets[jobIndex], keySelector);
+					}
+				});
+				isSortedInBuffer = !isSortedInBuffer;
+			}
+
+			if (buffer != nullptr)
+			{
+				_ParallelMoveFromBuffer(startIterator, buffer, length, numJobs, isSortedInBuffer);
+			}
+			GD_FREE(jobOffsets);
+			GD_FREE(jobHistograms);
+		}
+		template<typename TRandomAccessIterator>
+		GDINL static void ParallelRadixSort(TRandomAccessIterator const startIterator, TRandomAccessIterator const endIterator)
+		{
+			using ElementType = TypeTraits::RemoveReference<decltype(*startIterator)>;
+			ParallelRadixSort(startIterator, endIterator, [](ElementType const& element) { return element; });
+		}
+		//! @}
+
+		// ------------------------------------------------------------------------------------------
+		//! Performs stable radix sorting of the container of integers or floating point numbers, 
+		//! splitting the work across the job manager workers.
+		//! @param container The container to be sorted.
+		template<typename TContainer>
+		GDINL static void ParallelRadixSort(TContainer& container)
+		{
+			ParallelRadixSort(Begin(container), End(container));
+		}
+
+	}	// namespace Algo
+
+GD_NAMESPACE_END
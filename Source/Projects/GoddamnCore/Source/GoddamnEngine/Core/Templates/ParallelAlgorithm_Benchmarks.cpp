@@ -0,0 +1,91 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/Templates/ParallelAlgorithm_Benchmarks.cpp
+ * Parallel template algorithms benchmarks: scaling of the sorting with amount of jobs.
+ */
+#include <GoddamnEngine/Core/Templates/ParallelAlgorithm.h>
+#include <GoddamnEngine/Core/Containers/Vector.h>
+
+GD_NAMESPACE_BEGIN
+
+#if GD_TESTING_ENABLED
+
+	SizeTp static const ParallelSortBenchmarkLength = 1000000;
+	SizeTp static const ParallelSortBenchmarkNumJobs[] = { 1, 2, 4, 8, 16 };
+	char const* const ParallelSortBenchmarkCases[][5] = {
+		{ "ParallelSort 1M, 1 job", "ParallelSort 1M, 2 jobs", "ParallelSort 1M, 4 jobs", "ParallelSort 1M, 8 jobs", "ParallelSort 1M, 16 jobs" },
+		{ "ParallelStableSort 1M, 1 job", "ParallelStableSort 1M, 2 jobs", "ParallelStableSort 1M, 4 jobs", "ParallelStableSort 1M, 8 jobs", "ParallelStableSort 1M, 16 jobs" },
+		{ "ParallelRadixSort 1M, 1 job", "ParallelRadixSort 1M, 2 jobs", "ParallelRadixSort 1M, 4 jobs", "ParallelRadixSort 1M, 8 jobs", "ParallelRadixSort 1M, 16 jobs" },
+	};
+
+	// Typical draw list entry: sorting key and the payload.
+	struct ParallelSortBenchmarkDrawCall final
+	{
+		UInt64 SortKey;
+		UInt32 MeshIndex;
+		UInt32 MaterialIndex;
+	};	// struct ParallelSortBenchmarkDrawCall
+
+	// Measures sorting with amounts of jobs up to the amount of workers and the calling thread.
+	template<typename TElement, typename TLessPredicate, typename TKeySelector>
+	GDINL static void MeasureParallelSort(goddamn_testing::benchmark_state& state, Vector<TElement> const& unsorted
+		, TLessPredicate const& lessPredicate, TKeySelector const& keySelector)
+	{
+		// Copying of the input is included into the measurements.
+		Vector<TElement> elements;
+		auto const maxNumJobs = JobManager::GetNumWorkerThreads() + 1;
+		for (SizeTp numJobsIndex = 0; numJobsIndex < 5 && ParallelSortBenchmarkNumJobs[numJobsIndex] <= maxNumJobs; ++numJobsIndex)
+		{
+			auto const numJobs = ParallelSortBenchmarkNumJobs[numJobsIndex];
+			state.measure(ParallelSortBenchmarkCases[0][numJobsIndex], unsorted.GetLength(), [&]
+			{
+				elements = unsorted;
+				Algo::ParallelSort(elements.Begin(), elements.End(), lessPredicate, numJobs);
+			});
+			state.measure(ParallelSortBenchmarkCases[1][numJobsIndex], unsorted.GetLength(), [&]
+			{
+				elements = unsorted;
+				Algo::ParallelStableSort(elements.Begin(), elements.End(), lessPredicate, numJobs);
+			});
+			state.measure(ParallelSortBenchmarkCases[2][numJobsIndex], unsorted.GetLength(), [&]
+			{
+				elements = unsorted;
+				Algo::ParallelRadixSort(elements.Begin(), elements.End(), keySelector, numJobs);
+			});
+		}
+	}
+
+	gd_testing_benchmark(AlgoParallelSortIntegers, state)
+	{
+		Vector<UInt32> unsorted;
+		unsorted.Reserve(ParallelSortBenchmarkLength);
+		for (SizeTp cnt = 0; cnt < ParallelSortBenchmarkLength; ++cnt)
+		{
+			unsorted.InsertLast(static_cast<UInt32>(cnt * 2654435761u));
+		}
+		MeasureParallelSort(state, unsorted, TLess<UInt32>(), [](UInt32 const element) { return element; });
+	};
+
+	gd_testing_benchmark(AlgoParallelSortDrawCalls, state)
+	{
+		Vector<ParallelSortBenchmarkDrawCall> unsorted;
+		unsorted.Reserve(ParallelSortBenchmarkLength);
+		for (SizeTp cnt = 0; cnt < ParallelSortBenchmarkLength; ++cnt)
+		{
+			unsorted.InsertLast({ cnt * 0x9E3779B97F4A7C15ull, static_cast<UInt32>(cnt), static_cast<UInt32>(cnt % 64) });
+		}
+		MeasureParallelSort(state, unsorted
+			, [](ParallelSortBenchmarkDrawCall const& lhs, ParallelSortBenchmarkDrawCall const& rhs) { return lhs.SortKey < rhs.SortKey; }
+			, [](ParallelSortBenchmarkDrawCall const& drawCall) { return drawCall.SortKey; });
+	};
+
+#endif	// if GD_TESTING_ENABLED
+
+GD_NAMESPACE_END
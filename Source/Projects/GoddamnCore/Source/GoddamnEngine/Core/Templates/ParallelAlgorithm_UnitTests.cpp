@@ -0,0 +1,150 @@
+// ==========================================================================================
+// Copyright (C) Goddamn Industries 2018. All Rights Reserved.
+// 
+// This software or any its part is distributed under terms of Goddamn Industries End User
+// License Agreement. By downloading or using this software or any its part you agree with 
+// terms of Goddamn Industries End User License Agreement.
+// ==========================================================================================
+
+/*!
+ * @file GoddamnEngine/Core/Templates/ParallelAlgorithm_UnitTests.cpp
+ * Parallel template algorithms tests.
+ */
+#include <GoddamnEngine/Core/Templates/ParallelAlgorithm.h>
+#include <GoddamnEngine/Core/Containers/Vector.h>
+#include <GoddamnEngine/Core/Containers/String.h>
+#include <GoddamnEngine/Core/Containers/Map.h>
+
+GD_NAMESPACE_BEGIN
+
+#if GD_TESTING_ENABLED
+
+	// Lengths, that are sorted sequentially, split into uneven chunks and split into many chunks.
+	SizeTp static const ParallelSortTestLengths[] = { 0, 1, 1000, Algo::ParallelMinElementsPerJob * 2 + 17, Algo::ParallelMinElementsPerJob * 11 + 5 };
+	SizeTp static const ParallelSortTestNumJobs[] = { 0, 1, 2, 3, 8, 11 };
+
+	// Generates inputs for the parallel sorting algorithms.
+	GDINL static void GenerateParallelSortInput(Vector<Int32>& elements, SizeTp const kind, SizeTp const length)
+	{
+		elements.Emptify();
+		UInt32 random = 1;
+		for (SizeTp cnt = 0; cnt < length; ++cnt)
+		{
+			random = random * 1664525 + 1013904223;
+			auto const index = static_cast<Int32>(cnt);
+			switch (kind)
+			{
+				case 0: elements.InsertLast(static_cast<Int32>(random >> 8) - (1 << 23)); break;	// Random.
+				case 1: elements.InsertLast(index); break;										// Sorted.
+				case 2: elements.InsertLast(-index); break;										// Reversed.
+				case 3: elements.InsertLast(42); break;											// Equal.
+				default: elements.InsertLast(static_cast<Int32>(random >> 8) % 4); break;		// Few unique.
+			}
+		}
+	}
+
+	gd_testing_unit_test(AlgoParallelSort)
+	{
+		Vector<Int32> elements;
+		for (SizeTp kind = 0; kind < 5; ++kind)
+		{
+			for (auto const length : ParallelSortTestLengths)
+			{
+				GenerateParallelSortInput(elements, kind, length);
+				auto expected = elements;
+				Algo::UnstableSort(expected);
+				for (auto const numJobs : ParallelSortTestNumJobs)
+				{
+					auto sorted = elements;
+					Algo::ParallelSort(sorted.Begin(), sorted.End(), TLess<Int32>(), numJobs);
+					gd_testing_verify(sorted == expected);
+
+					sorted = elements;
+					Algo::ParallelRadixSort(sorted.Begin(), sorted.End(), [](Int32 const element) { return element; }, numJobs);
+					gd_testing_verify(sorted == expected);
+				}
+			}
+		}
+	};
+
+	gd_testing_unit_test(AlgoParallelStableSort)
+	{
+		Vector<Int32> elements;
+		for (SizeTp kind = 0; kind < 5; ++kind)
+		{
+			for (auto const length : ParallelSortTestLengths)
+			{
+				for (auto const numJobs : ParallelSortTestNumJobs)
+				{
+					// Elements are sorted by the low bits only, high bits keep the original index.
+					GenerateParallelSortInput(elements, kind, length);
+					for (SizeTp cnt = 0; cnt < length; ++cnt)
+					{
+						elements[cnt] = static_cast<Int32>((cnt << 8) | (elements[cnt] & 0xFF));
+					}
+					Algo::ParallelStableSort(elements.Begin(), elements.End(), [](Int32 const lhs, Int32 const rhs)
+					{
+						return (lhs & 0xFF) < (rhs & 0xFF);
+					}, numJobs);
+					for (SizeTp cnt = 1; cnt < length; ++cnt)
+					{
+						auto const lhs = elements[cnt - 1], rhs = elements[cnt];
+						gd_testing_verify((lhs & 0xFF) < (rhs & 0xFF) || ((lhs & 0xFF) == (rhs & 0xFF) && lhs < rhs));
+					}
+				}
+			}
+		}
+	};
+
+	gd_testing_unit_test(AlgoParallelSortStrings)
+	{
+		// Non-trivially movable elements.
+		SizeTp const length = Algo::ParallelMinElementsPerJob * 4;
+		Vector<MapPair<UInt16, String>> pairs;
+		for (SizeTp cnt = 0; cnt < length; ++cnt)
+		{
+			pairs.InsertLast(MapPair<UInt16, String>(static_cast<UInt16>(cnt * 7919 % 1000), String::FromInt64(cnt * 7919 % length)));
+		}
+
+		Algo::ParallelSort(pairs.Begin(), pairs.End(), [](MapPair<UInt16, String> const& lhs, MapPair<UInt16, String> const& rhs) { return lhs.Value < rhs.Value; });
+		for (SizeTp cnt = 1; cnt < length; ++cnt)
+		{
+			gd_testing_verify(pairs[cnt - 1].Value < pairs[cnt].Value);
+		}
+
+		// Sorting is stable: elements with same keys keep their order.
+		Algo::ParallelRadixSort(pairs.Begin(), pairs.End(), [](MapPair<UInt16, String> const& pair) { return pair.Key; });
+		for (SizeTp cnt = 1; cnt < length; ++cnt)
+		{
+			auto const& lhs = pairs[cnt - 1];
+			auto const& rhs = pairs[cnt];
+			gd_testing_verify(lhs.Key < rhs.Key || (lhs.Key == rhs.Key && lhs.Value < rhs.Value));
+		}
+	};
+
+	gd_testing_unit_test(AlgoParallelRadixSortKeys)
+	{
+		SizeTp const length = Algo::ParallelMinElementsPerJob * 4;
+		Vector<Float64> floats;
+		Vector<UInt64> largeIntegers;
+		for (SizeTp cnt = 0; cnt < length; ++cnt)
+		{
+			auto const random = static_cast<UInt64>(cnt) * 0x9E3779B97F4A7C15ull;
+			floats.InsertLast(static_cast<Float64>(static_cast<Int64>(random)) * 1e-10);
+			largeIntegers.InsertLast(random);
+		}
+
+		auto expectedFloats = floats;
+		Algo::UnstableSort(expectedFloats);
+		Algo::ParallelRadixSort(floats);
+		gd_testing_verify(floats == expectedFloats);
+
+		auto expectedLargeIntegers = largeIntegers;
+		Algo::UnstableSort(expectedLargeIntegers);
+		Algo::ParallelRadixSort(largeIntegers);
+		gd_testing_verify(largeIntegers == expectedLargeIntegers);
+	};
+
+#endif	// if GD_TESTING_ENABLED
+
+GD_NAMESPACE_END
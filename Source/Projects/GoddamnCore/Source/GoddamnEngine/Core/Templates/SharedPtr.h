@@ -277,6 +277,14 @@ GD_NAMESPACE_BEGIN
 
 	};	// struct SharedPtr<TPointee>
 
+	namespace TypeTraits
+	{
+		// Shared pointer is a plain pointer, so it can be relocated without touching the reference counter.
+		template<typename TPointee, typename TCast>
+		struct IsTriviallyRelocatable<SharedPtr<TPointee, TCast>> : public Internal::TypeTraitsBase<true>
+		{};
+	}	// namespace TypeTraits
+
 	/*!
 	 * Creates a shared pointer.
 	 * @param pointee Raw pointer.
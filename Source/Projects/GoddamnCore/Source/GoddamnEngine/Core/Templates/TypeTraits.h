@@ -542,6 +542,26 @@ GD_NAMESPACE_BEGIN
 		struct IsPOD final : public Internal::TypeTraitsBase<__is_pod(TType)>
 		{};
 
+		/*!
+		 * Checks if type can be copied with a plain memory copy.
+		 * @tparam TType Type to perform checks on.
+		 */
+		template<typename TType>
+		struct IsTriviallyCopyable final : public Internal::TypeTraitsBase<__is_trivially_copyable(TType)>
+		{};
+
+		/*!
+		 * Checks if object of the type can be moved to another address with a plain memory copy,
+		 * without calling move constructor and destructor. This is true for the trivially copyable types
+		 * and for the types that do not store pointers to themselves, like the handles and the heap-based containers.
+		 * Should be specialized for such types.
+		 *
+		 * @tparam TType Type to perform checks on.
+		 */
+		template<typename TType>
+		struct IsTriviallyRelocatable : public Internal::TypeTraitsBase<__is_trivially_copyable(TType)>
+		{};
+
 		/*!
 		 * Checks if type is contains pure virtual methods.
 		 * @tparam TType Type to perform checks on.
@@ -13,6 +13,7 @@
 #pragma once
 
 #include <GoddamnEngine/Include.h>
+#include <GoddamnEngine/Core/Templates/TypeTraits.h>
 
 GD_NAMESPACE_BEGIN
 
@@ -175,6 +176,14 @@ GD_NAMESPACE_BEGIN
 
 	};	// class UniquePtr 
 
+	namespace TypeTraits
+	{
+		// Unique pointer is a plain pointer, so it can be relocated without resetting the source.
+		template<typename TPointee>
+		struct IsTriviallyRelocatable<UniquePtr<TPointee>> : public Internal::TypeTraitsBase<true>
+		{};
+	}	// namespace TypeTraits
+
 	/*!
 	 * Creates a unique pointer.
 	 * @param pointee Raw pointer.
@@ -185,6 +185,14 @@ GD_NAMESPACE_BEGIN
 
 	};	// struct Pair
 
+	namespace TypeTraits
+	{
+		template<typename TFirst, typename TSecond>
+		struct IsTriviallyRelocatable<Pair<TFirst, TSecond>> 
+			: public Internal::TypeTraitsBase<IsTriviallyRelocatable<TFirst>::Value && IsTriviallyRelocatable<TSecond>::Value>
+		{};
+	}	// namespace TypeTraits
+
 	/*!
 	 * Initializes a First-Second pair with specified parameters.
 	 *
@@ -12,6 +12,10 @@
  */
 #include "Testing.h"
 #include "GoddamnEngine/Include.h"
+#include "GoddamnEngine/Core/Misc/MemoryTracker.h"
+
+#include <cstdio>
+#include <cstdlib>
 
 GD_NAMESPACE_BEGIN
 	class TestPlatformAssert final : public IPlatformAssert
@@ -64,4 +68,105 @@ namespace goddamn_testing
 		//}
 	}
 
+	// Writes results of the benchmarks into the file, specified by the GD_BENCHMARKING_JSON environment variable.
+	struct benchmark_json_writer final
+	{
+	private:
+		FILE* m_file;
+		bool  m_is_first_record;
+
+	public:
+		benchmark_json_writer()
+			: m_file(nullptr), m_is_first_record(true)
+		{
+			auto const filename = getenv("GD_BENCHMARKING_JSON");
+			if (filename != nullptr && *filename != '\0')
+			{
+				m_file = fopen(filename, "w");
+				if (m_file != nullptr)
+				{
+					fputs("[\n", m_file);
+				}
+			}
+		}
+
+		~benchmark_json_writer()
+		{
+			if (m_file != nullptr)
+			{
+				fputs("\n]\n", m_file);
+				fclose(m_file);
+			}
+		}
+
+		void write(char const* const benchmark_name, char const* const case_name, unsigned long long const items_count
+			, unsigned long long const nanoseconds, unsigned long long const allocated_bytes)
+		{
+			if (m_file != nullptr)
+			{
+				fputs(m_is_first_record ? "\t{ \"benchmark\": " : ",\n\t{ \"benchmark\": ", m_file);
+				write_string(benchmark_name);
+				fputs(", \"case\": ", m_file);
+				write_string(case_name);
+				fprintf(m_file, ", \"items\": %llu, \"nanoseconds\": %llu, \"nanoseconds_per_item\": %.3f, \"allocated_bytes\": %llu, \"allocated_bytes_per_item\": %.3f }"
+					, items_count, nanoseconds, per_item(nanoseconds, items_count), allocated_bytes, per_item(allocated_bytes, items_count));
+				m_is_first_record = false;
+			}
+		}
+
+		static double per_item(unsigned long long const value, unsigned long long const items_count)
+		{
+			return items_count != 0 ? static_cast<double>(value) / static_cast<double>(items_count) : 0.0;
+		}
+
+	private:
+		void write_string(char const* text)
+		{
+			fputc('"', m_file);
+			for (; *text != '\0'; ++text)
+			{
+				if (*text == '"' || *text == '\\')
+				{
+					fputc('\\', m_file);
+				}
+				fputc(*text, m_file);
+			}
+			fputc('"', m_file);
+		}
+	};	// struct benchmark_json_writer
+
+	gdt_api unsigned long long benchmark_state::allocated_bytes()
+	{
+		auto bytes = 0ull;
+		for (GD::SizeTp tag = 0; tag < static_cast<GD::SizeTp>(GD::MemoryTag::Count); ++tag)
+		{
+			bytes += GD::MemoryTracker::GetCounters(static_cast<GD::MemoryTag>(tag)).TotalBytes;
+		}
+		return bytes;
+	}
+
+	gdt_api void benchmark_state::report(char const* const case_name, unsigned long long const items_count, unsigned long long const nanoseconds, unsigned long long const allocated_bytes) const
+	{
+		static benchmark_json_writer json_writer;
+		json_writer.write(m_benchmark_name, case_name, items_count, nanoseconds, allocated_bytes);
+
+		auto const milliseconds = static_cast<double>(nanoseconds) / 1000000.0;
+		auto const items_per_second = nanoseconds != 0 ? static_cast<double>(items_count) * 1000000000.0 / static_cast<double>(nanoseconds) : 0.0;
+		printf("[benchmark] %s/%s: %.3f ms, %.2f M items/s, %.2f ns/item, %llu bytes allocated\n", m_benchmark_name, case_name
+			, milliseconds, items_per_second / 1000000.0, benchmark_json_writer::per_item(nanoseconds, items_count), allocated_bytes);
+	}
+
+	gdt_api benchmark::benchmark(char const* const benchmark_name, benchmark_function const benchmark_function)
+	{
+#if GD_BENCHMARKING_ENABLED
+		static GD::TestPlatformAssert TestPlatformAssert;
+		GD::IPlatformAssert::Push(TestPlatformAssert);
+		benchmark_state state(benchmark_name);
+		benchmark_function(state);
+		GD::IPlatformAssert::Pop();
+#else	// if GD_BENCHMARKING_ENABLED
+		(void)benchmark_name, benchmark_function;
+#endif	// if GD_BENCHMARKING_ENABLED
+	}
+
 }	// namespace goddamn_testing
@@ -22,6 +22,7 @@
 #endif
 
 #include <exception>
+#include <chrono>
 
 // **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
 // ******                                 Testing core.                                    ******
@@ -133,6 +134,107 @@ namespace goddamn_testing
 
 }	// namespace goddamn_testing
 
+// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+// ******                                 Benchmarking.                                    ******
+// **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
+
+/*!
+ * Defines a benchmark.
+ * Benchmarks are compiled together with the unit tests, but are executed only if 
+ * GD_BENCHMARKING_ENABLED is set, since they take much more time.
+ *
+ * Each case reports time per item and the number of bytes, allocated by a single run through
+ * the engine allocators.
+ * If the GD_BENCHMARKING_JSON environment variable is set, results are also written to the
+ * JSON file with the specified name, so that they can be compared between revisions.
+ *
+ * A simple example for using benchmarks:
+ * @code
+ *     gd_testing_benchmark(AVerySimpleBenchmark, state)
+ *     {
+ *         state.measure("Case", 1000, [] { for (int i = 0; i < 1000; ++i) DoSomething(); });
+ *     };
+ * @endcode
+ */
+#define gd_testing_benchmark(benchmark_name, state_name) \
+	static ::goddamn_testing::benchmark benchmark ## benchmark_name = ::goddamn_testing::benchmark_declaration(#benchmark_name) \
+		<< (::goddamn_testing::benchmark_function)[](::goddamn_testing::benchmark_state& state_name)
+
+namespace goddamn_testing
+{
+
+	/*!
+	 * Measures cases of a single benchmark.
+	 */
+	struct benchmark_state final
+	{
+	private:
+		char const* m_benchmark_name;
+
+	public:
+		explicit benchmark_state(char const* const benchmark_name)
+			: m_benchmark_name(benchmark_name)
+		{}
+
+		/*!
+		 * Runs specified case several times and reports the best time.
+		 *
+		 * @param case_name Name of the case.
+		 * @param items_count Number of items processed by a single run, used to compute throughput.
+		 * @param case_function Function to measure.
+		 * @param repetitions Number of the runs.
+		 */
+		template<typename TFunc>
+		void measure(char const* const case_name, unsigned long long const items_count, TFunc const& case_function, unsigned const repetitions = 5)
+		{
+			auto best_nanoseconds = ~0ull;
+			auto best_allocated_bytes = 0ull;
+			for (unsigned repetition = 0; repetition < repetitions; ++repetition)
+			{
+				auto const start_allocated_bytes = allocated_bytes();
+				auto const start = std::chrono::high_resolution_clock::now();
+				case_function();
+				auto const nanoseconds = static_cast<unsigned long long>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - start).count());
+				if (nanoseconds < best_nanoseconds)
+				{
+					best_nanoseconds = nanoseconds;
+					best_allocated_bytes = allocated_bytes() - start_allocated_bytes;
+				}
+			}
+			report(case_name, items_count, best_nanoseconds, best_allocated_bytes);
+		}
+
+	private:
+		gdt_api static unsigned long long allocated_bytes();
+		gdt_api void report(char const* const case_name, unsigned long long const items_count, unsigned long long const nanoseconds, unsigned long long const allocated_bytes) const;
+	};	// struct benchmark_state
+
+	using benchmark_function = void(*)(benchmark_state&);
+
+	struct benchmark final
+	{
+	public:
+		gdt_api benchmark(char const* const benchmark_name, benchmark_function const benchmark_function);
+	};	// struct benchmark
+
+	struct benchmark_declaration final
+	{
+	private:
+		char const* m_benchmark_name;
+
+	public:
+		explicit benchmark_declaration(char const* const benchmark_name)
+			: m_benchmark_name(benchmark_name)
+		{}
+
+		benchmark operator<< (benchmark_function const benchmark_function) const
+		{
+			return benchmark(m_benchmark_name, benchmark_function);
+		}
+	};	// struct benchmark_declaration
+
+}	// namespace goddamn_testing
+
 // **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
 // ******                              Testing utilities.                                  ******
 // **~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~**
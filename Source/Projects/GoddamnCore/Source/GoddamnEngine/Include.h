@@ -141,6 +141,10 @@ constexpr static void NotUsedConstexpr(T...) {}
 #define GD_TESTING_ENABLED 1
 #endif	// ifndef GD_TESTING_ENABLED
 
+#ifndef GD_BENCHMARKING_ENABLED
+#define GD_BENCHMARKING_ENABLED 0
+#endif	// ifndef GD_BENCHMARKING_ENABLED
+
 #include <GoddamnEngine/Core/Base/Version.h>
 #if !GD_RESOURCE_COMPILER
 #	if GD_TESTING_ENABLED
@@ -14,6 +14,7 @@
 
 #include <GoddamnEngine/Include.h>
 #include <GoddamnEngine/Engine/Entity/Component.h>
+#include <GoddamnEngine/Core/Containers/InlineVector.h>
 
 GD_NAMESPACE_BEGIN
 
@@ -24,8 +25,11 @@ GD_NAMESPACE_BEGIN
 	{
 	private:
 		GD_DECLARE_OBJECT_INTRINSIC(Entity, Behaviour);
+
+		// Most entities have only a few components, so they are stored without heap allocation.
+		using ComponentsVector = InlineVector<RefPtr<Component>, 8>;
 		
-		GD_PROPERTY(private, Vector<RefPtr<Component>>, m_Components);
+		GD_PROPERTY(private, ComponentsVector, m_Components);
 		//RefPtr<Transform> m_Transform;
 
 	public:
@@ -13,6 +13,7 @@
 #pragma once
 
 #include <GoddamnEngine/Engine/Entity/Component.h>
+#include <GoddamnEngine/Core/Containers/InlineVector.h>
 #include <GoddamnEngine/Core/Math/Vector.h>
 #include <GoddamnEngine/Core/Math/Matrix.h>
 #include <GoddamnEngine/Core/Math/Quaternion.h>
@@ -35,8 +36,11 @@ GD_NAMESPACE_BEGIN
 	private:
 		GD_DECLARE_OBJECT_INTRINSIC(Transform, Component);
 
+		// Most transforms have only a few children, so they are stored without heap allocation.
+		using ChildVector = InlineVector<RefPtr<Transform>, 4>;
+
 		GD_PROPERTY(private, RefPtr<Transform>, m_Parent);
-		GD_PROPERTY(private, Vector<RefPtr<Transform>>, m_Child);
+		GD_PROPERTY(private, ChildVector, m_Child);
 
 		GD_PROPERTY(private, Vector4,     m_LocalPosition);
 		GD_PROPERTY(private, Quaternion,  m_LocalRotation);